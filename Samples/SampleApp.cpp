@@ -1,8 +1,12 @@
 #include "SampleApp.h"
 #include "Core/Input.h"
 #include "Core/Log.h"
+#include "Core/JobSystem.h"
 #include "Graphics/RenderDocCapture.h"
 #include "Scene/SceneManager.h"
+#include "Scene/Meshlet.h"
+#include "Scene/MeshSimplifier.h"
+#include "Scene/VertexQuantization.h"
 #include "Scene/TonemapRenderer.h"
 #include "Shader/ShaderCompiler.h"
 #include <imgui_internal.h>
@@ -396,6 +400,7 @@ namespace Sea
         fftParams.normalStrength = 1.0f;
         fftParams.waterColor = { 0.02f, 0.06f, 0.1f, 1.0f };
         fftParams.foamColor = { 0.8f, 0.85f, 0.9f, 1.0f };
+        ApplyOceanSeed(fftParams, DEFAULT_OCEAN_SEED);
         if (!m_OceanFFT->Initialize(fftParams))
         {
             SEA_CORE_WARN("Failed to initialize OceanFFT - FFT Ocean will not be available");
@@ -441,6 +446,42 @@ namespace Sea
                 SEA_CORE_INFO("OceanFFT scene detected - enabling FFT ocean");
             }
             
+            // 按场景文件的种子与参数重建频谱，时钟回到第 0 步：同一场景每次加载得到相同的海面
+            const auto& sceneDef = m_SceneManager->GetCurrentSceneDef();
+            if (m_OceanFFT && !sceneDef.environmentType.empty())
+            {
+                auto& fftParams = m_OceanFFT->GetParams();
+                if (sceneDef.hasFFTOceanParams)
+                {
+                    // mapSize 可以在运行时修改；贴图数组按初始化时的 numCascades 创建，这一项保持不变
+                    const auto& sceneParams = sceneDef.fftOceanParams;
+                    if (sceneParams.numCascades != fftParams.numCascades)
+                    {
+                        SEA_CORE_WARN("Scene requests an FFT ocean with {} cascades, keeping {} cascades",
+                            sceneParams.numCascades, fftParams.numCascades);
+                    }
+                    if (sceneParams.mapSize != fftParams.mapSize)
+                    {
+                        m_GraphicsQueue->WaitForIdle();
+                        if (!m_OceanFFT->SetMapSize(sceneParams.mapSize))
+                        {
+                            SEA_CORE_WARN("Scene requests an unsupported {}x{} FFT ocean, keeping {}x{}",
+                                sceneParams.mapSize, sceneParams.mapSize, fftParams.mapSize, fftParams.mapSize);
+                        }
+                    }
+                    const u32 mapSize = fftParams.mapSize;
+                    const u32 numCascades = fftParams.numCascades;
+                    const u32 queryMapSize = fftParams.queryMapSize;
+                    fftParams = sceneParams;
+                    fftParams.mapSize = mapSize;
+                    fftParams.numCascades = numCascades;
+                    fftParams.queryMapSize = queryMapSize;
+                }
+                ApplyOceanSeed(fftParams, sceneDef.oceanSeed);
+                m_OceanFFT->ResetClock();
+                SEA_CORE_INFO("FFT ocean seeded from scene (seed {})", sceneDef.oceanSeed);
+            }
+            
             if (m_OceanSceneActive)
             {
                 // 为海洋场景设置相机
@@ -508,27 +549,56 @@ namespace Sea
 
     bool SampleApp::LoadExternalModel(const std::string& filepath)
     {
+        if (!m_SceneManager)
+            return false;
+
         SEA_CORE_INFO("Loading external model: {}", filepath);
         
-        auto mesh = MakeScope<Mesh>();
-        if (!mesh->LoadFromOBJ(*m_Device, filepath))
-        {
-            SEA_CORE_ERROR("Failed to load model: {}", filepath);
-            return false;
-        }
+        MeshUploadOptions options;
+        options.vertexFormat = m_QuantizeModelVertices ? VertexFormat::Quantized : VertexFormat::Standard;
+        options.splitForIndex16 = m_SplitModelForIndex16;
+        options.buildMeshlets = m_BuildModelMeshlets;
+        options.lodCount = static_cast<u32>(m_ModelLODCount);
+
+        // 后台加载，完成前先用占位网格放进场景；用户主动加载的模型优先于场景流式加载
+        MeshLoadId loadId = m_SceneManager->GetMeshLoader().Load(filepath, options, [this](MeshLoadId id, Scope<Mesh> mesh) {
+            Mesh* loaded = mesh ? mesh.get() : nullptr;
+            if (mesh)
+                m_Meshes.push_back(std::move(mesh));
+
+            // 失败时移除占位对象
+            for (size_t i = m_SceneObjects.size(); i-- > 0;)
+            {
+                if (m_SceneObjects[i].pendingMeshLoad != id)
+                    continue;
+
+                if (loaded)
+                {
+                    m_SceneObjects[i].mesh = loaded;
+                    m_SceneObjects[i].pendingMeshLoad = INVALID_MESH_LOAD;
+                    m_SceneObjects[i].MarkDirty();
+                }
+                else
+                {
+                    m_SceneObjects.erase(m_SceneObjects.begin() + i);
+                    if (m_SelectedObjectIndex >= static_cast<int>(m_SceneObjects.size()))
+                        m_SelectedObjectIndex = -1;
+                }
+            }
+            if (loaded)
+                SEA_CORE_INFO("Model loaded and added to scene");
+        }, MeshLoadPriority::High);
         
         // 添加到场景
         SceneObject obj;
-        obj.mesh = mesh.get();
+        obj.mesh = m_SceneManager->GetPlaceholderMesh();
+        obj.pendingMeshLoad = loadId;
         XMStoreFloat4x4(&obj.transform, XMMatrixTranslation(0.0f, 0.5f, 0.0f));
         obj.color = { 0.9f, 0.85f, 0.7f, 1.0f };
         obj.metallic = 0.3f;
         obj.roughness = 0.4f;
         
-        m_Meshes.push_back(std::move(mesh));
         m_SceneObjects.push_back(obj);
-        
-        SEA_CORE_INFO("Model loaded and added to scene");
         return true;
     }
 
@@ -545,6 +615,7 @@ namespace Sea
         PassTemplateLibrary::Shutdown();
         
         m_SceneObjects.clear();
+        m_SceneManager.reset();
         m_Meshes.clear();
         m_GridMesh.reset();
         m_SkyRenderer.reset();
@@ -565,6 +636,46 @@ namespace Sea
         RenderDocCapture::Shutdown();
     }
 
+    void SampleApp::UpdateShadowViews()
+    {
+        if (!m_Camera || !m_Renderer)
+            return;
+
+        m_Camera->Update();
+        m_CascadedShadows.Update(*m_Camera, m_Renderer->GetLightDirection());
+
+        m_CullViews.clear();
+        m_CullViews.emplace_back(m_Camera->GetViewProjectionMatrix());
+        for (u32 i = 0; i < m_CascadedShadows.GetCascadeCount(); ++i)
+        {
+            m_CullViews.push_back(m_CascadedShadows.GetCascade(i).frustum);
+        }
+
+        // 场景包围盒与 m_SceneObjects 一一对应，无网格的节点退化为一个点
+        m_CullBounds.resize(m_SceneObjects.size());
+        for (size_t i = 0; i < m_SceneObjects.size(); ++i)
+        {
+            const SceneObject& obj = m_SceneObjects[i];
+            const XMFLOAT3 zero = { 0.0f, 0.0f, 0.0f };
+            m_CullBounds[i] = obj.mesh
+                ? TransformBounds(obj.mesh->GetBoundsMin(), obj.mesh->GetBoundsMax(), obj.transform)
+                : TransformBounds(zero, zero, obj.transform);
+        }
+
+        // 所有视图一次遍历
+        m_ViewMasks.resize(m_CullBounds.size());
+        CullMultiView(m_CullViews, m_CullBounds, m_ViewMasks);
+
+        m_ViewVisibleCounts.fill(0);
+        for (u32 mask : m_ViewMasks)
+        {
+            for (u32 v = 0; v < m_CullViews.size(); ++v)
+            {
+                m_ViewVisibleCounts[v] += (mask >> v) & 1u;
+            }
+        }
+    }
+
     void SampleApp::UpdateCamera(f32 deltaTime)
     {
         // 右键控制相机
@@ -1169,6 +1280,11 @@ namespace Sea
                             if (ImGui::MenuItem("Duplicate"))
                             {
                                 SceneObject copy = m_SceneObjects[i];
+                                // 副本是新对象，需要自己的常量槽位
+                                copy.id = AllocateSceneObjectId();
+                                // 副本不挂在变换层级上，否则节点更新时会被写回原对象的位置
+                                copy.transformNode = TransformHierarchy::INVALID_NODE;
+                                copy.hasWorldInvTranspose = false;
                                 // 稍微偏移位置
                                 XMMATRIX transform = XMLoadFloat4x4(&copy.transform);
                                 transform = transform * XMMatrixTranslation(1.0f, 0.0f, 0.0f);
@@ -1215,7 +1331,29 @@ namespace Sea
                 ImGui::Separator();
                 
                 // Transform 编辑
-                if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
+                TransformHierarchy* transforms = m_SceneManager ? &m_SceneManager->GetTransformHierarchy() : nullptr;
+                if (transforms && transforms->IsValid(obj.transformNode) &&
+                    ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
+                {
+                    // 层级节点：编辑局部变换，子对象会随之更新
+                    u32 node = obj.transformNode;
+                    XMFLOAT3 localPosition = transforms->GetLocalPosition(node);
+                    XMFLOAT3 localScale = transforms->GetLocalScale(node);
+                    
+                    if (ImGui::DragFloat3("Local Position", &localPosition.x, 0.1f))
+                    {
+                        transforms->SetLocalPosition(node, localPosition);
+                    }
+                    if (ImGui::DragFloat3("Local Scale", &localScale.x, 0.01f, 0.01f, 10.0f))
+                    {
+                        transforms->SetLocalScale(node, localScale);
+                    }
+                    
+                    u32 parent = transforms->GetParent(node);
+                    if (parent != TransformHierarchy::INVALID_NODE)
+                        ImGui::Text("Parent Node: %u", parent);
+                }
+                else if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
                 {
                     XMMATRIX transform = XMLoadFloat4x4(&obj.transform);
                     
@@ -1230,6 +1368,7 @@ namespace Sea
                         obj.transform._41 = position.x;
                         obj.transform._42 = position.y;
                         obj.transform._43 = position.z;
+                        obj.MarkDirty();
                     }
                     
                     // 简单缩放 (假设统一缩放)
@@ -1240,21 +1379,24 @@ namespace Sea
                         XMMATRIX scaleMatrix = XMMatrixScaling(scale, scale, scale);
                         XMMATRIX translationMatrix = XMMatrixTranslation(position.x, position.y, position.z);
                         XMStoreFloat4x4(&obj.transform, scaleMatrix * translationMatrix);
+                        obj.MarkDirty();
                     }
                 }
                 
                 // Material 编辑
                 if (ImGui::CollapsingHeader("Material", ImGuiTreeNodeFlags_DefaultOpen))
                 {
-                    ImGui::ColorEdit4("Base Color", &obj.color.x);
-                    ImGui::SliderFloat("Metallic", &obj.metallic, 0.0f, 1.0f);
-                    ImGui::SliderFloat("Roughness", &obj.roughness, 0.0f, 1.0f);
-                    ImGui::SliderFloat("AO", &obj.ao, 0.0f, 1.0f);
+                    // 任何修改都递增 revision，渲染器只为变化的物体重新打包常量
+                    bool materialChanged = false;
+                    materialChanged |= ImGui::ColorEdit4("Base Color", &obj.color.x);
+                    materialChanged |= ImGui::SliderFloat("Metallic", &obj.metallic, 0.0f, 1.0f);
+                    materialChanged |= ImGui::SliderFloat("Roughness", &obj.roughness, 0.0f, 1.0f);
+                    materialChanged |= ImGui::SliderFloat("AO", &obj.ao, 0.0f, 1.0f);
                     
                     ImGui::Separator();
                     ImGui::Text("Emissive");
-                    ImGui::ColorEdit3("Emissive Color", &obj.emissiveColor.x);
-                    ImGui::SliderFloat("Emissive Intensity", &obj.emissiveIntensity, 0.0f, 10.0f);
+                    materialChanged |= ImGui::ColorEdit3("Emissive Color", &obj.emissiveColor.x);
+                    materialChanged |= ImGui::SliderFloat("Emissive Intensity", &obj.emissiveIntensity, 0.0f, 10.0f);
                     
                     ImGui::Separator();
                     
@@ -1265,12 +1407,14 @@ namespace Sea
                         obj.metallic = 1.0f;
                         obj.roughness = 0.3f;
                         obj.color = { 0.9f, 0.9f, 0.9f, 1.0f };
+                        materialChanged = true;
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Plastic"))
                     {
                         obj.metallic = 0.0f;
                         obj.roughness = 0.4f;
+                        materialChanged = true;
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Gold"))
@@ -1278,6 +1422,7 @@ namespace Sea
                         obj.metallic = 1.0f;
                         obj.roughness = 0.2f;
                         obj.color = { 1.0f, 0.766f, 0.336f, 1.0f };
+                        materialChanged = true;
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Rubber"))
@@ -1285,6 +1430,7 @@ namespace Sea
                         obj.metallic = 0.0f;
                         obj.roughness = 0.9f;
                         obj.color = { 0.1f, 0.1f, 0.1f, 1.0f };
+                        materialChanged = true;
                     }
                     
                     if (ImGui::Button("Copper"))
@@ -1292,6 +1438,7 @@ namespace Sea
                         obj.metallic = 1.0f;
                         obj.roughness = 0.25f;
                         obj.color = { 0.955f, 0.637f, 0.538f, 1.0f };
+                        materialChanged = true;
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Chrome"))
@@ -1299,6 +1446,7 @@ namespace Sea
                         obj.metallic = 1.0f;
                         obj.roughness = 0.1f;
                         obj.color = { 0.55f, 0.55f, 0.55f, 1.0f };
+                        materialChanged = true;
                     }
                     ImGui::SameLine();
                     if (ImGui::Button("Wood"))
@@ -1306,7 +1454,11 @@ namespace Sea
                         obj.metallic = 0.0f;
                         obj.roughness = 0.6f;
                         obj.color = { 0.6f, 0.4f, 0.2f, 1.0f };
+                        materialChanged = true;
                     }
+
+                    if (materialChanged)
+                        obj.MarkDirty();
                 }
             }
             else
@@ -1539,6 +1691,37 @@ namespace Sea
             
             // 外部模型列表
             ImGui::TextColored(ImVec4(0.6f, 0.8f, 1.0f, 1.0f), "OBJ Models (Drag to Viewport):");
+            ImGui::Checkbox("Quantize Vertices (20 B)", &m_QuantizeModelVertices);
+            ImGui::Checkbox("Split for 16-bit Indices", &m_SplitModelForIndex16);
+            ImGui::SameLine();
+            ImGui::Checkbox("Build Meshlets", &m_BuildModelMeshlets);
+            ImGui::SliderInt("LOD Levels", &m_ModelLODCount, 1, static_cast<int>(MESH_MAX_LODS));
+
+            // 后台加载状态
+            if (m_SceneManager)
+            {
+                AsyncMeshLoader& loader = m_SceneManager->GetMeshLoader();
+                MeshLoaderStats loadStats = loader.GetStats();
+                ImGui::Text("Streaming: %u queued, %u loading, %u ready  %.1f / %.0f MB (peak %.1f)",
+                            loadStats.queued, loadStats.loading, loadStats.ready,
+                            loadStats.inFlightBytes / (1024.0 * 1024.0), loader.GetMemoryBudget() / (1024.0 * 1024.0),
+                            loadStats.peakInFlightBytes / (1024.0 * 1024.0));
+                if (!loader.IsIdle())
+                {
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton("Cancel Loads"))
+                        loader.CancelAll();
+                }
+
+                MeshCacheStats cacheStats = m_SceneManager->GetMeshCache().GetStats();
+                ImGui::Text("Mesh Cache: %u meshes (%u in use)  %.1f / %.0f MB",
+                            cacheStats.entryCount, cacheStats.referencedCount, cacheStats.residentBytes / (1024.0 * 1024.0),
+                            m_SceneManager->GetMeshCache().GetMemoryBudget() / (1024.0 * 1024.0));
+                ImGui::Text("  hits %llu  misses %llu  shared %llu  evicted %llu (%.1f MB)",
+                            static_cast<unsigned long long>(cacheStats.hits), static_cast<unsigned long long>(cacheStats.misses),
+                            static_cast<unsigned long long>(cacheStats.duplicates), static_cast<unsigned long long>(cacheStats.evictions),
+                            cacheStats.evictedBytes / (1024.0 * 1024.0));
+            }
             
             if (m_AvailableModels.empty())
             {
@@ -2039,6 +2222,12 @@ namespace Sea
                                 ImGui::TreePop();
                             }
                         }
+                        
+                        OceanSpectrumCacheStats spectrumStats = m_OceanFFT->GetSpectrumCacheStats();
+                        ImGui::Text("Spectrum Cache: %u / %u slots  hits %llu  misses %llu  evicted %llu",
+                                    spectrumStats.cachedCount, spectrumStats.slotCount,
+                                    static_cast<unsigned long long>(spectrumStats.hits), static_cast<unsigned long long>(spectrumStats.misses),
+                                    static_cast<unsigned long long>(spectrumStats.evictions));
                         ImGui::TreePop();
                     }
                     
@@ -2048,6 +2237,33 @@ namespace Sea
                     {
                         m_OceanFFT->SetViewMode(viewMode);
                     }
+                    
+                    // FFT 分辨率：只重建与尺寸有关的资源，旋转因子表按 N 共享
+                    static const u32 mapSizes[] = { 128, 256, 512, 1024 };
+                    int mapSizeIndex = 0;
+                    for (int i = 0; i < IM_ARRAYSIZE(mapSizes); ++i)
+                    {
+                        if (mapSizes[i] == fftParams.mapSize)
+                            mapSizeIndex = i;
+                    }
+                    if (ImGui::Combo("Map Size##FFT", &mapSizeIndex, "128\0" "256\0" "512\0" "1024\0"))
+                    {
+                        // 旧的贴图与缓冲可能仍在 GPU 上使用
+                        m_GraphicsQueue->WaitForIdle();
+                        m_OceanFFT->SetMapSize(mapSizes[mapSizeIndex]);
+                    }
+                    ImGui::Text("FFT tables cached: %u sizes", GetOceanFFTTableCacheSize());
+                    
+                    // FFT dispatch plan
+                    int planMode = static_cast<int>(m_OceanFFT->GetFFTPlanMode());
+                    if (ImGui::Combo("FFT Plan##FFT", &planMode, "Staged\0Shared Memory\0"))
+                    {
+                        m_OceanFFT->SetFFTPlanMode(static_cast<OceanFFTPlanMode>(planMode));
+                    }
+                    const OceanFFTPlan& fftPlan = m_OceanFFT->GetFFTPlan();
+                    ImGui::Text("FFT: %zu dispatches, %u barriers (per-spectrum: %u)",
+                                fftPlan.dispatches.size(), fftPlan.barrierCount,
+                                GetLegacyOceanFFTDispatchCount(fftParams.mapSize, fftParams.numCascades));
                 }
                 else if (m_Ocean)
                 {
@@ -2067,7 +2283,8 @@ namespace Sea
                 if (useQuadTree && m_Ocean->GetQuadTree())
                 {
                     ImGui::TextColored(ImVec4(0.5f, 1.0f, 0.5f, 1.0f), 
-                        "(%u nodes)", m_Ocean->GetQuadTree()->GetLeafCount());
+                        "(%u nodes, %u tris)", m_Ocean->GetQuadTree()->GetLeafCount(),
+                        m_Ocean->GetQuadTree()->GetTriangleCount());
                 }
                 else
                 {
@@ -2218,8 +2435,16 @@ namespace Sea
             }
         }
 
+        // 上传后台加载完成的网格并替换占位网格，再同步变换层级（只重算被修改的子树）
+        if (m_SceneManager)
+        {
+            m_SceneManager->UpdateStreaming(m_SceneObjects);
+            m_SceneManager->UpdateTransforms(m_SceneObjects);
+        }
+
         // 更新相机
         UpdateCamera(deltaTime);
+        UpdateShadowViews();
 
         // 更新天空渲染器
         if (m_SkyRenderer)
@@ -2291,6 +2516,142 @@ namespace Sea
         ImGui::Separator();
         ImGui::Text("Scene Objects: %zu", m_SceneObjects.size());
         ImGui::Text("Meshes: %zu", m_Meshes.size());
+        {
+            // 索引缓冲：16 位网格数与总占用
+            u32 index16Meshes = 0;
+            u64 indexBytes = 0;
+            for (const auto& mesh : m_Meshes)
+            {
+                index16Meshes += mesh->GetIndexStride() == sizeof(u16) ? 1 : 0;
+                indexBytes += static_cast<u64>(mesh->GetIndexCount()) * mesh->GetIndexStride();
+            }
+            ImGui::Text("Index Buffers: %u/%zu 16-bit, %.2f MB", index16Meshes, m_Meshes.size(), indexBytes / (1024.0 * 1024.0));
+        }
+        if (m_SceneManager)
+        {
+            const auto& transformStats = m_SceneManager->GetTransformHierarchy().GetStats();
+            ImGui::Text("Transforms: %u nodes, %u updated (%.3f ms)",
+                        transformStats.nodeCount, transformStats.updatedNodes, transformStats.updateTimeMs);
+        }
+        {
+            // 物体常量：本帧重建的物体、实际上传字节与准备耗时
+            const ObjectConstantTableStats* cbStats = nullptr;
+            const MeshletCullStats* meshletStats = nullptr;
+            u32 culledObjects = 0;
+            if (m_CurrentPipeline == RenderPipeline::Deferred && m_DeferredRenderer)
+            {
+                cbStats = &m_DeferredRenderer->GetObjectConstantStats();
+                meshletStats = &m_DeferredRenderer->GetMeshletCullStats();
+                culledObjects = m_DeferredRenderer->GetCulledObjectCount();
+            }
+            else if (m_Renderer)
+            {
+                cbStats = &m_Renderer->GetObjectConstantStats();
+                meshletStats = &m_Renderer->GetMeshletCullStats();
+                culledObjects = m_Renderer->GetCulledObjectCount();
+            }
+            if (cbStats)
+            {
+                ImGui::Text("Object CB: %u/%u rebuilt, %llu bytes, prepare %.3f ms",
+                            cbStats->rebuiltObjects, cbStats->objectCount,
+                            static_cast<unsigned long long>(cbStats->uploadedBytes), cbStats->prepareTimeMs);
+                ImGui::Text("Frustum Culled: %u objects", culledObjects);
+            }
+            if (m_Renderer)
+            {
+                // 打开后每帧重建全部物体常量，与增量路径对比上面的实测数据
+                bool rebuildAll = m_Renderer->GetRebuildAllObjectConstants();
+                if (ImGui::Checkbox("Rebuild All Object Constants", &rebuildAll))
+                {
+                    m_Renderer->SetRebuildAllObjectConstants(rebuildAll);
+                    if (m_DeferredRenderer)
+                        m_DeferredRenderer->SetRebuildAllObjectConstants(rebuildAll);
+                }
+
+                // 两个渲染器共用一个开关
+                bool meshletCulling = m_Renderer->GetMeshletCulling();
+                if (ImGui::Checkbox("Meshlet Culling", &meshletCulling))
+                {
+                    m_Renderer->SetMeshletCulling(meshletCulling);
+                    if (m_DeferredRenderer)
+                        m_DeferredRenderer->SetMeshletCulling(meshletCulling);
+                }
+            }
+            if (meshletStats && meshletStats->meshletCount > 0)
+            {
+                const f64 rejected = meshletStats->triangleCount > 0
+                    ? 100.0 * (1.0 - static_cast<f64>(meshletStats->visibleTriangles) / meshletStats->triangleCount) : 0.0;
+                ImGui::Text("Meshlets: %u/%u visible (%u frustum, %u back-facing), %.1f%% triangles rejected",
+                            meshletStats->visibleMeshlets, meshletStats->meshletCount,
+                            meshletStats->frustumCulled, meshletStats->backfaceCulled, rejected);
+            }
+            if (m_Renderer)
+            {
+                bool meshLOD = m_Renderer->GetMeshLOD();
+                f32 pixelError = m_Renderer->GetLODPixelError();
+                bool changed = ImGui::Checkbox("Mesh LOD", &meshLOD);
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(120.0f);
+                changed |= ImGui::SliderFloat("Max Error (px)", &pixelError, 0.25f, 8.0f, "%.2f");
+                if (changed)
+                {
+                    m_Renderer->SetMeshLOD(meshLOD);
+                    m_Renderer->SetLODPixelError(pixelError);
+                    if (m_DeferredRenderer)
+                    {
+                        m_DeferredRenderer->SetMeshLOD(meshLOD);
+                        m_DeferredRenderer->SetLODPixelError(pixelError);
+                    }
+                }
+
+                const auto& lodCounts = (m_CurrentPipeline == RenderPipeline::Deferred && m_DeferredRenderer)
+                    ? m_DeferredRenderer->GetLODObjectCounts() : m_Renderer->GetLODObjectCounts();
+                ImGui::Text("LOD Objects:");
+                for (u32 lod = 0; lod < MESH_MAX_LODS; ++lod)
+                {
+                    if (lodCounts[lod] == 0)
+                        continue;
+                    ImGui::SameLine();
+                    ImGui::Text("L%u: %u", lod, lodCounts[lod]);
+                }
+            }
+        }
+        if (!m_CullViews.empty())
+        {
+            // 各视图可见物体数：主相机 / 各级联阴影
+            ImGui::Text("Visible (camera): %u", m_ViewVisibleCounts[0]);
+            for (u32 v = 1; v < m_CullViews.size(); ++v)
+            {
+                const ShadowCascade& cascade = m_CascadedShadows.GetCascade(v - 1);
+                ImGui::Text("Visible (cascade %u, %.1f-%.1f): %u", v - 1, cascade.splitNear, cascade.splitFar, m_ViewVisibleCounts[v]);
+            }
+        }
+        ImGui::Separator();
+        ImGui::Text("Job Threads: %u", JobSystem::GetThreadCount());
+        if (!m_CommandLists.empty())
+        {
+            // 冗余状态过滤统计（上一次录制）
+            auto& stateCache = m_CommandLists[m_FrameIndex]->GetStateCache();
+            const auto& stateStats = m_CommandLists[m_FrameIndex]->GetStateCacheStats();
+            ImGui::Separator();
+            ImGui::Text("State Sets: %u issued, %u filtered", stateStats.GetTotalIssued(), stateStats.GetTotalFiltered());
+            bool filterEnabled = stateCache.IsEnabled();
+            if (ImGui::Checkbox("Filter Redundant State", &filterEnabled))
+            {
+                for (auto& list : m_CommandLists)
+                    list->GetStateCache().SetEnabled(filterEnabled);
+            }
+            if (ImGui::TreeNode("State Filter Details"))
+            {
+                for (u32 i = 0; i < static_cast<u32>(RHIStateCategory::Count); ++i)
+                {
+                    auto category = static_cast<RHIStateCategory>(i);
+                    ImGui::Text("%s: %u / %u", GetStateCategoryName(category),
+                                stateStats.GetFiltered(category), stateStats.GetIssued(category));
+                }
+                ImGui::TreePop();
+            }
+        }
         if (ImGui::Button("Compile Graph"))
             m_RenderGraph->Compile();
         ImGui::End();
@@ -2361,13 +2722,13 @@ namespace Sea
                 sceneClearColor[2] = 0.15f;
                 sceneClearColor[3] = 1.0f;
             }
-            cmdList->GetCommandList()->ClearRenderTargetView(sceneRtv, sceneClearColor, 0, nullptr);
+            cmdList->ClearRenderTarget(sceneRtv, sceneClearColor);
             
             D3D12_CPU_DESCRIPTOR_HANDLE dsv = m_DSVHeap->GetCPUHandle(0);
-            cmdList->GetCommandList()->ClearDepthStencilView(dsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+            cmdList->ClearDepth(dsv);
 
             // 设置场景渲染目标
-            cmdList->GetCommandList()->OMSetRenderTargets(1, &sceneRtv, FALSE, &dsv);
+            cmdList->SetRenderTarget(sceneRtv, &dsv);
 
             // 设置场景视口
             Viewport sceneViewport = { 0, 0, static_cast<f32>(m_ViewportWidth), 
@@ -2384,11 +2745,8 @@ namespace Sea
                 // 1. G-Buffer Pass
                 m_DeferredRenderer->BeginGBufferPass(*cmdList, *m_Camera, m_TotalTime);
                 
-                // 渲染所有场景对象到 G-Buffer
-                for (const auto& obj : m_SceneObjects)
-                {
-                    m_DeferredRenderer->RenderObjectToGBuffer(*cmdList, obj);
-                }
+                // 渲染所有场景对象到 G-Buffer（剔除与常量打包在任务系统上并行）
+                m_DeferredRenderer->RenderObjectsToGBuffer(*cmdList, m_SceneObjects);
                 
                 m_DeferredRenderer->EndGBufferPass(*cmdList);
                 
@@ -2399,14 +2757,14 @@ namespace Sea
                 // 3. 渲染天空（在 deferred 之后叠加，使用深度测试）
                 if (m_SkyRenderer && m_SkyRenderer->GetSettings().EnableSky)
                 {
-                    cmdList->GetCommandList()->OMSetRenderTargets(1, &sceneRtv, FALSE, &dsv);
+                    cmdList->SetRenderTarget(sceneRtv, &dsv);
                     m_SkyRenderer->Render(*cmdList, *m_Camera);
                 }
                 
                 // 4. 渲染网格（前向渲染叠加）
                 if (m_GridMesh)
                 {
-                    cmdList->GetCommandList()->OMSetRenderTargets(1, &sceneRtv, FALSE, &dsv);
+                    cmdList->SetRenderTarget(sceneRtv, &dsv);
                     m_Renderer->BeginFrame(*m_Camera, m_TotalTime);
                     m_Renderer->RenderGrid(*cmdList, *m_GridMesh);
                 }
@@ -2415,6 +2773,7 @@ namespace Sea
             {
                 // ========== Forward 渲染路径 ==========
                 // 开始3D渲染
+                m_Renderer->SetViewportHeight(m_ViewportHeight);
                 m_Renderer->BeginFrame(*m_Camera, m_TotalTime);
 
                 // 首先渲染天空（如果启用）
@@ -2447,11 +2806,8 @@ namespace Sea
                         m_Renderer->RenderGrid(*cmdList, *m_GridMesh);
                     }
 
-                    // 渲染场景对象
-                    for (const auto& obj : m_SceneObjects)
-                    {
-                        m_Renderer->RenderObject(*cmdList, obj);
-                    }
+                    // 渲染场景对象（剔除与常量打包在任务系统上并行）
+                    m_Renderer->RenderObjects(*cmdList, m_SceneObjects);
                 }
             }
 
@@ -2520,7 +2876,7 @@ namespace Sea
                 
                 // 2.2 Tonemapping Pass: HDR -> LDR
                 ID3D12DescriptorHeap* heaps[] = { m_PostProcessSRVHeap->GetHeap() };
-                cmdList->GetCommandList()->SetDescriptorHeaps(1, heaps);
+                cmdList->SetDescriptorHeaps(heaps);
                 
                 // 执行 Tonemapping
                 m_TonemapRenderer->Render(
@@ -2568,7 +2924,7 @@ namespace Sea
                 if (m_TonemapRenderer)
                 {
                     ID3D12DescriptorHeap* heaps[] = { m_PostProcessSRVHeap->GetHeap() };
-                    cmdList->GetCommandList()->SetDescriptorHeaps(1, heaps);
+                    cmdList->SetDescriptorHeaps(heaps);
                     
                     auto& settings = m_TonemapRenderer->GetSettings();
                     bool originalEnabled = settings.Enabled;
@@ -2603,7 +2959,7 @@ namespace Sea
 
         // 设置 SwapChain 渲染目标
         auto rtv = m_SwapChain->GetCurrentRTV();
-        cmdList->GetCommandList()->OMSetRenderTargets(1, &rtv, FALSE, nullptr);
+        cmdList->SetRenderTarget(rtv);
 
         // 设置窗口视口
         Viewport viewport = { 0, 0, static_cast<f32>(m_Window->GetWidth()), 
@@ -2614,6 +2970,7 @@ namespace Sea
         cmdList->SetScissorRect(scissor);
 
         // 渲染 ImGui (ImGui会自动设置自己的描述符堆)
+        // ImGui 的 DX12 后端只接受原生命令列表，是唯一绕过状态过滤的 pass
         m_ImGuiRenderer->Render(cmdList->GetCommandList());
 
         // 转换后缓冲到呈现状态
@@ -14,6 +14,7 @@
 #include "Scene/BloomRenderer.h"
 #include "Scene/TonemapRenderer.h"
 #include "Scene/DeferredRenderer.h"
+#include "Scene/CascadedShadows.h"
 
 namespace Sea
 {
@@ -40,6 +41,7 @@ namespace Sea
         void CreateResources();
         void CreateScene();
         void UpdateCamera(f32 deltaTime);
+        void UpdateShadowViews();
         bool CreateDepthBuffer();
 
     private:
@@ -70,6 +72,13 @@ namespace Sea
         Scope<Mesh> m_GridMesh;
         std::vector<Scope<Mesh>> m_Meshes;
         std::vector<SceneObject> m_SceneObjects;
+
+        // 级联阴影视图与多视图剔除（bit0 = 主相机，bit1.. = 各级联）
+        CascadedShadows m_CascadedShadows;
+        std::vector<Frustum> m_CullViews;
+        std::vector<CullBounds> m_CullBounds;
+        std::vector<u32> m_ViewMasks;
+        std::array<u32, MAX_CULL_VIEWS> m_ViewVisibleCounts = {};
         
         // 场景选择
         int m_SelectedSceneIndex = 0;
@@ -78,6 +87,10 @@ namespace Sea
         // 外部模型
         std::vector<std::string> m_AvailableModels;
         int m_SelectedModelIndex = -1;
+        bool m_QuantizeModelVertices = false;     // 以 VertexFormat::Quantized 上传外部模型
+        bool m_SplitModelForIndex16 = false;      // 大模型拆分子网格以使用 16 位索引
+        bool m_BuildModelMeshlets = false;        // 生成 meshlet 供簇剔除使用
+        int m_ModelLODCount = 1;                  // LOD 级数（1 = 不生成 LOD 链）
         bool LoadExternalModel(const std::string& filepath);
         void ScanAvailableModels();
         
@@ -1,6 +1,8 @@
 // Simple 3D rendering shaders
 // Basic.hlsl
 
+#include "VertexQuantization.hlsli"
+
 cbuffer PerFrameData : register(b0)
 {
     row_major float4x4 ViewProjection;
@@ -33,8 +35,8 @@ cbuffer PerObjectData : register(b1)
 
 struct VSInput
 {
-    float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    VERTEX_POSITION_TYPE Position : POSITION;
+    VERTEX_NORMAL_TYPE Normal : NORMAL;
     float2 TexCoord : TEXCOORD0;
     float4 Color : COLOR0;
 };
@@ -52,10 +54,10 @@ PSInput VSMain(VSInput input)
 {
     PSInput output;
     
-    float4 worldPos = mul(float4(input.Position, 1.0), World);
+    float4 worldPos = mul(float4(DecodeVertexPosition(input.Position), 1.0), World);
     output.WorldPos = worldPos.xyz;
     output.Position = mul(worldPos, ViewProjection);
-    output.Normal = normalize(mul(float4(input.Normal, 0.0), WorldInvTranspose).xyz);
+    output.Normal = normalize(mul(float4(DecodeVertexNormal(input.Normal), 0.0), WorldInvTranspose).xyz);
     output.TexCoord = input.TexCoord;
     output.Color = input.Color * BaseColor;
     
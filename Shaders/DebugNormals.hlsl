@@ -1,5 +1,7 @@
 // Debug Normals Shader - 显示世界空间法线作为颜色
 
+#include "VertexQuantization.hlsli"
+
 cbuffer PerFrame : register(b0)
 {
     float4x4 ViewProjection;
@@ -32,8 +34,8 @@ cbuffer PerObject : register(b1)
 
 struct VSInput
 {
-    float3 position : POSITION;
-    float3 normal : NORMAL;
+    VERTEX_POSITION_TYPE position : POSITION;
+    VERTEX_NORMAL_TYPE normal : NORMAL;
     float2 texcoord : TEXCOORD;
     float4 color : COLOR;
 };
@@ -48,11 +50,11 @@ VSOutput VSMain(VSInput input)
 {
     VSOutput output;
     
-    float4 worldPos = mul(float4(input.position, 1.0), World);
+    float4 worldPos = mul(float4(DecodeVertexPosition(input.position), 1.0), World);
     output.position = mul(worldPos, ViewProjection);
     
     // 变换法线到世界空间
-    output.worldNormal = normalize(mul(input.normal, (float3x3)WorldInvTranspose));
+    output.worldNormal = normalize(mul(DecodeVertexNormal(input.normal), (float3x3)WorldInvTranspose));
     
     return output;
 }
@@ -1,6 +1,8 @@
 // GBuffer Pass Vertex Shader (Standalone)
 // For Deferred Rendering Pipeline
 
+#include "../VertexQuantization.hlsli"
+
 cbuffer FrameConstants : register(b0)
 {
     row_major float4x4 g_ViewProjection;
@@ -25,8 +27,8 @@ cbuffer ObjectConstants : register(b1)
 
 struct VSInput
 {
-    float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    VERTEX_POSITION_TYPE Position : POSITION;
+    VERTEX_NORMAL_TYPE Normal : NORMAL;
     float2 TexCoord : TEXCOORD;
 };
 
@@ -42,10 +44,10 @@ PSInput VSMain(VSInput input)
 {
     PSInput output;
     
-    float4 worldPos = mul(g_World, float4(input.Position, 1.0));
+    float4 worldPos = mul(g_World, float4(DecodeVertexPosition(input.Position), 1.0));
     output.Position = mul(g_ViewProjection, worldPos);
     output.WorldPos = worldPos.xyz;
-    output.Normal = normalize(mul((float3x3)g_WorldInvTranspose, input.Normal));
+    output.Normal = normalize(mul((float3x3)g_WorldInvTranspose, DecodeVertexNormal(input.Normal)));
     output.TexCoord = input.TexCoord;
     
     return output;
@@ -1,7 +1,12 @@
 // FFTCompute_CS.hlsl
-// Stockham FFT compute shader - performs one row of 1D FFT
-// Run horizontally, transpose, run again for 2D FFT
-// Based on GodotOceanWaves fft_compute.glsl
+// Radix-2 Stockham inverse FFT over every spectrum of every cascade at once
+// The host records the dispatches described by OceanFFTPlan (Source/Scene/OceanFFTPlan.h):
+//   StageMain      - one butterfly stage per dispatch, ping-pong between the two buffer halves
+//   SinglePassMain - one thread group per row/column, all stages in groupshared memory
+// Rows are transformed first, then columns (strided by MapSize, no transpose pass).
+// The last dispatch writes the result transposed (x * N + y), the layout FFTUnpack_CS expects.
+// The last dispatch scales by 1/N (g_OutputScale), the single inverse-FFT normalization OceanFFTCPU applies too.
+// Twiddles come from the table OceanFFTCPU uses (OceanFFTTables), uploaded once per map size.
 
 #include "OceanCommon.hlsli"
 
@@ -10,116 +15,131 @@
 // ============================================================================
 cbuffer FFTConstants : register(b0)
 {
-    uint g_Stage;              // Current FFT stage (0 to log2(N)-1)
-    uint g_Direction;          // 0 = forward (DFT), 1 = inverse (IDFT)
-    uint g_SpectrumIndex;      // Which spectrum we're processing
-    uint g_CascadeIndex;       // Which cascade
-    uint g_MapSize;            // FFT size
-    uint g_LogN;               // log2(MapSize)
-    uint g_PingPong;           // 0 or 1 for buffer selection
-    float _padding;
+    uint g_MapSize;            // FFT size N
+    uint g_LogN;               // log2(N)
+    uint g_Stage;              // Butterfly stage (StageMain only)
+    uint g_Axis;               // 0 = along rows, 1 = along columns
+    uint g_SourceOffset;       // Element offset of the half we read
+    uint g_DestOffset;         // Element offset of the half we write (may equal g_SourceOffset)
+    uint g_TransposeOutput;    // Write (x, y) to x * N + y
+    float g_OutputScale;       // 1/N on the last dispatch, 1 otherwise
 }
 
 // ============================================================================
 // Resources
 // ============================================================================
 
-// Butterfly lookup table
-StructuredBuffer<float4> g_ButterflyFactors : register(t0);
+// Two halves of [cascade][spectrum][row][col] float2, see OceanFFTPlan
+RWStructuredBuffer<float2> g_FFTBuffer : register(u0);
 
-// Ping-pong FFT buffers (read from one, write to other)
-RWStructuredBuffer<float2> g_FFTInput : register(u0);
-RWStructuredBuffer<float2> g_FFTOutput : register(u1);
-
-// ============================================================================
-// Shared Memory for Row FFT
-// ============================================================================
-groupshared Complex g_SharedData[512];  // Max 512 elements per row
+// exp(+2*PI*i*k/N), k in [0, N)
+StructuredBuffer<float2> g_Twiddles : register(t0);
 
 // ============================================================================
 // Helper Functions
 // ============================================================================
 
-uint GetBufferIndex(uint cascade, uint spectrum, uint row, uint col)
+static const uint STAGE_THREAD_GROUP_SIZE = 64;         // OceanFFTPlan::STAGE_THREAD_GROUP_SIZE
+static const uint SINGLE_PASS_THREAD_GROUP_SIZE = 128;  // OceanFFTPlan::SINGLE_PASS_THREAD_GROUP_SIZE
+static const uint MAX_SINGLE_PASS_SIZE = 1024;          // OceanFFTPlan::MAX_SINGLE_PASS_SIZE
+
+// Slice = cascade * 4 + spectrum
+uint GetLineIndex(uint slice, uint lineIndex, uint position, uint axis)
+{
+    uint base = slice * g_MapSize * g_MapSize;
+    return axis == 0 ? base + lineIndex * g_MapSize + position
+                     : base + position * g_MapSize + lineIndex;
+}
+
+uint GetWriteAxis()
+{
+    return g_TransposeOutput != 0 ? 0 : g_Axis;
+}
+
+// Butterfly j (< N/2) of a stage: inputs are x[j] and x[j + N/2], outputs land in natural order
+void Butterfly(uint stage, uint j, Complex a, Complex b, out uint outIndex0, out uint outIndex1, out Complex out0, out Complex out1)
 {
-    // Layout: [cascade][spectrum][row][col]
-    return cascade * 4 * g_MapSize * g_MapSize 
-         + spectrum * g_MapSize * g_MapSize 
-         + row * g_MapSize 
-         + col;
+    uint Ns = 1u << stage;
+    uint k = j & (Ns - 1);
+
+    // Inverse transform: exp(+i * PI * k / Ns) = w^(k * N / (2 * Ns))
+    Complex wb = ComplexMul(UnpackComplex(g_Twiddles[k * (g_MapSize >> (stage + 1))]), b);
+
+    outIndex0 = (j - k) * 2 + k;
+    outIndex1 = outIndex0 + Ns;
+    out0 = ComplexAdd(a, wb);
+    out1 = ComplexSub(a, wb);
 }
 
 // ============================================================================
-// Main: Process one row
+// StageMain: one stage, one butterfly per thread
+// Dispatch: (ceil(N/2 / 64), N lines, slices)
 // ============================================================================
-[numthreads(256, 1, 1)]
-void main(uint3 DTid : SV_DispatchThreadID, uint3 GTid : SV_GroupThreadID, uint3 Gid : SV_GroupID)
+[numthreads(STAGE_THREAD_GROUP_SIZE, 1, 1)]
+void StageMain(uint3 DTid : SV_DispatchThreadID, uint3 Gid : SV_GroupID)
 {
-    uint row = Gid.x;           // Which row we're processing
-    uint col = GTid.x;          // Column index within row
-    
-    if (row >= g_MapSize || col >= g_MapSize)
+    uint j = DTid.x;
+    uint lineIndex = Gid.y;
+    uint slice = Gid.z;
+    uint halfSize = g_MapSize >> 1;
+
+    if (j >= halfSize)
         return;
-    
-    // ========== Load data into shared memory ==========
-    uint inputIdx = GetBufferIndex(g_CascadeIndex, g_SpectrumIndex, row, col);
-    
-    float2 loaded = g_FFTInput[inputIdx];
-    g_SharedData[col] = UnpackComplex(loaded);
-    
+
+    Complex a = UnpackComplex(g_FFTBuffer[g_SourceOffset + GetLineIndex(slice, lineIndex, j, g_Axis)]);
+    Complex b = UnpackComplex(g_FFTBuffer[g_SourceOffset + GetLineIndex(slice, lineIndex, j + halfSize, g_Axis)]);
+
+    uint i0, i1;
+    Complex v0, v1;
+    Butterfly(g_Stage, j, a, b, i0, i1, v0, v1);
+
+    uint writeAxis = GetWriteAxis();
+    g_FFTBuffer[g_DestOffset + GetLineIndex(slice, lineIndex, i0, writeAxis)] = PackComplex(ComplexMulReal(v0, g_OutputScale));
+    g_FFTBuffer[g_DestOffset + GetLineIndex(slice, lineIndex, i1, writeAxis)] = PackComplex(ComplexMulReal(v1, g_OutputScale));
+}
+
+// ============================================================================
+// SinglePassMain: a whole row/column per thread group
+// Dispatch: (N lines, 1, slices), N <= MAX_SINGLE_PASS_SIZE
+// ============================================================================
+groupshared float2 g_Shared[2][MAX_SINGLE_PASS_SIZE];
+
+[numthreads(SINGLE_PASS_THREAD_GROUP_SIZE, 1, 1)]
+void SinglePassMain(uint3 GTid : SV_GroupThreadID, uint3 Gid : SV_GroupID)
+{
+    uint lineIndex = Gid.x;
+    uint slice = Gid.z;
+    uint halfSize = g_MapSize >> 1;
+
+    // ========== Load the row/column ==========
+    for (uint i = GTid.x; i < g_MapSize; i += SINGLE_PASS_THREAD_GROUP_SIZE)
+    {
+        g_Shared[0][i] = g_FFTBuffer[g_SourceOffset + GetLineIndex(slice, lineIndex, i, g_Axis)];
+    }
     GroupMemoryBarrierWithGroupSync();
-    
-    // ========== Perform all FFT stages in shared memory ==========
-    [unroll]
+
+    // ========== All stages, ping-pong in groupshared ==========
     for (uint stage = 0; stage < g_LogN; ++stage)
     {
-        uint butterflyWidth = 1u << (stage + 1);
-        uint halfWidth = butterflyWidth >> 1;
-        
-        // Which butterfly are we in?
-        uint butterflyIndex = col / butterflyWidth;
-        uint localIndex = col % butterflyWidth;
-        
-        // Indices within butterfly
-        uint idx0 = butterflyIndex * butterflyWidth + (localIndex % halfWidth);
-        uint idx1 = idx0 + halfWidth;
-        
-        // Twiddle factor
-        float angle = -TAU * float(localIndex % halfWidth) / float(butterflyWidth);
-        if (g_Direction == 1) angle = -angle;  // IDFT
-        
-        Complex twiddle = ComplexExp(angle);
-        
-        // Load butterfly pair
-        Complex a = g_SharedData[idx0];
-        Complex b = g_SharedData[idx1];
-        
-        GroupMemoryBarrierWithGroupSync();
-        
-        // Butterfly operation: out0 = a + W*b, out1 = a - W*b
-        Complex wb = ComplexMul(twiddle, b);
-        
-        if (localIndex < halfWidth)
-        {
-            g_SharedData[col] = ComplexAdd(a, wb);
-        }
-        else
+        uint src = stage & 1;
+        uint dst = src ^ 1;
+
+        for (uint j = GTid.x; j < halfSize; j += SINGLE_PASS_THREAD_GROUP_SIZE)
         {
-            g_SharedData[col] = ComplexSub(a, wb);
+            uint i0, i1;
+            Complex v0, v1;
+            Butterfly(stage, j, UnpackComplex(g_Shared[src][j]), UnpackComplex(g_Shared[src][j + halfSize]), i0, i1, v0, v1);
+            g_Shared[dst][i0] = PackComplex(v0);
+            g_Shared[dst][i1] = PackComplex(v1);
         }
-        
         GroupMemoryBarrierWithGroupSync();
     }
-    
-    // ========== Write result ==========
-    Complex result = g_SharedData[col];
-    
-    // Scale for inverse FFT
-    if (g_Direction == 1)
+
+    // ========== Write the row/column back ==========
+    uint result = g_LogN & 1;
+    uint writeAxis = GetWriteAxis();
+    for (uint o = GTid.x; o < g_MapSize; o += SINGLE_PASS_THREAD_GROUP_SIZE)
     {
-        result = ComplexMulReal(result, 1.0f / float(g_MapSize));
+        g_FFTBuffer[g_DestOffset + GetLineIndex(slice, lineIndex, o, writeAxis)] = g_Shared[result][o] * g_OutputScale;
     }
-    
-    uint outputIdx = GetBufferIndex(g_CascadeIndex, g_SpectrumIndex, row, col);
-    g_FFTOutput[outputIdx] = PackComplex(result);
 }
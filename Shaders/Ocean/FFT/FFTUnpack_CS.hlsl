@@ -14,7 +14,8 @@ cbuffer UnpackConstants : register(b0)
     float g_Whitecap;          // Foam threshold (Jacobian)
     float g_FoamGrowRate;      // Foam growth rate
     float g_FoamDecayRate;     // Foam decay rate
-    float3 _padding;
+    uint g_FFTOffset;          // Element offset of the FFT buffer half holding the result (OceanFFTPlan::outputHalf)
+    float2 _padding;
 }
 
 // ============================================================================
@@ -40,12 +41,11 @@ RWTexture2DArray<float4> g_NormalFoamMap : register(u2);
 // Helper Functions
 // ============================================================================
 
-// We access FFT buffer at offset of NUM_SPECTRA*map_size*map_size because
-// FFT does not transpose a second time (matching GodotOceanWaves)
+// The FFT writes its result transposed (matching GodotOceanWaves), same layout as the modulate output
 uint GetFFTIndex(uint cascade, uint spectrum, uint2 coord)
 {
-    return cascade * g_MapSize * g_MapSize * 4 * 2 
-         + 4 * g_MapSize * g_MapSize  // Offset to second half (post-FFT)
+    return g_FFTOffset
+         + cascade * g_MapSize * g_MapSize * 4
          + spectrum * g_MapSize * g_MapSize 
          + coord.y * g_MapSize 
          + coord.x;
@@ -13,8 +13,7 @@ static const float PI = 3.14159265358979323846f;
 static const float TAU = 2.0f * PI;
 static const float GRAVITY = 9.81f;
 
-static const uint MAP_SIZE = 256;  // Must match CPU-side value
-static const uint LOG2_MAP_SIZE = 8;
+// Map size is a runtime value (OceanFFT::SetMapSize), passed to each shader in its constant buffer
 static const uint NUM_CASCADES = 4;
 
 // ============================================================================
@@ -129,25 +128,25 @@ float DispersionDeepWater(float k)
 // ============================================================================
 
 // Get wave vector k from pixel coordinates
-float2 GetWaveVector(uint2 pixelCoord, float tileLength)
+float2 GetWaveVector(uint2 pixelCoord, uint mapSize, float tileLength)
 {
     float2 k;
     // 映射到 [-N/2, N/2) 范围
-    int halfN = (int)MAP_SIZE / 2;
-    int nx = ((int)pixelCoord.x < halfN) ? (int)pixelCoord.x : (int)pixelCoord.x - (int)MAP_SIZE;
-    int ny = ((int)pixelCoord.y < halfN) ? (int)pixelCoord.y : (int)pixelCoord.y - (int)MAP_SIZE;
+    int halfN = (int)mapSize / 2;
+    int nx = ((int)pixelCoord.x < halfN) ? (int)pixelCoord.x : (int)pixelCoord.x - (int)mapSize;
+    int ny = ((int)pixelCoord.y < halfN) ? (int)pixelCoord.y : (int)pixelCoord.y - (int)mapSize;
     
     k.x = TAU * (float)nx / tileLength;
     k.y = TAU * (float)ny / tileLength;
     return k;
 }
 
-float2 GetWaveVectorXY(uint2 pixelCoord, float tileLengthX, float tileLengthY)
+float2 GetWaveVectorXY(uint2 pixelCoord, uint mapSize, float tileLengthX, float tileLengthY)
 {
     float2 k;
-    int halfN = (int)MAP_SIZE / 2;
-    int nx = ((int)pixelCoord.x < halfN) ? (int)pixelCoord.x : (int)pixelCoord.x - (int)MAP_SIZE;
-    int ny = ((int)pixelCoord.y < halfN) ? (int)pixelCoord.y : (int)pixelCoord.y - (int)MAP_SIZE;
+    int halfN = (int)mapSize / 2;
+    int nx = ((int)pixelCoord.x < halfN) ? (int)pixelCoord.x : (int)pixelCoord.x - (int)mapSize;
+    int ny = ((int)pixelCoord.y < halfN) ? (int)pixelCoord.y : (int)pixelCoord.y - (int)mapSize;
     
     k.x = TAU * (float)nx / tileLengthX;
     k.y = TAU * (float)ny / tileLengthY;
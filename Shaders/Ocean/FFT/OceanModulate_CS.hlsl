@@ -14,7 +14,9 @@ cbuffer ModulateConstants : register(b0)
     float g_Depth;             // Water depth (meters)
     float g_Time;              // Current time (seconds)
     uint g_CascadeIndex;       // Current cascade index
-    float3 _padding;
+    uint g_SpectrumLayer;      // Spectrum cache slot holding this cascade's h0(k)
+    uint g_MapSize;            // Spectrum / FFT resolution
+    float _padding;
 }
 
 // ============================================================================
@@ -37,7 +39,7 @@ RWStructuredBuffer<float2> g_FFTBuffer : register(u0);
 // ============================================================================
 uint GetFFTIndex(uint2 coord, uint spectrumIndex)
 {
-    return spectrumIndex * MAP_SIZE * MAP_SIZE + coord.y * MAP_SIZE + coord.x;
+    return spectrumIndex * g_MapSize * g_MapSize + coord.y * g_MapSize + coord.x;
 }
 
 // ============================================================================
@@ -48,16 +50,16 @@ void main(uint3 DTid : SV_DispatchThreadID)
 {
     uint2 pixelCoord = DTid.xy;
     
-    if (any(pixelCoord >= MAP_SIZE))
+    if (any(pixelCoord >= g_MapSize))
         return;
     
     // Get wave vector k = (id - dims/2) * 2π / tile_length
-    float2 k_vec = ((float2)pixelCoord - (float)MAP_SIZE * 0.5f) * 2.0f * PI / g_TileLength;
+    float2 k_vec = ((float2)pixelCoord - (float)g_MapSize * 0.5f) * 2.0f * PI / g_TileLength;
     float k = length(k_vec) + 1e-6f;
     float2 k_unit = k_vec / k;
     
     // Load h0 spectrum - format: (h0.xy, conj(h0(-k)))
-    float4 h0_packed = g_InputSpectrum[uint3(pixelCoord, g_CascadeIndex)];
+    float4 h0_packed = g_InputSpectrum[uint3(pixelCoord, g_SpectrumLayer)];
     float2 h0_k = h0_packed.xy;
     float2 h0_neg_conj = h0_packed.zw;
     
@@ -95,7 +97,7 @@ void main(uint3 DTid : SV_DispatchThreadID)
     // ========== Pack outputs for FFT ==========
     // Because h respects the complex conjugation property (output will be real),
     // we can pack two waves into one complex number
-    uint baseIdx = g_CascadeIndex * 4 * MAP_SIZE * MAP_SIZE;
+    uint baseIdx = g_CascadeIndex * 4 * g_MapSize * g_MapSize;
     
     // Spectrum 0: packed (hx, hy) -> (hx.x - hy.y, hx.y + hy.x)
     // After FFT, real part = hx, imag part = hy
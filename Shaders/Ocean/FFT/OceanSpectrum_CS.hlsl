@@ -19,8 +19,9 @@ cbuffer SpectrumConstants : register(b0)
     float g_Swell;             // Swell parameter (wave elongation)
     float g_Detail;            // Detail parameter (high-freq suppression)
     float g_Spread;            // Spread parameter (directionality)
-    uint g_CascadeIndex;       // Current cascade index
-    float3 _padding;
+    uint g_CascadeIndex;       // Output layer (spectrum cache slot)
+    uint g_MapSize;            // Spectrum resolution
+    float2 _padding;
 }
 
 // ============================================================================
@@ -143,10 +144,10 @@ void main(uint3 DTid : SV_DispatchThreadID)
 {
     int2 pixelCoord = int2(DTid.xy);
     
-    if (any(DTid.xy >= MAP_SIZE))
+    if (any(DTid.xy >= g_MapSize))
         return;
     
-    int2 dims = int2(MAP_SIZE, MAP_SIZE);
+    int2 dims = int2(g_MapSize, g_MapSize);
     int2 id0 = pixelCoord;
     int2 id1 = ((-id0) % dims + dims) % dims;  // Wrap -k coordinate
     
@@ -18,13 +18,14 @@ cbuffer OceanCB : register(b0)
     float4 g_ScatterColor;
     float4 g_FoamParams;
     float4 g_AtmosphereParams;
+    float4 g_QuadTreeParams;    // x = 基础网格每边的格数 (OceanQuadTreeConfig::baseMeshResolution)
 };
 
 // 实例数据 (每个四叉树节点)
 struct InstanceData
 {
     float4 positionScale;   // xyz = 世界位置, w = 缩放
-    float4 lodMorph;        // x = LOD, y = morph factor, zw = reserved
+    float4 lodMorph;        // x = LOD, y = 1 / (w - z) (0 表示不变形), zw = 变形区间起止距离
     float4 neighborLOD;     // 四个邻居的 LOD (左, 右, 下, 上)
 };
 
@@ -140,11 +141,24 @@ WaveResult GerstnerWave(float4 wave, float2 pos, float time, float steepness)
     return result;
 }
 
+// ============================================================================
+// CDLOD Morphing - 按顶点到相机的距离连续过渡到上一级网格
+// ============================================================================
+float2 MorphVertex(float2 uv, float morph)
+{
+    float gridResolution = g_QuadTreeParams.x;
+    // 奇数格点逐渐移到相邻的偶数格点上，morph = 1 时与上一级（半分辨率）网格重合
+    float2 fracPart = frac(uv * gridResolution * 0.5) * 2.0 / gridResolution;
+    return uv - fracPart * morph;
+}
+
 // ============================================================================
 // Edge Morphing - 防止 LOD 边界裂缝
 // ============================================================================
 float3 ApplyEdgeMorph(float3 localPos, float2 uv, float4 neighborLOD, float currentLOD)
 {
+    float gridResolution = g_QuadTreeParams.x;
+
     // 边缘阈值
     float edgeThreshold = 0.02;
     
@@ -154,14 +168,14 @@ float3 ApplyEdgeMorph(float3 localPos, float2 uv, float4 neighborLOD, float curr
     bool bottomEdge = uv.y < edgeThreshold;
     bool topEdge = uv.y > (1.0 - edgeThreshold);
     
-    // 如果邻居 LOD 更粗糙，需要变形边缘顶点以匹配
+    // 如果邻居 LOD 更粗糙，需要把边缘顶点对齐到邻居的格点（邻居格距是本节点的 2^lodDiff 倍）
     float3 morphedPos = localPos;
     
     // 左边缘
     if (leftEdge && neighborLOD.x > currentLOD)
     {
         float lodDiff = neighborLOD.x - currentLOD;
-        float snapFactor = pow(2.0, lodDiff);
+        float snapFactor = gridResolution / pow(2.0, lodDiff);
         morphedPos.z = floor(morphedPos.z * snapFactor + 0.5) / snapFactor;
     }
     
@@ -169,7 +183,7 @@ float3 ApplyEdgeMorph(float3 localPos, float2 uv, float4 neighborLOD, float curr
     if (rightEdge && neighborLOD.y > currentLOD)
     {
         float lodDiff = neighborLOD.y - currentLOD;
-        float snapFactor = pow(2.0, lodDiff);
+        float snapFactor = gridResolution / pow(2.0, lodDiff);
         morphedPos.z = floor(morphedPos.z * snapFactor + 0.5) / snapFactor;
     }
     
@@ -177,7 +191,7 @@ float3 ApplyEdgeMorph(float3 localPos, float2 uv, float4 neighborLOD, float curr
     if (bottomEdge && neighborLOD.z > currentLOD)
     {
         float lodDiff = neighborLOD.z - currentLOD;
-        float snapFactor = pow(2.0, lodDiff);
+        float snapFactor = gridResolution / pow(2.0, lodDiff);
         morphedPos.x = floor(morphedPos.x * snapFactor + 0.5) / snapFactor;
     }
     
@@ -185,7 +199,7 @@ float3 ApplyEdgeMorph(float3 localPos, float2 uv, float4 neighborLOD, float curr
     if (topEdge && neighborLOD.w > currentLOD)
     {
         float lodDiff = neighborLOD.w - currentLOD;
-        float snapFactor = pow(2.0, lodDiff);
+        float snapFactor = gridResolution / pow(2.0, lodDiff);
         morphedPos.x = floor(morphedPos.x * snapFactor + 0.5) / snapFactor;
     }
     
@@ -204,11 +218,20 @@ VSOutput VSMain(VSInput input)
     float3 instancePos = instance.positionScale.xyz;
     float instanceScale = instance.positionScale.w;
     float currentLOD = instance.lodMorph.x;
-    float morphFactor = instance.lodMorph.y;
     float4 neighborLOD = instance.neighborLOD;
     
+    // 内部顶点按距离连续变形；边缘顶点保持不动，由 ApplyEdgeMorph 对齐到更粗的邻居，保证相邻节点共享的边一致
+    float3 localPos = input.position;
+    bool onEdge = any(input.texcoord < 0.02) || any(input.texcoord > 0.98);
+    if (!onEdge && instance.lodMorph.y > 0.0)
+    {
+        float vertexDistance = length(instancePos + localPos * instanceScale - g_CameraPos.xyz);
+        float morph = saturate((vertexDistance - instance.lodMorph.z) * instance.lodMorph.y);
+        localPos.xz = MorphVertex(input.texcoord, morph) - 0.5;
+    }
+
     // 应用边缘变形
-    float3 localPos = ApplyEdgeMorph(input.position, input.texcoord, neighborLOD, currentLOD);
+    localPos = ApplyEdgeMorph(localPos, input.texcoord, neighborLOD, currentLOD);
     
     // 变换到世界空间
     float3 worldPos = instancePos + localPos * instanceScale;
@@ -264,9 +287,6 @@ VSOutput VSMain(VSInput input)
         totalJacobian *= lerp(1.0, wave.jacobian, lod2);
     }
     
-    // 应用 LOD 变形 (平滑过渡到更粗糙的 LOD)
-    totalDisplacement = lerp(totalDisplacement, totalDisplacement * 0.5, morphFactor * 0.5);
-    
     // 应用位移
     float3 displacedPos = worldPos + totalDisplacement;
     
@@ -3,6 +3,7 @@
 // Uses Cook-Torrance BRDF with GGX distribution
 
 #include "PBRCommon.hlsli"
+#include "VertexQuantization.hlsli"
 
 // 帧常量
 cbuffer PerFrameData : register(b0)
@@ -39,8 +40,8 @@ cbuffer PerObjectData : register(b1)
 // 顶点输入 (不需要切线)
 struct VSInput
 {
-    float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    VERTEX_POSITION_TYPE Position : POSITION;
+    VERTEX_NORMAL_TYPE Normal : NORMAL;
     float2 TexCoord : TEXCOORD0;
     float4 Color : COLOR0;
 };
@@ -60,12 +61,12 @@ PSInput VSMain(VSInput input)
 {
     PSInput output;
     
-    float4 worldPos = mul(float4(input.Position, 1.0), World);
+    float4 worldPos = mul(float4(DecodeVertexPosition(input.Position), 1.0), World);
     output.WorldPos = worldPos.xyz;
     output.Position = mul(worldPos, ViewProjection);
     
     // 变换法线
-    output.Normal = normalize(mul(float4(input.Normal, 0.0), WorldInvTranspose).xyz);
+    output.Normal = normalize(mul(float4(DecodeVertexNormal(input.Normal), 0.0), WorldInvTranspose).xyz);
     output.TexCoord = input.TexCoord;
     output.Color = input.Color;
     
@@ -0,0 +1,35 @@
+// Vertex quantization helpers
+// VertexQuantization.hlsli
+
+#ifndef VERTEX_QUANTIZATION_HLSLI
+#define VERTEX_QUANTIZATION_HLSLI
+
+// 定义 QUANTIZED_VERTEX 时顶点来自 QuantizedVertex（Source/Scene/VertexQuantization.h）：
+//   POSITION  R16G16B16A16_UNORM  包围盒内归一化，反量化已折叠进 World 矩阵
+//   NORMAL    R16G16_SNORM        八面体编码
+//   TEXCOORD  R16G16_FLOAT / COLOR R8G8B8A8_UNORM 由输入装配直接展开，着色器无需改动
+#ifdef QUANTIZED_VERTEX
+    #define VERTEX_POSITION_TYPE float4
+    #define VERTEX_NORMAL_TYPE float2
+#else
+    #define VERTEX_POSITION_TYPE float3
+    #define VERTEX_NORMAL_TYPE float3
+#endif
+
+// 与 CPU 端 DecodeOctahedralNormal 保持一致
+float3 DecodeOctahedralNormal(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+float3 DecodeVertexPosition(float3 position) { return position; }
+float3 DecodeVertexPosition(float4 position) { return position.xyz; }
+
+float3 DecodeVertexNormal(float3 normal) { return normal; }
+float3 DecodeVertexNormal(float2 encoded) { return DecodeOctahedralNormal(encoded); }
+
+#endif // VERTEX_QUANTIZATION_HLSLI
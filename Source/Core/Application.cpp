@@ -2,6 +2,7 @@
 #include "Core/Log.h"
 #include "Core/Timer.h"
 #include "Core/FileSystem.h"
+#include "Core/JobSystem.h"
 
 namespace Sea
 {
@@ -34,6 +35,7 @@ namespace Sea
     bool Application::Initialize()
     {
         Log::Initialize();
+        JobSystem::Initialize();
         SEA_CORE_INFO("SeaEngine Initializing...");
 
         // 设置工作目录为可执行文件所在目录
@@ -73,6 +75,7 @@ namespace Sea
         SEA_CORE_INFO("SeaEngine Shutting down...");
         OnShutdown();
         m_Window->Shutdown();
+        JobSystem::Shutdown();
         Log::Shutdown();
     }
 
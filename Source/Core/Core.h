@@ -8,3 +8,6 @@
 #include "Core/Input.h"
 #include "Core/Timer.h"
 #include "Core/FileSystem.h"
+#include "Core/JobSystem.h"
+#include "Core/MappedFile.h"
+#include "Core/Hash.h"
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <cstring>
+
+namespace Sea
+{
+    // 64 位内容哈希（非加密），每次处理 8 字节，用于资源缓存校验
+    inline u64 HashBytes(const void* data, size_t size, u64 seed = 0)
+    {
+        constexpr u64 PRIME1 = 0x9E3779B185EBCA87ull;
+        constexpr u64 PRIME2 = 0xC2B2AE3D27D4EB4Full;
+
+        const u8* bytes = static_cast<const u8*>(data);
+        u64 hash = seed ^ (static_cast<u64>(size) * PRIME1);
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            u64 word;
+            std::memcpy(&word, bytes + i, 8);
+            word *= PRIME2;
+            word = (word << 31) | (word >> 33);
+            hash ^= word * PRIME1;
+            hash = ((hash << 27) | (hash >> 37)) * PRIME1 + PRIME2;
+        }
+
+        u64 tail = 0;
+        std::memcpy(&tail, bytes + i, size - i);
+        hash ^= tail * PRIME2;
+
+        // 最终混合
+        hash ^= hash >> 33;
+        hash *= PRIME2;
+        hash ^= hash >> 29;
+        hash *= PRIME1;
+        hash ^= hash >> 32;
+        return hash;
+    }
+}
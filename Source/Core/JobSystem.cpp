@@ -0,0 +1,525 @@
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    struct JobData
+    {
+        JobScheduler* scheduler = nullptr;     // 依赖完成后入队到哪个实例，同步执行的任务为空
+        JobSystem::RangeFunction function;
+        u32 count = 1;
+        u32 batchSize = 1;
+
+        std::atomic<u32> remainingBatches{ 0 };
+        std::atomic<u32> pendingDependencies{ 0 };
+        std::atomic<bool> finished{ false };
+
+        // 依赖本任务的后续任务，完成时逐个减少它们的依赖计数
+        std::mutex continuationMutex;
+        std::vector<Ref<JobData>> continuations;
+    };
+
+    namespace
+    {
+        struct JobBatch
+        {
+            Ref<JobData> job;
+            u32 begin = 0;
+            u32 end = 0;
+        };
+
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<JobBatch> batches;
+        };
+
+        // 线程绑定的实例与队列；实例用递增编号识别，避免销毁后地址复用被误认
+        struct ThreadBinding
+        {
+            u64 schedulerId = 0;
+            u32 queueIndex = 0;
+        };
+
+        constexpr u32 INVALID_QUEUE = ~0u;
+
+        thread_local ThreadBinding t_Binding;
+        thread_local JobScheduler* t_Scheduler = nullptr;     // 工作线程 / ScopedJobSystem 使用的实例
+
+        std::atomic<JobScheduler*> s_GlobalScheduler{ nullptr };
+        std::atomic<u64> s_NextSchedulerId{ 1 };
+
+        JobScheduler* GetCurrentScheduler()
+        {
+            return t_Scheduler ? t_Scheduler : s_GlobalScheduler.load(std::memory_order_acquire);
+        }
+    }
+
+    // 一个任务系统实例：工作线程与所有队列
+    // 队列布局：0 = 创建实例的线程，1..N-1 = 工作线程，之后是外部线程按需认领的队列
+    // 队列数组在构造时一次分配好，运行期间不会重新分配，窃取时无需额外同步
+    class JobScheduler : public NonCopyable
+    {
+    public:
+        static constexpr u32 MAX_EXTERNAL_THREADS = 8;
+
+        explicit JobScheduler(u32 threadCount)
+            : m_Id(s_NextSchedulerId.fetch_add(1, std::memory_order_relaxed))
+            , m_ThreadCount(threadCount)
+            , m_OwnerThread(std::this_thread::get_id())
+        {
+            const u32 queueCount = threadCount + MAX_EXTERNAL_THREADS;
+            m_Queues.reserve(queueCount);
+            for (u32 i = 0; i < queueCount; ++i)
+            {
+                m_Queues.push_back(MakeScope<WorkQueue>());
+            }
+
+            m_Running = true;
+            for (u32 i = 1; i < threadCount; ++i)
+            {
+                m_Workers.emplace_back(&JobScheduler::WorkerLoop, this, i);
+            }
+        }
+
+        ~JobScheduler()
+        {
+            // 把还没执行的任务跑完，避免等待方永远挂起
+            while (TryRunOne(0)) {}
+
+            {
+                std::lock_guard<std::mutex> lock(m_SleepMutex);
+                m_Running = false;
+            }
+            m_SleepCondition.notify_all();
+
+            for (auto& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        u64 GetId() const { return m_Id; }
+        u32 GetThreadCount() const { return m_ThreadCount; }
+
+        // 当前线程在本实例中的队列，没有绑定时返回 INVALID_QUEUE
+        u32 GetBoundQueue() const
+        {
+            if (std::this_thread::get_id() == m_OwnerThread)
+                return 0;
+            return (t_Binding.schedulerId == m_Id) ? t_Binding.queueIndex : INVALID_QUEUE;
+        }
+
+        void Enqueue(const Ref<JobData>& job)
+        {
+            const u32 batchCount = (job->count + job->batchSize - 1) / job->batchSize;
+            if (batchCount == 0)
+            {
+                Finish(job);
+                return;
+            }
+
+            const u32 queueIndex = AcquireQueue();
+            if (queueIndex == INVALID_QUEUE)
+            {
+                // 外部队列已经分完：在提交线程上同步执行，而不是挤进别的线程的队列
+                for (u32 begin = 0; begin < job->count; begin += job->batchSize)
+                {
+                    job->function(begin, std::min(begin + job->batchSize, job->count));
+                }
+                Finish(job);
+                return;
+            }
+
+            job->remainingBatches.store(batchCount, std::memory_order_relaxed);
+
+            // 先计数再发布：否则别的线程可能在计数增加前取走并递减，计数会下溢
+            m_QueuedBatches.fetch_add(batchCount, std::memory_order_release);
+            {
+                WorkQueue& queue = *m_Queues[queueIndex];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                for (u32 begin = 0; begin < job->count; begin += job->batchSize)
+                {
+                    queue.batches.push_back({ job, begin, std::min(begin + job->batchSize, job->count) });
+                }
+            }
+
+            // 先拿一下锁，保证正在进入等待的线程不会错过通知
+            { std::lock_guard<std::mutex> lock(m_SleepMutex); }
+            if (batchCount == 1)
+                m_SleepCondition.notify_one();
+            else
+                m_SleepCondition.notify_all();
+            m_WaitCondition.notify_all();
+        }
+
+        void Wait(const JobData& job)
+        {
+            const u32 queueIndex = GetBoundQueue();
+            while (!job.finished.load(std::memory_order_acquire))
+            {
+                // 等待期间帮忙执行任务（包括窃取）
+                if (TryRunOne(queueIndex))
+                    continue;
+
+                // 没有可做的任务：阻塞到任务完成或有新任务入队
+                std::unique_lock<std::mutex> lock(m_SleepMutex);
+                m_WaitCondition.wait(lock, [this, &job] {
+                    return job.finished.load(std::memory_order_acquire) ||
+                           m_QueuedBatches.load(std::memory_order_acquire) > 0;
+                });
+            }
+        }
+
+    private:
+        u32 AcquireQueue()
+        {
+            const u32 bound = GetBoundQueue();
+            if (bound != INVALID_QUEUE)
+                return bound;
+
+            // 外部线程第一次提交任务：认领一个专属队列，之后一直使用
+            const u32 slot = m_ExternalQueueCount.fetch_add(1, std::memory_order_relaxed);
+            if (slot >= MAX_EXTERNAL_THREADS)
+            {
+                if (slot == MAX_EXTERNAL_THREADS)
+                {
+                    SEA_CORE_WARN("JobSystem: more than {} external threads, extra threads run their jobs inline",
+                                  MAX_EXTERNAL_THREADS);
+                }
+                return INVALID_QUEUE;
+            }
+
+            t_Binding = { m_Id, m_ThreadCount + slot };
+            return t_Binding.queueIndex;
+        }
+
+        bool PopOwn(u32 queueIndex, JobBatch& out)
+        {
+            WorkQueue& queue = *m_Queues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.batches.empty())
+                return false;
+            out = std::move(queue.batches.back());
+            queue.batches.pop_back();
+            return true;
+        }
+
+        bool Steal(u32 queueIndex, JobBatch& out)
+        {
+            const u32 queueCount = static_cast<u32>(m_Queues.size());
+            const u32 first = (queueIndex == INVALID_QUEUE) ? 0 : queueIndex + 1;
+            for (u32 i = 0; i < queueCount; ++i)
+            {
+                const u32 victim = (first + i) % queueCount;
+                if (victim == queueIndex)
+                    continue;
+
+                WorkQueue& queue = *m_Queues[victim];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.batches.empty())
+                    continue;
+                out = std::move(queue.batches.front());
+                queue.batches.pop_front();
+                return true;
+            }
+            return false;
+        }
+
+        bool TryRunOne(u32 queueIndex)
+        {
+            JobBatch batch;
+            const bool popped = (queueIndex != INVALID_QUEUE && PopOwn(queueIndex, batch)) || Steal(queueIndex, batch);
+            if (!popped)
+                return false;
+
+            m_QueuedBatches.fetch_sub(1, std::memory_order_relaxed);
+            Execute(batch);
+            return true;
+        }
+
+        void Execute(JobBatch& batch)
+        {
+            batch.job->function(batch.begin, batch.end);
+            if (batch.job->remainingBatches.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Finish(batch.job);
+            }
+        }
+
+        void Finish(const Ref<JobData>& job)
+        {
+            // 先释放闭包，等待方看到 finished 后可以安全销毁被捕获的数据
+            job->function = nullptr;
+
+            std::vector<Ref<JobData>> continuations;
+            {
+                std::lock_guard<std::mutex> lock(job->continuationMutex);
+                job->finished.store(true, std::memory_order_release);
+                continuations.swap(job->continuations);
+            }
+
+            for (const auto& next : continuations)
+            {
+                if (next->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    next->scheduler->Enqueue(next);
+                }
+            }
+
+            // 唤醒阻塞在 Wait 里的线程
+            { std::lock_guard<std::mutex> lock(m_SleepMutex); }
+            m_WaitCondition.notify_all();
+        }
+
+        void WorkerLoop(u32 queueIndex)
+        {
+            t_Binding = { m_Id, queueIndex };
+            t_Scheduler = this;
+            while (m_Running.load(std::memory_order_acquire))
+            {
+                if (TryRunOne(queueIndex))
+                    continue;
+
+                std::unique_lock<std::mutex> lock(m_SleepMutex);
+                m_SleepCondition.wait(lock, [this] {
+                    return m_QueuedBatches.load(std::memory_order_acquire) > 0 ||
+                           !m_Running.load(std::memory_order_acquire);
+                });
+            }
+        }
+
+    private:
+        const u64 m_Id;
+        const u32 m_ThreadCount;
+        const std::thread::id m_OwnerThread;
+
+        std::vector<Scope<WorkQueue>> m_Queues;
+        std::vector<std::thread> m_Workers;
+        std::atomic<bool> m_Running{ false };
+        std::atomic<u32> m_QueuedBatches{ 0 };
+        std::atomic<u32> m_ExternalQueueCount{ 0 };
+
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;     // 工作线程等待新任务
+        std::condition_variable m_WaitCondition;      // Wait 等待任务完成或新任务
+    };
+
+    namespace
+    {
+        Ref<JobData> CreateJob(JobScheduler* scheduler, JobSystem::RangeFunction function, u32 count, u32 batchSize)
+        {
+            auto job = MakeRef<JobData>();
+            job->scheduler = scheduler;
+            job->function = std::move(function);
+            job->count = count;
+            job->batchSize = std::max(1u, batchSize);
+            return job;
+        }
+
+        u32 ResolveThreadCount(u32 threadCount)
+        {
+            return (threadCount == 0) ? std::max(1u, std::thread::hardware_concurrency()) : threadCount;
+        }
+    }
+
+    bool JobHandle::IsComplete() const
+    {
+        return !m_Job || m_Job->finished.load(std::memory_order_acquire);
+    }
+
+    void JobSystem::Initialize(u32 threadCount)
+    {
+        if (s_GlobalScheduler.load(std::memory_order_acquire))
+        {
+            SEA_CORE_WARN("JobSystem already initialized");
+            return;
+        }
+
+        threadCount = ResolveThreadCount(threadCount);
+        s_GlobalScheduler.store(new JobScheduler(threadCount), std::memory_order_release);
+        SEA_CORE_INFO("JobSystem initialized with {} threads", threadCount);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        delete s_GlobalScheduler.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    bool JobSystem::IsInitialized()
+    {
+        return GetCurrentScheduler() != nullptr;
+    }
+
+    u32 JobSystem::GetThreadCount()
+    {
+        JobScheduler* scheduler = GetCurrentScheduler();
+        return scheduler ? scheduler->GetThreadCount() : 1;
+    }
+
+    u32 JobSystem::GetCurrentThreadIndex()
+    {
+        JobScheduler* scheduler = GetCurrentScheduler();
+        if (!scheduler)
+            return 0;
+
+        const u32 queueIndex = scheduler->GetBoundQueue();
+        return (queueIndex < scheduler->GetThreadCount()) ? queueIndex : 0;
+    }
+
+    void JobSystem::Submit(const Ref<JobData>& job, std::span<const JobHandle> dependencies)
+    {
+        // 多持有一个计数，防止依赖在注册过程中完成导致提前入队
+        job->pendingDependencies.store(1, std::memory_order_relaxed);
+
+        for (const auto& dependency : dependencies)
+        {
+            if (dependency.IsComplete())
+                continue;
+
+            JobData& other = *dependency.m_Job;
+            std::lock_guard<std::mutex> lock(other.continuationMutex);
+            if (!other.finished.load(std::memory_order_acquire))
+            {
+                job->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+                other.continuations.push_back(job);
+            }
+        }
+
+        if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            job->scheduler->Enqueue(job);
+        }
+    }
+
+    JobHandle JobSystem::Schedule(JobFunction job, std::span<const JobHandle> dependencies)
+    {
+        return ParallelFor(1, 1, [job = std::move(job)](u32, u32) { job(); }, dependencies);
+    }
+
+    JobHandle JobSystem::ParallelFor(u32 count, u32 batchSize, RangeFunction function,
+                                     std::span<const JobHandle> dependencies)
+    {
+        JobScheduler* scheduler = GetCurrentScheduler();
+        const u32 threadCount = scheduler ? scheduler->GetThreadCount() : 1;
+        if (batchSize == 0)
+        {
+            // 每个线程大约分到 4 个 batch，兼顾负载均衡与调度开销
+            batchSize = std::max(1u, count / (threadCount * 4));
+        }
+
+        if (!scheduler)
+        {
+            // 未初始化时同步执行；此时依赖必然已经完成
+            auto job = CreateJob(nullptr, nullptr, count, batchSize);
+            for (u32 begin = 0; begin < count; begin += job->batchSize)
+            {
+                function(begin, std::min(begin + job->batchSize, count));
+            }
+            job->finished = true;
+            return JobHandle(job);
+        }
+
+        auto job = CreateJob(scheduler, std::move(function), count, batchSize);
+        Submit(job, dependencies);
+        return JobHandle(job);
+    }
+
+    void JobSystem::RunParallelFor(u32 count, u32 batchSize, const RangeFunction& function)
+    {
+        if (count == 0)
+            return;
+
+        JobScheduler* scheduler = GetCurrentScheduler();
+        const u32 threadCount = scheduler ? scheduler->GetThreadCount() : 1;
+        if (batchSize == 0)
+        {
+            batchSize = std::max(1u, count / (threadCount * 4));
+        }
+
+        if (threadCount == 1 || count <= batchSize)
+        {
+            function(0, count);
+            return;
+        }
+
+        // function 在 Wait 返回前一直有效，按引用捕获即可
+        Wait(ParallelFor(count, batchSize, [&function](u32 begin, u32 end) { function(begin, end); }));
+    }
+
+    void JobSystem::Wait(const JobHandle& handle)
+    {
+        // 同步执行的任务创建时就已完成；其余任务回到提交它的实例上等待
+        if (handle.IsComplete())
+            return;
+
+        handle.m_Job->scheduler->Wait(*handle.m_Job);
+    }
+
+    void JobSystem::WaitAll(std::span<const JobHandle> handles)
+    {
+        for (const auto& handle : handles)
+        {
+            Wait(handle);
+        }
+    }
+
+    ScopedJobSystem::ScopedJobSystem(u32 threadCount)
+        : m_Scheduler(MakeScope<JobScheduler>(ResolveThreadCount(threadCount)))
+        , m_PreviousScheduler(t_Scheduler)
+    {
+        t_Scheduler = m_Scheduler.get();
+    }
+
+    ScopedJobSystem::~ScopedJobSystem()
+    {
+        t_Scheduler = m_PreviousScheduler;
+        m_Scheduler.reset();
+    }
+
+    void BenchmarkJobScaling(const char* name, const std::function<void()>& workload, u32 iterations, u32 maxThreads)
+    {
+        if (iterations == 0)
+            return;
+
+        maxThreads = ResolveThreadCount(maxThreads);
+        SEA_CORE_INFO("Job scaling benchmark: {} ({} iterations)", name, iterations);
+
+        // 1, 2, 3, 4, 8, 16 ... 最后一档固定为 maxThreads
+        std::vector<u32> threadCounts;
+        for (u32 threads = 1; threads < maxThreads; threads = (threads < 4) ? threads + 1 : threads * 2)
+        {
+            threadCounts.push_back(threads);
+        }
+        threadCounts.push_back(maxThreads);
+
+        f64 singleThreadMs = 0.0;
+        for (u32 threads : threadCounts)
+        {
+            ScopedJobSystem jobSystem(threads);
+
+            workload();     // 预热
+
+            auto startTime = std::chrono::high_resolution_clock::now();
+            for (u32 i = 0; i < iterations; ++i)
+            {
+                workload();
+            }
+            auto endTime = std::chrono::high_resolution_clock::now();
+            f64 ms = std::chrono::duration<f64, std::milli>(endTime - startTime).count() / iterations;
+
+            if (threads == 1)
+                singleThreadMs = ms;
+
+            SEA_CORE_INFO("  {:2} threads: {:8.3f} ms  speedup {:.2f}x", threads, ms, singleThreadMs / ms);
+        }
+    }
+}
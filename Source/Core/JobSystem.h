@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <functional>
+#include <span>
+
+namespace Sea
+{
+    struct JobData;
+    class JobScheduler;
+
+    // 任务句柄：可以等待，也可以作为其它任务的依赖
+    class JobHandle
+    {
+    public:
+        JobHandle() = default;
+
+        bool IsValid() const { return m_Job != nullptr; }
+        bool IsComplete() const;
+
+    private:
+        friend class JobSystem;
+        explicit JobHandle(Ref<JobData> job) : m_Job(std::move(job)) {}
+
+        Ref<JobData> m_Job;
+    };
+
+    // 工作窃取任务系统
+    // - 每个线程一个双端队列：自己从尾部取（LIFO，缓存友好），空闲线程从别人头部窃取
+    // - 非工作线程（加载线程等）第一次提交任务时分到自己的队列，不与主线程共用队列 0
+    // - Wait 时先帮忙跑队列里的任务，没有可做的任务就阻塞到任务完成或有新任务入队
+    // - 依赖全部完成后任务才会入队；ParallelFor 按 batch 拆成多个小任务
+    // - 未初始化时所有任务在调用线程上立即同步执行
+    class JobSystem
+    {
+    public:
+        using JobFunction = std::function<void()>;
+        using RangeFunction = std::function<void(u32 begin, u32 end)>;
+
+        // threadCount 包含主线程，0 = 硬件线程数
+        // Shutdown 前必须保证其它线程已经不再使用任务系统
+        static void Initialize(u32 threadCount = 0);
+        static void Shutdown();
+
+        static bool IsInitialized();
+        static u32 GetThreadCount();
+
+        // 当前线程编号：0 = 主线程（或任何非工作线程），1..N-1 = 工作线程
+        static u32 GetCurrentThreadIndex();
+
+        static JobHandle Schedule(JobFunction job, std::span<const JobHandle> dependencies = {});
+
+        // 把 [0, count) 按 batchSize 拆分并行执行，batchSize 为 0 时自动选择
+        static JobHandle ParallelFor(u32 count, u32 batchSize, RangeFunction function,
+                                     std::span<const JobHandle> dependencies = {});
+
+        // 同步版本：数量不足一个 batch 或只有一个线程时直接在当前线程执行
+        static void RunParallelFor(u32 count, u32 batchSize, const RangeFunction& function);
+
+        static void Wait(const JobHandle& handle);
+        static void WaitAll(std::span<const JobHandle> handles);
+
+    private:
+        static void Submit(const Ref<JobData>& job, std::span<const JobHandle> dependencies);
+    };
+
+    // 在当前线程上临时换用一个独立的任务系统实例，析构时恢复
+    // 用于按不同线程数跑基准测试：全局实例和其它线程上正在执行的任务都不受影响
+    class ScopedJobSystem : public NonCopyable
+    {
+    public:
+        explicit ScopedJobSystem(u32 threadCount);
+        ~ScopedJobSystem();
+
+    private:
+        Scope<JobScheduler> m_Scheduler;
+        JobScheduler* m_PreviousScheduler = nullptr;
+    };
+
+    // 扩展性测试：分别用 1..maxThreads 个线程运行 workload，输出耗时与加速比
+    // 每一档都在独立的 ScopedJobSystem 上运行，不会重建全局任务系统
+    void BenchmarkJobScaling(const char* name, const std::function<void()>& workload,
+                             u32 iterations = 10, u32 maxThreads = 0);
+}
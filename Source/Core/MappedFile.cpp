@@ -0,0 +1,136 @@
+#include "Core/MappedFile.h"
+#include "Core/Log.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Sea
+{
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            m_Data = other.m_Data;
+            m_Size = other.m_Size;
+            m_Opened = other.m_Opened;
+#ifdef _WIN32
+            m_FileHandle = other.m_FileHandle;
+            m_MappingHandle = other.m_MappingHandle;
+            other.m_FileHandle = nullptr;
+            other.m_MappingHandle = nullptr;
+#else
+            m_FileDescriptor = other.m_FileDescriptor;
+            other.m_FileDescriptor = -1;
+#endif
+            other.m_Data = nullptr;
+            other.m_Size = 0;
+            other.m_Opened = false;
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            SEA_CORE_ERROR("Failed to open file for mapping: {}", path.string());
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            SEA_CORE_ERROR("Failed to query file size: {}", path.string());
+            return false;
+        }
+
+        m_FileHandle = file;
+        m_Size = static_cast<u64>(size.QuadPart);
+        m_Opened = true;
+        if (m_Size == 0)
+            return true;    // 空文件无法映射，按空内容处理
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            SEA_CORE_ERROR("Failed to create file mapping: {}", path.string());
+            Close();
+            return false;
+        }
+        m_MappingHandle = mapping;
+
+        m_Data = static_cast<const u8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            SEA_CORE_ERROR("Failed to open file for mapping: {}", path.string());
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            SEA_CORE_ERROR("Failed to query file size: {}", path.string());
+            return false;
+        }
+
+        m_FileDescriptor = fd;
+        m_Size = static_cast<u64>(info.st_size);
+        m_Opened = true;
+        if (m_Size == 0)
+            return true;    // 空文件无法映射，按空内容处理
+
+        void* data = mmap(nullptr, static_cast<size_t>(m_Size), PROT_READ, MAP_PRIVATE, fd, 0);
+        m_Data = (data == MAP_FAILED) ? nullptr : static_cast<const u8*>(data);
+#endif
+
+        if (!m_Data)
+        {
+            SEA_CORE_ERROR("Failed to map file: {}", path.string());
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+#ifdef _WIN32
+        if (m_Data)
+            UnmapViewOfFile(m_Data);
+        if (m_MappingHandle)
+            CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+        if (m_FileHandle)
+            CloseHandle(static_cast<HANDLE>(m_FileHandle));
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+#else
+        if (m_Data)
+            munmap(const_cast<u8*>(m_Data), static_cast<size_t>(m_Size));
+        if (m_FileDescriptor >= 0)
+            ::close(m_FileDescriptor);
+        m_FileDescriptor = -1;
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Opened = false;
+    }
+}
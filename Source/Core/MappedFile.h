@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <filesystem>
+#include <span>
+
+namespace Sea
+{
+    // 只读内存映射文件：内容按需由操作系统换入，不经过中间缓冲区
+    class MappedFile : public NonCopyable
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const { return m_Opened; }
+        const u8* GetData() const { return m_Data; }
+        u64 GetSize() const { return m_Size; }
+        std::span<const u8> GetBytes() const { return { m_Data, static_cast<size_t>(m_Size) }; }
+
+    private:
+        const u8* m_Data = nullptr;
+        u64 m_Size = 0;
+        bool m_Opened = false;
+#ifdef _WIN32
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+#else
+        int m_FileDescriptor = -1;
+#endif
+    };
+}
@@ -53,6 +53,11 @@ namespace Sea
         m_Allocator->Reset();
         m_CommandList->Reset(m_Allocator.Get(), nullptr);
         m_PendingBarriers.clear();
+
+        // 新的录制从未知状态开始
+        m_LastStateCacheStats = m_StateCache.GetStats();
+        m_StateCache.ResetStats();
+        m_StateCache.Invalidate();
     }
 
     void CommandList::Close()
@@ -111,16 +116,24 @@ namespace Sea
 
     void CommandList::ClearRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const f32* color)
     {
+        FlushBarriers();
         m_CommandList->ClearRenderTargetView(rtv, color, 0, nullptr);
     }
 
     void CommandList::ClearDepthStencil(D3D12_CPU_DESCRIPTOR_HANDLE dsv, f32 depth, u8 stencil)
     {
+        FlushBarriers();
         m_CommandList->ClearDepthStencilView(dsv, 
             D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 
             depth, stencil, 0, nullptr);
     }
 
+    void CommandList::ClearDepth(D3D12_CPU_DESCRIPTOR_HANDLE dsv, f32 depth)
+    {
+        FlushBarriers();
+        m_CommandList->ClearDepthStencilView(dsv, D3D12_CLEAR_FLAG_DEPTH, depth, 0, 0, nullptr);
+    }
+
     void CommandList::SetRenderTargets(std::span<D3D12_CPU_DESCRIPTOR_HANDLE> rtvs, 
                                        const D3D12_CPU_DESCRIPTOR_HANDLE* dsv)
     {
@@ -132,6 +145,11 @@ namespace Sea
         );
     }
 
+    void CommandList::SetRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const D3D12_CPU_DESCRIPTOR_HANDLE* dsv)
+    {
+        m_CommandList->OMSetRenderTargets(1, &rtv, FALSE, dsv);
+    }
+
     void CommandList::SetViewport(const Viewport& viewport)
     {
         D3D12_VIEWPORT vp = viewport.ToD3D12();
@@ -146,7 +164,7 @@ namespace Sea
 
     void CommandList::SetPipelineState(PipelineState* pso)
     {
-        if (pso)
+        if (pso && m_StateCache.SetPipelineState(pso->GetPipelineState()))
         {
             m_CommandList->SetPipelineState(pso->GetPipelineState());
         }
@@ -154,7 +172,7 @@ namespace Sea
 
     void CommandList::SetGraphicsRootSignature(RootSignature* rootSig)
     {
-        if (rootSig)
+        if (rootSig && m_StateCache.SetGraphicsRootSignature(rootSig->GetRootSignature()))
         {
             m_CommandList->SetGraphicsRootSignature(rootSig->GetRootSignature());
         }
@@ -162,7 +180,7 @@ namespace Sea
 
     void CommandList::SetComputeRootSignature(RootSignature* rootSig)
     {
-        if (rootSig)
+        if (rootSig && m_StateCache.SetComputeRootSignature(rootSig->GetRootSignature()))
         {
             m_CommandList->SetComputeRootSignature(rootSig->GetRootSignature());
         }
@@ -170,6 +188,21 @@ namespace Sea
 
     void CommandList::SetDescriptorHeaps(std::span<ID3D12DescriptorHeap*> heaps)
     {
+        // D3D12 同时最多绑定 CBV_SRV_UAV 和 Sampler 两个堆
+        std::array<const void*, RHIStateCache::MAX_DESCRIPTOR_HEAPS> keys = {};
+        if (heaps.size() <= keys.size())
+        {
+            for (size_t i = 0; i < heaps.size(); ++i)
+                keys[i] = heaps[i];
+
+            if (!m_StateCache.SetDescriptorHeaps(std::span<const void* const>(keys.data(), heaps.size())))
+                return;
+        }
+        else
+        {
+            m_StateCache.Invalidate();
+        }
+
         m_CommandList->SetDescriptorHeaps(static_cast<UINT>(heaps.size()), heaps.data());
     }
 
@@ -185,21 +218,33 @@ namespace Sea
 
     void CommandList::SetGraphicsRootCBV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::CBV, address))
+            return;
+
         m_CommandList->SetGraphicsRootConstantBufferView(rootIndex, address);
     }
 
     void CommandList::SetGraphicsRootSRV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::SRV, address))
+            return;
+
         m_CommandList->SetGraphicsRootShaderResourceView(rootIndex, address);
     }
 
     void CommandList::SetGraphicsRootUAV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::UAV, address))
+            return;
+
         m_CommandList->SetGraphicsRootUnorderedAccessView(rootIndex, address);
     }
 
     void CommandList::SetGraphicsRootDescriptorTable(u32 rootIndex, D3D12_GPU_DESCRIPTOR_HANDLE baseHandle)
     {
+        if (!m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::DescriptorTable, baseHandle.ptr))
+            return;
+
         m_CommandList->SetGraphicsRootDescriptorTable(rootIndex, baseHandle);
     }
 
@@ -215,74 +260,102 @@ namespace Sea
 
     void CommandList::SetComputeRootCBV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::CBV, address))
+            return;
+
         m_CommandList->SetComputeRootConstantBufferView(rootIndex, address);
     }
 
     void CommandList::SetComputeRootSRV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::SRV, address))
+            return;
+
         m_CommandList->SetComputeRootShaderResourceView(rootIndex, address);
     }
 
     void CommandList::SetComputeRootUAV(u32 rootIndex, D3D12_GPU_VIRTUAL_ADDRESS address)
     {
+        if (!m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::UAV, address))
+            return;
+
         m_CommandList->SetComputeRootUnorderedAccessView(rootIndex, address);
     }
 
     void CommandList::SetComputeRootDescriptorTable(u32 rootIndex, D3D12_GPU_DESCRIPTOR_HANDLE baseHandle)
     {
+        if (!m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::DescriptorTable, baseHandle.ptr))
+            return;
+
         m_CommandList->SetComputeRootDescriptorTable(rootIndex, baseHandle);
     }
 
     void CommandList::SetVertexBuffer(u32 slot, const D3D12_VERTEX_BUFFER_VIEW& view)
     {
+        if (!m_StateCache.SetVertexBuffer(slot, view.BufferLocation, view.SizeInBytes, view.StrideInBytes))
+            return;
+
         m_CommandList->IASetVertexBuffers(slot, 1, &view);
     }
 
     void CommandList::SetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view)
     {
+        if (!m_StateCache.SetIndexBuffer(view.BufferLocation, view.SizeInBytes, static_cast<u32>(view.Format)))
+            return;
+
         m_CommandList->IASetIndexBuffer(&view);
     }
 
     void CommandList::SetPrimitiveTopology(PrimitiveTopology topology)
     {
+        if (!m_StateCache.SetPrimitiveTopology(static_cast<u32>(topology)))
+            return;
+
         m_CommandList->IASetPrimitiveTopology(static_cast<D3D12_PRIMITIVE_TOPOLOGY>(topology));
     }
 
     void CommandList::Draw(u32 vertexCount, u32 instanceCount, u32 startVertex, u32 startInstance)
     {
+        FlushBarriers();
         m_CommandList->DrawInstanced(vertexCount, instanceCount, startVertex, startInstance);
     }
 
     void CommandList::DrawIndexed(u32 indexCount, u32 instanceCount, u32 startIndex, 
                                   i32 baseVertex, u32 startInstance)
     {
+        FlushBarriers();
         m_CommandList->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
     }
 
     void CommandList::Dispatch(u32 groupCountX, u32 groupCountY, u32 groupCountZ)
     {
+        FlushBarriers();
         m_CommandList->Dispatch(groupCountX, groupCountY, groupCountZ);
     }
 
     void CommandList::CopyBuffer(ID3D12Resource* dest, ID3D12Resource* src, u64 size)
     {
+        FlushBarriers();
         m_CommandList->CopyBufferRegion(dest, 0, src, 0, size);
     }
 
     void CommandList::CopyBufferRegion(ID3D12Resource* dest, u64 destOffset, 
                                        ID3D12Resource* src, u64 srcOffset, u64 size)
     {
+        FlushBarriers();
         m_CommandList->CopyBufferRegion(dest, destOffset, src, srcOffset, size);
     }
 
     void CommandList::CopyTexture(ID3D12Resource* dest, ID3D12Resource* src)
     {
+        FlushBarriers();
         m_CommandList->CopyResource(dest, src);
     }
 
     void CommandList::CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION& dest,
                                         const D3D12_TEXTURE_COPY_LOCATION& src)
     {
+        FlushBarriers();
         m_CommandList->CopyTextureRegion(&dest, 0, 0, 0, &src, nullptr);
     }
 }
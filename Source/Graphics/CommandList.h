@@ -2,6 +2,7 @@
 
 #include "Graphics/GraphicsTypes.h"
 #include "Core/Types.h"
+#include "RHI/RHIStateCache.h"
 
 namespace Sea
 {
@@ -25,6 +26,7 @@ namespace Sea
         void Close();
 
         // 资源屏障
+        // 屏障先攒批，在下一个清除 / 绘制 / 调度 / 拷贝命令之前自动提交
         void TransitionBarrier(ID3D12Resource* resource, ResourceState before, ResourceState after);
         void UAVBarrier(ID3D12Resource* resource);
         void FlushBarriers();
@@ -32,10 +34,12 @@ namespace Sea
         // 清除操作
         void ClearRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const f32* color);
         void ClearDepthStencil(D3D12_CPU_DESCRIPTOR_HANDLE dsv, f32 depth = 1.0f, u8 stencil = 0);
+        void ClearDepth(D3D12_CPU_DESCRIPTOR_HANDLE dsv, f32 depth = 1.0f);
 
         // 渲染目标
         void SetRenderTargets(std::span<D3D12_CPU_DESCRIPTOR_HANDLE> rtvs, 
                              const D3D12_CPU_DESCRIPTOR_HANDLE* dsv = nullptr);
+        void SetRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const D3D12_CPU_DESCRIPTOR_HANDLE* dsv = nullptr);
         void SetViewport(const Viewport& viewport);
         void SetScissorRect(const ScissorRect& rect);
 
@@ -83,7 +87,15 @@ namespace Sea
         void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION& dest,
                               const D3D12_TEXTURE_COPY_LOCATION& src);
 
-        ID3D12GraphicsCommandList* GetCommandList() const { return m_CommandList.Get(); }
+        // 冗余状态过滤
+        // 引擎内的渲染 pass 都应通过上面的接口录制。原生指针只留给无法改写的外部代码
+        // （ImGui 的 DX12 后端）和 CommandQueue 提交；取指针时先提交攒着的屏障并清空缓存状态，
+        // 因为之后的原生录制会绕过缓存
+        ID3D12GraphicsCommandList* GetCommandList() { FlushBarriers(); m_StateCache.Invalidate(); return m_CommandList.Get(); }
+        void InvalidateState() { m_StateCache.Invalidate(); }
+        RHIStateCache& GetStateCache() { return m_StateCache; }
+        const RHIStateCacheStats& GetStateCacheStats() const { return m_LastStateCacheStats; }  // 上一次录制的统计
+
         CommandQueueType GetType() const { return m_Type; }
 
     private:
@@ -95,5 +107,8 @@ namespace Sea
 
         std::vector<D3D12_RESOURCE_BARRIER> m_PendingBarriers;
         static constexpr u32 MaxPendingBarriers = 16;
+
+        RHIStateCache m_StateCache;
+        RHIStateCacheStats m_LastStateCacheStats;
     };
 }
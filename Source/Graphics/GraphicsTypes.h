@@ -59,6 +59,8 @@ namespace Sea
         DepthWrite = D3D12_RESOURCE_STATE_DEPTH_WRITE,
         DepthRead = D3D12_RESOURCE_STATE_DEPTH_READ,
         ShaderResource = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+        PixelShaderResource = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+        NonPixelShaderResource = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
         CopyDest = D3D12_RESOURCE_STATE_COPY_DEST,
         CopySource = D3D12_RESOURCE_STATE_COPY_SOURCE,
         Present = D3D12_RESOURCE_STATE_PRESENT,
@@ -0,0 +1,224 @@
+#include "RHI/RHIStateCache.h"
+
+namespace Sea
+{
+    const char* GetStateCategoryName(RHIStateCategory category)
+    {
+        switch (category)
+        {
+        case RHIStateCategory::PipelineState:           return "PipelineState";
+        case RHIStateCategory::GraphicsRootSignature:   return "GraphicsRootSignature";
+        case RHIStateCategory::ComputeRootSignature:    return "ComputeRootSignature";
+        case RHIStateCategory::DescriptorHeaps:         return "DescriptorHeaps";
+        case RHIStateCategory::VertexBuffer:            return "VertexBuffer";
+        case RHIStateCategory::IndexBuffer:             return "IndexBuffer";
+        case RHIStateCategory::PrimitiveTopology:       return "PrimitiveTopology";
+        case RHIStateCategory::GraphicsRootParameter:   return "GraphicsRootParameter";
+        case RHIStateCategory::ComputeRootParameter:    return "ComputeRootParameter";
+        default:                                        return "Unknown";
+        }
+    }
+
+    u32 RHIStateCacheStats::GetTotalIssued() const
+    {
+        u32 total = 0;
+        for (u32 count : issued) total += count;
+        return total;
+    }
+
+    u32 RHIStateCacheStats::GetTotalFiltered() const
+    {
+        u32 total = 0;
+        for (u32 count : filtered) total += count;
+        return total;
+    }
+
+    void RHIStateCache::Invalidate()
+    {
+        m_PipelineState = nullptr;
+        m_GraphicsRootSignature = nullptr;
+        m_ComputeRootSignature = nullptr;
+
+        m_DescriptorHeaps = {};
+        m_DescriptorHeapCount = 0;
+        m_DescriptorHeapsValid = false;
+
+        m_VertexBuffers = {};
+
+        m_IndexBufferAddress = 0;
+        m_IndexBufferSize = 0;
+        m_IndexBufferFormat = 0;
+        m_IndexBufferValid = false;
+
+        m_PrimitiveTopology = UNKNOWN_TOPOLOGY;
+
+        m_GraphicsRootParameters = {};
+        m_ComputeRootParameters = {};
+    }
+
+    bool RHIStateCache::Record(RHIStateCategory category, bool changed)
+    {
+        u32 index = static_cast<u32>(category);
+        if (changed || !m_Enabled)
+        {
+            m_Stats.issued[index]++;
+            return true;
+        }
+        m_Stats.filtered[index]++;
+        return false;
+    }
+
+    bool RHIStateCache::SetPipelineState(const void* pso)
+    {
+        bool changed = (pso != m_PipelineState);
+        m_PipelineState = pso;
+        return Record(RHIStateCategory::PipelineState, changed);
+    }
+
+    bool RHIStateCache::SetGraphicsRootSignature(const void* rootSig)
+    {
+        bool changed = (rootSig != m_GraphicsRootSignature);
+        if (changed || !m_Enabled)
+        {
+            // 切换根签名后之前的根参数全部失效
+            m_GraphicsRootParameters = {};
+        }
+        m_GraphicsRootSignature = rootSig;
+        return Record(RHIStateCategory::GraphicsRootSignature, changed);
+    }
+
+    bool RHIStateCache::SetComputeRootSignature(const void* rootSig)
+    {
+        bool changed = (rootSig != m_ComputeRootSignature);
+        if (changed || !m_Enabled)
+        {
+            m_ComputeRootParameters = {};
+        }
+        m_ComputeRootSignature = rootSig;
+        return Record(RHIStateCategory::ComputeRootSignature, changed);
+    }
+
+    bool RHIStateCache::SetDescriptorHeaps(std::span<const void* const> heaps)
+    {
+        if (heaps.size() > MAX_DESCRIPTOR_HEAPS)
+        {
+            // 超出可跟踪数量，直接转发并放弃缓存
+            m_DescriptorHeapsValid = false;
+            InvalidateDescriptorTables(m_GraphicsRootParameters);
+            InvalidateDescriptorTables(m_ComputeRootParameters);
+            return Record(RHIStateCategory::DescriptorHeaps, true);
+        }
+
+        bool changed = !m_DescriptorHeapsValid || heaps.size() != m_DescriptorHeapCount;
+        for (size_t i = 0; i < heaps.size() && !changed; ++i)
+        {
+            bool found = false;
+            for (u32 j = 0; j < m_DescriptorHeapCount; ++j)
+            {
+                if (m_DescriptorHeaps[j] == heaps[i])
+                {
+                    found = true;
+                    break;
+                }
+            }
+            changed = !found;
+        }
+
+        if (changed)
+        {
+            m_DescriptorHeaps = {};
+            for (size_t i = 0; i < heaps.size(); ++i)
+            {
+                m_DescriptorHeaps[i] = heaps[i];
+            }
+            m_DescriptorHeapCount = static_cast<u32>(heaps.size());
+            m_DescriptorHeapsValid = true;
+
+            // 描述符表句柄指向旧堆，保守起见全部重新绑定
+            InvalidateDescriptorTables(m_GraphicsRootParameters);
+            InvalidateDescriptorTables(m_ComputeRootParameters);
+        }
+        return Record(RHIStateCategory::DescriptorHeaps, changed);
+    }
+
+    bool RHIStateCache::SetVertexBuffer(u32 slot, u64 gpuAddress, u32 sizeInBytes, u32 strideInBytes)
+    {
+        if (slot >= MAX_VERTEX_BUFFER_SLOTS)
+        {
+            return Record(RHIStateCategory::VertexBuffer, true);
+        }
+
+        VertexBufferBinding& binding = m_VertexBuffers[slot];
+        bool changed = !binding.valid ||
+                       binding.gpuAddress != gpuAddress ||
+                       binding.sizeInBytes != sizeInBytes ||
+                       binding.strideInBytes != strideInBytes;
+
+        binding.gpuAddress = gpuAddress;
+        binding.sizeInBytes = sizeInBytes;
+        binding.strideInBytes = strideInBytes;
+        binding.valid = true;
+        return Record(RHIStateCategory::VertexBuffer, changed);
+    }
+
+    bool RHIStateCache::SetIndexBuffer(u64 gpuAddress, u32 sizeInBytes, u32 format)
+    {
+        bool changed = !m_IndexBufferValid ||
+                       m_IndexBufferAddress != gpuAddress ||
+                       m_IndexBufferSize != sizeInBytes ||
+                       m_IndexBufferFormat != format;
+
+        m_IndexBufferAddress = gpuAddress;
+        m_IndexBufferSize = sizeInBytes;
+        m_IndexBufferFormat = format;
+        m_IndexBufferValid = true;
+        return Record(RHIStateCategory::IndexBuffer, changed);
+    }
+
+    bool RHIStateCache::SetPrimitiveTopology(u32 topology)
+    {
+        bool changed = (topology != m_PrimitiveTopology);
+        m_PrimitiveTopology = topology;
+        return Record(RHIStateCategory::PrimitiveTopology, changed);
+    }
+
+    bool RHIStateCache::SetGraphicsRootParameter(u32 rootIndex, RHIRootParameterKind kind, u64 value)
+    {
+        return SetRootParameter(m_GraphicsRootParameters, RHIStateCategory::GraphicsRootParameter,
+                                rootIndex, kind, value);
+    }
+
+    bool RHIStateCache::SetComputeRootParameter(u32 rootIndex, RHIRootParameterKind kind, u64 value)
+    {
+        return SetRootParameter(m_ComputeRootParameters, RHIStateCategory::ComputeRootParameter,
+                                rootIndex, kind, value);
+    }
+
+    bool RHIStateCache::SetRootParameter(RootParameterTable& table, RHIStateCategory category,
+                                         u32 rootIndex, RHIRootParameterKind kind, u64 value)
+    {
+        if (rootIndex >= MAX_ROOT_PARAMETERS)
+        {
+            return Record(category, true);
+        }
+
+        RootParameterBinding& binding = table[rootIndex];
+        bool changed = binding.kind != kind || binding.value != value;
+
+        binding.kind = kind;
+        binding.value = value;
+        return Record(category, changed);
+    }
+
+    void RHIStateCache::InvalidateDescriptorTables(RootParameterTable& table)
+    {
+        for (auto& binding : table)
+        {
+            if (binding.kind == RHIRootParameterKind::DescriptorTable)
+            {
+                binding = {};
+            }
+        }
+    }
+
+} // namespace Sea
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <array>
+#include <span>
+
+namespace Sea
+{
+    //=============================================================================
+    // RHIStateCache - 冗余状态过滤
+    //=============================================================================
+
+    //! 被缓存的状态类别（用于统计）
+    enum class RHIStateCategory : u32
+    {
+        PipelineState = 0,
+        GraphicsRootSignature,
+        ComputeRootSignature,
+        DescriptorHeaps,
+        VertexBuffer,
+        IndexBuffer,
+        PrimitiveTopology,
+        GraphicsRootParameter,
+        ComputeRootParameter,
+        Count
+    };
+
+    //! 返回状态类别名称（用于 UI / 日志）
+    const char* GetStateCategoryName(RHIStateCategory category);
+
+    //! 根参数绑定类型
+    enum class RHIRootParameterKind : u8
+    {
+        None = 0,
+        CBV,
+        SRV,
+        UAV,
+        DescriptorTable
+    };
+
+    //! 每个类别提交 / 过滤的调用次数
+    struct RHIStateCacheStats
+    {
+        std::array<u32, static_cast<u32>(RHIStateCategory::Count)> issued = {};
+        std::array<u32, static_cast<u32>(RHIStateCategory::Count)> filtered = {};
+
+        u32 GetIssued(RHIStateCategory category) const { return issued[static_cast<u32>(category)]; }
+        u32 GetFiltered(RHIStateCategory category) const { return filtered[static_cast<u32>(category)]; }
+        u32 GetTotalIssued() const;
+        u32 GetTotalFiltered() const;
+
+        void Reset() { issued = {}; filtered = {}; }
+    };
+
+    //! 平台无关的命令列表状态缓存
+    //! 每个 Set* 返回 true 表示状态发生了变化、需要转发给底层 API；
+    //! 返回 false 表示与当前绑定完全相同，调用可以丢弃。
+    //! 对象以不透明指针 / GPU 地址标识，因此 DX12 包装层和 RHI 层可以共用。
+    class RHIStateCache
+    {
+    public:
+        static constexpr u32 MAX_VERTEX_BUFFER_SLOTS = 16;
+        static constexpr u32 MAX_ROOT_PARAMETERS = 64;     // D3D12 根签名最多 64 DWORD
+        static constexpr u32 MAX_DESCRIPTOR_HEAPS = 2;     // CBV_SRV_UAV + Sampler
+        static constexpr u32 UNKNOWN_TOPOLOGY = ~0u;
+
+        RHIStateCache() { Invalidate(); }
+
+        //! 忘记所有已绑定状态（命令列表 Reset、或外部绕过缓存直接录制之后调用）
+        void Invalidate();
+
+        //! 关闭后所有调用都会被转发，只计数不过滤（便于对比）
+        void SetEnabled(bool enabled) { m_Enabled = enabled; if (!enabled) Invalidate(); }
+        bool IsEnabled() const { return m_Enabled; }
+
+        // 管线状态 / 根签名
+        bool SetPipelineState(const void* pso);
+        bool SetGraphicsRootSignature(const void* rootSig);
+        bool SetComputeRootSignature(const void* rootSig);
+
+        // 描述符堆（顺序无关）
+        bool SetDescriptorHeaps(std::span<const void* const> heaps);
+
+        // 输入装配
+        bool SetVertexBuffer(u32 slot, u64 gpuAddress, u32 sizeInBytes, u32 strideInBytes);
+        bool SetIndexBuffer(u64 gpuAddress, u32 sizeInBytes, u32 format);
+        bool SetPrimitiveTopology(u32 topology);
+
+        // 根参数（CBV/SRV/UAV 为 GPU 地址，描述符表为 GPU 句柄）
+        bool SetGraphicsRootParameter(u32 rootIndex, RHIRootParameterKind kind, u64 value);
+        bool SetComputeRootParameter(u32 rootIndex, RHIRootParameterKind kind, u64 value);
+
+        const RHIStateCacheStats& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats.Reset(); }
+
+    private:
+        struct RootParameterBinding
+        {
+            u64 value = 0;
+            RHIRootParameterKind kind = RHIRootParameterKind::None;
+        };
+        using RootParameterTable = std::array<RootParameterBinding, MAX_ROOT_PARAMETERS>;
+
+        struct VertexBufferBinding
+        {
+            u64 gpuAddress = 0;
+            u32 sizeInBytes = 0;
+            u32 strideInBytes = 0;
+            bool valid = false;
+        };
+
+        bool Record(RHIStateCategory category, bool changed);
+        bool SetRootParameter(RootParameterTable& table, RHIStateCategory category,
+                              u32 rootIndex, RHIRootParameterKind kind, u64 value);
+        static void InvalidateDescriptorTables(RootParameterTable& table);
+
+        bool m_Enabled = true;
+
+        const void* m_PipelineState = nullptr;
+        const void* m_GraphicsRootSignature = nullptr;
+        const void* m_ComputeRootSignature = nullptr;
+
+        std::array<const void*, MAX_DESCRIPTOR_HEAPS> m_DescriptorHeaps = {};
+        u32 m_DescriptorHeapCount = 0;
+        bool m_DescriptorHeapsValid = false;
+
+        std::array<VertexBufferBinding, MAX_VERTEX_BUFFER_SLOTS> m_VertexBuffers = {};
+
+        u64 m_IndexBufferAddress = 0;
+        u32 m_IndexBufferSize = 0;
+        u32 m_IndexBufferFormat = 0;
+        bool m_IndexBufferValid = false;
+
+        u32 m_PrimitiveTopology = UNKNOWN_TOPOLOGY;
+
+        RootParameterTable m_GraphicsRootParameters = {};
+        RootParameterTable m_ComputeRootParameters = {};
+
+        RHIStateCacheStats m_Stats;
+    };
+
+} // namespace Sea
@@ -0,0 +1,144 @@
+#include "RHI/RHIStateFilterCommandList.h"
+
+namespace Sea
+{
+    void RHIStateFilterCommandList::Reset()
+    {
+        m_Inner.Reset();
+        m_StateCache.Invalidate();
+    }
+
+    void RHIStateFilterCommandList::SetPipelineState(RHIPipelineState* pso)
+    {
+        if (m_StateCache.SetPipelineState(pso))
+        {
+            m_Inner.SetPipelineState(pso);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetGraphicsRootSignature(RHIRootSignature* rootSig)
+    {
+        if (m_StateCache.SetGraphicsRootSignature(rootSig))
+        {
+            m_Inner.SetGraphicsRootSignature(rootSig);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetComputeRootSignature(RHIRootSignature* rootSig)
+    {
+        if (m_StateCache.SetComputeRootSignature(rootSig))
+        {
+            m_Inner.SetComputeRootSignature(rootSig);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetDescriptorHeaps(std::span<RHIDescriptorHeap*> heaps)
+    {
+        std::array<const void*, RHIStateCache::MAX_DESCRIPTOR_HEAPS> keys = {};
+        if (heaps.size() <= keys.size())
+        {
+            for (size_t i = 0; i < heaps.size(); ++i)
+            {
+                keys[i] = heaps[i];
+            }
+            if (!m_StateCache.SetDescriptorHeaps(std::span<const void* const>(keys.data(), heaps.size())))
+            {
+                return;
+            }
+        }
+        else
+        {
+            m_StateCache.Invalidate();
+        }
+        m_Inner.SetDescriptorHeaps(heaps);
+    }
+
+    void RHIStateFilterCommandList::SetGraphicsRootCBV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::CBV, gpuAddress))
+        {
+            m_Inner.SetGraphicsRootCBV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetGraphicsRootSRV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::SRV, gpuAddress))
+        {
+            m_Inner.SetGraphicsRootSRV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetGraphicsRootUAV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::UAV, gpuAddress))
+        {
+            m_Inner.SetGraphicsRootUAV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetGraphicsRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle baseHandle)
+    {
+        if (m_StateCache.SetGraphicsRootParameter(rootIndex, RHIRootParameterKind::DescriptorTable, baseHandle.gpuHandle))
+        {
+            m_Inner.SetGraphicsRootDescriptorTable(rootIndex, baseHandle);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetComputeRootCBV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::CBV, gpuAddress))
+        {
+            m_Inner.SetComputeRootCBV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetComputeRootSRV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::SRV, gpuAddress))
+        {
+            m_Inner.SetComputeRootSRV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetComputeRootUAV(u32 rootIndex, u64 gpuAddress)
+    {
+        if (m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::UAV, gpuAddress))
+        {
+            m_Inner.SetComputeRootUAV(rootIndex, gpuAddress);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetComputeRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle baseHandle)
+    {
+        if (m_StateCache.SetComputeRootParameter(rootIndex, RHIRootParameterKind::DescriptorTable, baseHandle.gpuHandle))
+        {
+            m_Inner.SetComputeRootDescriptorTable(rootIndex, baseHandle);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetVertexBuffer(u32 slot, const RHIVertexBufferView& view)
+    {
+        if (m_StateCache.SetVertexBuffer(slot, view.gpuAddress, view.sizeInBytes, view.strideInBytes))
+        {
+            m_Inner.SetVertexBuffer(slot, view);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetIndexBuffer(const RHIIndexBufferView& view)
+    {
+        if (m_StateCache.SetIndexBuffer(view.gpuAddress, view.sizeInBytes, view.is32Bit ? 32u : 16u))
+        {
+            m_Inner.SetIndexBuffer(view);
+        }
+    }
+
+    void RHIStateFilterCommandList::SetPrimitiveTopology(RHIPrimitiveTopology topology)
+    {
+        if (m_StateCache.SetPrimitiveTopology(static_cast<u32>(topology)))
+        {
+            m_Inner.SetPrimitiveTopology(topology);
+        }
+    }
+
+} // namespace Sea
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "RHI/RHICommandList.h"
+#include "RHI/RHIStateCache.h"
+
+namespace Sea
+{
+    //=============================================================================
+    // RHIStateFilterCommandList - 冗余状态过滤装饰器
+    //=============================================================================
+    //! 包装任意 RHICommandList 后端，丢弃与当前绑定完全相同的
+    //! PSO / 根签名 / 描述符堆 / VB / IB / 拓扑 / 根参数设置。
+    //! 其余命令原样转发。后端只会收到真正改变状态的调用，
+    //! 因此可以用一个记录调用的 mock 后端在任意平台上验证过滤结果。
+    class RHIStateFilterCommandList : public RHICommandList
+    {
+    public:
+        explicit RHIStateFilterCommandList(RHICommandList& inner) : m_Inner(inner) {}
+        ~RHIStateFilterCommandList() override = default;
+
+        //! 被包装的后端命令列表
+        RHICommandList& GetInner() { return m_Inner; }
+
+        //! 过滤统计与缓存控制
+        RHIStateCache& GetStateCache() { return m_StateCache; }
+        const RHIStateCacheStats& GetStats() const { return m_StateCache.GetStats(); }
+
+        //! 外部直接对后端录制命令之后必须调用
+        void InvalidateState() { m_StateCache.Invalidate(); }
+
+        void Reset() override;
+        void Close() override { m_Inner.Close(); }
+
+        //=========================================================================
+        // Resource Barriers
+        //=========================================================================
+        void TransitionBarrier(RHITexture* resource, RHIResourceState before, RHIResourceState after) override
+        {
+            m_Inner.TransitionBarrier(resource, before, after);
+        }
+        void TransitionBarrier(RHIBuffer* resource, RHIResourceState before, RHIResourceState after) override
+        {
+            m_Inner.TransitionBarrier(resource, before, after);
+        }
+        void UAVBarrier(RHIResource* resource) override { m_Inner.UAVBarrier(resource); }
+        void FlushBarriers() override { m_Inner.FlushBarriers(); }
+
+        //=========================================================================
+        // Clear Operations
+        //=========================================================================
+        void ClearRenderTarget(RHIDescriptorHandle rtv, const f32 color[4]) override
+        {
+            m_Inner.ClearRenderTarget(rtv, color);
+        }
+        void ClearDepthStencil(RHIDescriptorHandle dsv, f32 depth, u8 stencil = 0) override
+        {
+            m_Inner.ClearDepthStencil(dsv, depth, stencil);
+        }
+
+        //=========================================================================
+        // Render State
+        //=========================================================================
+        void SetRenderTargets(std::span<RHIDescriptorHandle> rtvs,
+                              const RHIDescriptorHandle* dsv = nullptr) override
+        {
+            m_Inner.SetRenderTargets(rtvs, dsv);
+        }
+        void SetViewport(const RHIViewport& viewport) override { m_Inner.SetViewport(viewport); }
+        void SetScissorRect(const RHIScissorRect& rect) override { m_Inner.SetScissorRect(rect); }
+
+        void SetPipelineState(RHIPipelineState* pso) override;
+        void SetGraphicsRootSignature(RHIRootSignature* rootSig) override;
+        void SetComputeRootSignature(RHIRootSignature* rootSig) override;
+        void SetDescriptorHeaps(std::span<RHIDescriptorHeap*> heaps) override;
+
+        //=========================================================================
+        // Root Parameters
+        //=========================================================================
+
+        //! 根常量是按值写入的，不做过滤
+        void SetGraphicsRootConstant(u32 rootIndex, u32 value, u32 offset) override
+        {
+            m_Inner.SetGraphicsRootConstant(rootIndex, value, offset);
+        }
+        void SetGraphicsRootConstants(u32 rootIndex, const void* data, u32 count) override
+        {
+            m_Inner.SetGraphicsRootConstants(rootIndex, data, count);
+        }
+        void SetGraphicsRootCBV(u32 rootIndex, u64 gpuAddress) override;
+        void SetGraphicsRootSRV(u32 rootIndex, u64 gpuAddress) override;
+        void SetGraphicsRootUAV(u32 rootIndex, u64 gpuAddress) override;
+        void SetGraphicsRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle baseHandle) override;
+
+        void SetComputeRootConstant(u32 rootIndex, u32 value, u32 offset) override
+        {
+            m_Inner.SetComputeRootConstant(rootIndex, value, offset);
+        }
+        void SetComputeRootConstants(u32 rootIndex, const void* data, u32 count) override
+        {
+            m_Inner.SetComputeRootConstants(rootIndex, data, count);
+        }
+        void SetComputeRootCBV(u32 rootIndex, u64 gpuAddress) override;
+        void SetComputeRootSRV(u32 rootIndex, u64 gpuAddress) override;
+        void SetComputeRootUAV(u32 rootIndex, u64 gpuAddress) override;
+        void SetComputeRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle baseHandle) override;
+
+        //=========================================================================
+        // Input Assembly
+        //=========================================================================
+        void SetVertexBuffer(u32 slot, const RHIVertexBufferView& view) override;
+        void SetIndexBuffer(const RHIIndexBufferView& view) override;
+        void SetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+
+        //=========================================================================
+        // Draw / Compute / Copy Commands
+        //=========================================================================
+        void Draw(u32 vertexCount, u32 instanceCount = 1,
+                  u32 startVertex = 0, u32 startInstance = 0) override
+        {
+            m_Inner.Draw(vertexCount, instanceCount, startVertex, startInstance);
+        }
+        void DrawIndexed(u32 indexCount, u32 instanceCount = 1,
+                         u32 startIndex = 0, i32 baseVertex = 0,
+                         u32 startInstance = 0) override
+        {
+            m_Inner.DrawIndexed(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+        }
+        void Dispatch(u32 groupCountX, u32 groupCountY, u32 groupCountZ) override
+        {
+            m_Inner.Dispatch(groupCountX, groupCountY, groupCountZ);
+        }
+        void CopyBuffer(RHIBuffer* dest, RHIBuffer* src) override { m_Inner.CopyBuffer(dest, src); }
+        void CopyBufferRegion(RHIBuffer* dest, u64 destOffset,
+                              RHIBuffer* src, u64 srcOffset, u64 size) override
+        {
+            m_Inner.CopyBufferRegion(dest, destOffset, src, srcOffset, size);
+        }
+        void CopyTexture(RHITexture* dest, RHITexture* src) override { m_Inner.CopyTexture(dest, src); }
+        void CopyTextureRegion(RHITexture* dest, u32 destX, u32 destY, u32 destZ,
+                               RHITexture* src, const RHISubResource* srcSubresource = nullptr) override
+        {
+            m_Inner.CopyTextureRegion(dest, destX, destY, destZ, src, srcSubresource);
+        }
+
+        //=========================================================================
+        // Debug Markers
+        //=========================================================================
+        void BeginEvent(const char* name) override { m_Inner.BeginEvent(name); }
+        void EndEvent() override { m_Inner.EndEvent(); }
+        void SetMarker(const char* name) override { m_Inner.SetMarker(name); }
+
+    private:
+        RHICommandList& m_Inner;
+        RHIStateCache m_StateCache;
+    };
+
+} // namespace Sea
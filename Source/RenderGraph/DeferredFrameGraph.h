@@ -44,6 +44,7 @@ namespace Sea
     //=============================================================================
     // Shadow Map Data
     //=============================================================================
+    //! 每级联的视图/投影与剔除由 Scene/CascadedShadows 计算（默认值与其一致）
     struct ShadowMapData
     {
         FrameGraphResourceHandle cascadedShadowMap;
@@ -0,0 +1,115 @@
+#include "Scene/AsyncMeshLoader.h"
+#include "Scene/MeshCooker.h"
+#include "Core/Log.h"
+#include <chrono>
+#include <filesystem>
+
+namespace Sea
+{
+    namespace
+    {
+        // OBJ 文本解析时的峰值内存约为文件大小的两倍（文本映射 + 去重后的顶点 / 索引 + 优化用的暂存数组）
+        constexpr u64 OBJ_MEMORY_FACTOR = 2;
+
+        u64 EstimateLoadBytes(const std::string& filepath)
+        {
+            std::error_code ec;
+            const std::filesystem::path cookedPath = GetCookedMeshPath(filepath);
+            if (std::filesystem::exists(cookedPath, ec))
+            {
+                const u64 size = std::filesystem::file_size(cookedPath, ec);
+                if (!ec)
+                    return size;
+            }
+
+            const u64 size = std::filesystem::file_size(filepath, ec);
+            return ec ? 0 : size * OBJ_MEMORY_FACTOR;
+        }
+
+        struct OBJLoadTask : public MeshLoadTask
+        {
+            std::string filepath;
+            MeshUploadOptions options;
+            MeshLoadCallback callback;
+            MeshUploadData data;
+
+            bool Prepare() override
+            {
+                auto startTime = std::chrono::high_resolution_clock::now();
+                const bool success = Mesh::PrepareOBJ(filepath, options, data, &cancelled);
+                auto endTime = std::chrono::high_resolution_clock::now();
+
+                if (!cancelled)
+                {
+                    SEA_CORE_INFO("Prepared mesh {} on loader thread in {:.2f} ms", filepath,
+                                  std::chrono::duration<f64, std::milli>(endTime - startTime).count());
+                }
+                return success;
+            }
+
+            u64 GetResidentBytes() const override { return data.GetUploadSize(); }
+        };
+    }
+
+    MeshLoadId AsyncMeshLoader::Load(const std::string& filepath, const MeshUploadOptions& options,
+                                     MeshLoadCallback callback, MeshLoadPriority priority)
+    {
+        auto task = MakeRef<OBJLoadTask>();
+        task->filepath = filepath;
+        task->options = options;
+        task->callback = std::move(callback);
+        return m_Scheduler.Submit(task, priority, EstimateLoadBytes(filepath));
+    }
+
+    u32 AsyncMeshLoader::Update(Device& device, u64 uploadBudget)
+    {
+        std::vector<Ref<MeshLoadTask>> batch;
+        m_Scheduler.AcquireReady(uploadBudget, batch);
+
+        u32 completed = 0;
+        for (const auto& entry : batch)
+        {
+            auto& task = static_cast<OBJLoadTask&>(*entry);
+
+            // 前面请求的回调可能取消了后面的请求
+            if (task.cancelled)
+            {
+                m_Scheduler.Finish(task, false);
+                continue;
+            }
+
+            Scope<Mesh> mesh;
+            if (task.success)
+            {
+                auto startTime = std::chrono::high_resolution_clock::now();
+                mesh = MakeScope<Mesh>();
+                if (!mesh->Upload(device, std::move(task.data)))
+                {
+                    mesh.reset();
+                }
+                else
+                {
+                    auto endTime = std::chrono::high_resolution_clock::now();
+                    SEA_CORE_INFO("Streamed mesh {}: {:.2f} MB uploaded in {:.2f} ms", task.filepath,
+                                  task.residentBytes / (1024.0 * 1024.0),
+                                  std::chrono::duration<f64, std::milli>(endTime - startTime).count());
+                }
+            }
+            task.data = MeshUploadData();
+
+            if (!mesh)
+            {
+                SEA_CORE_ERROR("Failed to load mesh: {}", task.filepath);
+            }
+
+            m_Scheduler.Finish(task, mesh != nullptr);
+            if (task.callback)
+            {
+                task.callback(task.id, std::move(mesh));
+            }
+            completed++;
+        }
+
+        return completed;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/Mesh.h"
+#include "Scene/MeshLoadScheduler.h"
+#include <functional>
+#include <string>
+
+namespace Sea
+{
+    class Device;
+
+    // 在主线程（Update 内）调用；mesh 为空表示加载失败，被取消的请求不会回调
+    using MeshLoadCallback = std::function<void(MeshLoadId id, Scope<Mesh> mesh)>;
+
+    // 后台网格加载：加载线程上跑 Mesh::PrepareOBJ（读取 / 解析 / 优化 / meshlet / LOD），
+    // 主线程每帧在 Update 中创建 GPU 缓冲并触发回调
+    // 排队、内存预算、取消与统计由 MeshLoadScheduler 负责，这里只负责 OBJ 的准备与上传
+    class AsyncMeshLoader : public NonCopyable
+    {
+    public:
+        static constexpr u64 DEFAULT_MEMORY_BUDGET = 512ull << 20;
+        static constexpr u64 DEFAULT_UPLOAD_BUDGET = 64ull << 20;
+
+        explicit AsyncMeshLoader(u64 memoryBudget = DEFAULT_MEMORY_BUDGET, u32 threadCount = 1)
+            : m_Scheduler(memoryBudget, threadCount)
+        {
+        }
+
+        MeshLoadId Load(const std::string& filepath, const MeshUploadOptions& options, MeshLoadCallback callback,
+                        MeshLoadPriority priority = MeshLoadPriority::Normal);
+
+        // 排队中的请求直接移除；读取中的请求在下一个阶段边界停下；已读完的直接丢弃
+        bool Cancel(MeshLoadId id) { return m_Scheduler.Cancel(id); }
+        void CancelAll() { m_Scheduler.CancelAll(); }
+        // 只对还在排队的请求有效
+        bool SetPriority(MeshLoadId id, MeshLoadPriority priority) { return m_Scheduler.SetPriority(id, priority); }
+
+        // 主线程每帧调用：上传已准备好的网格并触发回调，返回本帧完成的请求数
+        // 每帧最多上传 uploadBudget 字节（至少一个网格），避免一帧内拷贝过多数据造成卡顿
+        u32 Update(Device& device, u64 uploadBudget = DEFAULT_UPLOAD_BUDGET);
+
+        bool IsIdle() const { return m_Scheduler.IsIdle(); }
+        MeshLoaderStats GetStats() const { return m_Scheduler.GetStats(); }
+
+        void SetMemoryBudget(u64 bytes) { m_Scheduler.SetMemoryBudget(bytes); }
+        u64 GetMemoryBudget() const { return m_Scheduler.GetMemoryBudget(); }
+
+    private:
+        MeshLoadScheduler m_Scheduler;
+    };
+}
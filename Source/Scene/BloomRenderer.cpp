@@ -489,8 +489,6 @@ namespace Sea
         if (!m_Settings.Enabled)
             return;
 
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 更新常量缓冲区
         BloomConstants constants = {};
         constants.TexelSizeX = 1.0f / static_cast<float>(m_Width);
@@ -511,10 +509,10 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(BloomConstants));
 
         // 设置根签名和描述符堆
-        d3dCmdList->SetGraphicsRootSignature(m_RootSignature->GetRootSignature());
+        cmdList.SetGraphicsRootSignature(m_RootSignature.get());
         ID3D12DescriptorHeap* heaps[] = { m_SRVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_ConstantBuffer->GetGPUAddress());
+        cmdList.SetDescriptorHeaps(heaps);
+        cmdList.SetGraphicsRootCBV(0, m_ConstantBuffer->GetGPUAddress());
 
         // Pass 1: Threshold - 从场景提取高亮
         ThresholdPass(cmdList, inputSRV);
@@ -533,7 +531,7 @@ namespace Sea
         
         // 恢复描述符堆到默认 SRV 堆
         ID3D12DescriptorHeap* defaultHeaps[] = { m_SRVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, defaultHeaps);
+        cmdList.SetDescriptorHeaps(defaultHeaps);
 
         // 注意：不再调用 CompositePass
         // Bloom 结果通过 GetBloomResultSRV() 获取，在 Tonemapping 阶段合成
@@ -541,20 +539,13 @@ namespace Sea
 
     void BloomRenderer::ThresholdPass(CommandList& cmdList, D3D12_GPU_DESCRIPTOR_HANDLE inputSRV)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& target = m_DownsampleChain[0];
 
         // 转换目标到 RenderTarget
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = target.Resource.Get();
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::PixelShaderResource, ResourceState::RenderTarget);
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &target.RTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(target.RTV);
 
         // 更新 texel size
         BloomConstants constants = {};
@@ -575,40 +566,31 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(BloomConstants));
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(target.Width), static_cast<float>(target.Height), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(target.Width), static_cast<LONG>(target.Height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(target.Width), static_cast<f32>(target.Height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(target.Width), static_cast<i32>(target.Height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 绘制
-        d3dCmdList->SetPipelineState(m_ThresholdPSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, inputSRV);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetPipelineState(m_ThresholdPSO.get());
+        cmdList.SetGraphicsRootDescriptorTable(1, inputSRV);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
 
         // 转换回 ShaderResource
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::RenderTarget, ResourceState::PixelShaderResource);
     }
 
     void BloomRenderer::DownsamplePass(CommandList& cmdList, u32 mipLevel)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& source = m_DownsampleChain[mipLevel - 1];
         auto& target = m_DownsampleChain[mipLevel];
 
         // 转换目标到 RenderTarget
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = target.Resource.Get();
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::PixelShaderResource, ResourceState::RenderTarget);
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &target.RTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(target.RTV);
 
         // 更新 texel size
         BloomConstants constants = {};
@@ -629,26 +611,23 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(BloomConstants));
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(target.Width), static_cast<float>(target.Height), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(target.Width), static_cast<LONG>(target.Height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(target.Width), static_cast<f32>(target.Height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(target.Width), static_cast<i32>(target.Height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 绘制
-        d3dCmdList->SetPipelineState(m_DownsamplePSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, source.SRV);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetPipelineState(m_DownsamplePSO.get());
+        cmdList.SetGraphicsRootDescriptorTable(1, source.SRV);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
 
         // 转换回 ShaderResource
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::RenderTarget, ResourceState::PixelShaderResource);
     }
 
     void BloomRenderer::UpsamplePass(CommandList& cmdList, u32 mipLevel)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& target = m_UpsampleChain[mipLevel];
         
         // 低分辨率源的尺寸（用于 texel size）
@@ -668,16 +647,10 @@ namespace Sea
         }
 
         // 转换目标到 RenderTarget
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = target.Resource.Get();
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::PixelShaderResource, ResourceState::RenderTarget);
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &target.RTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(target.RTV);
 
         // 更新 texel size (使用低分辨率源纹理尺寸)
         BloomConstants constants = {};
@@ -700,27 +673,25 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(BloomConstants));
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(target.Width), static_cast<float>(target.Height), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(target.Width), static_cast<LONG>(target.Height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(target.Width), static_cast<f32>(target.Height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(target.Width), static_cast<i32>(target.Height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 使用 Upsample 专用 SRV 堆和 SRV 对
         ID3D12DescriptorHeap* heaps[] = { m_UpsampleSRVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
+        cmdList.SetDescriptorHeaps(heaps);
         
         // 绘制
-        d3dCmdList->SetPipelineState(m_UpsamplePSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_ConstantBuffer->GetGPUAddress());
+        cmdList.SetPipelineState(m_UpsamplePSO.get());
+        cmdList.SetGraphicsRootCBV(0, m_ConstantBuffer->GetGPUAddress());
         // 使用预先创建的 SRV 对 (t0=lowRes, t1=highRes)
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, m_UpsampleSRVPairs[mipLevel]);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetGraphicsRootDescriptorTable(1, m_UpsampleSRVPairs[mipLevel]);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
 
         // 转换回 ShaderResource
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(target.Resource.Get(), ResourceState::RenderTarget, ResourceState::PixelShaderResource);
     }
 
     void BloomRenderer::CompositePass(CommandList& cmdList, 
@@ -729,19 +700,11 @@ namespace Sea
                                        ID3D12Resource* outputResource,
                                        u32 outputWidth, u32 outputHeight)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 转换输出到 RenderTarget
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = outputResource;
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(outputResource, ResourceState::Present, ResourceState::RenderTarget);
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &outputRTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(outputRTV);
 
         // 更新常量
         BloomConstants constants = {};
@@ -762,20 +725,18 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(BloomConstants));
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(outputWidth), static_cast<float>(outputHeight), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(outputWidth), static_cast<LONG>(outputHeight) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(outputWidth), static_cast<f32>(outputHeight), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(outputWidth), static_cast<i32>(outputHeight) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 绘制 (使用最终 upsample 结果作为 bloom)
-        d3dCmdList->SetPipelineState(m_CompositePSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, m_UpsampleChain[0].SRV);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetPipelineState(m_CompositePSO.get());
+        cmdList.SetGraphicsRootDescriptorTable(1, m_UpsampleChain[0].SRV);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
 
         // 转换回 Present
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(outputResource, ResourceState::RenderTarget, ResourceState::Present);
     }
 }
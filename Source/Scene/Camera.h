@@ -38,6 +38,7 @@ namespace Sea
         XMFLOAT4X4 GetViewProjectionMatrix() const;
 
         f32 GetFOV() const { return m_FOV; }
+        f32 GetAspectRatio() const { return m_AspectRatio; }
         f32 GetNearZ() const { return m_NearZ; }
         f32 GetFarZ() const { return m_FarZ; }
 
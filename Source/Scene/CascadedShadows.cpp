@@ -0,0 +1,112 @@
+#include "Scene/CascadedShadows.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Sea
+{
+    void ComputeCascadeSplits(f32 nearZ, f32 farZ, u32 count, f32 lambda, f32* outSplits)
+    {
+        outSplits[0] = nearZ;
+        for (u32 i = 1; i < count; ++i)
+        {
+            f32 t = static_cast<f32>(i) / static_cast<f32>(count);
+            f32 logSplit = nearZ * std::pow(farZ / nearZ, t);
+            f32 uniformSplit = nearZ + (farZ - nearZ) * t;
+            outSplits[i] = lambda * logSplit + (1.0f - lambda) * uniformSplit;
+        }
+        outSplits[count] = farZ;
+    }
+
+    void CascadedShadows::SetSettings(const CascadedShadowSettings& settings)
+    {
+        m_Settings = settings;
+        m_Settings.cascadeCount = std::clamp(settings.cascadeCount, 1u, MAX_CASCADES);
+        m_Settings.shadowMapSize = std::max(1u, settings.shadowMapSize);
+    }
+
+    void CascadedShadows::Update(const Camera& camera, const XMFLOAT3& lightDirection)
+    {
+        const u32 count = m_Settings.cascadeCount;
+        const f32 nearZ = camera.GetNearZ();
+        const f32 farZ = std::max(nearZ + 0.001f, std::min(camera.GetFarZ(), m_Settings.maxShadowDistance));
+
+        f32 splits[MAX_CASCADES + 1];
+        ComputeCascadeSplits(nearZ, farZ, count, m_Settings.splitLambda, splits);
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_Cascades[i].splitNear = splits[i];
+            m_Cascades[i].splitFar = splits[i + 1];
+            FitCascade(m_Cascades[i], camera, lightDirection);
+        }
+    }
+
+    void CascadedShadows::FitCascade(ShadowCascade& cascade, const Camera& camera, const XMFLOAT3& lightDirection) const
+    {
+        const XMVECTOR position = XMLoadFloat3(&camera.GetPosition());
+        const XMVECTOR forward = XMLoadFloat3(&camera.GetForward());
+        const XMVECTOR right = XMLoadFloat3(&camera.GetRight());
+        const XMVECTOR up = XMLoadFloat3(&camera.GetUp());
+
+        const f32 tanHalfY = std::tan(XMConvertToRadians(camera.GetFOV()) * 0.5f);
+        const f32 tanHalfX = tanHalfY * camera.GetAspectRatio();
+
+        // 切片的 8 个角点
+        XMVECTOR corners[8];
+        u32 cornerIndex = 0;
+        for (f32 depth : { cascade.splitNear, cascade.splitFar })
+        {
+            XMVECTOR planeCenter = XMVectorMultiplyAdd(forward, XMVectorReplicate(depth), position);
+            XMVECTOR dx = XMVectorScale(right, depth * tanHalfX);
+            XMVECTOR dy = XMVectorScale(up, depth * tanHalfY);
+            corners[cornerIndex++] = planeCenter - dx - dy;
+            corners[cornerIndex++] = planeCenter + dx - dy;
+            corners[cornerIndex++] = planeCenter - dx + dy;
+            corners[cornerIndex++] = planeCenter + dx + dy;
+        }
+
+        XMVECTOR center = XMVectorZero();
+        for (const auto& corner : corners)
+        {
+            center = center + corner;
+        }
+        center = XMVectorScale(center, 1.0f / 8.0f);
+
+        f32 radius = 0.0f;
+        for (const auto& corner : corners)
+        {
+            radius = std::max(radius, XMVectorGetX(XMVector3Length(corner - center)));
+        }
+        // 取整到 1/16，避免浮点抖动改变投影尺寸
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        const f32 mapSize = static_cast<f32>(m_Settings.shadowMapSize);
+        cascade.radius = radius;
+        cascade.texelSize = (radius * 2.0f) / mapSize;
+
+        // 光源视图：方向固定，只随包围球中心平移
+        XMVECTOR lightDir = XMVector3Normalize(XMLoadFloat3(&lightDirection));
+        XMVECTOR lightUp = (std::abs(XMVectorGetY(lightDir)) > 0.99f) ? XMVectorSet(0, 0, 1, 0) : XMVectorSet(0, 1, 0, 0);
+        const f32 backDistance = radius + m_Settings.casterExtension;
+        XMVECTOR eye = center - XMVectorScale(lightDir, backDistance);
+
+        XMMATRIX view = XMMatrixLookAtLH(eye, center, lightUp);
+        XMMATRIX proj = XMMatrixOrthographicOffCenterLH(-radius, radius, -radius, radius, 0.0f, backDistance + radius);
+
+        // texel 对齐：把世界原点投影到阴影贴图上，取整到整 texel 后把偏移补回投影矩阵
+        XMVECTOR origin = XMVector3TransformCoord(XMVectorZero(), view * proj);
+        const f32 halfSize = mapSize * 0.5f;
+        f32 originX = XMVectorGetX(origin) * halfSize;
+        f32 originY = XMVectorGetY(origin) * halfSize;
+        XMFLOAT4X4 projSnapped;
+        XMStoreFloat4x4(&projSnapped, proj);
+        projSnapped._41 += (std::round(originX) - originX) / halfSize;
+        projSnapped._42 += (std::round(originY) - originY) / halfSize;
+        proj = XMLoadFloat4x4(&projSnapped);
+
+        XMStoreFloat4x4(&cascade.view, view);
+        XMStoreFloat4x4(&cascade.projection, proj);
+        XMStoreFloat4x4(&cascade.viewProjection, view * proj);
+        cascade.frustum.SetFromViewProjection(cascade.viewProjection);
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/Camera.h"
+#include "Scene/Frustum.h"
+#include <DirectXMath.h>
+#include <array>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 与 DeferredFrameGraph 的 ShadowMapData 默认值一致
+    struct CascadedShadowSettings
+    {
+        u32 cascadeCount = 4;
+        u32 shadowMapSize = 2048;
+        f32 splitLambda = 0.75f;            // 0 = 均匀划分，1 = 对数划分（PSSM 混合）
+        f32 maxShadowDistance = 200.0f;     // 阴影覆盖的最远距离（会被相机远平面截断）
+        f32 casterExtension = 100.0f;       // 沿光线反方向延伸近平面，收录视锥外的投影物
+    };
+
+    struct ShadowCascade
+    {
+        XMFLOAT4X4 view;
+        XMFLOAT4X4 projection;              // 已做 texel 对齐
+        XMFLOAT4X4 viewProjection;
+        f32 splitNear = 0.0f;
+        f32 splitFar = 0.0f;
+        f32 radius = 0.0f;                  // 包围球半径，只取决于切片形状，相机旋转时不变
+        f32 texelSize = 0.0f;               // 世界空间下一个阴影贴图 texel 的尺寸
+        Frustum frustum;
+    };
+
+    // 级联阴影视图计算
+    // - 切分：对数与均匀划分按 lambda 混合
+    // - 每级使用切片包围球拟合正交投影，尺寸与相机朝向无关
+    // - 投影原点按 texel 对齐，相机平移时阴影边缘不闪烁
+    // 只依赖 DirectXMath，宿主机单元测试见 Tests/Scene/CascadedShadowsTests.cpp
+    class CascadedShadows
+    {
+    public:
+        static constexpr u32 MAX_CASCADES = 8;
+
+        void SetSettings(const CascadedShadowSettings& settings);
+        const CascadedShadowSettings& GetSettings() const { return m_Settings; }
+
+        // lightDirection 为光线传播方向（从光源指向场景）
+        void Update(const Camera& camera, const XMFLOAT3& lightDirection);
+
+        u32 GetCascadeCount() const { return m_Settings.cascadeCount; }
+        const ShadowCascade& GetCascade(u32 index) const { return m_Cascades[index]; }
+
+    private:
+        void FitCascade(ShadowCascade& cascade, const Camera& camera, const XMFLOAT3& lightDirection) const;
+
+    private:
+        CascadedShadowSettings m_Settings;
+        std::array<ShadowCascade, MAX_CASCADES> m_Cascades = {};
+    };
+
+    // 计算 count 级的切分距离，outSplits 需要 count + 1 个元素（首尾分别为 nearZ / farZ）
+    void ComputeCascadeSplits(f32 nearZ, f32 farZ, u32 count, f32 lambda, f32* outSplits);
+}
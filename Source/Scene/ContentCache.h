@@ -0,0 +1,246 @@
+#pragma once
+
+#include "Core/Hash.h"
+#include "Core/Log.h"
+#include "Core/Types.h"
+#include <filesystem>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sea
+{
+    struct ContentCacheStats
+    {
+        u32 entryCount = 0;
+        u32 referencedCount = 0;    // 引用计数 > 0 的条目，不会被淘汰
+        u64 residentBytes = 0;      // 缓存中条目占用的内存（含无引用的）
+        u64 insertedBytes = 0;      // 累计放入缓存的字节数
+        u64 hits = 0;
+        u64 misses = 0;
+        u64 duplicates = 0;         // 不同路径加载出相同内容，复用已有条目
+        u64 evictions = 0;
+        u64 evictedBytes = 0;
+    };
+
+    // 内容寻址、带引用计数的资源缓存（与设备无关，MeshCache 以 Mesh 实例化）
+    // 键 = 源文件内容哈希 + variant（同一内容的不同派生版本，例如上传选项），不同路径下的相同文件只保留一份
+    // 路径到内容哈希的映射按文件大小与修改时间校验，文件改动后重新加载
+    // 引用计数归零的条目仍留在缓存中，超出预算时按 LRU 淘汰；
+    // 淘汰的条目再等 RETIRE_FRAMES 帧才销毁，保证在途的命令列表不再引用它的缓冲
+    template<typename T>
+    class ContentCache : public NonCopyable
+    {
+    public:
+        static constexpr u32 RETIRE_FRAMES = 3;     // 不少于同时在途的帧数（交换链缓冲数）
+
+        explicit ContentCache(u64 memoryBudget)
+            : m_MemoryBudget(memoryBudget)
+        {
+        }
+
+        // 路径的内容已知且仍在缓存中时增加引用并返回条目，否则返回 nullptr（计一次 miss，需要加载）
+        T* Acquire(const std::string& filepath, u64 variant)
+        {
+            auto path = m_Paths.find(filepath);
+            if (path != m_Paths.end())
+            {
+                u64 fileSize = 0;
+                std::filesystem::file_time_type writeTime;
+                if (!GetFileInfo(filepath, fileSize, writeTime) ||
+                    fileSize != path->second.fileSize || writeTime != path->second.writeTime)
+                {
+                    // 文件被修改或删除，内容哈希失效
+                    m_Paths.erase(path);
+                }
+                else
+                {
+                    auto entry = m_Entries.find(MakeKey(path->second.sourceHash, variant));
+                    if (entry != m_Entries.end())
+                    {
+                        AddRef(entry->second);
+                        m_Stats.hits++;
+                        return entry->second.item.get();
+                    }
+                }
+            }
+
+            m_Stats.misses++;
+            return nullptr;
+        }
+
+        // 放入加载完成的条目并返回它（带一个引用）；相同内容已在缓存中时丢弃 item，返回已有的条目
+        // sourceHash 为 0（读不到内容哈希）时退化为按路径寻址
+        T* Insert(const std::string& filepath, u64 variant, u64 sourceHash, u64 bytes, Scope<T> item)
+        {
+            if (!item)
+                return nullptr;
+
+            if (sourceHash == 0)
+                sourceHash = HashBytes(filepath.data(), filepath.size());
+
+            PathInfo info;
+            info.sourceHash = sourceHash;
+            if (GetFileInfo(filepath, info.fileSize, info.writeTime))
+                m_Paths[filepath] = info;
+
+            const Key key = MakeKey(sourceHash, variant);
+            auto existing = m_Entries.find(key);
+            if (existing != m_Entries.end())
+            {
+                // 新条目还没有被任何命令列表引用，可以直接销毁
+                AddRef(existing->second);
+                m_Stats.duplicates++;
+                SEA_CORE_INFO("Content cache: {} has the same content as a cached entry, reusing it", filepath);
+                return existing->second.item.get();
+            }
+
+            Entry& entry = m_Entries[key];
+            entry.bytes = bytes;
+            entry.refCount = 1;
+            entry.item = std::move(item);
+            m_ItemKeys[entry.item.get()] = key;
+
+            m_Stats.residentBytes += entry.bytes;
+            m_Stats.insertedBytes += entry.bytes;
+            return entry.item.get();
+        }
+
+        void Release(const T* item)
+        {
+            auto it = m_ItemKeys.find(item);
+            if (it == m_ItemKeys.end())
+                return;
+
+            Entry& entry = m_Entries.at(it->second);
+            if (entry.refCount == 0)
+            {
+                SEA_CORE_WARN("Content cache: releasing an entry that is not referenced");
+                return;
+            }
+
+            if (--entry.refCount == 0)
+            {
+                entry.lruPosition = m_LRU.insert(m_LRU.end(), it->second);
+            }
+        }
+
+        // 每帧调用一次：淘汰超出预算的无引用条目，销毁退役满 RETIRE_FRAMES 帧的条目
+        void Update()
+        {
+            while (m_Stats.residentBytes > m_MemoryBudget && !m_LRU.empty())
+            {
+                Evict(m_LRU.front());
+            }
+
+            for (size_t i = 0; i < m_Retired.size();)
+            {
+                if (--m_Retired[i].framesLeft == 0)
+                {
+                    m_Retired[i] = std::move(m_Retired.back());
+                    m_Retired.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        // 立即销毁所有条目，调用前需确保 GPU 空闲
+        void Clear()
+        {
+            m_Retired.clear();
+            m_LRU.clear();
+            m_ItemKeys.clear();
+            m_Entries.clear();
+            m_Paths.clear();
+            m_Stats.residentBytes = 0;
+        }
+
+        void SetMemoryBudget(u64 bytes) { m_MemoryBudget = bytes; }
+        u64 GetMemoryBudget() const { return m_MemoryBudget; }
+
+        ContentCacheStats GetStats() const
+        {
+            ContentCacheStats stats = m_Stats;
+            stats.entryCount = static_cast<u32>(m_Entries.size());
+            stats.referencedCount = static_cast<u32>(m_Entries.size() - m_LRU.size());
+            return stats;
+        }
+
+    private:
+        using Key = u64;
+
+        struct Entry
+        {
+            Scope<T> item;
+            u32 refCount = 0;
+            u64 bytes = 0;
+            typename std::list<Key>::iterator lruPosition;  // 只在 refCount == 0 时有效
+        };
+
+        struct PathInfo
+        {
+            u64 sourceHash = 0;
+            u64 fileSize = 0;
+            std::filesystem::file_time_type writeTime;
+        };
+
+        struct RetiredItem
+        {
+            Scope<T> item;
+            u32 framesLeft = 0;
+        };
+
+        static Key MakeKey(u64 sourceHash, u64 variant)
+        {
+            const u64 fields[] = { sourceHash, variant };
+            return HashBytes(fields, sizeof(fields));
+        }
+
+        static bool GetFileInfo(const std::string& filepath, u64& outSize, std::filesystem::file_time_type& outWriteTime)
+        {
+            std::error_code ec;
+            outSize = std::filesystem::file_size(filepath, ec);
+            if (ec)
+                return false;
+            outWriteTime = std::filesystem::last_write_time(filepath, ec);
+            return !ec;
+        }
+
+        void AddRef(Entry& entry)
+        {
+            if (entry.refCount++ == 0)
+            {
+                m_LRU.erase(entry.lruPosition);
+            }
+        }
+
+        void Evict(Key key)
+        {
+            auto it = m_Entries.find(key);
+            Entry& entry = it->second;
+
+            m_LRU.erase(entry.lruPosition);
+            m_ItemKeys.erase(entry.item.get());
+            m_Stats.residentBytes -= entry.bytes;
+            m_Stats.evictions++;
+            m_Stats.evictedBytes += entry.bytes;
+
+            m_Retired.push_back({ std::move(entry.item), RETIRE_FRAMES });
+            m_Entries.erase(it);
+        }
+
+    private:
+        std::unordered_map<Key, Entry> m_Entries;
+        std::unordered_map<const T*, Key> m_ItemKeys;
+        std::unordered_map<std::string, PathInfo> m_Paths;
+        std::list<Key> m_LRU;                   // 无引用的条目，最近释放的在尾部
+        std::vector<RetiredItem> m_Retired;
+
+        u64 m_MemoryBudget = 0;
+        ContentCacheStats m_Stats;
+    };
+}
@@ -2,6 +2,10 @@
 #include "Scene/SimpleRenderer.h"  // For SceneObject
 #include "Shader/ShaderCompiler.h"
 #include "Core/Log.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 
 namespace Sea
 {
@@ -46,10 +50,12 @@ namespace Sea
     {
         ReleaseGBufferResources();
         m_GBufferConstantBuffer.reset();
-        m_GBufferObjectConstantBuffer.reset();
+        m_GBufferObjectConstants.Shutdown();
         m_LightingConstantBuffer.reset();
         m_GBufferPSO.reset();
         m_GBufferWireframePSO.reset();
+        m_GBufferQuantizedPSO.reset();
+        m_GBufferQuantizedWireframePSO.reset();
         m_LightingPSO.reset();
         m_GBufferRootSignature.reset();
         m_LightingRootSignature.reset();
@@ -62,6 +68,8 @@ namespace Sea
         // 释放旧的 PSO（保留 Root Signature）
         m_GBufferPSO.reset();
         m_GBufferWireframePSO.reset();
+        m_GBufferQuantizedPSO.reset();
+        m_GBufferQuantizedWireframePSO.reset();
         m_LightingPSO.reset();
         m_GBufferRootSignature.reset();
         m_LightingRootSignature.reset();
@@ -99,10 +107,8 @@ namespace Sea
         if (!m_GBufferConstantBuffer->Initialize(nullptr))
             return false;
 
-        // G-Buffer object constants (for all objects)
-        cbDesc.size = OBJECT_CB_ALIGNMENT * MAX_OBJECTS_PER_FRAME;
-        m_GBufferObjectConstantBuffer = MakeScope<Buffer>(m_Device, cbDesc);
-        if (!m_GBufferObjectConstantBuffer->Initialize(nullptr))
+        // G-Buffer object constants (常驻，内容变化时才上传)
+        if (!m_GBufferObjectConstants.Initialize(m_Device, MAX_OBJECTS_PER_FRAME, "GBuffer_ObjectConstants"))
             return false;
 
         // Lighting pass constants
@@ -251,6 +257,38 @@ namespace Sea
             SEA_CORE_WARN("DeferredRenderer: Failed to create G-Buffer Wireframe PSO");
         }
 
+        // ========== Quantized G-Buffer PSOs ==========
+        // VertexFormat::Quantized 的网格：同一个顶点着色器打开 QUANTIZED_VERTEX，换成压缩输入布局
+        ShaderCompileDesc quantizedVsDesc = vsDesc;
+        quantizedVsDesc.defines.push_back({ "QUANTIZED_VERTEX", "1" });
+        auto quantizedVsResult = ShaderCompiler::Compile(quantizedVsDesc);
+
+        if (!quantizedVsResult.success)
+        {
+            SEA_CORE_WARN("DeferredRenderer: Failed to compile quantized GBuffer_VS: {}", quantizedVsResult.errors);
+        }
+        else
+        {
+            std::vector<D3D12_INPUT_ELEMENT_DESC> quantizedLayout = {
+                { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+                { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+                { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+            };
+
+            GraphicsPipelineDesc quantizedPsoDesc = gbufferPsoDesc;
+            quantizedPsoDesc.vertexShader = quantizedVsResult.bytecode;
+            quantizedPsoDesc.inputLayout = quantizedLayout;
+            m_GBufferQuantizedPSO = PipelineState::CreateGraphics(m_Device, quantizedPsoDesc);
+
+            quantizedPsoDesc.fillMode = FillMode::Wireframe;
+            m_GBufferQuantizedWireframePSO = PipelineState::CreateGraphics(m_Device, quantizedPsoDesc);
+
+            if (!m_GBufferQuantizedPSO)
+            {
+                SEA_CORE_WARN("DeferredRenderer: Failed to create quantized G-Buffer PSO");
+            }
+        }
+
         // ========== Compile Lighting Shaders ==========
         ShaderCompileDesc lightingVsDesc;
         lightingVsDesc.filePath = "Shaders/Fullscreen_VS.hlsl";
@@ -465,83 +503,91 @@ namespace Sea
 
     void DeferredRenderer::BeginGBufferPass(CommandList& cmdList, Camera& camera, float time)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
-        m_CurrentObjectIndex = 0;
+        m_GBufferObjectConstants.BeginFrame();
+        m_LastCulledObjectCount = m_CulledObjectCount;
+        m_CulledObjectCount = 0;
+        m_LastMeshletStats = m_MeshletStats;
+        m_MeshletStats = {};
+        m_LastLODObjectCounts = m_LODObjectCounts;
+        m_LODObjectCounts = {};
 
         // 转换 G-Buffer 到 RenderTarget 状态
-        std::vector<D3D12_RESOURCE_BARRIER> barriers(GBufferLayout::COUNT);
         for (u32 i = 0; i < GBufferLayout::COUNT; ++i)
         {
-            barriers[i].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-            barriers[i].Transition.pResource = m_GBuffer[i].Resource.Get();
-            barriers[i].Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-            barriers[i].Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-            barriers[i].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            cmdList.TransitionBarrier(m_GBuffer[i].Resource.Get(), ResourceState::PixelShaderResource, ResourceState::RenderTarget);
         }
-        d3dCmdList->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
 
         // 清除 G-Buffer
         float clearColor[4] = { 0, 0, 0, 0 };
         for (u32 i = 0; i < GBufferLayout::COUNT; ++i)
         {
-            d3dCmdList->ClearRenderTargetView(m_GBuffer[i].RTV, clearColor, 0, nullptr);
+            cmdList.ClearRenderTarget(m_GBuffer[i].RTV, clearColor);
         }
-        d3dCmdList->ClearDepthStencilView(m_DSV, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+        cmdList.ClearDepth(m_DSV);
 
         // 设置渲染目标
         D3D12_CPU_DESCRIPTOR_HANDLE rtvs[GBufferLayout::COUNT];
         for (u32 i = 0; i < GBufferLayout::COUNT; ++i)
             rtvs[i] = m_GBuffer[i].RTV;
-        d3dCmdList->OMSetRenderTargets(GBufferLayout::COUNT, rtvs, FALSE, &m_DSV);
+        cmdList.SetRenderTargets(rtvs, &m_DSV);
 
         // 设置视口和裁剪
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(m_Width), static_cast<float>(m_Height), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(m_Width), static_cast<LONG>(m_Height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(m_Width), static_cast<f32>(m_Height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(m_Width), static_cast<i32>(m_Height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
-        // 根据视图模式选择 PSO
-        if (m_ViewMode == 1 && m_GBufferWireframePSO)
-        {
-            d3dCmdList->SetPipelineState(m_GBufferWireframePSO->GetPipelineState());
-        }
-        else
-        {
-            d3dCmdList->SetPipelineState(m_GBufferPSO->GetPipelineState());
-        }
-        d3dCmdList->SetGraphicsRootSignature(m_GBufferRootSignature->GetRootSignature());
+        // 根据视图模式选择 PSO（压缩顶点的网格在 RecordDraw 中切换）
+        cmdList.SetPipelineState(SelectGBufferPSO(false));
+        cmdList.SetGraphicsRootSignature(m_GBufferRootSignature.get());
 
         // 更新帧常量
         XMMATRIX view = XMLoadFloat4x4(&camera.GetViewMatrix());
         XMMATRIX proj = XMLoadFloat4x4(&camera.GetProjectionMatrix());
         XMMATRIX viewProj = view * proj;
 
+        XMFLOAT4X4 viewProjRowMajor;
+        XMStoreFloat4x4(&viewProjRowMajor, viewProj);
+        m_Frustum.SetFromViewProjection(viewProjRowMajor);
+
         XMStoreFloat4x4(&m_FrameConstants.ViewProjection, XMMatrixTranspose(viewProj));
         XMStoreFloat4x4(&m_FrameConstants.View, XMMatrixTranspose(view));
         XMStoreFloat4x4(&m_FrameConstants.Projection, XMMatrixTranspose(proj));
         m_FrameConstants.CameraPosition = camera.GetPosition();
         m_FrameConstants.Time = time;
+        m_LODScreenScale = Mesh::GetLODScreenScale(camera, m_Height);
 
         m_GBufferConstantBuffer->Update(&m_FrameConstants, sizeof(GBufferConstants));
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_GBufferConstantBuffer->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(0, m_GBufferConstantBuffer->GetGPUAddress());
 
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
     }
 
-    void DeferredRenderer::RenderObjectToGBuffer(CommandList& cmdList, const SceneObject& obj)
+    void DeferredRenderer::BuildObjectConstants(const SceneObject& obj, GBufferObjectConstants& objConstants) const
     {
-        if (!obj.mesh || m_CurrentObjectIndex >= MAX_OBJECTS_PER_FRAME)
-            return;
-
-        auto* d3dCmdList = cmdList.GetCommandList();
-
-        // 更新物体常量
-        GBufferObjectConstants objConstants = {};
+        objConstants = {};
         XMMATRIX world = XMLoadFloat4x4(&obj.transform);
-        XMStoreFloat4x4(&objConstants.World, XMMatrixTranspose(world));
+
+        // 压缩顶点：反量化矩阵折叠进世界矩阵，逆转置矩阵仍由原始变换计算
+        if (obj.mesh && obj.mesh->IsQuantized())
+        {
+            XMStoreFloat4x4(&objConstants.World, XMMatrixTranspose(obj.mesh->GetQuantization().GetDequantizeMatrix() * world));
+        }
+        else
+        {
+            XMStoreFloat4x4(&objConstants.World, XMMatrixTranspose(world));
+        }
         
-        XMMATRIX worldInvTranspose = XMMatrixTranspose(XMMatrixInverse(nullptr, world));
-        XMStoreFloat4x4(&objConstants.WorldInvTranspose, XMMatrixTranspose(worldInvTranspose));
+        // 挂在变换层级上的物体直接用层级缓存的逆转置矩阵
+        if (obj.hasWorldInvTranspose)
+        {
+            XMStoreFloat4x4(&objConstants.WorldInvTranspose, XMMatrixTranspose(XMLoadFloat4x4(&obj.worldInvTranspose)));
+        }
+        else
+        {
+            XMMATRIX worldInvTranspose = XMMatrixTranspose(XMMatrixInverse(nullptr, world));
+            XMStoreFloat4x4(&objConstants.WorldInvTranspose, XMMatrixTranspose(worldInvTranspose));
+        }
         
         objConstants.BaseColor = obj.color;
         objConstants.Metallic = obj.metallic;
@@ -549,39 +595,157 @@ namespace Sea
         objConstants.AO = obj.ao;
         objConstants.EmissiveIntensity = obj.emissiveIntensity;
         objConstants.EmissiveColor = obj.emissiveColor;
+    }
+
+    bool DeferredRenderer::UpdateObjectConstants(const SceneObject& obj, u32 slot)
+    {
+        if (m_GBufferObjectConstants.IsCurrent(slot, obj.revision))
+            return false;
 
-        // 写入到动态常量缓冲区
-        u64 offset = m_CurrentObjectIndex * OBJECT_CB_ALIGNMENT;
-        m_GBufferObjectConstantBuffer->Update(&objConstants, sizeof(GBufferObjectConstants), offset);
+        GBufferObjectConstants objConstants;
+        BuildObjectConstants(obj, objConstants);
+        m_GBufferObjectConstants.Upload(slot, objConstants, obj.revision);
+        return true;
+    }
 
-        D3D12_GPU_VIRTUAL_ADDRESS cbAddress = m_GBufferObjectConstantBuffer->GetGPUAddress() + offset;
-        d3dCmdList->SetGraphicsRootConstantBufferView(1, cbAddress);
+    PipelineState* DeferredRenderer::SelectGBufferPSO(bool quantized) const
+    {
+        const Ref<PipelineState>& solid = quantized ? m_GBufferQuantizedPSO : m_GBufferPSO;
+        const Ref<PipelineState>& wireframe = quantized ? m_GBufferQuantizedWireframePSO : m_GBufferWireframePSO;
+        return (m_ViewMode == 1 && wireframe) ? wireframe.get() : solid.get();
+    }
+
+    void DeferredRenderer::RecordDraw(CommandList& cmdList, const SceneObject& obj, u32 slot,
+                                      const std::vector<MeshletDrawRange>* meshletRanges, u32 lod)
+    {
+        // 标准与压缩顶点的网格混合时逐物体切换（相同 PSO 会被 CommandList 过滤掉）
+        PipelineState* pso = SelectGBufferPSO(obj.mesh->IsQuantized());
+        if (!pso)
+            return;
+        cmdList.SetPipelineState(pso);
 
-        // 绘制
-        auto vbv = obj.mesh->GetVertexBuffer()->GetVertexBufferView();
-        auto ibv = obj.mesh->GetIndexBuffer()->GetIndexBufferView();
-        d3dCmdList->IASetVertexBuffers(0, 1, &vbv);
-        d3dCmdList->IASetIndexBuffer(&ibv);
-        d3dCmdList->DrawIndexedInstanced(obj.mesh->GetIndexCount(), 1, 0, 0, 0);
+        cmdList.SetGraphicsRootCBV(1, m_GBufferObjectConstants.GetGPUAddress(slot));
 
-        m_CurrentObjectIndex++;
+        // 绘制（相同网格连续绘制时 VB/IB 会被 CommandList 过滤掉）
+        cmdList.SetVertexBuffer(0, obj.mesh->GetVertexBuffer()->GetVertexBufferView());
+        cmdList.SetIndexBuffer(obj.mesh->GetIndexBuffer()->GetIndexBufferView());
+        if (meshletRanges)
+            obj.mesh->Draw(cmdList, *meshletRanges);
+        else
+            obj.mesh->DrawLOD(cmdList, lod);
     }
 
-    void DeferredRenderer::EndGBufferPass(CommandList& cmdList)
+    void DeferredRenderer::RenderObjectToGBuffer(CommandList& cmdList, const SceneObject& obj)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
+        if (!obj.mesh)
+            return;
+
+        const u32 slot = m_GBufferObjectConstants.AcquireSlot(obj.id);
+        if (slot == ObjectConstantTable<GBufferObjectConstants>::INVALID_SLOT)
+            return;
+
+        // 常量表里已经是这个 revision 的内容时不重新打包
+        auto startTime = std::chrono::high_resolution_clock::now();
+        const bool rebuilt = UpdateObjectConstants(obj, slot);
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_GBufferObjectConstants.AddStats(1, rebuilt ? 1 : 0, std::chrono::duration<f32, std::milli>(endTime - startTime).count());
+
+        RecordDraw(cmdList, obj, slot);
+    }
 
+    void DeferredRenderer::RenderObjectsToGBuffer(CommandList& cmdList, const std::vector<SceneObject>& objects)
+    {
+        // 与 SimpleRenderer::RenderObjects 相同：槽位按物体 id 分配，剔除/打包并行，录制串行
+        const u32 count = static_cast<u32>(objects.size());
+        m_ObjectSlots.resize(count);
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_ObjectSlots[i] = objects[i].mesh ? m_GBufferObjectConstants.AcquireSlot(objects[i].id)
+                                               : ObjectConstantTable<GBufferObjectConstants>::INVALID_SLOT;
+        }
+
+        m_VisibleObjects.assign(count, 0);
+        if (m_MeshletRanges.size() < count)
+            m_MeshletRanges.resize(count);
+        m_ObjectMeshletStats.assign(count, {});
+        m_ObjectLODs.assign(count, 0);
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        std::atomic<u32> drawnObjects = 0;
+        std::atomic<u32> rebuiltObjects = 0;
+        std::atomic<u32> culledObjects = 0;
+        JobSystem::RunParallelFor(count, PREPARE_BATCH_SIZE, [&](u32 begin, u32 end) {
+            u32 drawn = 0, rebuilt = 0, culled = 0;
+            for (u32 i = begin; i < end; ++i)
+            {
+                const SceneObject& obj = objects[i];
+                const u32 slot = m_ObjectSlots[i];
+                if (slot == ObjectConstantTable<GBufferObjectConstants>::INVALID_SLOT)
+                    continue;
+
+                if (m_FrustumCulling &&
+                    !m_Frustum.IntersectsTransformedAABB(obj.mesh->GetBoundsMin(), obj.mesh->GetBoundsMax(), obj.transform))
+                {
+                    ++culled;
+                    continue;
+                }
+
+                // G-Buffer 的线框管线同样剔除背面，簇剔除可以直接用法线锥
+                // LOD 按投影误差选择；meshlet 只对应 LOD0，选中更粗的级别时整体绘制
+                u32 lod = 0;
+                if (m_MeshLOD && obj.mesh->GetLODCount() > 1)
+                    lod = obj.mesh->SelectLOD(obj.transform, m_FrameConstants.CameraPosition, m_LODScreenScale, m_LODPixelError);
+                m_ObjectLODs[i] = static_cast<u8>(lod);
+
+                if (lod == 0 && m_MeshletCulling && obj.mesh->HasMeshlets())
+                {
+                    CullMeshlets(obj.mesh->GetMeshlets(), m_Frustum, m_FrameConstants.CameraPosition, obj.transform,
+                                 m_MeshletRanges[i], &m_ObjectMeshletStats[i]);
+                    if (m_MeshletRanges[i].empty())
+                    {
+                        ++culled;
+                        continue;
+                    }
+                    m_VisibleObjects[i] = 2;
+                }
+                else
+                {
+                    m_VisibleObjects[i] = 1;
+                }
+
+                if (UpdateObjectConstants(obj, slot))
+                    ++rebuilt;
+
+                ++drawn;
+            }
+            drawnObjects += drawn;
+            rebuiltObjects += rebuilt;
+            culledObjects += culled;
+        });
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        m_GBufferObjectConstants.AddStats(drawnObjects, rebuiltObjects, std::chrono::duration<f32, std::milli>(endTime - startTime).count());
+        m_CulledObjectCount += culledObjects;
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_MeshletStats.Add(m_ObjectMeshletStats[i]);
+            if (m_VisibleObjects[i])
+            {
+                ++m_LODObjectCounts[m_ObjectLODs[i]];
+                RecordDraw(cmdList, objects[i], m_ObjectSlots[i], m_VisibleObjects[i] == 2 ? &m_MeshletRanges[i] : nullptr,
+                           m_ObjectLODs[i]);
+            }
+        }
+    }
+
+    void DeferredRenderer::EndGBufferPass(CommandList& cmdList)
+    {
         // 转换 G-Buffer 到 ShaderResource 状态
-        std::vector<D3D12_RESOURCE_BARRIER> barriers(GBufferLayout::COUNT);
         for (u32 i = 0; i < GBufferLayout::COUNT; ++i)
         {
-            barriers[i].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-            barriers[i].Transition.pResource = m_GBuffer[i].Resource.Get();
-            barriers[i].Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-            barriers[i].Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-            barriers[i].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            cmdList.TransitionBarrier(m_GBuffer[i].Resource.Get(), ResourceState::RenderTarget, ResourceState::PixelShaderResource);
         }
-        d3dCmdList->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
     }
 
     void DeferredRenderer::LightingPass(CommandList& cmdList,
@@ -589,24 +753,22 @@ namespace Sea
                                          ID3D12Resource* outputResource,
                                          u32 outputWidth, u32 outputHeight)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &outputRTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(outputRTV);
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(outputWidth), static_cast<float>(outputHeight), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(outputWidth), static_cast<LONG>(outputHeight) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(outputWidth), static_cast<f32>(outputHeight), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(outputWidth), static_cast<i32>(outputHeight) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 设置 PSO 和根签名
-        d3dCmdList->SetPipelineState(m_LightingPSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootSignature(m_LightingRootSignature->GetRootSignature());
+        cmdList.SetPipelineState(m_LightingPSO.get());
+        cmdList.SetGraphicsRootSignature(m_LightingRootSignature.get());
 
         // 设置描述符堆
         ID3D12DescriptorHeap* heaps[] = { m_SRVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
+        cmdList.SetDescriptorHeaps(heaps);
 
         // 更新光照常量
         LightingConstants lightConstants = {};
@@ -622,14 +784,14 @@ namespace Sea
         lightConstants.AmbientColor = m_AmbientColor;
 
         m_LightingConstantBuffer->Update(&lightConstants, sizeof(LightingConstants));
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_LightingConstantBuffer->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(0, m_LightingConstantBuffer->GetGPUAddress());
 
         // G-Buffer SRVs
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, m_GBuffer[0].SRV);
+        cmdList.SetGraphicsRootDescriptorTable(1, m_GBuffer[0].SRV);
 
         // 绘制全屏三角形
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
     }
 
     ID3D12Resource* DeferredRenderer::GetGBufferResource(u32 index) const
@@ -3,8 +3,13 @@
 #include "Graphics/Graphics.h"
 #include "Scene/Scene.h"
 #include "Scene/Camera.h"
+#include "Scene/ObjectConstantTable.h"
+#include "Scene/Frustum.h"
+#include "Scene/Meshlet.h"
+#include "Scene/MeshSimplifier.h"
 #include <DirectXMath.h>
 #include <array>
+#include <vector>
 
 namespace Sea
 {
@@ -80,6 +85,8 @@ namespace Sea
         // 渲染流程
         void BeginGBufferPass(CommandList& cmdList, Camera& camera, float time);
         void RenderObjectToGBuffer(CommandList& cmdList, const struct SceneObject& obj);
+        // 批量绘制：剔除与常量打包在任务系统上并行完成，之后按顺序录制命令
+        void RenderObjectsToGBuffer(CommandList& cmdList, const std::vector<struct SceneObject>& objects);
         void EndGBufferPass(CommandList& cmdList);
 
         void LightingPass(CommandList& cmdList, 
@@ -103,12 +110,41 @@ namespace Sea
         // 重新编译着色器
         bool RecompileShaders();
 
+        // 物体常量上传统计（上一帧）
+        const ObjectConstantTableStats& GetObjectConstantStats() const { return m_GBufferObjectConstants.GetStats(); }
+        // 每帧重建全部物体常量，用于实测增量更新省下的开销
+        void SetRebuildAllObjectConstants(bool enabled) { m_GBufferObjectConstants.SetForceRebuild(enabled); }
+        bool GetRebuildAllObjectConstants() const { return m_GBufferObjectConstants.GetForceRebuild(); }
+
+        // 视锥剔除（仅 RenderObjectsToGBuffer 生效）
+        void SetFrustumCulling(bool enabled) { m_FrustumCulling = enabled; }
+        bool GetFrustumCulling() const { return m_FrustumCulling; }
+        u32 GetCulledObjectCount() const { return m_LastCulledObjectCount; }   // 上一帧
+
+        // meshlet 簇剔除（仅 RenderObjectsToGBuffer 生效，网格需以 buildMeshlets 上传）
+        void SetMeshletCulling(bool enabled) { m_MeshletCulling = enabled; }
+        bool GetMeshletCulling() const { return m_MeshletCulling; }
+        const MeshletCullStats& GetMeshletCullStats() const { return m_LastMeshletStats; }     // 上一帧
+
+        // 网格 LOD（仅 RenderObjectsToGBuffer 生效）：选择投影误差不超过 pixelError 个像素的最粗一级
+        void SetMeshLOD(bool enabled) { m_MeshLOD = enabled; }
+        bool GetMeshLOD() const { return m_MeshLOD; }
+        void SetLODPixelError(f32 pixels) { m_LODPixelError = pixels; }
+        f32 GetLODPixelError() const { return m_LODPixelError; }
+        const std::array<u32, MESH_MAX_LODS>& GetLODObjectCounts() const { return m_LastLODObjectCounts; }   // 上一帧各级物体数
+
         // 获取 G-Buffer 用于调试
         ID3D12Resource* GetGBufferResource(u32 index) const;
         D3D12_GPU_DESCRIPTOR_HANDLE GetGBufferSRV(u32 index) const;
 
     private:
         bool CreateGBufferResources(u32 width, u32 height);
+        void BuildObjectConstants(const struct SceneObject& obj, GBufferObjectConstants& objConstants) const;
+        // 物体常量不是最新时重新打包并上传，返回是否上传
+        bool UpdateObjectConstants(const struct SceneObject& obj, u32 slot);
+        void RecordDraw(CommandList& cmdList, const struct SceneObject& obj, u32 slot,
+                        const std::vector<MeshletDrawRange>* meshletRanges = nullptr, u32 lod = 0);
+        PipelineState* SelectGBufferPSO(bool quantized) const;
         bool CreatePipelines();
         bool CreateConstantBuffers();
         void ReleaseGBufferResources();
@@ -143,17 +179,37 @@ namespace Sea
         Scope<RootSignature> m_LightingRootSignature;
         Ref<PipelineState> m_GBufferPSO;
         Ref<PipelineState> m_GBufferWireframePSO;  // Wireframe 模式
+        Ref<PipelineState> m_GBufferQuantizedPSO;           // 压缩顶点（VertexFormat::Quantized）
+        Ref<PipelineState> m_GBufferQuantizedWireframePSO;
         Ref<PipelineState> m_LightingPSO;
 
         // 常量缓冲区
         Scope<Buffer> m_GBufferConstantBuffer;
-        Scope<Buffer> m_GBufferObjectConstantBuffer;
+        ObjectConstantTable<GBufferObjectConstants> m_GBufferObjectConstants;  // 常驻，按物体 id 分配槽位
         Scope<Buffer> m_LightingConstantBuffer;
         
-        // 物体常量缓冲区动态分配
+        // 常量表容量（每帧最多绘制的物体数）
         static constexpr u32 MAX_OBJECTS_PER_FRAME = 256;
-        static constexpr u32 OBJECT_CB_ALIGNMENT = 256;
-        u32 m_CurrentObjectIndex = 0;
+
+        // 批量绘制的并行准备
+        static constexpr u32 PREPARE_BATCH_SIZE = 32;
+        std::vector<u32> m_ObjectSlots;        // 每个物体在常量表中的槽位
+        std::vector<u8> m_VisibleObjects;      // 0 = 剔除，1 = 整体绘制，2 = 按 meshlet 区间绘制
+        Frustum m_Frustum;
+        bool m_FrustumCulling = true;
+        u32 m_CulledObjectCount = 0;
+        u32 m_LastCulledObjectCount = 0;
+        bool m_MeshletCulling = true;
+        std::vector<std::vector<MeshletDrawRange>> m_MeshletRanges;
+        std::vector<MeshletCullStats> m_ObjectMeshletStats;
+        MeshletCullStats m_MeshletStats;
+        MeshletCullStats m_LastMeshletStats;
+        bool m_MeshLOD = true;
+        f32 m_LODPixelError = 1.0f;
+        f32 m_LODScreenScale = 1.0f;
+        std::vector<u8> m_ObjectLODs;
+        std::array<u32, MESH_MAX_LODS> m_LODObjectCounts = {};
+        std::array<u32, MESH_MAX_LODS> m_LastLODObjectCounts = {};
 
         // 光照参数
         XMFLOAT3 m_LightDirection = { -0.5f, -1.0f, 0.5f };
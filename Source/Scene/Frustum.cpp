@@ -0,0 +1,102 @@
+#include "Scene/Frustum.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Sea
+{
+    void Frustum::SetFromViewProjection(const XMFLOAT4X4& m)
+    {
+        // Gribb/Hartmann：行向量约定下平面来自矩阵的列
+        m_Planes[Left]   = { m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41 };
+        m_Planes[Right]  = { m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41 };
+        m_Planes[Bottom] = { m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42 };
+        m_Planes[Top]    = { m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42 };
+        m_Planes[Near]   = { m._13, m._23, m._33, m._43 };
+        m_Planes[Far]    = { m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43 };
+
+        for (auto& plane : m_Planes)
+        {
+            f32 length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f)
+            {
+                plane.x /= length;
+                plane.y /= length;
+                plane.z /= length;
+                plane.w /= length;
+            }
+        }
+    }
+
+    bool Frustum::IntersectsAABB(const XMFLOAT3& center, const XMFLOAT3& extents) const
+    {
+        for (const auto& plane : m_Planes)
+        {
+            f32 distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            f32 radius = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+            if (distance + radius < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    bool Frustum::IntersectsSphere(const XMFLOAT3& center, f32 radius) const
+    {
+        for (const auto& plane : m_Planes)
+        {
+            f32 distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            if (distance < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    bool Frustum::IntersectsTransformedAABB(const XMFLOAT3& localMin, const XMFLOAT3& localMax, const XMFLOAT4X4& world) const
+    {
+        CullBounds bounds = TransformBounds(localMin, localMax, world);
+        return IntersectsAABB(bounds.center, bounds.extents);
+    }
+
+    CullBounds TransformBounds(const XMFLOAT3& localMin, const XMFLOAT3& localMax, const XMFLOAT4X4& world)
+    {
+        const XMFLOAT3 c = { (localMin.x + localMax.x) * 0.5f, (localMin.y + localMax.y) * 0.5f, (localMin.z + localMax.z) * 0.5f };
+        const XMFLOAT3 e = { (localMax.x - localMin.x) * 0.5f, (localMax.y - localMin.y) * 0.5f, (localMax.z - localMin.z) * 0.5f };
+
+        // 中心做完整变换，半尺寸按 |M| 变换（Arvo 方法）
+        CullBounds bounds;
+        bounds.center = {
+            c.x * world._11 + c.y * world._21 + c.z * world._31 + world._41,
+            c.x * world._12 + c.y * world._22 + c.z * world._32 + world._42,
+            c.x * world._13 + c.y * world._23 + c.z * world._33 + world._43
+        };
+        bounds.extents = {
+            e.x * std::abs(world._11) + e.y * std::abs(world._21) + e.z * std::abs(world._31),
+            e.x * std::abs(world._12) + e.y * std::abs(world._22) + e.z * std::abs(world._32),
+            e.x * std::abs(world._13) + e.y * std::abs(world._23) + e.z * std::abs(world._33)
+        };
+        return bounds;
+    }
+
+    void CullMultiView(std::span<const Frustum> views, std::span<const CullBounds> bounds, std::span<u32> outMasks)
+    {
+        const u32 viewCount = std::min(static_cast<u32>(views.size()), MAX_CULL_VIEWS);
+        const u32 count = static_cast<u32>(std::min(bounds.size(), outMasks.size()));
+
+        JobSystem::RunParallelFor(count, 256, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+            {
+                // 包围盒只读一次，依次测试所有视图
+                const CullBounds& box = bounds[i];
+                u32 mask = 0;
+                for (u32 v = 0; v < viewCount; ++v)
+                {
+                    if (views[v].IntersectsAABB(box.center, box.extents))
+                    {
+                        mask |= 1u << v;
+                    }
+                }
+                outMasks[i] = mask;
+            }
+        });
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <DirectXMath.h>
+#include <span>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 视锥体（6 个平面，法线朝内）
+    // 从行主序的 ViewProjection 矩阵提取（clip = v * M，D3D 深度范围 [0, 1]）
+    class Frustum
+    {
+    public:
+        enum Plane : u32 { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+        Frustum() = default;
+        explicit Frustum(const XMFLOAT4X4& viewProjection) { SetFromViewProjection(viewProjection); }
+
+        void SetFromViewProjection(const XMFLOAT4X4& viewProjection);
+
+        const XMFLOAT4& GetPlane(u32 index) const { return m_Planes[index]; }
+
+        // 中心 + 半尺寸形式的 AABB，只要不完全在某个平面外侧就视为可见
+        bool IntersectsAABB(const XMFLOAT3& center, const XMFLOAT3& extents) const;
+        bool IntersectsSphere(const XMFLOAT3& center, f32 radius) const;
+
+        // 局部空间 AABB 经过 world 变换后的包围盒是否可见
+        bool IntersectsTransformedAABB(const XMFLOAT3& localMin, const XMFLOAT3& localMax, const XMFLOAT4X4& world) const;
+
+    private:
+        XMFLOAT4 m_Planes[Count] = {};
+    };
+
+    // 世界空间 AABB（中心 + 半尺寸）
+    struct CullBounds
+    {
+        XMFLOAT3 center = { 0, 0, 0 };
+        XMFLOAT3 extents = { 0, 0, 0 };
+    };
+
+    constexpr u32 MAX_CULL_VIEWS = 32;
+
+    // 局部 AABB 经 world 变换后的世界空间包围盒
+    CullBounds TransformBounds(const XMFLOAT3& localMin, const XMFLOAT3& localMax, const XMFLOAT4X4& world);
+
+    // 多视图剔除：对场景包围盒只遍历一次，同时测试所有视图（主相机 + 各级阴影等）
+    // outMasks[i] 的第 v 位表示 bounds[i] 在 views[v] 中可见；最多 MAX_CULL_VIEWS 个视图
+    void CullMultiView(std::span<const Frustum> views, std::span<const CullBounds> bounds, std::span<u32> outMasks);
+}
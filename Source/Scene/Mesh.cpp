@@ -1,199 +1,313 @@
 #include "Scene/Mesh.h"
 #include "Graphics/Device.h"
+#include "Graphics/CommandList.h"
+#include "Scene/Camera.h"
+#include "Scene/MeshCooker.h"
+#include "Scene/MeshOptimizer.h"
+#include "Scene/OBJLoader.h"
 #include "Core/Log.h"
 
-#define TINYOBJLOADER_IMPLEMENTATION
-#include <tiny_obj_loader.h>
-
-#include <unordered_map>
+#include <algorithm>
 #include <cmath>
 
 namespace Sea
 {
-    bool Mesh::LoadFromOBJ(Device& device, const std::string& filepath)
+    bool Mesh::LoadFromOBJ(Device& device, const std::string& filepath, const MeshUploadOptions& options)
+    {
+        MeshUploadData data;
+        if (!PrepareOBJ(filepath, options, data))
+            return false;
+        return Upload(device, std::move(data));
+    }
+
+    bool Mesh::LoadCooked(Device& device, const CookedMesh& cooked, const MeshUploadOptions& options)
     {
-        tinyobj::attrib_t attrib;
-        std::vector<tinyobj::shape_t> shapes;
-        std::vector<tinyobj::material_t> materials;
-        std::string warn, err;
+        MeshUploadData data;
+        data.subMeshes.assign(cooked.GetSubMeshes().begin(), cooked.GetSubMeshes().end());
+        data.materials.reserve(cooked.GetMaterialCount());
+        for (u32 i = 0; i < cooked.GetMaterialCount(); ++i)
+        {
+            data.materials.push_back(cooked.GetMaterial(i));
+        }
+
+        data.boundsMin = cooked.GetBoundsMin();
+        data.boundsMax = cooked.GetBoundsMax();
+        PrepareUpload(cooked.GetVertices(), cooked.GetIndices(), options, data);
+        return Upload(device, std::move(data));
+    }
 
-        // 获取目录路径用于材质加载
-        std::string directory = filepath.substr(0, filepath.find_last_of("/\\") + 1);
+    bool Mesh::CreateFromVertices(Device& device, 
+                                  std::span<const Vertex> vertices, 
+                                  std::span<const u32> indices,
+                                  const MeshUploadOptions& options)
+    {
+        MeshUploadData data;
+        data.subMeshes = std::move(m_SubMeshes);
+        data.materials = std::move(m_Materials);
+        ComputeMeshBounds(vertices, data.boundsMin, data.boundsMax);
+        PrepareUpload(vertices, indices, options, data);
+        return Upload(device, std::move(data));
+    }
 
-        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filepath.c_str(), directory.c_str()))
+    bool Mesh::PrepareOBJ(const std::string& filepath, const MeshUploadOptions& options, MeshUploadData& outData,
+                          const std::atomic<bool>* cancelled)
+    {
+        // 烘焙缓存命中时顶点 / 索引直接引用映射内存，映射随 outData 一起交给主线程
+        auto cooked = MakeScope<CookedMesh>();
+        if (LoadMeshCached(filepath, *cooked))
         {
-            SEA_CORE_ERROR("Failed to load OBJ: {} {}", warn, err);
+            outData.subMeshes.assign(cooked->GetSubMeshes().begin(), cooked->GetSubMeshes().end());
+            outData.materials.clear();
+            for (u32 i = 0; i < cooked->GetMaterialCount(); ++i)
+            {
+                outData.materials.push_back(cooked->GetMaterial(i));
+            }
+            outData.boundsMin = cooked->GetBoundsMin();
+            outData.boundsMax = cooked->GetBoundsMax();
+            outData.sourceHash = cooked->GetHeader().sourceHash;
+
+            const std::span<const Vertex> vertices = cooked->GetVertices();
+            const std::span<const u32> indices = cooked->GetIndices();
+            outData.cooked = std::move(cooked);
+            return PrepareUpload(vertices, indices, options, outData, cancelled);
+        }
+
+        // 缓存不可用（例如目录只读）时退回直接解析
+        u64 sourceSize = 0;
+        if (!HashSourceFile(filepath, outData.sourceHash, sourceSize))
+            outData.sourceHash = 0;
+
+        MeshData data;
+        if (!LoadOBJ(filepath, data))
             return false;
+        if (cancelled && cancelled->load(std::memory_order_relaxed))
+            return false;
+
+        outData.materials = std::move(data.materials);
+        outData.subMeshes = std::move(data.subMeshes);
+        ComputeMeshBounds(data.vertices, outData.boundsMin, outData.boundsMax);
+        outData.vertexStorage = std::move(data.vertices);
+        outData.indexStorage = std::move(data.indices);
+        return PrepareUpload(outData.vertexStorage, outData.indexStorage, options, outData, cancelled);
+    }
+
+    u64 Mesh::GetMemorySize() const
+    {
+        return (m_VertexBuffer ? m_VertexBuffer->GetSize() : 0) + (m_IndexBuffer ? m_IndexBuffer->GetSize() : 0);
+    }
+
+    void Mesh::Draw(CommandList& cmdList, u32 instanceCount) const
+    {
+        if (!m_HasBaseVertex)
+        {
+            cmdList.DrawIndexed(m_IndexCount, instanceCount);
+            return;
         }
 
-        if (!warn.empty())
-            SEA_CORE_WARN("OBJ Warning: {}", warn);
+        for (const SubMesh& subMesh : m_SubMeshes)
+        {
+            cmdList.DrawIndexed(subMesh.indexCount, instanceCount, subMesh.indexOffset, static_cast<i32>(subMesh.baseVertex));
+        }
+    }
 
-        std::vector<Vertex> vertices;
-        std::vector<u32> indices;
-        std::unordered_map<std::string, u32> uniqueVertices;
+    void Mesh::Draw(CommandList& cmdList, std::span<const MeshletDrawRange> ranges, u32 instanceCount) const
+    {
+        for (const MeshletDrawRange& range : ranges)
+        {
+            cmdList.DrawIndexed(range.indexCount, instanceCount, range.indexOffset, static_cast<i32>(range.baseVertex));
+        }
+    }
 
-        // 加载材质
-        for (const auto& mat : materials)
+    void Mesh::DrawLOD(CommandList& cmdList, u32 lod, u32 instanceCount) const
+    {
+        if (lod == 0 || lod >= m_LODs.size())
         {
-            Material m;
-            m.name = mat.name;
-            m.albedo = { mat.diffuse[0], mat.diffuse[1], mat.diffuse[2], 1.0f };
-            m.metallic = mat.metallic;
-            m.roughness = mat.roughness;
-            m.albedoTexture = mat.diffuse_texname;
-            m.normalTexture = mat.normal_texname;
-            m_Materials.push_back(m);
+            Draw(cmdList, instanceCount);
+            return;
         }
 
-        // 如果没有材质，添加默认材质
-        if (m_Materials.empty())
+        for (const SubMesh& subMesh : m_LODs[lod].subMeshes)
         {
-            Material defaultMat;
-            defaultMat.name = "Default";
-            m_Materials.push_back(defaultMat);
+            if (subMesh.indexCount > 0)
+                cmdList.DrawIndexed(subMesh.indexCount, instanceCount, subMesh.indexOffset, static_cast<i32>(subMesh.baseVertex));
         }
+    }
 
-        // 处理每个形状
-        for (const auto& shape : shapes)
+    u32 Mesh::SelectLOD(const XMFLOAT4X4& world, const XMFLOAT3& cameraPosition, f32 screenScale, f32 pixelError) const
+    {
+        if (m_LODs.size() <= 1)
+            return 0;
+
+        // 世界空间包围球：包围盒中心变换过去，半径按最大轴缩放
+        const XMVECTOR localCenter = XMVectorScale(XMVectorAdd(XMLoadFloat3(&m_BoundsMin), XMLoadFloat3(&m_BoundsMax)), 0.5f);
+        const XMMATRIX transform = XMLoadFloat4x4(&world);
+        const XMVECTOR center = XMVector3TransformCoord(localCenter, transform);
+        const f32 maxScale = std::sqrt(std::max({ world._11 * world._11 + world._12 * world._12 + world._13 * world._13,
+                                                  world._21 * world._21 + world._22 * world._22 + world._23 * world._23,
+                                                  world._31 * world._31 + world._32 * world._32 + world._33 * world._33 }));
+        const f32 diagonal = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&m_BoundsMax), XMLoadFloat3(&m_BoundsMin)))) * maxScale;
+        const f32 distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(center, XMLoadFloat3(&cameraPosition)))) - diagonal * 0.5f;
+        if (distance <= 0.0f)
+            return 0;
+
+        // 误差随级别单调增加，从最粗的一级往回找
+        const f32 pixelsPerError = diagonal / distance * screenScale;
+        for (u32 lod = static_cast<u32>(m_LODs.size()) - 1; lod > 0; --lod)
+        {
+            if (m_LODs[lod].error * pixelsPerError <= pixelError)
+                return lod;
+        }
+        return 0;
+    }
+
+    f32 Mesh::GetLODScreenScale(const Camera& camera, u32 viewportHeight)
+    {
+        return static_cast<f32>(viewportHeight) / (2.0f * std::tan(XMConvertToRadians(camera.GetFOV()) * 0.5f));
+    }
+
+    bool Mesh::PrepareUpload(std::span<const Vertex> vertices, std::span<const u32> indices,
+                             const MeshUploadOptions& options, MeshUploadData& outData, const std::atomic<bool>* cancelled)
+    {
+        auto isCancelled = [cancelled]() { return cancelled && cancelled->load(std::memory_order_relaxed); };
+
+        // 拆分需要可写的顶点/索引，复制到暂存数组后切分再处理（包围盒不变）
+        if (options.splitForIndex16 && vertices.size() > INDEX16_MAX_VERTICES)
+        {
+            std::vector<Vertex> splitVertices(vertices.begin(), vertices.end());
+            std::vector<u32> splitIndices(indices.begin(), indices.end());
+            u32 segmentCount = SplitMeshForIndex16(splitVertices, splitIndices, outData.subMeshes);
+            SEA_CORE_INFO("Split mesh for 16-bit indices: {} -> {} vertices, {} submeshes",
+                          vertices.size(), splitVertices.size(), segmentCount);
+
+            outData.vertexStorage = std::move(splitVertices);
+            outData.indexStorage = std::move(splitIndices);
+            MeshUploadOptions splitOptions = options;
+            splitOptions.splitForIndex16 = false;
+            return PrepareUpload(outData.vertexStorage, outData.indexStorage, splitOptions, outData, cancelled);
+        }
+
+        // 如果没有子网格，创建一个（meshlet 与 LOD 链都按子网格处理）
+        if (outData.subMeshes.empty())
         {
             SubMesh subMesh;
-            subMesh.indexOffset = static_cast<u32>(indices.size());
+            subMesh.indexOffset = 0;
+            subMesh.indexCount = static_cast<u32>(indices.size());
             subMesh.materialIndex = 0;
+            outData.subMeshes.push_back(subMesh);
+        }
 
-            for (const auto& index : shape.mesh.indices)
+        // meshlet 构建会在子网格内重排三角形、LOD 链会追加索引，都需要先复制到暂存数组
+        outData.meshlets.Clear();
+        outData.lods.clear();
+        outData.lod0IndexCount = static_cast<u32>(indices.size());
+        if (options.buildMeshlets || options.lodCount > 1)
+        {
+            std::vector<u32> stagedIndices(indices.begin(), indices.end());
+            if (options.buildMeshlets)
             {
-                Vertex vertex{};
-
-                // 位置
-                vertex.position = {
-                    attrib.vertices[3 * index.vertex_index + 0],
-                    attrib.vertices[3 * index.vertex_index + 1],
-                    attrib.vertices[3 * index.vertex_index + 2]
-                };
-
-                // 法线
-                if (index.normal_index >= 0)
-                {
-                    vertex.normal = {
-                        attrib.normals[3 * index.normal_index + 0],
-                        attrib.normals[3 * index.normal_index + 1],
-                        attrib.normals[3 * index.normal_index + 2]
-                    };
-                }
-
-                // 纹理坐标
-                if (index.texcoord_index >= 0)
-                {
-                    vertex.texCoord = {
-                        attrib.texcoords[2 * index.texcoord_index + 0],
-                        1.0f - attrib.texcoords[2 * index.texcoord_index + 1]
-                    };
-                }
-
-                // 顶点颜色
-                vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
-
-                // 使用唯一顶点
-                std::string key = std::to_string(index.vertex_index) + "_" + 
-                                  std::to_string(index.normal_index) + "_" + 
-                                  std::to_string(index.texcoord_index);
-
-                if (uniqueVertices.count(key) == 0)
-                {
-                    uniqueVertices[key] = static_cast<u32>(vertices.size());
-                    vertices.push_back(vertex);
-                }
-
-                indices.push_back(uniqueVertices[key]);
+                BuildMeshlets(vertices, stagedIndices, outData.subMeshes, outData.meshlets);
+                SEA_CORE_INFO("Built {} meshlets for {} triangles", outData.meshlets.meshlets.size(), indices.size() / 3);
             }
-
-            subMesh.indexCount = static_cast<u32>(indices.size()) - subMesh.indexOffset;
-            if (!shape.mesh.material_ids.empty() && shape.mesh.material_ids[0] >= 0)
+            if (isCancelled())
+                return false;
+            if (options.lodCount > 1)
             {
-                subMesh.materialIndex = shape.mesh.material_ids[0];
+                LODChainOptions lodOptions;
+                lodOptions.levelCount = options.lodCount;
+                GenerateLODChain(vertices, outData.subMeshes, lodOptions, stagedIndices, outData.lods);
+                SEA_CORE_INFO("Generated {} LODs: {} -> {} triangles, error {:.3f}%", outData.lods.size(),
+                              outData.lods.front().triangleCount, outData.lods.back().triangleCount,
+                              outData.lods.back().error * 100.0f);
+                if (outData.lods.size() <= 1)
+                    outData.lods.clear();
             }
-            m_SubMeshes.push_back(subMesh);
+            if (isCancelled())
+                return false;
+            outData.indexStorage = std::move(stagedIndices);
+            indices = outData.indexStorage;
         }
 
-        SEA_CORE_INFO("Loaded OBJ: {} vertices, {} indices, {} submeshes", 
-                      vertices.size(), indices.size(), m_SubMeshes.size());
+        outData.vertexCount = static_cast<u32>(vertices.size());
+        outData.indexCount = static_cast<u32>(indices.size());
+        outData.vertexFormat = options.vertexFormat;
+        outData.quantization = ComputeVertexQuantization(outData.boundsMin, outData.boundsMax);
+        outData.hasBaseVertex = std::any_of(outData.subMeshes.begin(), outData.subMeshes.end(),
+                                            [](const SubMesh& subMesh) { return subMesh.baseVertex != 0; });
 
-        return CreateFromVertices(device, vertices, indices);
+        // 压缩格式先在 CPU 上量化到暂存数组，再上传
+        outData.vertexData = vertices.data();
+        if (outData.vertexFormat == VertexFormat::Quantized)
+        {
+            outData.quantizedStorage.resize(vertices.size());
+            QuantizeVertices(vertices, outData.quantization, outData.quantizedStorage);
+            outData.vertexData = outData.quantizedStorage.data();
+        }
+
+        // 所有索引都能用 16 位表示时使用 R16_UINT，索引带宽与显存减半
+        outData.indexData = indices.data();
+        outData.indexStride = sizeof(u32);
+        if (FitsIndex16(indices))
+        {
+            outData.index16Storage.assign(indices.begin(), indices.end());
+            outData.indexData = outData.index16Storage.data();
+            outData.indexStride = sizeof(u16);
+        }
+
+        // 如果没有材质，创建默认材质
+        if (outData.materials.empty())
+        {
+            Material defaultMat;
+            defaultMat.name = "Default";
+            outData.materials.push_back(defaultMat);
+        }
+
+        return !isCancelled();
     }
 
-    bool Mesh::CreateFromVertices(Device& device, 
-                                  const std::vector<Vertex>& vertices, 
-                                  const std::vector<u32>& indices)
+    bool Mesh::Upload(Device& device, MeshUploadData&& data)
     {
-        m_VertexCount = static_cast<u32>(vertices.size());
-        m_IndexCount = static_cast<u32>(indices.size());
+        m_VertexCount = data.vertexCount;
+        m_IndexCount = data.lod0IndexCount;
+        m_IndexStride = data.indexStride;
+        m_HasBaseVertex = data.hasBaseVertex;
+        m_VertexFormat = data.vertexFormat;
+        m_Quantization = data.quantization;
+        m_SubMeshes = std::move(data.subMeshes);
+        m_Materials = std::move(data.materials);
+        m_Meshlets = std::move(data.meshlets);
+        m_LODs = std::move(data.lods);
+        m_BoundsMin = data.boundsMin;
+        m_BoundsMax = data.boundsMax;
+        m_SourceHash = data.sourceHash;
 
         // 创建顶点缓冲
         BufferDesc vbDesc{};
-        vbDesc.size = vertices.size() * sizeof(Vertex);
-        vbDesc.stride = sizeof(Vertex);
+        vbDesc.size = static_cast<u64>(data.vertexCount) * GetVertexStride();
+        vbDesc.stride = GetVertexStride();
         vbDesc.type = BufferType::Vertex;
         
         m_VertexBuffer = MakeScope<Buffer>(device, vbDesc);
-        if (!m_VertexBuffer->Initialize(vertices.data()))
+        if (!m_VertexBuffer->Initialize(data.vertexData))
         {
             SEA_CORE_ERROR("Failed to create vertex buffer");
             return false;
         }
 
-        // 创建索引缓冲
         BufferDesc ibDesc{};
-        ibDesc.size = indices.size() * sizeof(u32);
-        ibDesc.stride = sizeof(u32);
+        ibDesc.size = static_cast<u64>(data.indexCount) * m_IndexStride;
+        ibDesc.stride = m_IndexStride;
         ibDesc.type = BufferType::Index;
         
         m_IndexBuffer = MakeScope<Buffer>(device, ibDesc);
-        if (!m_IndexBuffer->Initialize(indices.data()))
+        if (!m_IndexBuffer->Initialize(data.indexData))
         {
             SEA_CORE_ERROR("Failed to create index buffer");
             return false;
         }
 
-        // 如果没有子网格，创建一个
-        if (m_SubMeshes.empty())
-        {
-            SubMesh subMesh;
-            subMesh.indexOffset = 0;
-            subMesh.indexCount = m_IndexCount;
-            subMesh.materialIndex = 0;
-            m_SubMeshes.push_back(subMesh);
-        }
-
-        // 如果没有材质，创建默认材质
-        if (m_Materials.empty())
-        {
-            Material defaultMat;
-            defaultMat.name = "Default";
-            m_Materials.push_back(defaultMat);
-        }
-
-        CalculateBounds(vertices);
         return true;
     }
 
-    void Mesh::CalculateBounds(const std::vector<Vertex>& vertices)
-    {
-        if (vertices.empty()) return;
-
-        m_BoundsMin = m_BoundsMax = vertices[0].position;
-
-        for (const auto& v : vertices)
-        {
-            m_BoundsMin.x = std::min(m_BoundsMin.x, v.position.x);
-            m_BoundsMin.y = std::min(m_BoundsMin.y, v.position.y);
-            m_BoundsMin.z = std::min(m_BoundsMin.z, v.position.z);
-            m_BoundsMax.x = std::max(m_BoundsMax.x, v.position.x);
-            m_BoundsMax.y = std::max(m_BoundsMax.y, v.position.y);
-            m_BoundsMax.z = std::max(m_BoundsMax.z, v.position.z);
-        }
-    }
-
     Scope<Mesh> Mesh::CreateCube(Device& device, f32 size)
     {
         f32 h = size * 0.5f;
@@ -246,7 +360,7 @@ namespace Sea
         return mesh;
     }
 
-    Scope<Mesh> Mesh::CreateSphere(Device& device, f32 radius, u32 slices, u32 stacks)
+    Scope<Mesh> Mesh::CreateSphere(Device& device, f32 radius, u32 slices, u32 stacks, const MeshUploadOptions& options)
     {
         std::vector<Vertex> vertices;
         std::vector<u32> indices;
@@ -291,8 +405,10 @@ namespace Sea
             }
         }
 
+        OptimizeMesh(vertices, indices, {});
+
         auto mesh = MakeScope<Mesh>();
-        if (!mesh->CreateFromVertices(device, vertices, indices))
+        if (!mesh->CreateFromVertices(device, vertices, indices, options))
             return nullptr;
         return mesh;
     }
@@ -317,7 +433,8 @@ namespace Sea
         return mesh;
     }
 
-    Scope<Mesh> Mesh::CreateTorus(Device& device, f32 outerRadius, f32 innerRadius, u32 sides, u32 rings)
+    Scope<Mesh> Mesh::CreateTorus(Device& device, f32 outerRadius, f32 innerRadius, u32 sides, u32 rings,
+                                   const MeshUploadOptions& options)
     {
         std::vector<Vertex> vertices;
         std::vector<u32> indices;
@@ -370,8 +487,10 @@ namespace Sea
             }
         }
 
+        OptimizeMesh(vertices, indices, {});
+
         auto mesh = MakeScope<Mesh>();
-        if (!mesh->CreateFromVertices(device, vertices, indices))
+        if (!mesh->CreateFromVertices(device, vertices, indices, options))
             return nullptr;
         return mesh;
     }
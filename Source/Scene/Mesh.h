@@ -2,7 +2,14 @@
 
 #include "Core/Types.h"
 #include "Graphics/Buffer.h"
+#include "Scene/MeshCooker.h"
+#include "Scene/MeshData.h"
+#include "Scene/Meshlet.h"
+#include "Scene/MeshSimplifier.h"
+#include "Scene/VertexQuantization.h"
 #include <DirectXMath.h>
+#include <atomic>
+#include <span>
 #include <vector>
 #include <string>
 
@@ -10,32 +17,54 @@ namespace Sea
 {
     using namespace DirectX;
 
-    struct Vertex
-    {
-        XMFLOAT3 position;
-        XMFLOAT3 normal;
-        XMFLOAT2 texCoord;
-        XMFLOAT4 color;
-    };
+    class Device;
+    class CommandList;
+    class Camera;
 
-    struct SubMesh
+    struct MeshUploadOptions
     {
-        u32 indexOffset = 0;
-        u32 indexCount = 0;
-        u32 materialIndex = 0;
+        VertexFormat vertexFormat = VertexFormat::Standard;
+        // 顶点数超过 65536 时用 SplitMeshForIndex16 拆分子网格，使大网格也能使用 16 位索引
+        bool splitForIndex16 = false;
+        // 生成 meshlet 及其包围球 / 法线锥，供 CullMeshlets 做簇剔除（会在子网格内重排三角形）
+        bool buildMeshlets = false;
+        // 大于 1 时用 GenerateLODChain 生成 LOD 链（共用顶点缓冲，各级索引追加在 LOD0 之后）
+        u32 lodCount = 1;
     };
 
-    struct Material
+    // 上传前的 CPU 端结果：拆分、meshlet、LOD 链、量化与 16 位索引转换都已完成，只剩创建 GPU 缓冲
+    // 由 Mesh::PrepareOBJ / PrepareUpload 在任意线程生成，再在主线程交给 Mesh::Upload
+    struct MeshUploadData
     {
-        std::string name;
-        XMFLOAT4 albedo = { 1.0f, 1.0f, 1.0f, 1.0f };
-        f32 metallic = 0.0f;
-        f32 roughness = 0.5f;
-        std::string albedoTexture;
-        std::string normalTexture;
-    };
+        // 上传源：指向下面的自有存储、cooked 的映射内存，或（同步路径下）调用方的数组
+        // 自有存储只会被移动，vector 移动后数据指针不变，所以整个结构可以安全地跨线程移动
+        const void* vertexData = nullptr;
+        const void* indexData = nullptr;
+        u32 vertexCount = 0;
+        u32 indexCount = 0;             // 缓冲中的索引总数（含各级 LOD）
+        u32 lod0IndexCount = 0;
+        u32 indexStride = sizeof(u32);
+        bool hasBaseVertex = false;
+        VertexFormat vertexFormat = VertexFormat::Standard;
+        VertexQuantization quantization;
 
-    class Device;
+        std::vector<SubMesh> subMeshes;
+        std::vector<Material> materials;
+        MeshletData meshlets;
+        std::vector<MeshLOD> lods;
+        XMFLOAT3 boundsMin = { 0, 0, 0 };
+        XMFLOAT3 boundsMax = { 0, 0, 0 };
+        u64 sourceHash = 0;             // 源文件内容哈希，程序生成的网格为 0
+
+        Scope<CookedMesh> cooked;
+        std::vector<Vertex> vertexStorage;
+        std::vector<QuantizedVertex> quantizedStorage;
+        std::vector<u32> indexStorage;
+        std::vector<u16> index16Storage;
+
+        // 上传的字节数（顶点 + 索引缓冲）
+        u64 GetUploadSize() const { return static_cast<u64>(vertexCount) * GetVertexStride(vertexFormat) + static_cast<u64>(indexCount) * indexStride; }
+    };
 
     class Mesh : public NonCopyable
     {
@@ -43,43 +72,98 @@ namespace Sea
         Mesh() = default;
         ~Mesh() = default;
 
-        bool LoadFromOBJ(Device& device, const std::string& filepath);
+        // 经由烘焙缓存（.seamesh）加载，缓存命中时跳过 OBJ 解析
+        // vertexFormat 为 Quantized 时上传前按包围盒压缩成 QuantizedVertex
+        // 所有索引都小于 65536 时自动使用 16 位索引缓冲
+        bool LoadFromOBJ(Device& device, const std::string& filepath, const MeshUploadOptions& options = {});
+        // 顶点/索引直接从映射内存上传，包围盒取自文件头
+        bool LoadCooked(Device& device, const CookedMesh& cooked, const MeshUploadOptions& options = {});
         bool CreateFromVertices(Device& device, 
-                               const std::vector<Vertex>& vertices, 
-                               const std::vector<u32>& indices);
+                               std::span<const Vertex> vertices, 
+                               std::span<const u32> indices,
+                               const MeshUploadOptions& options = {});
+
+        // 异步加载用的两段式接口：PrepareOBJ 不需要图形设备，可以在工作线程上完成读取 / 解析 / 优化 / LOD 生成，
+        // Upload 在主线程创建 GPU 缓冲并接管 data 中的子网格、材质、meshlet 与 LOD 数据
+        // cancelled 非空时在各阶段之间检查，置位后尽早返回 false
+        static bool PrepareOBJ(const std::string& filepath, const MeshUploadOptions& options, MeshUploadData& outData,
+                               const std::atomic<bool>* cancelled = nullptr);
+        // outData 需先填好子网格、材质与包围盒（量化参数由包围盒得出）；vertices / indices 在 Upload 之前必须保持有效
+        static bool PrepareUpload(std::span<const Vertex> vertices, std::span<const u32> indices,
+                                  const MeshUploadOptions& options, MeshUploadData& outData,
+                                  const std::atomic<bool>* cancelled = nullptr);
+        bool Upload(Device& device, MeshUploadData&& data);
+
+        // 录制绘制命令（调用前需设置好 PSO、VB/IB）；拆分过的网格按子网格逐段绘制
+        void Draw(CommandList& cmdList, u32 instanceCount = 1) const;
+        // 只绘制 CullMeshlets 输出的可见区间
+        void Draw(CommandList& cmdList, std::span<const MeshletDrawRange> ranges, u32 instanceCount = 1) const;
+        // 绘制指定 LOD（超出范围时绘制 LOD0）
+        void DrawLOD(CommandList& cmdList, u32 lod, u32 instanceCount = 1) const;
+
+        // 选择投影误差不超过 pixelError 个像素的最粗 LOD
+        // 投影误差 = LOD 误差 × 世界空间包围盒对角线 / 到包围球的距离 × screenScale
+        u32 SelectLOD(const XMFLOAT4X4& world, const XMFLOAT3& cameraPosition, f32 screenScale, f32 pixelError) const;
+        // 距离 1 处单位长度在屏幕上的像素数：viewportHeight / (2 tan(fovY / 2))
+        static f32 GetLODScreenScale(const Camera& camera, u32 viewportHeight);
 
         // 几何体生成
         static Scope<Mesh> CreateCube(Device& device, f32 size = 1.0f);
-        static Scope<Mesh> CreateSphere(Device& device, f32 radius = 1.0f, u32 slices = 32, u32 stacks = 16);
+        static Scope<Mesh> CreateSphere(Device& device, f32 radius = 1.0f, u32 slices = 32, u32 stacks = 16,
+                                        const MeshUploadOptions& options = {});
         static Scope<Mesh> CreatePlane(Device& device, f32 width = 10.0f, f32 depth = 10.0f);
-        static Scope<Mesh> CreateTorus(Device& device, f32 outerRadius = 1.0f, f32 innerRadius = 0.3f, u32 sides = 32, u32 rings = 24);
+        static Scope<Mesh> CreateTorus(Device& device, f32 outerRadius = 1.0f, f32 innerRadius = 0.3f, u32 sides = 32, u32 rings = 24,
+                                       const MeshUploadOptions& options = {});
 
         Buffer* GetVertexBuffer() const { return m_VertexBuffer.get(); }
         Buffer* GetIndexBuffer() const { return m_IndexBuffer.get(); }
         
         u32 GetVertexCount() const { return m_VertexCount; }
-        u32 GetIndexCount() const { return m_IndexCount; }
-        u32 GetVertexStride() const { return sizeof(Vertex); }
+        u32 GetIndexCount() const { return m_IndexCount; }      // LOD0
+        u32 GetIndexStride() const { return m_IndexStride; }    // 2 或 4 字节
+        u32 GetVertexStride() const { return Sea::GetVertexStride(m_VertexFormat); }
+
+        // 压缩格式下渲染器需要把 GetQuantization().GetDequantizeMatrix() 左乘到世界矩阵上
+        VertexFormat GetVertexFormat() const { return m_VertexFormat; }
+        bool IsQuantized() const { return m_VertexFormat == VertexFormat::Quantized; }
+        const VertexQuantization& GetQuantization() const { return m_Quantization; }
         
         const std::vector<SubMesh>& GetSubMeshes() const { return m_SubMeshes; }
         const std::vector<Material>& GetMaterials() const { return m_Materials; }
 
+        bool HasMeshlets() const { return !m_Meshlets.IsEmpty(); }
+        const MeshletData& GetMeshlets() const { return m_Meshlets; }
+
+        // 没有生成 LOD 链时只有 LOD0
+        u32 GetLODCount() const { return m_LODs.empty() ? 1 : static_cast<u32>(m_LODs.size()); }
+        const std::vector<MeshLOD>& GetLODs() const { return m_LODs; }
+        u32 GetLODTriangleCount(u32 lod) const { return lod < m_LODs.size() ? m_LODs[lod].triangleCount : m_IndexCount / 3; }
+
         const XMFLOAT3& GetBoundsMin() const { return m_BoundsMin; }
         const XMFLOAT3& GetBoundsMax() const { return m_BoundsMax; }
 
-    private:
-        void CalculateBounds(const std::vector<Vertex>& vertices);
+        // 源文件内容哈希（程序生成的网格为 0），供 MeshCache 按内容去重
+        u64 GetSourceHash() const { return m_SourceHash; }
+        // 顶点 + 索引缓冲占用的显存
+        u64 GetMemorySize() const;
 
     private:
         Scope<Buffer> m_VertexBuffer;
         Scope<Buffer> m_IndexBuffer;
         u32 m_VertexCount = 0;
         u32 m_IndexCount = 0;
+        u32 m_IndexStride = sizeof(u32);
+        bool m_HasBaseVertex = false;   // 子网格带有 baseVertex 偏移，不能一次画完
+        VertexFormat m_VertexFormat = VertexFormat::Standard;
+        VertexQuantization m_Quantization;
 
         std::vector<SubMesh> m_SubMeshes;
         std::vector<Material> m_Materials;
+        MeshletData m_Meshlets;
+        std::vector<MeshLOD> m_LODs;    // [0] 为原始网格，meshlet 只对应 LOD0
 
         XMFLOAT3 m_BoundsMin = { 0, 0, 0 };
         XMFLOAT3 m_BoundsMax = { 0, 0, 0 };
+        u64 m_SourceHash = 0;
     };
 }
@@ -0,0 +1,27 @@
+#include "Scene/MeshCache.h"
+#include "Core/Hash.h"
+
+namespace Sea
+{
+    u64 MeshCache::MakeVariant(const MeshUploadOptions& options)
+    {
+        // 逐字段打包，避免结构体填充字节参与哈希
+        const u64 fields[] = {
+            static_cast<u64>(options.vertexFormat),
+            static_cast<u64>(options.splitForIndex16),
+            static_cast<u64>(options.buildMeshlets),
+            static_cast<u64>(options.lodCount),
+        };
+        return HashBytes(fields, sizeof(fields));
+    }
+
+    Mesh* MeshCache::Insert(const std::string& filepath, const MeshUploadOptions& options, Scope<Mesh> mesh)
+    {
+        if (!mesh)
+            return nullptr;
+
+        const u64 sourceHash = mesh->GetSourceHash();
+        const u64 bytes = mesh->GetMemorySize();
+        return m_Cache.Insert(filepath, MakeVariant(options), sourceHash, bytes, std::move(mesh));
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/ContentCache.h"
+#include "Scene/Mesh.h"
+#include <string>
+
+namespace Sea
+{
+    using MeshCacheStats = ContentCacheStats;
+
+    // 内容寻址、带引用计数的网格缓存，场景切换时保留
+    // 引用计数、LRU 淘汰、退役与路径校验由 ContentCache 负责；这里把上传选项折算成 variant，
+    // 并从网格取得内容哈希与显存大小
+    class MeshCache : public NonCopyable
+    {
+    public:
+        static constexpr u64 DEFAULT_MEMORY_BUDGET = 256ull << 20;
+        static constexpr u32 RETIRE_FRAMES = ContentCache<Mesh>::RETIRE_FRAMES;
+
+        explicit MeshCache(u64 memoryBudget = DEFAULT_MEMORY_BUDGET)
+            : m_Cache(memoryBudget)
+        {
+        }
+
+        // 路径的内容已知且仍在缓存中时增加引用并返回网格，否则返回 nullptr（计一次 miss，需要加载）
+        Mesh* Acquire(const std::string& filepath, const MeshUploadOptions& options)
+        {
+            return m_Cache.Acquire(filepath, MakeVariant(options));
+        }
+        // 放入加载完成的网格并返回它（带一个引用）；相同内容已在缓存中时丢弃 mesh，返回已有的网格
+        Mesh* Insert(const std::string& filepath, const MeshUploadOptions& options, Scope<Mesh> mesh);
+        void Release(Mesh* mesh) { m_Cache.Release(mesh); }
+
+        // 每帧调用一次：淘汰超出预算的无引用网格，销毁退役满 RETIRE_FRAMES 帧的网格
+        void Update() { m_Cache.Update(); }
+        // 立即销毁所有网格，调用前需确保 GPU 空闲
+        void Clear() { m_Cache.Clear(); }
+
+        void SetMemoryBudget(u64 bytes) { m_Cache.SetMemoryBudget(bytes); }
+        u64 GetMemoryBudget() const { return m_Cache.GetMemoryBudget(); }
+        MeshCacheStats GetStats() const { return m_Cache.GetStats(); }
+
+    private:
+        static u64 MakeVariant(const MeshUploadOptions& options);
+
+    private:
+        ContentCache<Mesh> m_Cache;
+    };
+}
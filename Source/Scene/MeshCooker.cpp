@@ -0,0 +1,279 @@
+#include "Scene/MeshCooker.h"
+#include "Scene/OBJLoader.h"
+#include "Core/Hash.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    static_assert(sizeof(CookedMeshHeader) == 128, "CookedMeshHeader layout changed, bump VERSION");
+    static_assert(sizeof(CookedMaterial) == 48, "CookedMaterial layout changed, bump VERSION");
+    static_assert(sizeof(SubMesh) == 16, "SubMesh layout changed, bump VERSION");
+    static_assert(sizeof(Vertex) == 48, "Vertex layout changed, bump VERSION");
+
+    namespace
+    {
+        constexpr u64 SECTION_ALIGNMENT = 64;
+
+        inline u64 AlignUp(u64 value, u64 alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        // 区段必须完整落在文件内，且起始地址满足元素对齐
+        template<typename T>
+        bool GetSection(const MappedFile& file, u64 offset, u64 count, std::span<const T>& outSection)
+        {
+            if (offset % alignof(T) != 0 || offset > file.GetSize() || count > (file.GetSize() - offset) / sizeof(T))
+                return false;
+            outSection = { reinterpret_cast<const T*>(file.GetData() + offset), static_cast<size_t>(count) };
+            return true;
+        }
+
+        void WritePadding(std::ofstream& file, u64 alignment)
+        {
+            static const char zeros[SECTION_ALIGNMENT] = {};
+            u64 position = static_cast<u64>(file.tellp());
+            file.write(zeros, static_cast<std::streamsize>(AlignUp(position, alignment) - position));
+        }
+    }
+
+    bool HashSourceFile(const std::filesystem::path& path, u64& outHash, u64& outSize)
+    {
+        MappedFile source;
+        if (!source.Open(path))
+            return false;
+        outHash = HashBytes(source.GetData(), static_cast<size_t>(source.GetSize()));
+        outSize = source.GetSize();
+        return true;
+    }
+
+    bool CookedMesh::Open(const std::filesystem::path& path, u64 expectedSourceHash)
+    {
+        Close();
+
+        if (!m_File.Open(path))
+            return false;
+
+        auto fail = [this, &path](const char* reason) {
+            SEA_CORE_WARN("Invalid cooked mesh {}: {}", path.string(), reason);
+            Close();
+            return false;
+        };
+
+        if (m_File.GetSize() < sizeof(CookedMeshHeader))
+            return fail("file too small");
+
+        const auto* header = reinterpret_cast<const CookedMeshHeader*>(m_File.GetData());
+        if (header->magic != CookedMeshHeader::MAGIC || header->version != CookedMeshHeader::VERSION)
+            return fail("unsupported format version");
+        if (header->vertexStride != sizeof(Vertex) || header->fileSize != m_File.GetSize())
+            return fail("layout mismatch");
+        if (expectedSourceHash != 0 && header->sourceHash != expectedSourceHash)
+            return fail("source hash mismatch");
+
+        if (!GetSection(m_File, header->vertexOffset, header->vertexCount, m_Vertices) ||
+            !GetSection(m_File, header->indexOffset, header->indexCount, m_Indices) ||
+            !GetSection(m_File, header->subMeshOffset, header->subMeshCount, m_SubMeshes) ||
+            !GetSection(m_File, header->materialOffset, header->materialCount, m_Materials) ||
+            !GetSection(m_File, header->stringOffset, header->stringSize, m_Strings))
+        {
+            return fail("section out of range");
+        }
+
+        // 索引会原样交给网格优化、量化与 GPU 上传，子网格区间与每个索引（加上 baseVertex）都必须落在范围内
+        for (const SubMesh& subMesh : m_SubMeshes)
+        {
+            if (static_cast<u64>(subMesh.indexOffset) + subMesh.indexCount > m_Indices.size())
+                return fail("submesh out of range");
+            for (u32 index : m_Indices.subspan(subMesh.indexOffset, subMesh.indexCount))
+            {
+                if (static_cast<u64>(index) + subMesh.baseVertex >= m_Vertices.size())
+                    return fail("index out of range");
+            }
+        }
+        if (m_SubMeshes.empty())
+        {
+            for (u32 index : m_Indices)
+            {
+                if (index >= m_Vertices.size())
+                    return fail("index out of range");
+            }
+        }
+
+        m_Header = header;
+        return true;
+    }
+
+    void CookedMesh::Close()
+    {
+        m_Header = nullptr;
+        m_Vertices = {};
+        m_Indices = {};
+        m_SubMeshes = {};
+        m_Materials = {};
+        m_Strings = {};
+        m_File.Close();
+    }
+
+    std::string CookedMesh::ReadString(u32 offset, u32 length) const
+    {
+        if (static_cast<u64>(offset) + length > m_Strings.size())
+            return {};
+        return std::string(m_Strings.data() + offset, length);
+    }
+
+    Material CookedMesh::GetMaterial(u32 index) const
+    {
+        const CookedMaterial& cooked = m_Materials[index];
+
+        Material material;
+        material.name = ReadString(cooked.nameOffset, cooked.nameLength);
+        material.albedo = cooked.albedo;
+        material.metallic = cooked.metallic;
+        material.roughness = cooked.roughness;
+        material.albedoTexture = ReadString(cooked.albedoTextureOffset, cooked.albedoTextureLength);
+        material.normalTexture = ReadString(cooked.normalTextureOffset, cooked.normalTextureLength);
+        return material;
+    }
+
+    void ComputeMeshBounds(std::span<const Vertex> vertices, XMFLOAT3& outMin, XMFLOAT3& outMax)
+    {
+        if (vertices.empty())
+        {
+            outMin = outMax = { 0, 0, 0 };
+            return;
+        }
+
+        outMin = outMax = vertices[0].position;
+        for (const auto& v : vertices)
+        {
+            outMin.x = std::min(outMin.x, v.position.x);
+            outMin.y = std::min(outMin.y, v.position.y);
+            outMin.z = std::min(outMin.z, v.position.z);
+            outMax.x = std::max(outMax.x, v.position.x);
+            outMax.y = std::max(outMax.y, v.position.y);
+            outMax.z = std::max(outMax.z, v.position.z);
+        }
+    }
+
+    bool CookMesh(const MeshData& data, u64 sourceHash, u64 sourceSize, const std::filesystem::path& outPath)
+    {
+        // 材质字符串集中写入字符串区
+        std::string strings;
+        std::vector<CookedMaterial> materials;
+        materials.reserve(data.materials.size());
+        auto addString = [&strings](const std::string& value, u32& outOffset, u32& outLength) {
+            outOffset = static_cast<u32>(strings.size());
+            outLength = static_cast<u32>(value.size());
+            strings += value;
+        };
+        for (const auto& material : data.materials)
+        {
+            CookedMaterial cooked;
+            addString(material.name, cooked.nameOffset, cooked.nameLength);
+            addString(material.albedoTexture, cooked.albedoTextureOffset, cooked.albedoTextureLength);
+            addString(material.normalTexture, cooked.normalTextureOffset, cooked.normalTextureLength);
+            cooked.albedo = material.albedo;
+            cooked.metallic = material.metallic;
+            cooked.roughness = material.roughness;
+            materials.push_back(cooked);
+        }
+
+        CookedMeshHeader header;
+        header.sourceHash = sourceHash;
+        header.sourceSize = sourceSize;
+        header.vertexCount = static_cast<u32>(data.vertices.size());
+        header.indexCount = static_cast<u32>(data.indices.size());
+        header.subMeshCount = static_cast<u32>(data.subMeshes.size());
+        header.materialCount = static_cast<u32>(materials.size());
+        ComputeMeshBounds(data.vertices, header.boundsMin, header.boundsMax);
+
+        header.vertexOffset = AlignUp(sizeof(CookedMeshHeader), SECTION_ALIGNMENT);
+        header.indexOffset = AlignUp(header.vertexOffset + data.vertices.size() * sizeof(Vertex), SECTION_ALIGNMENT);
+        header.subMeshOffset = AlignUp(header.indexOffset + data.indices.size() * sizeof(u32), SECTION_ALIGNMENT);
+        header.materialOffset = AlignUp(header.subMeshOffset + data.subMeshes.size() * sizeof(SubMesh), SECTION_ALIGNMENT);
+        header.stringOffset = AlignUp(header.materialOffset + materials.size() * sizeof(CookedMaterial), SECTION_ALIGNMENT);
+        header.stringSize = strings.size();
+        header.fileSize = header.stringOffset + header.stringSize;
+
+        // 临时文件名按线程与调用次数区分，多个加载线程同时烘焙同一个源文件时不会截断彼此的文件
+        static std::atomic<u32> s_TempCounter{ 0 };
+        std::filesystem::path tempPath = outPath;
+        tempPath += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "." +
+                    std::to_string(s_TempCounter.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                SEA_CORE_ERROR("Failed to create cooked mesh: {}", tempPath.string());
+                return false;
+            }
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            WritePadding(file, SECTION_ALIGNMENT);
+            file.write(reinterpret_cast<const char*>(data.vertices.data()), data.vertices.size() * sizeof(Vertex));
+            WritePadding(file, SECTION_ALIGNMENT);
+            file.write(reinterpret_cast<const char*>(data.indices.data()), data.indices.size() * sizeof(u32));
+            WritePadding(file, SECTION_ALIGNMENT);
+            file.write(reinterpret_cast<const char*>(data.subMeshes.data()), data.subMeshes.size() * sizeof(SubMesh));
+            WritePadding(file, SECTION_ALIGNMENT);
+            file.write(reinterpret_cast<const char*>(materials.data()), materials.size() * sizeof(CookedMaterial));
+            WritePadding(file, SECTION_ALIGNMENT);
+            file.write(strings.data(), strings.size());
+
+            if (!file)
+            {
+                SEA_CORE_ERROR("Failed to write cooked mesh: {}", tempPath.string());
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, outPath, ec);
+        if (ec)
+        {
+            SEA_CORE_ERROR("Failed to move cooked mesh into place: {} ({})", outPath.string(), ec.message());
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    std::filesystem::path GetCookedMeshPath(const std::filesystem::path& sourcePath)
+    {
+        std::filesystem::path cookedPath = sourcePath;
+        cookedPath += ".seamesh";
+        return cookedPath;
+    }
+
+    bool LoadMeshCached(const std::string& objPath, CookedMesh& outMesh)
+    {
+        u64 sourceHash = 0;
+        u64 sourceSize = 0;
+        if (!HashSourceFile(objPath, sourceHash, sourceSize))
+            return false;
+
+        const std::filesystem::path cookedPath = GetCookedMeshPath(objPath);
+        if (std::filesystem::exists(cookedPath) && outMesh.Open(cookedPath, sourceHash))
+            return true;
+
+        // 缓存缺失或过期：重新解析并烘焙
+        MeshData data;
+        if (!LoadOBJ(objPath, data))
+            return false;
+
+        if (!CookMesh(data, sourceHash, sourceSize, cookedPath))
+            return false;
+
+        SEA_CORE_INFO("Cooked mesh: {} ({} vertices, {} indices)", cookedPath.string(), data.vertices.size(), data.indices.size());
+        return outMesh.Open(cookedPath, sourceHash);
+    }
+}
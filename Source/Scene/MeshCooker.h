@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/MappedFile.h"
+#include "Scene/MeshData.h"
+#include <DirectXMath.h>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 烘焙网格文件（.seamesh）
+    // 布局：Header | Vertex[] | u32 索引[] | SubMesh[] | CookedMaterial[] | 字符串区
+    // 顶点/索引块按 64 字节对齐，映射后可以直接作为 Vertex*/u32* 使用
+    struct CookedMeshHeader
+    {
+        static constexpr u32 MAGIC = 0x4D414553;   // "SEAM"
+        static constexpr u32 VERSION = 3;      // 2: 顶点/索引经过 OptimizeMesh；3: SubMesh 增加 baseVertex
+
+        u32 magic = MAGIC;
+        u32 version = VERSION;
+        u64 sourceHash = 0;         // 源文件内容哈希
+        u64 sourceSize = 0;
+        u32 vertexStride = sizeof(Vertex);
+        u32 vertexCount = 0;
+        u32 indexCount = 0;
+        u32 subMeshCount = 0;
+        u32 materialCount = 0;
+        u32 reserved = 0;
+        XMFLOAT3 boundsMin = { 0, 0, 0 };
+        XMFLOAT3 boundsMax = { 0, 0, 0 };
+        u64 vertexOffset = 0;
+        u64 indexOffset = 0;
+        u64 subMeshOffset = 0;
+        u64 materialOffset = 0;
+        u64 stringOffset = 0;
+        u64 stringSize = 0;
+        u64 fileSize = 0;
+    };
+
+    // 材质的定长记录，字符串以 (偏移, 长度) 引用字符串区
+    struct CookedMaterial
+    {
+        u32 nameOffset = 0;
+        u32 nameLength = 0;
+        u32 albedoTextureOffset = 0;
+        u32 albedoTextureLength = 0;
+        u32 normalTextureOffset = 0;
+        u32 normalTextureLength = 0;
+        f32 metallic = 0.0f;
+        f32 roughness = 0.5f;
+        XMFLOAT4 albedo = { 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    // 通过内存映射打开的烘焙网格，顶点/索引直接指向映射内存（零拷贝）
+    class CookedMesh : public NonCopyable
+    {
+    public:
+        // 校验头部、各区段范围以及子网格与索引的范围，expectedSourceHash 非 0 时还要求与源文件哈希一致
+        bool Open(const std::filesystem::path& path, u64 expectedSourceHash = 0);
+        void Close();
+
+        bool IsOpen() const { return m_Header != nullptr; }
+        const CookedMeshHeader& GetHeader() const { return *m_Header; }
+
+        std::span<const Vertex> GetVertices() const { return m_Vertices; }
+        std::span<const u32> GetIndices() const { return m_Indices; }
+        std::span<const SubMesh> GetSubMeshes() const { return m_SubMeshes; }
+
+        u32 GetMaterialCount() const { return m_Header ? m_Header->materialCount : 0; }
+        Material GetMaterial(u32 index) const;
+
+        const XMFLOAT3& GetBoundsMin() const { return m_Header->boundsMin; }
+        const XMFLOAT3& GetBoundsMax() const { return m_Header->boundsMax; }
+
+    private:
+        std::string ReadString(u32 offset, u32 length) const;
+
+    private:
+        MappedFile m_File;
+        const CookedMeshHeader* m_Header = nullptr;
+        std::span<const Vertex> m_Vertices;
+        std::span<const u32> m_Indices;
+        std::span<const SubMesh> m_SubMeshes;
+        std::span<const CookedMaterial> m_Materials;
+        std::span<const char> m_Strings;
+    };
+
+    // 源文件内容哈希（HashBytes），烘焙缓存校验与内容寻址的网格缓存共用
+    bool HashSourceFile(const std::filesystem::path& path, u64& outHash, u64& outSize);
+
+    // 计算网格包围盒（烘焙时写入头部，加载时不再遍历顶点）
+    void ComputeMeshBounds(std::span<const Vertex> vertices, XMFLOAT3& outMin, XMFLOAT3& outMax);
+
+    // 把 CPU 网格数据写成烘焙文件（先写临时文件再改名，避免留下半个文件）
+    bool CookMesh(const MeshData& data, u64 sourceHash, u64 sourceSize, const std::filesystem::path& outPath);
+
+    // 源文件旁边的缓存路径：model.obj -> model.obj.seamesh
+    std::filesystem::path GetCookedMeshPath(const std::filesystem::path& sourcePath);
+
+    // 读取 OBJ 的烘焙缓存：按源文件内容哈希命中则直接映射，否则解析 OBJ、烘焙后再映射
+    bool LoadMeshCached(const std::string& objPath, CookedMesh& outMesh);
+}
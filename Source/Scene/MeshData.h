@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <string>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    struct Vertex
+    {
+        XMFLOAT3 position;
+        XMFLOAT3 normal;
+        XMFLOAT2 texCoord;
+        XMFLOAT4 color;
+    };
+
+    struct SubMesh
+    {
+        u32 indexOffset = 0;
+        u32 indexCount = 0;
+        u32 materialIndex = 0;
+        u32 baseVertex = 0;         // 索引相对的起始顶点（SplitMeshForIndex16 拆分后的网格才会非 0）
+    };
+
+    struct Material
+    {
+        std::string name;
+        XMFLOAT4 albedo = { 1.0f, 1.0f, 1.0f, 1.0f };
+        f32 metallic = 0.0f;
+        f32 roughness = 0.5f;
+        std::string albedoTexture;
+        std::string normalTexture;
+    };
+
+    // CPU 端网格数据（不依赖图形设备，加载/处理可以在任意线程、任意平台完成）
+    struct MeshData
+    {
+        std::vector<Vertex> vertices;
+        std::vector<u32> indices;
+        std::vector<SubMesh> subMeshes;
+        std::vector<Material> materials;
+
+        void Clear()
+        {
+            vertices.clear();
+            indices.clear();
+            subMeshes.clear();
+            materials.clear();
+        }
+    };
+}
@@ -0,0 +1,273 @@
+#include "Scene/MeshLoadScheduler.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+
+namespace Sea
+{
+    namespace
+    {
+        // max_element 返回第一个最大值，同一优先级保持先到先得
+        template<typename Iterator>
+        Iterator FindHighestPriority(Iterator begin, Iterator end)
+        {
+            return std::max_element(begin, end, [](const Ref<MeshLoadTask>& a, const Ref<MeshLoadTask>& b) {
+                return a->priority < b->priority;
+            });
+        }
+
+        template<typename Container>
+        typename Container::iterator FindTask(Container& tasks, MeshLoadId id)
+        {
+            return std::find_if(tasks.begin(), tasks.end(), [id](const Ref<MeshLoadTask>& task) { return task->id == id; });
+        }
+    }
+
+    MeshLoadScheduler::MeshLoadScheduler(u64 memoryBudget, u32 threadCount)
+        : m_MemoryBudget(memoryBudget)
+    {
+        threadCount = std::max(1u, threadCount);
+        for (u32 i = 0; i < threadCount; ++i)
+        {
+            m_Threads.emplace_back(&MeshLoadScheduler::WorkerLoop, this);
+        }
+    }
+
+    MeshLoadScheduler::~MeshLoadScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+            for (const auto& task : m_Loading)
+            {
+                task->cancelled = true;
+            }
+
+            // 读取中的任务由加载线程退出前计数
+            m_Stats.cancelled += static_cast<u32>(m_Queue.size() + m_Ready.size());
+            for (const auto& task : m_Ready)
+            {
+                ReleaseBytes(task->residentBytes);
+            }
+            m_Queue.clear();
+            m_Ready.clear();
+        }
+        m_Condition.notify_all();
+
+        for (auto& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    MeshLoadId MeshLoadScheduler::Submit(Ref<MeshLoadTask> task, MeshLoadPriority priority, u64 estimatedBytes)
+    {
+        MeshLoadId id = INVALID_MESH_LOAD;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            id = m_NextId++;
+            task->id = id;
+            task->priority = priority;
+            task->estimatedBytes = estimatedBytes;
+            m_Queue.push_back(std::move(task));
+        }
+        m_Condition.notify_one();
+        return id;
+    }
+
+    bool MeshLoadScheduler::Cancel(MeshLoadId id)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        auto queued = FindTask(m_Queue, id);
+        if (queued != m_Queue.end())
+        {
+            m_Queue.erase(queued);
+            m_Stats.cancelled++;
+            return true;
+        }
+
+        // 读取中的任务由加载线程在阶段边界发现并丢弃，内存也由它归还
+        auto loading = FindTask(m_Loading, id);
+        if (loading != m_Loading.end())
+        {
+            (*loading)->cancelled = true;
+            return true;
+        }
+
+        auto ready = FindTask(m_Ready, id);
+        if (ready != m_Ready.end())
+        {
+            const u64 bytes = (*ready)->residentBytes;
+            m_Ready.erase(ready);
+            m_Stats.cancelled++;
+            ReleaseBytes(bytes);
+            return true;
+        }
+
+        // 同一批中前面任务的回调可能取消后面的任务，由 Finish 计数并归还内存
+        auto uploading = FindTask(m_Uploading, id);
+        if (uploading != m_Uploading.end())
+        {
+            (*uploading)->cancelled = true;
+            return true;
+        }
+
+        return false;
+    }
+
+    void MeshLoadScheduler::CancelAll()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stats.cancelled += static_cast<u32>(m_Queue.size() + m_Ready.size());
+        m_Queue.clear();
+        for (const auto& task : m_Ready)
+        {
+            ReleaseBytes(task->residentBytes);
+        }
+        m_Ready.clear();
+        for (const auto& task : m_Loading)
+        {
+            task->cancelled = true;
+        }
+        for (const auto& task : m_Uploading)
+        {
+            task->cancelled = true;
+        }
+    }
+
+    bool MeshLoadScheduler::SetPriority(MeshLoadId id, MeshLoadPriority priority)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto queued = FindTask(m_Queue, id);
+        if (queued == m_Queue.end())
+            return false;
+
+        (*queued)->priority = priority;
+        return true;
+    }
+
+    void MeshLoadScheduler::AcquireReady(u64 uploadBudget, std::vector<Ref<MeshLoadTask>>& outTasks)
+    {
+        outTasks.clear();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        u64 uploadBytes = 0;
+        while (!m_Ready.empty() && (outTasks.empty() || uploadBytes + m_Ready.front()->residentBytes <= uploadBudget))
+        {
+            uploadBytes += m_Ready.front()->residentBytes;
+            outTasks.push_back(m_Ready.front());
+            m_Uploading.push_back(std::move(m_Ready.front()));
+            m_Ready.pop_front();
+        }
+    }
+
+    void MeshLoadScheduler::Finish(const MeshLoadTask& task, bool success)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto uploading = FindTask(m_Uploading, task.id);
+        if (uploading == m_Uploading.end())
+            return;
+
+        if (task.cancelled)
+            m_Stats.cancelled++;
+        else if (success)
+            m_Stats.completed++;
+        else
+            m_Stats.failed++;
+        ReleaseBytes(task.residentBytes);
+        m_Uploading.erase(uploading);
+    }
+
+    bool MeshLoadScheduler::IsIdle() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Queue.empty() && m_Loading.empty() && m_Ready.empty() && m_Uploading.empty();
+    }
+
+    MeshLoaderStats MeshLoadScheduler::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        MeshLoaderStats stats = m_Stats;
+        stats.queued = static_cast<u32>(m_Queue.size());
+        stats.loading = static_cast<u32>(m_Loading.size());
+        stats.ready = static_cast<u32>(m_Ready.size() + m_Uploading.size());
+        return stats;
+    }
+
+    void MeshLoadScheduler::SetMemoryBudget(u64 bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_MemoryBudget = bytes;
+        }
+        m_Condition.notify_all();
+    }
+
+    u64 MeshLoadScheduler::GetMemoryBudget() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_MemoryBudget;
+    }
+
+    bool MeshLoadScheduler::CanStartNext() const
+    {
+        if (m_Queue.empty())
+            return false;
+
+        // 没有其它任务占用内存时总是放行，保证超出预算的大文件也能加载
+        auto next = FindHighestPriority(m_Queue.begin(), m_Queue.end());
+        return m_Stats.inFlightBytes == 0 || m_Stats.inFlightBytes + (*next)->estimatedBytes <= m_MemoryBudget;
+    }
+
+    void MeshLoadScheduler::ReleaseBytes(u64 bytes)
+    {
+        m_Stats.inFlightBytes -= std::min(bytes, m_Stats.inFlightBytes);
+        m_Condition.notify_all();
+    }
+
+    void MeshLoadScheduler::WorkerLoop()
+    {
+        // 加载线程上的 ParallelFor 全部串行执行，不占用帧内使用的全局任务系统
+        ScopedJobSystem jobSystem(1);
+
+        while (true)
+        {
+            Ref<MeshLoadTask> task;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [this] { return m_Stop || CanStartNext(); });
+                if (m_Stop)
+                    return;
+
+                auto next = FindHighestPriority(m_Queue.begin(), m_Queue.end());
+                task = *next;
+                m_Queue.erase(next);
+                m_Loading.push_back(task);
+
+                m_Stats.inFlightBytes += task->estimatedBytes;
+                m_Stats.peakInFlightBytes = std::max(m_Stats.peakInFlightBytes, m_Stats.inFlightBytes);
+            }
+
+            const bool success = !task->cancelled && task->Prepare();
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Loading.erase(std::find(m_Loading.begin(), m_Loading.end(), task));
+            m_Stats.inFlightBytes -= std::min(task->estimatedBytes, m_Stats.inFlightBytes);
+
+            if (task->cancelled)
+            {
+                // 任务持有的数据在 task 析构时释放（锁外）
+                m_Stats.cancelled++;
+                m_Condition.notify_all();
+                continue;
+            }
+
+            // 估算值换成实际大小，直到主线程上传完才归还
+            task->success = success;
+            task->residentBytes = success ? task->GetResidentBytes() : 0;
+            m_Stats.inFlightBytes += task->residentBytes;
+            m_Stats.peakInFlightBytes = std::max(m_Stats.peakInFlightBytes, m_Stats.inFlightBytes);
+            m_Ready.push_back(task);
+            m_Condition.notify_all();
+        }
+    }
+}
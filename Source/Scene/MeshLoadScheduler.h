@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    using MeshLoadId = u64;
+    constexpr MeshLoadId INVALID_MESH_LOAD = 0;
+
+    // 优先级高的先开始读取，同一优先级先到先得
+    enum class MeshLoadPriority : u8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    struct MeshLoaderStats
+    {
+        u32 queued = 0;             // 等待开始
+        u32 loading = 0;            // 正在读取 / 解析 / 优化
+        u32 ready = 0;              // 等待主线程上传（含正在上传的）
+        u64 inFlightBytes = 0;      // 读取中（估算）与等待上传（实际）的内存
+        u64 peakInFlightBytes = 0;
+        u32 completed = 0;
+        u32 failed = 0;
+        u32 cancelled = 0;
+    };
+
+    // 加载线程上执行的任务，派生类持有输入与准备好的数据
+    struct MeshLoadTask : public NonCopyable
+    {
+        virtual ~MeshLoadTask() = default;
+
+        // 在加载线程上执行，应在阶段边界检查 cancelled 并尽早返回
+        virtual bool Prepare() = 0;
+        // Prepare 成功后，数据在上传前占用的字节数
+        virtual u64 GetResidentBytes() const = 0;
+
+        // 以下由 MeshLoadScheduler 维护
+        MeshLoadId id = INVALID_MESH_LOAD;
+        MeshLoadPriority priority = MeshLoadPriority::Normal;
+        u64 estimatedBytes = 0;     // 开始读取前的估算
+        u64 residentBytes = 0;      // 读取完成后的实际大小
+        std::atomic<bool> cancelled{ false };
+        bool success = false;
+    };
+
+    // AsyncMeshLoader 中与设备无关的部分：排队、加载线程、内存预算、取消与统计
+    // 任务依次经过 排队 -> 读取中 -> 等待上传 -> 上传中 四个状态，各状态的数量直接由对应的容器给出
+    // 读取中和等待上传的任务总内存不超过 memoryBudget（单个超出预算的任务在没有其它任务占用时仍会放行）
+    // 每个加载线程换用单线程的 ScopedJobSystem，Prepare 内部的 ParallelFor 在加载线程上串行执行，
+    // 不会向全局 JobSystem 提交任务，长时间的加载不会占住帧内 ParallelFor 等待的工作线程
+    // 析构时排队中、读取中与等待上传的任务都计入 cancelled
+    class MeshLoadScheduler : public NonCopyable
+    {
+    public:
+        explicit MeshLoadScheduler(u64 memoryBudget, u32 threadCount = 1);
+        ~MeshLoadScheduler();
+
+        MeshLoadId Submit(Ref<MeshLoadTask> task, MeshLoadPriority priority, u64 estimatedBytes);
+
+        // 排队中的任务直接移除；读取中的任务在下一个阶段边界停下；等待上传的直接丢弃；上传中的由 Finish 计数
+        bool Cancel(MeshLoadId id);
+        void CancelAll();
+        // 只对还在排队的任务有效
+        bool SetPriority(MeshLoadId id, MeshLoadPriority priority);
+
+        // 主线程调用：按完成顺序取出等待上传的任务，总字节数不超过 uploadBudget（至少一个），取出的任务进入上传中
+        void AcquireReady(u64 uploadBudget, std::vector<Ref<MeshLoadTask>>& outTasks);
+        // 上传结束后调用，归还内存并按结果计数；上传前已取消的任务计入 cancelled
+        void Finish(const MeshLoadTask& task, bool success);
+
+        bool IsIdle() const;
+        MeshLoaderStats GetStats() const;
+
+        void SetMemoryBudget(u64 bytes);
+        u64 GetMemoryBudget() const;
+
+    private:
+        void WorkerLoop();
+        bool CanStartNext() const;
+        void ReleaseBytes(u64 bytes);
+
+    private:
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        std::vector<std::thread> m_Threads;
+        bool m_Stop = false;
+
+        std::deque<Ref<MeshLoadTask>> m_Queue;
+        std::vector<Ref<MeshLoadTask>> m_Loading;
+        std::deque<Ref<MeshLoadTask>> m_Ready;
+        std::vector<Ref<MeshLoadTask>> m_Uploading;
+
+        MeshLoadId m_NextId = 1;
+        u64 m_MemoryBudget = 0;
+        MeshLoaderStats m_Stats;    // queued / loading / ready 在 GetStats 中按容器大小填写
+    };
+}
@@ -0,0 +1,481 @@
+#include "Scene/MeshOptimizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace Sea
+{
+    namespace
+    {
+        // 时间戳形式的 FIFO 缓存：顶点进入缓存时记录时间戳，time - stamp > cacheSize 即已被挤出
+        inline u32 UpdateCache(const u32* indices, size_t indexCount, u32 cacheSize, std::vector<u32>& timestamps, u32& time)
+        {
+            u32 misses = 0;
+            for (size_t i = 0; i < indexCount; ++i)
+            {
+                const u32 v = indices[i];
+                if (time - timestamps[v] > cacheSize)
+                {
+                    timestamps[v] = time++;
+                    ++misses;
+                }
+            }
+            return misses;
+        }
+
+        // 顶点 -> 相邻三角形（CSR）
+        struct TriangleAdjacency
+        {
+            std::vector<u32> offsets;
+            std::vector<u32> triangles;
+
+            TriangleAdjacency(std::span<const u32> indices, u32 vertexCount, std::vector<u32>& outLiveCounts)
+            {
+                outLiveCounts.assign(vertexCount, 0);
+                for (u32 v : indices)
+                    ++outLiveCounts[v];
+
+                offsets.resize(vertexCount + 1);
+                offsets[0] = 0;
+                for (u32 v = 0; v < vertexCount; ++v)
+                    offsets[v + 1] = offsets[v] + outLiveCounts[v];
+
+                triangles.resize(indices.size());
+                std::vector<u32> cursor(offsets.begin(), offsets.end() - 1);
+                for (size_t i = 0; i < indices.size(); ++i)
+                    triangles[cursor[indices[i]]++] = static_cast<u32>(i / 3);
+            }
+        };
+
+        struct Float3
+        {
+            f64 x = 0.0, y = 0.0, z = 0.0;
+        };
+
+        struct ClusterSortKey
+        {
+            f32 key;
+            u32 cluster;
+        };
+    }
+
+    VertexCacheStats AnalyzeVertexCache(std::span<const u32> indices, u32 vertexCount, u32 cacheSize)
+    {
+        VertexCacheStats stats;
+        if (indices.size() < 3 || vertexCount == 0)
+            return stats;
+
+        std::vector<u32> timestamps(vertexCount, 0);
+        std::vector<u8> referenced(vertexCount, 0);
+        u32 time = cacheSize + 1;
+        const u32 misses = UpdateCache(indices.data(), indices.size(), cacheSize, timestamps, time);
+
+        u32 referencedCount = 0;
+        for (u32 v : indices)
+        {
+            referencedCount += referenced[v] ? 0 : 1;
+            referenced[v] = 1;
+        }
+
+        stats.acmr = static_cast<f32>(misses) / static_cast<f32>(indices.size() / 3);
+        stats.atvr = static_cast<f32>(misses) / static_cast<f32>(referencedCount);
+        return stats;
+    }
+
+    void OptimizeVertexCache(std::span<u32> indices, u32 vertexCount, std::vector<u32>* outClusters, u32 cacheSize)
+    {
+        if (outClusters)
+        {
+            outClusters->clear();
+            outClusters->push_back(0);
+        }
+
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0 || vertexCount == 0)
+            return;
+
+        const std::vector<u32> input(indices.begin(), indices.begin() + triangleCount * 3);
+        std::vector<u32> liveTriangles;
+        const TriangleAdjacency adjacency(input, vertexCount, liveTriangles);
+
+        std::vector<u32> timestamps(vertexCount, 0);
+        std::vector<u8> emitted(triangleCount, 0);
+        std::vector<u32> deadEnd;
+        std::vector<u32> candidates;
+        deadEnd.reserve(input.size());
+        candidates.reserve(64);
+
+        u32 time = cacheSize + 1;
+        u32 inputCursor = 0;
+        size_t outputCursor = 0;
+
+        // 死胡同：先从最近输出过的顶点里找仍有未输出三角形的，找不到再按顶点序号顺序扫描
+        auto skipDeadEnd = [&]() -> i64 {
+            while (!deadEnd.empty())
+            {
+                const u32 v = deadEnd.back();
+                deadEnd.pop_back();
+                if (liveTriangles[v] > 0)
+                    return v;
+            }
+            while (inputCursor < vertexCount)
+            {
+                if (liveTriangles[inputCursor] > 0)
+                    return inputCursor;
+                ++inputCursor;
+            }
+            return -1;
+        };
+
+        i64 fanning = skipDeadEnd();
+        while (fanning >= 0)
+        {
+            // 输出扇心顶点的所有剩余三角形
+            candidates.clear();
+            for (u32 a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; ++a)
+            {
+                const u32 triangle = adjacency.triangles[a];
+                if (emitted[triangle])
+                    continue;
+                emitted[triangle] = 1;
+
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const u32 v = input[triangle * 3 + k];
+                    indices[outputCursor++] = v;
+                    deadEnd.push_back(v);
+                    candidates.push_back(v);
+                    --liveTriangles[v];
+                    if (time - timestamps[v] > cacheSize)
+                        timestamps[v] = time++;
+                }
+            }
+
+            // 下一个扇心：扇出后仍留在缓存中的顶点里，在缓存中最久的优先
+            i64 best = -1;
+            i64 bestPriority = -1;
+            for (u32 v : candidates)
+            {
+                if (liveTriangles[v] == 0)
+                    continue;
+
+                i64 priority = 0;
+                if (time - timestamps[v] + 2 * liveTriangles[v] <= cacheSize)
+                    priority = time - timestamps[v];
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    best = v;
+                }
+            }
+
+            if (best < 0)
+            {
+                best = skipDeadEnd();
+                if (best >= 0 && outClusters)
+                    outClusters->push_back(static_cast<u32>(outputCursor / 3));
+            }
+            fanning = best;
+        }
+    }
+
+    void OptimizeOverdraw(std::span<u32> indices, std::span<const Vertex> vertices, std::span<const u32> clusters,
+                          f32 threshold, u32* outClusterCount)
+    {
+        const u32 triangleCount = static_cast<u32>(indices.size() / 3);
+        const u32 vertexCount = static_cast<u32>(vertices.size());
+        if (triangleCount == 0)
+            return;
+
+        // 1. 软边界：硬簇内累计 ACMR 一旦降到 (簇 ACMR * threshold) 以下就切开，之后重置缓存
+        std::vector<u32> softClusters;
+        std::vector<u32> timestamps(vertexCount, 0);
+        u32 time = 0;
+        for (size_t c = 0; c < clusters.size(); ++c)
+        {
+            const u32 start = clusters[c];
+            const u32 end = (c + 1 < clusters.size()) ? clusters[c + 1] : triangleCount;
+            if (start >= end)
+                continue;
+
+            time += VERTEX_CACHE_SIZE + 1;
+            const u32 clusterMisses = UpdateCache(&indices[start * 3], (end - start) * 3, VERTEX_CACHE_SIZE, timestamps, time);
+            const f32 targetAcmr = static_cast<f32>(clusterMisses) / static_cast<f32>(end - start) * threshold;
+
+            softClusters.push_back(start);
+            time += VERTEX_CACHE_SIZE + 1;
+            u32 runningMisses = 0;
+            u32 runningTriangles = 0;
+            for (u32 t = start; t < end; ++t)
+            {
+                runningMisses += UpdateCache(&indices[t * 3], 3, VERTEX_CACHE_SIZE, timestamps, time);
+                ++runningTriangles;
+                if (static_cast<f32>(runningMisses) / static_cast<f32>(runningTriangles) <= targetAcmr && t + 1 < end)
+                {
+                    softClusters.push_back(t + 1);
+                    time += VERTEX_CACHE_SIZE + 1;
+                    runningMisses = 0;
+                    runningTriangles = 0;
+                }
+            }
+        }
+
+        const u32 clusterCount = static_cast<u32>(softClusters.size());
+        if (outClusterCount)
+            *outClusterCount = clusterCount;
+        if (clusterCount <= 1)
+            return;
+
+        // 2. 每个簇的面积加权中心与法线
+        std::vector<Float3> centroids(clusterCount);
+        std::vector<Float3> normals(clusterCount);
+        std::vector<f64> areas(clusterCount, 0.0);
+        Float3 meshCentroid;
+        f64 meshArea = 0.0;
+
+        for (u32 c = 0; c < clusterCount; ++c)
+        {
+            const u32 start = softClusters[c];
+            const u32 end = (c + 1 < clusterCount) ? softClusters[c + 1] : triangleCount;
+            for (u32 t = start; t < end; ++t)
+            {
+                const XMFLOAT3& p0 = vertices[indices[t * 3 + 0]].position;
+                const XMFLOAT3& p1 = vertices[indices[t * 3 + 1]].position;
+                const XMFLOAT3& p2 = vertices[indices[t * 3 + 2]].position;
+
+                const f64 e1x = p1.x - p0.x, e1y = p1.y - p0.y, e1z = p1.z - p0.z;
+                const f64 e2x = p2.x - p0.x, e2y = p2.y - p0.y, e2z = p2.z - p0.z;
+                const f64 nx = e1y * e2z - e1z * e2y;
+                const f64 ny = e1z * e2x - e1x * e2z;
+                const f64 nz = e1x * e2y - e1y * e2x;
+                const f64 area = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+                const f64 cx = (p0.x + p1.x + p2.x) / 3.0;
+                const f64 cy = (p0.y + p1.y + p2.y) / 3.0;
+                const f64 cz = (p0.z + p1.z + p2.z) / 3.0;
+
+                centroids[c].x += cx * area;
+                centroids[c].y += cy * area;
+                centroids[c].z += cz * area;
+                normals[c].x += nx;
+                normals[c].y += ny;
+                normals[c].z += nz;
+                areas[c] += area;
+            }
+
+            meshCentroid.x += centroids[c].x;
+            meshCentroid.y += centroids[c].y;
+            meshCentroid.z += centroids[c].z;
+            meshArea += areas[c];
+        }
+
+        if (meshArea <= 0.0)
+            return;
+        meshCentroid.x /= meshArea;
+        meshCentroid.y /= meshArea;
+        meshCentroid.z /= meshArea;
+
+        // 3. 朝外的簇先画：key = dot(簇中心 - 网格中心, 簇法线)
+        std::vector<ClusterSortKey> sortKeys(clusterCount);
+        for (u32 c = 0; c < clusterCount; ++c)
+        {
+            f64 key = 0.0;
+            const f64 normalLength = std::sqrt(normals[c].x * normals[c].x + normals[c].y * normals[c].y + normals[c].z * normals[c].z);
+            if (areas[c] > 0.0 && normalLength > 0.0)
+            {
+                const f64 dx = centroids[c].x / areas[c] - meshCentroid.x;
+                const f64 dy = centroids[c].y / areas[c] - meshCentroid.y;
+                const f64 dz = centroids[c].z / areas[c] - meshCentroid.z;
+                key = (dx * normals[c].x + dy * normals[c].y + dz * normals[c].z) / normalLength;
+            }
+            sortKeys[c] = { static_cast<f32>(key), c };
+        }
+
+        std::stable_sort(sortKeys.begin(), sortKeys.end(), [](const ClusterSortKey& a, const ClusterSortKey& b) {
+            return a.key > b.key;
+        });
+
+        const std::vector<u32> source(indices.begin(), indices.begin() + triangleCount * 3);
+        size_t outputCursor = 0;
+        for (const auto& sortKey : sortKeys)
+        {
+            const u32 start = softClusters[sortKey.cluster];
+            const u32 end = (sortKey.cluster + 1 < clusterCount) ? softClusters[sortKey.cluster + 1] : triangleCount;
+            std::copy(source.begin() + start * 3, source.begin() + end * 3, indices.begin() + outputCursor);
+            outputCursor += (end - start) * 3;
+        }
+    }
+
+    u32 OptimizeVertexFetch(std::vector<Vertex>& vertices, std::span<u32> indices)
+    {
+        constexpr u32 UNUSED = ~0u;
+        std::vector<u32> remap(vertices.size(), UNUSED);
+        std::vector<Vertex> reordered;
+        reordered.reserve(vertices.size());
+
+        for (u32& index : indices)
+        {
+            if (remap[index] == UNUSED)
+            {
+                remap[index] = static_cast<u32>(reordered.size());
+                reordered.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+
+        vertices.swap(reordered);
+        return static_cast<u32>(vertices.size());
+    }
+
+    void OptimizeMesh(std::vector<Vertex>& vertices, std::vector<u32>& indices, std::span<const SubMesh> subMeshes,
+                      MeshOptimizeStats* outStats)
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        const u32 vertexCount = static_cast<u32>(vertices.size());
+
+        MeshOptimizeStats stats;
+        stats.before = AnalyzeVertexCache(indices, vertexCount);
+
+        // 子网格各自优化；先压缩成局部顶点编号，避免每个子网格都分配整网格大小的辅助数组
+        constexpr u32 UNUSED = ~0u;
+        std::vector<u32> globalToLocal(vertexCount, UNUSED);
+        std::vector<u32> localToGlobal;
+        std::vector<Vertex> localVertices;
+        std::vector<u32> clusters;
+
+        auto optimizeRange = [&](u32 indexOffset, u32 indexCount) {
+            indexCount -= indexCount % 3;
+            if (indexCount < 6 || static_cast<size_t>(indexOffset) + indexCount > indices.size())
+                return;
+
+            std::span<u32> range(indices.data() + indexOffset, indexCount);
+            localToGlobal.clear();
+            localVertices.clear();
+            for (u32& index : range)
+            {
+                if (globalToLocal[index] == UNUSED)
+                {
+                    globalToLocal[index] = static_cast<u32>(localToGlobal.size());
+                    localToGlobal.push_back(index);
+                    localVertices.push_back(vertices[index]);
+                }
+                index = globalToLocal[index];
+            }
+
+            u32 clusterCount = 0;
+            OptimizeVertexCache(range, static_cast<u32>(localToGlobal.size()), &clusters);
+            OptimizeOverdraw(range, localVertices, clusters, 1.05f, &clusterCount);
+            stats.clusterCount += clusterCount;
+
+            for (u32& index : range)
+                index = localToGlobal[index];
+            for (u32 global : localToGlobal)
+                globalToLocal[global] = UNUSED;
+        };
+
+        if (subMeshes.empty())
+        {
+            optimizeRange(0, static_cast<u32>(indices.size()));
+        }
+        else
+        {
+            for (const auto& subMesh : subMeshes)
+                optimizeRange(subMesh.indexOffset, subMesh.indexCount);
+        }
+
+        OptimizeVertexFetch(vertices, indices);
+
+        stats.after = AnalyzeVertexCache(indices, static_cast<u32>(vertices.size()));
+        stats.timeMs = std::chrono::duration<f32, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+        if (outStats)
+            *outStats = stats;
+    }
+
+    bool FitsIndex16(std::span<const u32> indices)
+    {
+        u32 maxIndex = 0;
+        for (u32 index : indices)
+            maxIndex = std::max(maxIndex, index);
+        return maxIndex < INDEX16_MAX_VERTICES;
+    }
+
+    u32 SplitMeshForIndex16(std::vector<Vertex>& vertices, std::vector<u32>& indices, std::vector<SubMesh>& subMeshes,
+                            u32 maxVertices)
+    {
+        if (vertices.size() <= maxVertices || maxVertices < 3)
+            return static_cast<u32>(std::max<size_t>(subMeshes.size(), 1));
+
+        std::vector<SubMesh> sourceSubMeshes = subMeshes;
+        if (sourceSubMeshes.empty())
+        {
+            SubMesh whole;
+            whole.indexCount = static_cast<u32>(indices.size());
+            sourceSubMeshes.push_back(whole);
+        }
+
+        constexpr u32 UNUSED = ~0u;
+        std::vector<u32> globalToLocal(vertices.size(), UNUSED);
+        std::vector<u32> localToGlobal;
+        localToGlobal.reserve(maxVertices);
+
+        std::vector<Vertex> splitVertices;
+        std::vector<u32> splitIndices;
+        std::vector<SubMesh> splitSubMeshes;
+        splitVertices.reserve(vertices.size());
+        splitIndices.reserve(indices.size());
+
+        for (const SubMesh& source : sourceSubMeshes)
+        {
+            const size_t begin = std::min<size_t>(source.indexOffset, indices.size());
+            size_t end = std::min<size_t>(begin + source.indexCount, indices.size());
+            end -= (end - begin) % 3;
+
+            SubMesh segment;
+            segment.materialIndex = source.materialIndex;
+            segment.indexOffset = static_cast<u32>(splitIndices.size());
+            segment.baseVertex = static_cast<u32>(splitVertices.size());
+
+            // 结束当前段：清空局部编号，下一段从当前顶点/索引末尾开始
+            auto flush = [&]() {
+                segment.indexCount = static_cast<u32>(splitIndices.size()) - segment.indexOffset;
+                if (segment.indexCount > 0)
+                    splitSubMeshes.push_back(segment);
+                for (u32 global : localToGlobal)
+                    globalToLocal[global] = UNUSED;
+                localToGlobal.clear();
+                segment.indexOffset = static_cast<u32>(splitIndices.size());
+                segment.baseVertex = static_cast<u32>(splitVertices.size());
+            };
+
+            for (size_t i = begin; i < end; i += 3)
+            {
+                // 退化三角形里重复的新顶点会被多算一次，只会让段稍早结束
+                u32 newVertices = 0;
+                for (u32 k = 0; k < 3; ++k)
+                    newVertices += globalToLocal[indices[i + k]] == UNUSED ? 1 : 0;
+                if (localToGlobal.size() + newVertices > maxVertices)
+                    flush();
+
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const u32 global = indices[i + k];
+                    if (globalToLocal[global] == UNUSED)
+                    {
+                        globalToLocal[global] = static_cast<u32>(localToGlobal.size());
+                        localToGlobal.push_back(global);
+                        splitVertices.push_back(vertices[global]);
+                    }
+                    splitIndices.push_back(globalToLocal[global]);
+                }
+            }
+            flush();
+        }
+
+        vertices.swap(splitVertices);
+        indices.swap(splitIndices);
+        subMeshes.swap(splitSubMeshes);
+        return static_cast<u32>(subMeshes.size());
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    // 后变换顶点缓存模拟使用的 FIFO 大小
+    constexpr u32 VERTEX_CACHE_SIZE = 16;
+
+    // 16 位索引能寻址的顶点数
+    constexpr u32 INDEX16_MAX_VERTICES = 65536;
+
+    struct VertexCacheStats
+    {
+        f32 acmr = 0.0f;    // 平均每个三角形的缓存未命中数（最优 0.5，最差 3）
+        f32 atvr = 0.0f;    // 缓存未命中数 / 被引用顶点数（最优 1）
+    };
+
+    struct MeshOptimizeStats
+    {
+        VertexCacheStats before;
+        VertexCacheStats after;
+        u32 clusterCount = 0;       // 参与 overdraw 排序的簇数
+        f32 timeMs = 0.0f;
+    };
+
+    // FIFO 缓存模拟，统计 ACMR / ATVR
+    VertexCacheStats AnalyzeVertexCache(std::span<const u32> indices, u32 vertexCount, u32 cacheSize = VERTEX_CACHE_SIZE);
+
+    // Tipsify（Sander et al. 2007）：线性时间的顶点缓存重排
+    // outClusters 返回硬边界（每次跳出死胡同时缓存内容失效）处的三角形下标，第一个总是 0
+    void OptimizeVertexCache(std::span<u32> indices, u32 vertexCount, std::vector<u32>* outClusters = nullptr,
+                             u32 cacheSize = VERTEX_CACHE_SIZE);
+
+    // 在硬边界内再按 ACMR 阈值切出软边界，然后按“簇中心相对网格中心在簇法线上的投影”从外向内排序
+    // threshold 为允许的 ACMR 退化比例（1.05 = 最多比缓存最优顺序差 5%）
+    void OptimizeOverdraw(std::span<u32> indices, std::span<const Vertex> vertices, std::span<const u32> clusters,
+                          f32 threshold = 1.05f, u32* outClusterCount = nullptr);
+
+    // 按首次使用顺序重排顶点缓冲并改写索引，未被引用的顶点会被丢弃；返回新的顶点数
+    u32 OptimizeVertexFetch(std::vector<Vertex>& vertices, std::span<u32> indices);
+
+    // 完整流程：每个子网格内做缓存重排 + overdraw 排序（子网格的索引区间保持不变），最后整体做顶点获取重排
+    // 要求索引为全局顶点编号（baseVertex 为 0），需要拆分时应在优化之后调用 SplitMeshForIndex16
+    void OptimizeMesh(std::vector<Vertex>& vertices, std::vector<u32>& indices, std::span<const SubMesh> subMeshes,
+                      MeshOptimizeStats* outStats = nullptr);
+
+    inline void OptimizeMesh(MeshData& data, MeshOptimizeStats* outStats = nullptr)
+    {
+        OptimizeMesh(data.vertices, data.indices, data.subMeshes, outStats);
+    }
+
+    // 所有索引都小于 INDEX16_MAX_VERTICES 时返回 true，上传时据此选择 R16_UINT 索引缓冲
+    bool FitsIndex16(std::span<const u32> indices);
+
+    // 把子网格按三角形顺序切成引用顶点不超过 maxVertices 的段，每段的顶点连续存放并记录在 baseVertex，
+    // 索引改写为段内编号，之后整个网格都可以使用 16 位索引（段之间共享的顶点会被复制）
+    // 子网格为空时视为一个覆盖全部索引的子网格；顶点数本来就不超过 maxVertices 时不做修改
+    // 返回拆分后的子网格数
+    u32 SplitMeshForIndex16(std::vector<Vertex>& vertices, std::vector<u32>& indices, std::vector<SubMesh>& subMeshes,
+                            u32 maxVertices = INDEX16_MAX_VERTICES);
+
+    inline u32 SplitMeshForIndex16(MeshData& data, u32 maxVertices = INDEX16_MAX_VERTICES)
+    {
+        return SplitMeshForIndex16(data.vertices, data.indices, data.subMeshes, maxVertices);
+    }
+}
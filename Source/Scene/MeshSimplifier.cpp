@@ -0,0 +1,534 @@
+#include "Scene/MeshSimplifier.h"
+#include "Scene/MeshOptimizer.h"
+#include "Scene/MeshCooker.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u32 UNUSED = ~0u;
+
+        // 开放边界边的垂直平面权重（相对三角形面积），越大边界越不容易被拉动
+        constexpr f64 BORDER_WEIGHT = 10.0;
+
+        // 每一轮只接受误差不超过“达到目标所需的第 N 小误差”这一倍数的折叠，避免一轮里为了凑数量做出昂贵的折叠
+        constexpr f64 PASS_ERROR_SLACK = 1.5;
+
+        XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        f32 Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        f32 Length(const XMFLOAT3& v) { return std::sqrt(Dot(v, v)); }
+
+        XMFLOAT3 Cross(const XMFLOAT3& a, const XMFLOAT3& b)
+        {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        // 对称 4x4 二次型，w 为累计权重（面积）
+        struct Quadric
+        {
+            f64 a00 = 0, a11 = 0, a22 = 0, a01 = 0, a02 = 0, a12 = 0;
+            f64 b0 = 0, b1 = 0, b2 = 0, c = 0, w = 0;
+
+            void AddPlane(f64 nx, f64 ny, f64 nz, f64 d, f64 weight)
+            {
+                a00 += weight * nx * nx; a11 += weight * ny * ny; a22 += weight * nz * nz;
+                a01 += weight * nx * ny; a02 += weight * nx * nz; a12 += weight * ny * nz;
+                b0 += weight * nx * d; b1 += weight * ny * d; b2 += weight * nz * d;
+                c += weight * d * d;
+                w += weight;
+            }
+
+            void Add(const Quadric& o)
+            {
+                a00 += o.a00; a11 += o.a11; a22 += o.a22; a01 += o.a01; a02 += o.a02; a12 += o.a12;
+                b0 += o.b0; b1 += o.b1; b2 += o.b2; c += o.c; w += o.w;
+            }
+
+            // 加权平均的平方距离
+            f64 Error(const XMFLOAT3& p) const
+            {
+                const f64 x = p.x, y = p.y, z = p.z;
+                const f64 r = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                              2.0 * (b0 * x + b1 * y + b2 * z) + c;
+                return w > 0.0 ? std::abs(r) / w : 0.0;
+            }
+        };
+
+        struct Collapse
+        {
+            u32 from;
+            u32 to;
+            f64 error;
+        };
+    }
+
+    f32 SimplifyMesh(std::span<const Vertex> vertices, std::span<const u32> indices, std::span<const u32> triangleGroups,
+                     u32 targetTriangleCount, f32 targetError, std::vector<u32>& outIndices, std::vector<u32>& outGroups,
+                     SimplifyStats* outStats)
+    {
+        SimplifyStats stats;
+        const u32 vertexCount = static_cast<u32>(vertices.size());
+        outIndices.assign(indices.begin(), indices.end() - indices.size() % 3);
+        outGroups.assign(outIndices.size() / 3, 0);
+        for (size_t t = 0; t < outGroups.size() && t < triangleGroups.size(); ++t)
+            outGroups[t] = triangleGroups[t];
+
+        for (u32 index : outIndices)
+        {
+            if (index >= vertexCount)
+            {
+                SEA_CORE_ERROR("SimplifyMesh: index {} out of range ({} vertices)", index, vertexCount);
+                if (outStats)
+                    *outStats = stats;
+                return 0.0f;
+            }
+        }
+
+        // 位置去重：同一位置上的多个顶点（UV / 法线接缝）在拓扑上视为同一个点
+        std::vector<u32> wedges(vertexCount);
+        std::iota(wedges.begin(), wedges.end(), 0u);
+        std::sort(wedges.begin(), wedges.end(), [&](u32 a, u32 b) {
+            const XMFLOAT3& pa = vertices[a].position;
+            const XMFLOAT3& pb = vertices[b].position;
+            return std::tie(pa.x, pa.y, pa.z, a) < std::tie(pb.x, pb.y, pb.z, b);
+        });
+
+        std::vector<u32> positionOf(vertexCount);
+        std::vector<XMFLOAT3> points;
+        points.reserve(vertexCount);
+        for (u32 i = 0; i < vertexCount; ++i)
+        {
+            const XMFLOAT3& p = vertices[wedges[i]].position;
+            if (points.empty() || p.x != points.back().x || p.y != points.back().y || p.z != points.back().z)
+                points.push_back(p);
+            positionOf[wedges[i]] = static_cast<u32>(points.size() - 1);
+        }
+        const u32 positionCount = static_cast<u32>(points.size());
+
+        // 输入中位置重合的退化三角形不可见，直接去掉（否则会干扰邻接与接缝判断）
+        {
+            size_t kept = 0;
+            for (size_t t = 0; t < outGroups.size(); ++t)
+            {
+                const u32 p0 = positionOf[outIndices[t * 3]], p1 = positionOf[outIndices[t * 3 + 1]], p2 = positionOf[outIndices[t * 3 + 2]];
+                if (p0 == p1 || p1 == p2 || p0 == p2)
+                    continue;
+                for (u32 k = 0; k < 3; ++k)
+                    outIndices[kept * 3 + k] = outIndices[t * 3 + k];
+                outGroups[kept++] = outGroups[t];
+            }
+            outIndices.resize(kept * 3);
+            outGroups.resize(kept);
+        }
+
+        XMFLOAT3 boundsMin, boundsMax;
+        ComputeMeshBounds(vertices, boundsMin, boundsMax);
+        const f64 extent = std::max(static_cast<f64>(Length(Sub(boundsMax, boundsMin))), 1e-12);
+        const f64 errorLimit = static_cast<f64>(targetError) * extent * static_cast<f64>(targetError) * extent;
+
+        // 初始二次型：每个三角形所在平面，按面积加权
+        std::vector<Quadric> quadrics(positionCount);
+        for (size_t t = 0; t < outIndices.size() / 3; ++t)
+        {
+            const u32 p0 = positionOf[outIndices[t * 3]], p1 = positionOf[outIndices[t * 3 + 1]], p2 = positionOf[outIndices[t * 3 + 2]];
+            const XMFLOAT3 n = Cross(Sub(points[p1], points[p0]), Sub(points[p2], points[p0]));
+            const f64 length = Length(n);
+            if (length <= 0.0)
+                continue;
+            const f64 nx = n.x / length, ny = n.y / length, nz = n.z / length;
+            const f64 d = -(nx * points[p0].x + ny * points[p0].y + nz * points[p0].z);
+            for (u32 p : { p0, p1, p2 })
+                quadrics[p].AddPlane(nx, ny, nz, d, length * 0.5);
+        }
+
+        std::vector<u32> adjacencyOffsets;
+        std::vector<u32> adjacencyTriangles;
+        std::vector<u8> locked;
+        std::vector<u8> border;
+        std::vector<u8> passLocked;
+        std::vector<u32> wedgeRemap(vertexCount, UNUSED);
+        std::vector<u32> wedgePair(vertexCount, UNUSED);
+        std::vector<u32> pairedWedges;
+        std::vector<std::pair<u32, u32>> neighbours;    // (位置, 共享该边的三角形数)
+        std::vector<Collapse> collapses;
+        std::vector<u32> compacted;
+        std::vector<u32> compactedGroups;
+        f64 maxError = 0.0;
+        bool firstPass = true;
+
+        // 每个分组剩余的三角形数，分组编号压缩成连续下标；折叠不能删掉某个分组的最后一个三角形
+        std::vector<u32> groupIds(outGroups.begin(), outGroups.end());
+        std::sort(groupIds.begin(), groupIds.end());
+        groupIds.erase(std::unique(groupIds.begin(), groupIds.end()), groupIds.end());
+        std::vector<u32> groupTriangles;
+        auto groupSlot = [&groupIds](u32 group) {
+            return static_cast<u32>(std::lower_bound(groupIds.begin(), groupIds.end(), group) - groupIds.begin());
+        };
+
+        auto resolve = [&](u32 wedge) { return wedgeRemap[wedge] != UNUSED ? wedgeRemap[wedge] : wedge; };
+
+        // 把 from 上的每个顶点配对到 to 上同一侧的顶点（取两者共有的三角形里 to 对应的顶点）
+        // from 上有顶点不与 to 共享三角形，或者同一顶点对应 to 上的多个顶点（跨接缝）时失败
+        auto pairWedges = [&](u32 from, u32 to, u32& outSharedTriangles) {
+            bool valid = true;
+            outSharedTriangles = 0;
+            pairedWedges.clear();
+            for (u32 a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1] && valid; ++a)
+            {
+                const u32 t = adjacencyTriangles[a];
+                u32 fromWedge = UNUSED, toWedge = UNUSED;
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const u32 w = resolve(outIndices[t * 3 + k]);
+                    if (positionOf[w] == from)
+                        fromWedge = w;
+                    else if (positionOf[w] == to)
+                        toWedge = w;
+                }
+                if (fromWedge == UNUSED || toWedge == UNUSED)
+                    continue;
+
+                ++outSharedTriangles;
+                if (wedgePair[fromWedge] == UNUSED)
+                {
+                    wedgePair[fromWedge] = toWedge;
+                    pairedWedges.push_back(fromWedge);
+                }
+                else if (wedgePair[fromWedge] != toWedge)
+                {
+                    valid = false;
+                }
+            }
+            for (u32 a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1] && valid; ++a)
+            {
+                const u32 t = adjacencyTriangles[a];
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const u32 w = resolve(outIndices[t * 3 + k]);
+                    if (positionOf[w] == from && wedgePair[w] == UNUSED)
+                        valid = false;
+                }
+            }
+            if (outSharedTriangles == 0)
+                valid = false;
+            if (!valid)
+            {
+                for (u32 w : pairedWedges)
+                    wedgePair[w] = UNUSED;
+                pairedWedges.clear();
+            }
+            return valid;
+        };
+
+        auto releasePairs = [&]() {
+            for (u32 w : pairedWedges)
+                wedgePair[w] = UNUSED;
+            pairedWedges.clear();
+        };
+
+        // from 移到 to 后，不含 to 的相邻三角形法线不能翻转
+        auto flipsTriangles = [&](u32 from, u32 to) {
+            for (u32 a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a)
+            {
+                const u32 t = adjacencyTriangles[a];
+                u32 corner[3];
+                bool containsTarget = false;
+                u32 fromCorner = 0;
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    corner[k] = positionOf[resolve(outIndices[t * 3 + k])];
+                    containsTarget |= corner[k] == to;
+                    if (corner[k] == from)
+                        fromCorner = k;
+                }
+                if (containsTarget)
+                    continue;
+
+                const XMFLOAT3& b = points[corner[(fromCorner + 1) % 3]];
+                const XMFLOAT3& c = points[corner[(fromCorner + 2) % 3]];
+                const XMFLOAT3 before = Cross(Sub(b, points[from]), Sub(c, points[from]));
+                const XMFLOAT3 after = Cross(Sub(b, points[to]), Sub(c, points[to]));
+                const f32 beforeLength = Length(before), afterLength = Length(after);
+                if (beforeLength <= 0.0f)
+                    continue;
+                if (Dot(before, after) <= 1e-2f * beforeLength * afterLength)
+                    return true;
+            }
+            return false;
+        };
+
+        u32 triangleCount = static_cast<u32>(outIndices.size() / 3);
+        while (triangleCount > targetTriangleCount)
+        {
+            // 位置 -> 三角形邻接（CSR）
+            adjacencyOffsets.assign(positionCount + 1, 0);
+            for (u32 index : outIndices)
+                ++adjacencyOffsets[positionOf[index] + 1];
+            for (u32 p = 0; p < positionCount; ++p)
+                adjacencyOffsets[p + 1] += adjacencyOffsets[p];
+            adjacencyTriangles.resize(outIndices.size());
+            {
+                std::vector<u32> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < outIndices.size(); ++i)
+                    adjacencyTriangles[cursor[positionOf[outIndices[i]]]++] = static_cast<u32>(i / 3);
+            }
+
+            // 分类 + 为每个可折叠的位置找误差最小的合法目标
+            locked.assign(positionCount, 0);
+            border.assign(positionCount, 0);
+            collapses.clear();
+            for (u32 p = 0; p < positionCount; ++p)
+            {
+                const u32 begin = adjacencyOffsets[p], end = adjacencyOffsets[p + 1];
+                if (begin == end)
+                    continue;
+
+                neighbours.clear();
+                const u32 group = outGroups[adjacencyTriangles[begin]];
+                u32 wedgeCount = 0;
+                u32 firstWedge = UNUSED;
+                for (u32 a = begin; a < end; ++a)
+                {
+                    const u32 t = adjacencyTriangles[a];
+                    if (outGroups[t] != group)
+                        locked[p] = 1;
+                    for (u32 k = 0; k < 3; ++k)
+                    {
+                        const u32 w = outIndices[t * 3 + k];
+                        const u32 q = positionOf[w];
+                        if (q == p)
+                        {
+                            if (firstWedge == UNUSED)
+                                firstWedge = w;
+                            wedgeCount += w != firstWedge ? 1 : 0;
+                            continue;
+                        }
+                        auto it = std::find_if(neighbours.begin(), neighbours.end(), [q](const auto& n) { return n.first == q; });
+                        if (it == neighbours.end())
+                            neighbours.emplace_back(q, 1);
+                        else
+                            ++it->second;
+                    }
+                }
+
+                for (const auto& [q, count] : neighbours)
+                {
+                    if (count > 2)
+                        locked[p] = 1;      // 非流形边
+                    if (count == 1)
+                    {
+                        border[p] = 1;
+
+                        // 开放边界：加一个过该边、垂直于所在三角形的平面，防止边界向内收缩
+                        if (firstPass)
+                        {
+                            for (u32 a = begin; a < end; ++a)
+                            {
+                                const u32 t = adjacencyTriangles[a];
+                                const u32 p0 = positionOf[outIndices[t * 3]], p1 = positionOf[outIndices[t * 3 + 1]], p2 = positionOf[outIndices[t * 3 + 2]];
+                                if (p0 != q && p1 != q && p2 != q)
+                                    continue;
+                                const XMFLOAT3 faceNormal = Cross(Sub(points[p1], points[p0]), Sub(points[p2], points[p0]));
+                                const XMFLOAT3 edge = Sub(points[q], points[p]);
+                                XMFLOAT3 planeNormal = Cross(edge, faceNormal);
+                                const f64 length = Length(planeNormal);
+                                if (length <= 0.0)
+                                    break;
+                                const f64 nx = planeNormal.x / length, ny = planeNormal.y / length, nz = planeNormal.z / length;
+                                const f64 d = -(nx * points[p].x + ny * points[p].y + nz * points[p].z);
+                                quadrics[p].AddPlane(nx, ny, nz, d, Dot(edge, edge) * BORDER_WEIGHT);
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                if (firstPass)
+                {
+                    stats.lockedVertices += locked[p];
+                    stats.borderVertices += border[p];
+                    stats.seamVertices += wedgeCount > 0 ? 1 : 0;
+                }
+                if (locked[p])
+                    continue;
+
+                // 按误差从小到大尝试，取第一个拓扑合法的目标
+                std::sort(neighbours.begin(), neighbours.end(), [&](const auto& a, const auto& b) {
+                    return quadrics[p].Error(points[a.first]) < quadrics[p].Error(points[b.first]);
+                });
+                for (const auto& [q, count] : neighbours)
+                {
+                    if (border[p] && count != 1)
+                        continue;       // 边界上的点只能沿边界移动
+                    u32 shared = 0;
+                    if (!pairWedges(p, q, shared))
+                        continue;
+                    releasePairs();
+                    collapses.push_back({ p, q, quadrics[p].Error(points[q]) });
+                    break;
+                }
+            }
+            firstPass = false;
+
+            if (collapses.empty())
+                break;
+
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+            // 一次折叠内部点去掉 2 个三角形，按此估算本轮需要的折叠数
+            const u32 trianglesToRemove = triangleCount - targetTriangleCount;
+            const size_t goal = std::clamp<size_t>(trianglesToRemove / 2, 1, collapses.size());
+            const f64 passLimit = std::min(errorLimit, collapses[goal - 1].error * PASS_ERROR_SLACK);
+
+            passLocked.assign(positionCount, 0);
+            groupTriangles.assign(groupIds.size(), 0);
+            for (u32 group : outGroups)
+                ++groupTriangles[groupSlot(group)];
+            u32 removed = 0;
+            u32 applied = 0;
+            for (const Collapse& collapse : collapses)
+            {
+                if (collapse.error > passLimit || removed >= trianglesToRemove)
+                    break;
+                if (passLocked[collapse.from] || passLocked[collapse.to])
+                    continue;
+
+                u32 shared = 0;
+                if (!pairWedges(collapse.from, collapse.to, shared))
+                    continue;
+
+                // 未锁定的位置周围只有一个分组，共享边的三角形都属于它
+                const u32 group = groupSlot(outGroups[adjacencyTriangles[adjacencyOffsets[collapse.from]]]);
+                if (groupTriangles[group] <= shared || flipsTriangles(collapse.from, collapse.to))
+                {
+                    releasePairs();
+                    continue;
+                }
+
+                for (u32 w : pairedWedges)
+                    wedgeRemap[w] = wedgePair[w];
+                releasePairs();
+
+                quadrics[collapse.to].Add(quadrics[collapse.from]);
+                passLocked[collapse.from] = 1;
+                passLocked[collapse.to] = 1;
+                groupTriangles[group] -= shared;
+                removed += shared;
+                maxError = std::max(maxError, collapse.error);
+                ++applied;
+            }
+
+            if (applied == 0)
+                break;
+            stats.collapseCount += applied;
+            ++stats.passCount;
+
+            // 改写索引并去掉退化三角形（保持原顺序，子网格仍然连续）
+            compacted.clear();
+            compactedGroups.clear();
+            for (size_t t = 0; t < outIndices.size() / 3; ++t)
+            {
+                const u32 w0 = resolve(outIndices[t * 3]), w1 = resolve(outIndices[t * 3 + 1]), w2 = resolve(outIndices[t * 3 + 2]);
+                const u32 p0 = positionOf[w0], p1 = positionOf[w1], p2 = positionOf[w2];
+                if (p0 == p1 || p1 == p2 || p0 == p2)
+                    continue;
+                compacted.insert(compacted.end(), { w0, w1, w2 });
+                compactedGroups.push_back(outGroups[t]);
+            }
+            outIndices.swap(compacted);
+            outGroups.swap(compactedGroups);
+            std::fill(wedgeRemap.begin(), wedgeRemap.end(), UNUSED);
+            triangleCount = static_cast<u32>(outIndices.size() / 3);
+        }
+
+        if (outStats)
+            *outStats = stats;
+        return static_cast<f32>(std::sqrt(maxError) / extent);
+    }
+
+    void GenerateLODChain(std::span<const Vertex> vertices, std::span<const SubMesh> subMeshes,
+                          const LODChainOptions& options, std::vector<u32>& indices, std::vector<MeshLOD>& outLODs)
+    {
+        outLODs.clear();
+
+        SubMesh whole;
+        whole.indexCount = static_cast<u32>(indices.size());
+        std::span<const SubMesh> ranges = subMeshes.empty() ? std::span<const SubMesh>(&whole, 1) : subMeshes;
+
+        // 转为全局顶点编号，子网格下标作为分组
+        std::vector<u32> current;
+        std::vector<u32> currentGroups;
+        current.reserve(indices.size());
+        for (u32 s = 0; s < ranges.size(); ++s)
+        {
+            const SubMesh& range = ranges[s];
+            const size_t end = std::min<size_t>(static_cast<size_t>(range.indexOffset) + range.indexCount, indices.size());
+            for (size_t i = range.indexOffset; i + 3 <= end; i += 3)
+            {
+                current.insert(current.end(), { indices[i] + range.baseVertex, indices[i + 1] + range.baseVertex,
+                                                indices[i + 2] + range.baseVertex });
+                currentGroups.push_back(s);
+            }
+        }
+
+        MeshLOD lod0;
+        lod0.subMeshes.assign(ranges.begin(), ranges.end());
+        lod0.triangleCount = static_cast<u32>(current.size() / 3);
+        outLODs.push_back(std::move(lod0));
+
+        const u32 levelCount = std::min(options.levelCount, MESH_MAX_LODS);
+        std::vector<u32> next;
+        std::vector<u32> nextGroups;
+        f32 error = 0.0f;
+        for (u32 level = 1; level < levelCount; ++level)
+        {
+            const u32 previousTriangles = static_cast<u32>(current.size() / 3);
+            const u32 target = static_cast<u32>(previousTriangles * options.reduction);
+            const f32 budget = options.maxError - error;
+            if (budget <= 0.0f || target == 0)
+                break;
+
+            const f32 levelError = SimplifyMesh(vertices, current, currentGroups, target, budget, next, nextGroups);
+            const u32 triangleCount = static_cast<u32>(next.size() / 3);
+            if (triangleCount == 0 || triangleCount > previousTriangles * 0.9f)
+                break;
+
+            // 每级的误差都相对上一级测得，累加作为相对 LOD0 的保守估计
+            error += levelError;
+
+            MeshLOD lod;
+            lod.triangleCount = triangleCount;
+            lod.error = error;
+            lod.subMeshes.reserve(ranges.size());
+            for (u32 s = 0; s < ranges.size(); ++s)
+            {
+                SubMesh subMesh = ranges[s];
+                subMesh.indexOffset = static_cast<u32>(indices.size());
+                for (size_t t = 0; t < nextGroups.size(); ++t)
+                {
+                    if (nextGroups[t] != s)
+                        continue;
+                    for (u32 k = 0; k < 3; ++k)
+                        indices.push_back(next[t * 3 + k] - subMesh.baseVertex);
+                }
+                subMesh.indexCount = static_cast<u32>(indices.size()) - subMesh.indexOffset;
+                if (subMesh.indexCount > 0)
+                {
+                    OptimizeVertexCache(std::span<u32>(indices).subspan(subMesh.indexOffset, subMesh.indexCount),
+                                        static_cast<u32>(vertices.size()));
+                }
+                lod.subMeshes.push_back(subMesh);
+            }
+            outLODs.push_back(std::move(lod));
+
+            current.swap(next);
+            currentGroups.swap(nextGroups);
+        }
+    }
+}
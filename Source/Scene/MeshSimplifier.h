@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    // LOD 链的最大级数（含原始网格 LOD0）
+    constexpr u32 MESH_MAX_LODS = 8;
+
+    struct SimplifyStats
+    {
+        u32 passCount = 0;
+        u32 collapseCount = 0;
+        u32 lockedVertices = 0;     // 材质边界 / 非流形边上的位置，不参与折叠
+        u32 seamVertices = 0;       // UV 或法线接缝上的位置（同一位置有多个顶点）
+        u32 borderVertices = 0;     // 开放边界上的位置
+    };
+
+    // 二次误差度量（Garland & Heckbert 1997）的半边折叠简化：只改写索引、不产生新顶点，各级 LOD 可以共用顶点缓冲
+    // indices 为全局顶点编号，triangleGroups 为每个三角形所属的分组（子网格），分组交界处的位置被锁定以保持材质边界
+    // 接缝：同一位置上的多个顶点只能沿接缝边一起折叠，每个顶点映射到接缝另一端同一侧的顶点，UV / 法线不会串到另一侧
+    // 开放边界上的位置只能沿边界折叠；会使相邻三角形翻转的折叠会被拒绝
+    // targetError 为允许的误差（相对包围盒对角线）；返回实际误差（同样是相对值）
+    f32 SimplifyMesh(std::span<const Vertex> vertices, std::span<const u32> indices, std::span<const u32> triangleGroups,
+                     u32 targetTriangleCount, f32 targetError, std::vector<u32>& outIndices, std::vector<u32>& outGroups,
+                     SimplifyStats* outStats = nullptr);
+
+    struct MeshLOD
+    {
+        std::vector<SubMesh> subMeshes;     // 与 LOD0 的子网格一一对应，索引区间位于共享的索引缓冲中
+        u32 triangleCount = 0;
+        f32 error = 0.0f;                   // 相对 LOD0 的累计误差（相对包围盒对角线）
+    };
+
+    struct LODChainOptions
+    {
+        u32 levelCount = 4;         // 含 LOD0
+        f32 reduction = 0.5f;       // 每一级相对上一级的三角形比例
+        f32 maxError = 0.05f;       // 累计误差上限，达到后不再生成更粗的级别
+    };
+
+    // 逐级简化生成 LOD 链：LOD0 为输入本身，每一级从上一级简化得到，索引追加到 indices 末尾
+    // indices 调用前为 LOD0 的索引；子网格为空时视为一个覆盖全部索引的子网格
+    // 每一级在子网格内做顶点缓存重排；某一级减少不到 10% 或误差超限时提前结束
+    void GenerateLODChain(std::span<const Vertex> vertices, std::span<const SubMesh> subMeshes,
+                          const LODChainOptions& options, std::vector<u32>& indices, std::vector<MeshLOD>& outLODs);
+}
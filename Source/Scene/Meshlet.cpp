@@ -0,0 +1,474 @@
+#include "Scene/Meshlet.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u32 BOUNDS_BATCH_SIZE = 256;
+
+        inline XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        inline f32 Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        inline f32 Length(const XMFLOAT3& a) { return std::sqrt(Dot(a, a)); }
+        inline XMFLOAT3 Cross(const XMFLOAT3& a, const XMFLOAT3& b)
+        {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        // Ritter 包围球：先用两个近似最远点定初始球，再把落在外面的点逐个包进来
+        void ComputeBoundingSphere(const XMFLOAT3* points, u32 count, XMFLOAT3& outCenter, f32& outRadius)
+        {
+            auto farthestFrom = [points, count](const XMFLOAT3& p) {
+                u32 best = 0;
+                f32 bestDistance = -1.0f;
+                for (u32 i = 0; i < count; ++i)
+                {
+                    XMFLOAT3 d = Sub(points[i], p);
+                    f32 distance = Dot(d, d);
+                    if (distance > bestDistance)
+                    {
+                        bestDistance = distance;
+                        best = i;
+                    }
+                }
+                return best;
+            };
+
+            const XMFLOAT3& a = points[farthestFrom(points[0])];
+            const XMFLOAT3& b = points[farthestFrom(a)];
+            XMFLOAT3 center = { (a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f, (a.z + b.z) * 0.5f };
+            f32 radius = Length(Sub(b, a)) * 0.5f;
+
+            for (u32 i = 0; i < count; ++i)
+            {
+                XMFLOAT3 d = Sub(points[i], center);
+                f32 distance = Length(d);
+                if (distance > radius)
+                {
+                    f32 newRadius = (radius + distance) * 0.5f;
+                    f32 shift = (newRadius - radius) / distance;
+                    center = { center.x + d.x * shift, center.y + d.y * shift, center.z + d.z * shift };
+                    radius = newRadius;
+                }
+            }
+
+            // 浮点误差留一点余量，保证剔除保守
+            outCenter = center;
+            outRadius = radius * 1.0001f + 1e-6f;
+        }
+
+        MeshletBounds ComputeMeshletBounds(const MeshletData& data, const Meshlet& meshlet, std::span<const Vertex> vertices)
+        {
+            MeshletBounds bounds;
+            if (meshlet.vertexCount == 0)
+                return bounds;
+
+            XMFLOAT3 positions[256];
+            for (u32 i = 0; i < meshlet.vertexCount; ++i)
+                positions[i] = vertices[data.vertices[meshlet.vertexOffset + i]].position;
+
+            ComputeBoundingSphere(positions, meshlet.vertexCount, bounds.center, bounds.radius);
+
+            // 三角形法线（顺时针为正面，cross(b - a, c - a) 指向正面一侧），退化三角形不参与
+            XMFLOAT3 normals[512];
+            u32 normalCount = 0;
+            XMFLOAT3 axis = { 0, 0, 0 };
+            const u8* triangles = data.triangles.data() + meshlet.triangleOffset;
+            for (u32 t = 0; t < meshlet.triangleCount; ++t)
+            {
+                const XMFLOAT3& p0 = positions[triangles[t * 3 + 0]];
+                const XMFLOAT3& p1 = positions[triangles[t * 3 + 1]];
+                const XMFLOAT3& p2 = positions[triangles[t * 3 + 2]];
+                XMFLOAT3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+                f32 length = Length(n);
+                if (length <= 1e-20f)
+                    continue;
+                n = { n.x / length, n.y / length, n.z / length };
+                normals[normalCount++] = n;
+                axis = { axis.x + n.x, axis.y + n.y, axis.z + n.z };
+            }
+
+            f32 axisLength = Length(axis);
+            if (normalCount == 0 || axisLength <= 1e-6f)
+                return bounds;
+
+            axis = { axis.x / axisLength, axis.y / axisLength, axis.z / axisLength };
+            f32 minDot = 1.0f;
+            for (u32 i = 0; i < normalCount; ++i)
+                minDot = std::min(minDot, Dot(axis, normals[i]));
+
+            bounds.coneAxis = axis;
+            // 半角 >= 90° 时法线锥不能用于剔除
+            bounds.coneCutoff = minDot > 0.0f ? std::min(std::sqrt(1.0f - minDot * minDot) + 1e-4f, 1.0f) : 1.0f;
+            return bounds;
+        }
+    }
+
+    void BuildMeshlets(std::span<const Vertex> vertices, std::span<u32> indices, std::span<const SubMesh> subMeshes,
+                       MeshletData& outData, u32 maxVertices, u32 maxTriangles)
+    {
+        outData.Clear();
+        maxVertices = std::clamp(maxVertices, 3u, 256u);    // 局部编号是 u8
+        maxTriangles = std::clamp(maxTriangles, 1u, 512u);
+
+        SubMesh whole;
+        whole.indexCount = static_cast<u32>(indices.size());
+        std::span<const SubMesh> ranges = subMeshes.empty() ? std::span<const SubMesh>(&whole, 1) : subMeshes;
+
+        outData.meshlets.reserve(indices.size() / 3 / std::max(maxTriangles / 2, 1u) + ranges.size());
+        outData.vertices.reserve(indices.size() / 3);
+        outData.triangles.reserve(indices.size());
+
+        constexpr u32 UNUSED = ~0u;
+        std::vector<u32> globalToDense(vertices.size(), UNUSED);
+        std::vector<u32> denseToGlobal;
+        std::vector<u32> denseToLocal;          // 当前 meshlet 内的局部编号
+        std::vector<u32> triangles;             // 稠密顶点编号
+        std::vector<XMFLOAT3> triangleNormals;
+        std::vector<u8> emitted;
+        std::vector<u32> adjacencyOffsets;
+        std::vector<u32> adjacencyTriangles;
+        std::vector<u32> reordered;
+        u32 localDense[256];
+        u32 previousDense[256];
+        u32 previousCount = 0;
+
+        for (const SubMesh& range : ranges)
+        {
+            const size_t begin = std::min<size_t>(range.indexOffset, indices.size());
+            size_t end = std::min<size_t>(begin + range.indexCount, indices.size());
+            end -= (end - begin) % 3;
+            const u32 triangleCount = static_cast<u32>((end - begin) / 3);
+            if (triangleCount == 0)
+                continue;
+
+            // 子网格内压缩成稠密顶点编号，邻接表只需要子网格大小
+            denseToGlobal.clear();
+            triangles.resize(static_cast<size_t>(triangleCount) * 3);
+            for (size_t i = begin; i < end; ++i)
+            {
+                const u32 global = indices[i] + range.baseVertex;
+                if (global >= vertices.size())
+                {
+                    SEA_CORE_ERROR("BuildMeshlets: index {} out of range ({} vertices)", global, vertices.size());
+                    for (u32 g : denseToGlobal)
+                        globalToDense[g] = UNUSED;
+                    outData.Clear();
+                    return;
+                }
+                if (globalToDense[global] == UNUSED)
+                {
+                    globalToDense[global] = static_cast<u32>(denseToGlobal.size());
+                    denseToGlobal.push_back(global);
+                }
+                triangles[i - begin] = globalToDense[global];
+            }
+            for (u32 g : denseToGlobal)
+                globalToDense[g] = UNUSED;
+
+            const u32 denseCount = static_cast<u32>(denseToGlobal.size());
+            adjacencyOffsets.assign(denseCount + 1, 0);
+            for (u32 v : triangles)
+                ++adjacencyOffsets[v + 1];
+            for (u32 v = 0; v < denseCount; ++v)
+                adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+            adjacencyTriangles.resize(triangles.size());
+            {
+                std::vector<u32> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < triangles.size(); ++i)
+                    adjacencyTriangles[cursor[triangles[i]]++] = static_cast<u32>(i / 3);
+            }
+
+            triangleNormals.resize(triangleCount);
+            for (u32 t = 0; t < triangleCount; ++t)
+            {
+                const XMFLOAT3& p0 = vertices[denseToGlobal[triangles[t * 3 + 0]]].position;
+                const XMFLOAT3& p1 = vertices[denseToGlobal[triangles[t * 3 + 1]]].position;
+                const XMFLOAT3& p2 = vertices[denseToGlobal[triangles[t * 3 + 2]]].position;
+                XMFLOAT3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+                f32 length = Length(n);
+                triangleNormals[t] = length > 1e-20f ? XMFLOAT3{ n.x / length, n.y / length, n.z / length } : XMFLOAT3{ 0, 0, 0 };
+            }
+
+            emitted.assign(triangleCount, 0);
+            denseToLocal.assign(denseCount, UNUSED);
+            reordered.clear();
+            reordered.reserve(triangles.size());
+
+            Meshlet meshlet;
+            meshlet.baseVertex = range.baseVertex;
+            XMFLOAT3 coneSum = { 0, 0, 0 };
+            XMFLOAT3 coneAxis = { 0, 0, 0 };
+            XMFLOAT3 boundsMin = {};
+            XMFLOAT3 boundsMax = {};
+            u32 remaining = triangleCount;
+            u32 nextSeed = 0;
+            u32 lastTriangle = UNUSED;
+            previousCount = 0;
+
+            auto beginMeshlet = [&]() {
+                meshlet.indexOffset = static_cast<u32>(begin + reordered.size());
+                meshlet.vertexOffset = static_cast<u32>(outData.vertices.size());
+                meshlet.triangleOffset = static_cast<u32>(outData.triangles.size());
+                meshlet.vertexCount = 0;
+                meshlet.triangleCount = 0;
+                coneSum = { 0, 0, 0 };
+                coneAxis = { 0, 0, 0 };
+                boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+                boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            };
+
+            auto flush = [&]() {
+                outData.meshlets.push_back(meshlet);
+                for (u32 i = 0; i < meshlet.vertexCount; ++i)
+                {
+                    denseToLocal[localDense[i]] = UNUSED;
+                    previousDense[i] = localDense[i];
+                }
+                previousCount = meshlet.vertexCount;
+                beginMeshlet();
+            };
+
+            auto newVertexCount = [&](u32 t) {
+                const u32 a = triangles[t * 3], b = triangles[t * 3 + 1], c = triangles[t * 3 + 2];
+                u32 count = (denseToLocal[a] == UNUSED) + (denseToLocal[b] == UNUSED && b != a) +
+                            (denseToLocal[c] == UNUSED && c != a && c != b);
+                return count;
+            };
+
+            // 评分：新增顶点越少越好，其次法线越贴近当前法线锥越好（锥越窄，背面剔除越有效）
+            constexpr f32 CONE_WEIGHT = 0.5f;
+            u32 best = UNUSED;
+            f32 bestScore = 0.0f;
+            auto consider = [&](u32 t) {
+                if (emitted[t])
+                    return;
+                const u32 extra = newVertexCount(t);
+                if (meshlet.vertexCount + extra > maxVertices)
+                    return;
+                const f32 score = static_cast<f32>(extra) + (1.0f - Dot(triangleNormals[t], coneAxis)) * CONE_WEIGHT;
+                if (best == UNUSED || score < bestScore)
+                {
+                    best = t;
+                    bestScore = score;
+                }
+            };
+            auto considerNeighbours = [&](u32 dense) {
+                for (u32 a = adjacencyOffsets[dense]; a < adjacencyOffsets[dense + 1]; ++a)
+                    consider(adjacencyTriangles[a]);
+            };
+
+            // 没有相连的候选时，在原顺序里往后找一小段，取落在当前 meshlet 包围盒附近（向外扩一半尺寸）的最近三角形
+            // 碎片多的模型可以把相邻的小块装进同一个 meshlet，而不会把远处的三角形拉进来撑大包围球
+            constexpr u32 JUMP_WINDOW = 64;
+            auto findNearbyTriangle = [&]() {
+                const XMFLOAT3 center = { (boundsMin.x + boundsMax.x) * 0.5f, (boundsMin.y + boundsMax.y) * 0.5f,
+                                          (boundsMin.z + boundsMax.z) * 0.5f };
+                const XMFLOAT3 reach = { (boundsMax.x - boundsMin.x) * 0.75f, (boundsMax.y - boundsMin.y) * 0.75f,
+                                         (boundsMax.z - boundsMin.z) * 0.75f };
+                u32 nearest = UNUSED;
+                f32 nearestDistance = FLT_MAX;
+                for (u32 t = nextSeed; t < triangleCount && t < nextSeed + JUMP_WINDOW; ++t)
+                {
+                    if (emitted[t])
+                        continue;
+                    XMFLOAT3 centroid = { 0, 0, 0 };
+                    for (u32 k = 0; k < 3; ++k)
+                    {
+                        const XMFLOAT3& p = vertices[denseToGlobal[triangles[t * 3 + k]]].position;
+                        centroid = { centroid.x + p.x / 3.0f, centroid.y + p.y / 3.0f, centroid.z + p.z / 3.0f };
+                    }
+                    const XMFLOAT3 d = Sub(centroid, center);
+                    if (std::abs(d.x) > reach.x || std::abs(d.y) > reach.y || std::abs(d.z) > reach.z)
+                        continue;
+                    const f32 distance = Dot(d, d);
+                    if (distance < nearestDistance)
+                    {
+                        nearest = t;
+                        nearestDistance = distance;
+                    }
+                }
+                return nearest;
+            };
+
+            beginMeshlet();
+            while (remaining > 0)
+            {
+                best = UNUSED;
+                if (meshlet.triangleCount > 0 && meshlet.triangleCount < maxTriangles)
+                {
+                    // 先看刚加入的三角形的邻居，没有合适的再扩大到整个 meshlet 的顶点
+                    for (u32 k = 0; k < 3; ++k)
+                        considerNeighbours(triangles[lastTriangle * 3 + k]);
+                    if (best == UNUSED)
+                    {
+                        for (u32 i = 0; i < meshlet.vertexCount; ++i)
+                            considerNeighbours(localDense[i]);
+                    }
+                }
+
+                if (best == UNUSED)
+                {
+                    while (emitted[nextSeed])
+                        ++nextSeed;
+
+                    // 相连的三角形用完但 meshlet 还没满时，先尝试装入附近的其它碎片
+                    if (meshlet.triangleCount > 0 && meshlet.triangleCount < maxTriangles && meshlet.vertexCount + 3 <= maxVertices)
+                        best = findNearbyTriangle();
+                }
+
+                if (best == UNUSED)
+                {
+                    if (meshlet.triangleCount > 0)
+                        flush();
+
+                    // 新 meshlet 从上一个 meshlet 的邻居开始，保持空间连续；都用完后按原顺序找下一个
+                    if (meshlet.triangleCount == 0)
+                    {
+                        for (u32 i = 0; i < previousCount && best == UNUSED; ++i)
+                            considerNeighbours(previousDense[i]);
+                    }
+                    if (best == UNUSED)
+                        best = nextSeed;
+                }
+
+                // 加入三角形
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const u32 dense = triangles[best * 3 + k];
+                    const XMFLOAT3& p = vertices[denseToGlobal[dense]].position;
+                    boundsMin = { std::min(boundsMin.x, p.x), std::min(boundsMin.y, p.y), std::min(boundsMin.z, p.z) };
+                    boundsMax = { std::max(boundsMax.x, p.x), std::max(boundsMax.y, p.y), std::max(boundsMax.z, p.z) };
+                    if (denseToLocal[dense] == UNUSED)
+                    {
+                        denseToLocal[dense] = meshlet.vertexCount;
+                        localDense[meshlet.vertexCount++] = dense;
+                        outData.vertices.push_back(denseToGlobal[dense]);
+                    }
+                    outData.triangles.push_back(static_cast<u8>(denseToLocal[dense]));
+                    reordered.push_back(denseToGlobal[dense] - range.baseVertex);
+                }
+                ++meshlet.triangleCount;
+                emitted[best] = 1;
+                --remaining;
+                lastTriangle = best;
+
+                const XMFLOAT3& n = triangleNormals[best];
+                coneSum = { coneSum.x + n.x, coneSum.y + n.y, coneSum.z + n.z };
+                const f32 coneLength = Length(coneSum);
+                coneAxis = coneLength > 1e-6f ? XMFLOAT3{ coneSum.x / coneLength, coneSum.y / coneLength, coneSum.z / coneLength }
+                                              : XMFLOAT3{ 0, 0, 0 };
+            }
+            flush();
+
+            std::copy(reordered.begin(), reordered.end(), indices.begin() + begin);
+        }
+
+        outData.bounds.resize(outData.meshlets.size());
+        JobSystem::RunParallelFor(static_cast<u32>(outData.meshlets.size()), BOUNDS_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 m = begin; m < end; ++m)
+                outData.bounds[m] = ComputeMeshletBounds(outData, outData.meshlets[m], vertices);
+        });
+    }
+
+    void CullMeshlets(const MeshletData& data, const Frustum& frustum, const XMFLOAT3& cameraPosition,
+                      const XMFLOAT4X4& world, std::vector<MeshletDrawRange>& outRanges, MeshletCullStats* outStats,
+                      bool allowBackfaceCulling)
+    {
+        outRanges.clear();
+        MeshletCullStats stats;
+        stats.meshletCount = static_cast<u32>(data.meshlets.size());
+
+        // 视锥平面变换到局部空间：(x, 1) * W 在平面 p 上的距离 = (x, 1) * (W * p)
+        XMFLOAT4 planes[Frustum::Count];
+        for (u32 i = 0; i < Frustum::Count; ++i)
+        {
+            const XMFLOAT4& p = frustum.GetPlane(i);
+            XMFLOAT4 local = {
+                world._11 * p.x + world._12 * p.y + world._13 * p.z + world._14 * p.w,
+                world._21 * p.x + world._22 * p.y + world._23 * p.z + world._24 * p.w,
+                world._31 * p.x + world._32 * p.y + world._33 * p.z + world._34 * p.w,
+                world._41 * p.x + world._42 * p.y + world._43 * p.z + world._44 * p.w
+            };
+            f32 length = std::sqrt(local.x * local.x + local.y * local.y + local.z * local.z);
+            if (length > 0.0f)
+                local = { local.x / length, local.y / length, local.z / length, local.w / length };
+            planes[i] = local;
+        }
+
+        // 法线锥只在旋转 + 均匀缩放 + 平移下保持角度，其它情况只做视锥剔除
+        const XMFLOAT3 row0 = { world._11, world._12, world._13 };
+        const XMFLOAT3 row1 = { world._21, world._22, world._23 };
+        const XMFLOAT3 row2 = { world._31, world._32, world._33 };
+        const f32 scale0 = Length(row0), scale1 = Length(row1), scale2 = Length(row2);
+        const f32 minScale = std::min({ scale0, scale1, scale2 });
+        const f32 maxScale = std::max({ scale0, scale1, scale2 });
+        const f32 shearTolerance = 1e-3f * minScale * minScale;
+        const bool orthogonal = std::abs(Dot(row0, row1)) <= shearTolerance && std::abs(Dot(row1, row2)) <= shearTolerance &&
+                                std::abs(Dot(row0, row2)) <= shearTolerance;
+        const bool backfaceCulling = allowBackfaceCulling && minScale > 0.0f && maxScale <= minScale * 1.001f && orthogonal &&
+                                     Dot(row0, Cross(row1, row2)) > 0.0f;
+
+        XMFLOAT3 localCamera = cameraPosition;
+        if (backfaceCulling)
+        {
+            XMMATRIX invWorld = XMMatrixInverse(nullptr, XMLoadFloat4x4(&world));
+            XMStoreFloat3(&localCamera, XMVector3TransformCoord(XMLoadFloat3(&cameraPosition), invWorld));
+        }
+
+        for (size_t m = 0; m < data.meshlets.size(); ++m)
+        {
+            const Meshlet& meshlet = data.meshlets[m];
+            const MeshletBounds& bounds = data.bounds[m];
+            stats.triangleCount += meshlet.triangleCount;
+
+            bool inside = true;
+            for (const XMFLOAT4& plane : planes)
+            {
+                if (plane.x * bounds.center.x + plane.y * bounds.center.y + plane.z * bounds.center.z + plane.w < -bounds.radius)
+                {
+                    inside = false;
+                    break;
+                }
+            }
+            if (!inside)
+            {
+                ++stats.frustumCulled;
+                continue;
+            }
+
+            // 球内任一点看向簇的方向与锥轴的夹角都小于 90° - θ 时，所有三角形都是背面
+            if (backfaceCulling && bounds.coneCutoff < 1.0f)
+            {
+                XMFLOAT3 toCenter = Sub(bounds.center, localCamera);
+                if (Dot(toCenter, bounds.coneAxis) >= bounds.coneCutoff * Length(toCenter) + bounds.radius)
+                {
+                    ++stats.backfaceCulled;
+                    continue;
+                }
+            }
+
+            ++stats.visibleMeshlets;
+            stats.visibleTriangles += meshlet.triangleCount;
+
+            const u32 indexCount = meshlet.triangleCount * 3;
+            if (!outRanges.empty() && outRanges.back().baseVertex == meshlet.baseVertex &&
+                outRanges.back().indexOffset + outRanges.back().indexCount == meshlet.indexOffset)
+            {
+                outRanges.back().indexCount += indexCount;
+            }
+            else
+            {
+                outRanges.push_back({ meshlet.indexOffset, indexCount, meshlet.baseVertex });
+            }
+        }
+
+        if (outStats)
+            *outStats = stats;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include "Scene/Frustum.h"
+#include <DirectXMath.h>
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 每个 meshlet 的顶点 / 三角形上限（与 mesh shader 常用配置一致，三角形局部索引用 u8 存放）
+    constexpr u32 MESHLET_MAX_VERTICES = 64;
+    constexpr u32 MESHLET_MAX_TRIANGLES = 124;
+
+    struct Meshlet
+    {
+        u32 vertexOffset = 0;       // MeshletData::vertices 中的起始位置
+        u32 triangleOffset = 0;     // MeshletData::triangles 中的起始位置（每个三角形 3 个 u8）
+        u32 vertexCount = 0;
+        u32 triangleCount = 0;
+        u32 indexOffset = 0;        // 在网格索引缓冲中对应的连续区间，可以直接作为 DrawIndexed 的参数
+        u32 baseVertex = 0;         // 所在子网格的 baseVertex
+    };
+
+    // 局部空间的包围球与法线锥
+    // 法线锥：所有三角形法线与 coneAxis 的夹角不超过 θ，coneCutoff = sin θ；θ >= 90° 时 coneCutoff = 1 表示不做背面剔除
+    struct MeshletBounds
+    {
+        XMFLOAT3 center = { 0, 0, 0 };
+        f32 radius = 0.0f;
+        XMFLOAT3 coneAxis = { 0, 0, 1 };
+        f32 coneCutoff = 1.0f;
+    };
+
+    struct MeshletData
+    {
+        std::vector<Meshlet> meshlets;
+        std::vector<MeshletBounds> bounds;
+        std::vector<u32> vertices;      // meshlet 局部顶点 -> 网格顶点（已加上 baseVertex）
+        std::vector<u8> triangles;      // meshlet 局部顶点编号
+
+        bool IsEmpty() const { return meshlets.empty(); }
+
+        void Clear()
+        {
+            meshlets.clear();
+            bounds.clear();
+            vertices.clear();
+            triangles.clear();
+        }
+    };
+
+    // 剔除后需要绘制的索引区间（相邻的可见 meshlet 会合并）
+    struct MeshletDrawRange
+    {
+        u32 indexOffset = 0;
+        u32 indexCount = 0;
+        u32 baseVertex = 0;
+    };
+
+    struct MeshletCullStats
+    {
+        u32 meshletCount = 0;
+        u32 visibleMeshlets = 0;
+        u32 frustumCulled = 0;
+        u32 backfaceCulled = 0;
+        u64 triangleCount = 0;
+        u64 visibleTriangles = 0;
+
+        void Add(const MeshletCullStats& other)
+        {
+            meshletCount += other.meshletCount;
+            visibleMeshlets += other.visibleMeshlets;
+            frustumCulled += other.frustumCulled;
+            backfaceCulled += other.backfaceCulled;
+            triangleCount += other.triangleCount;
+            visibleTriangles += other.visibleTriangles;
+        }
+    };
+
+    // 贪心构建（不跨子网格）：从种子三角形出发，每次加入共享顶点最多、法线最贴近当前法线锥的相邻三角形，
+    // 顶点或三角形达到上限后从上一个 meshlet 的邻居开始下一个
+    // 各子网格内的索引会按 meshlet 顺序重排，因此每个 meshlet 都是索引缓冲里的一段连续区间
+    // 包围球与法线锥在 JobSystem 上并行计算
+    void BuildMeshlets(std::span<const Vertex> vertices, std::span<u32> indices, std::span<const SubMesh> subMeshes,
+                       MeshletData& outData, u32 maxVertices = MESHLET_MAX_VERTICES, u32 maxTriangles = MESHLET_MAX_TRIANGLES);
+
+    // CPU 簇剔除：包围球对视锥、法线锥对相机位置，输出可见 meshlet 合并后的绘制区间
+    // frustum / cameraPosition 为世界空间，world 为物体的世界矩阵（行向量约定）
+    // 世界矩阵含非均匀缩放、切变或镜像时跳过背面剔除（法线锥在这种变换下不再保守）
+    // 不剔除背面的管线（例如线框）应传 allowBackfaceCulling = false
+    void CullMeshlets(const MeshletData& data, const Frustum& frustum, const XMFLOAT3& cameraPosition,
+                      const XMFLOAT4X4& world, std::vector<MeshletDrawRange>& outRanges,
+                      MeshletCullStats* outStats = nullptr, bool allowBackfaceCulling = true);
+}
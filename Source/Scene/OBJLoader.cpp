@@ -0,0 +1,317 @@
+#include "Scene/OBJLoader.h"
+#include "Scene/MeshOptimizer.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+// 实现必须在任何其他包含 tiny_obj_loader.h 的头文件之前展开
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+#include "Scene/OBJParser.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Sea
+{
+    namespace
+    {
+        // (v, n, t) 三个 OBJ 索引打包成的 96 位键，缺失的分量为 -1
+        struct VertexKey
+        {
+            i32 position;
+            i32 normal;
+            i32 texCoord;
+
+            bool operator==(const VertexKey& other) const
+            {
+                return position == other.position && normal == other.normal && texCoord == other.texCoord;
+            }
+        };
+
+        inline u64 HashVertexKey(const VertexKey& key)
+        {
+            u64 h = static_cast<u64>(static_cast<u32>(key.position)) * 0x9E3779B97F4A7C15ull;
+            h ^= static_cast<u64>(static_cast<u32>(key.normal)) * 0xC2B2AE3D27D4EB4Full;
+            h ^= static_cast<u64>(static_cast<u32>(key.texCoord)) * 0x165667B19E3779F9ull;
+            return h ^ (h >> 29);
+        }
+
+        // 开放寻址（线性探测）去重表：键与值放在同一个 16 字节槽位里，查找不产生任何分配
+        class VertexDedupTable
+        {
+        public:
+            static constexpr u32 EMPTY = ~0u;
+
+            explicit VertexDedupTable(u64 expectedCount)
+            {
+                // 负载因子不超过 0.7
+                u64 capacity = 16;
+                while (capacity * 7 < expectedCount * 10)
+                    capacity *= 2;
+                m_Slots.assign(capacity, Slot{ {}, EMPTY });
+                m_Mask = capacity - 1;
+            }
+
+            // 已存在则返回原索引；否则插入 newIndex 并返回 EMPTY
+            u32 FindOrInsert(const VertexKey& key, u32 newIndex)
+            {
+                if ((m_Count + 1) * 10 > m_Slots.size() * 7)
+                {
+                    Grow();
+                }
+
+                u64 i = HashVertexKey(key) & m_Mask;
+                while (true)
+                {
+                    Slot& slot = m_Slots[i];
+                    if (slot.value == EMPTY)
+                    {
+                        slot.key = key;
+                        slot.value = newIndex;
+                        ++m_Count;
+                        return EMPTY;
+                    }
+                    if (slot.key == key)
+                    {
+                        return slot.value;
+                    }
+                    i = (i + 1) & m_Mask;
+                }
+            }
+
+            u32 GetCapacity() const { return static_cast<u32>(m_Slots.size()); }
+            u32 GetGrowthCount() const { return m_Growths; }
+
+        private:
+            struct Slot
+            {
+                VertexKey key;
+                u32 value;
+            };
+            static_assert(sizeof(Slot) == 16, "Dedup slot should stay 16 bytes");
+
+            void Grow()
+            {
+                std::vector<Slot> old;
+                old.swap(m_Slots);
+                m_Slots.assign(old.size() * 2, Slot{ {}, EMPTY });
+                m_Mask = m_Slots.size() - 1;
+                for (const Slot& slot : old)
+                {
+                    if (slot.value == EMPTY)
+                        continue;
+                    u64 i = HashVertexKey(slot.key) & m_Mask;
+                    while (m_Slots[i].value != EMPTY)
+                        i = (i + 1) & m_Mask;
+                    m_Slots[i] = slot;
+                }
+                ++m_Growths;
+            }
+
+            std::vector<Slot> m_Slots;
+            u64 m_Mask = 0;
+            u64 m_Count = 0;
+            u32 m_Growths = 0;
+        };
+
+        inline Vertex BuildVertex(const tinyobj::attrib_t& attrib, const tinyobj::index_t& index)
+        {
+            Vertex vertex{};
+
+            // 位置
+            vertex.position = {
+                attrib.vertices[3 * index.vertex_index + 0],
+                attrib.vertices[3 * index.vertex_index + 1],
+                attrib.vertices[3 * index.vertex_index + 2]
+            };
+
+            // 法线
+            if (index.normal_index >= 0)
+            {
+                vertex.normal = {
+                    attrib.normals[3 * index.normal_index + 0],
+                    attrib.normals[3 * index.normal_index + 1],
+                    attrib.normals[3 * index.normal_index + 2]
+                };
+            }
+
+            // 纹理坐标
+            if (index.texcoord_index >= 0)
+            {
+                vertex.texCoord = {
+                    attrib.texcoords[2 * index.texcoord_index + 0],
+                    1.0f - attrib.texcoords[2 * index.texcoord_index + 1]
+                };
+            }
+
+            // 顶点颜色
+            vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+            return vertex;
+        }
+
+        u64 CountIndices(const std::vector<tinyobj::shape_t>& shapes)
+        {
+            u64 count = 0;
+            for (const auto& shape : shapes)
+                count += shape.mesh.indices.size();
+            return count;
+        }
+
+        // 去重后的唯一顶点不会超过索引数，也不会超过各属性组合数；取较小者预分配，避免巨型网格过度分配
+        u64 EstimateUniqueVertices(const tinyobj::attrib_t& attrib, u64 indexCount)
+        {
+            u64 attributeCount = std::max({ attrib.vertices.size() / 3, attrib.normals.size() / 3, attrib.texcoords.size() / 2 });
+            return std::min(indexCount, attributeCount * 2);
+        }
+
+        void BuildIndexedMesh(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::shape_t>& shapes,
+                              MeshData& outData, OBJLoadStats& stats)
+        {
+            const u64 indexCount = CountIndices(shapes);
+            VertexDedupTable table(EstimateUniqueVertices(attrib, indexCount));
+
+            outData.indices.reserve(indexCount);
+            outData.vertices.reserve(static_cast<size_t>(std::min<u64>(indexCount, attrib.vertices.size() / 3 * 2)));
+
+            for (const auto& shape : shapes)
+            {
+                SubMesh subMesh;
+                subMesh.indexOffset = static_cast<u32>(outData.indices.size());
+                subMesh.materialIndex = 0;
+
+                for (const auto& index : shape.mesh.indices)
+                {
+                    // 使用唯一顶点：只有新顶点才需要组装 Vertex
+                    const VertexKey key = { index.vertex_index, index.normal_index, index.texcoord_index };
+                    const u32 newIndex = static_cast<u32>(outData.vertices.size());
+                    const u32 existing = table.FindOrInsert(key, newIndex);
+                    if (existing == VertexDedupTable::EMPTY)
+                    {
+                        outData.vertices.push_back(BuildVertex(attrib, index));
+                        outData.indices.push_back(newIndex);
+                    }
+                    else
+                    {
+                        outData.indices.push_back(existing);
+                    }
+                }
+
+                subMesh.indexCount = static_cast<u32>(outData.indices.size()) - subMesh.indexOffset;
+                if (!shape.mesh.material_ids.empty() && shape.mesh.material_ids[0] >= 0)
+                {
+                    subMesh.materialIndex = shape.mesh.material_ids[0];
+                }
+                outData.subMeshes.push_back(subMesh);
+            }
+
+            stats.indexCount = indexCount;
+            stats.uniqueVertices = outData.vertices.size();
+            stats.tableCapacity = table.GetCapacity();
+            stats.tableGrowths = table.GetGrowthCount();
+        }
+
+        bool ParseOBJSerial(const std::string& filepath, const std::string& directory, tinyobj::attrib_t& attrib,
+                            std::vector<tinyobj::shape_t>& shapes, std::vector<tinyobj::material_t>& materials)
+        {
+            std::string warn, err;
+            if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filepath.c_str(), directory.c_str()))
+            {
+                SEA_CORE_ERROR("Failed to load OBJ: {} {}", warn, err);
+                return false;
+            }
+
+            if (!warn.empty())
+                SEA_CORE_WARN("OBJ Warning: {}", warn);
+            return true;
+        }
+
+        // 优先使用多线程解析，遇到不支持的内容时回退到 tinyobjloader
+        bool ParseOBJ(const std::string& filepath, tinyobj::attrib_t& attrib, std::vector<tinyobj::shape_t>& shapes,
+                      std::vector<tinyobj::material_t>& materials, u32* outParseChunks = nullptr)
+        {
+            // 获取目录路径用于材质加载
+            std::string directory = filepath.substr(0, filepath.find_last_of("/\\") + 1);
+
+            std::string warn;
+            OBJParseStats parseStats;
+            switch (ParseOBJParallel(filepath, directory, attrib, shapes, materials, warn, &parseStats))
+            {
+            case OBJParseResult::Success:
+                if (!warn.empty())
+                    SEA_CORE_WARN("OBJ Warning: {}", warn);
+                if (outParseChunks)
+                    *outParseChunks = parseStats.chunkCount;
+                return true;
+            case OBJParseResult::Failed:
+                SEA_CORE_ERROR("Failed to load OBJ: cannot open {}", filepath);
+                return false;
+            case OBJParseResult::Unsupported:
+                break;
+            }
+
+            attrib = tinyobj::attrib_t();
+            shapes.clear();
+            materials.clear();
+            if (outParseChunks)
+                *outParseChunks = 0;
+            return ParseOBJSerial(filepath, directory, attrib, shapes, materials);
+        }
+    }
+
+    bool LoadOBJ(const std::string& filepath, MeshData& outData, OBJLoadStats* outStats)
+    {
+        OBJLoadStats stats;
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        if (!ParseOBJ(filepath, attrib, shapes, materials, &stats.parseChunks))
+            return false;
+
+        auto parseTime = std::chrono::high_resolution_clock::now();
+
+        outData.Clear();
+
+        // 加载材质
+        for (const auto& mat : materials)
+        {
+            Material m;
+            m.name = mat.name;
+            m.albedo = { mat.diffuse[0], mat.diffuse[1], mat.diffuse[2], 1.0f };
+            m.metallic = mat.metallic;
+            m.roughness = mat.roughness;
+            m.albedoTexture = mat.diffuse_texname;
+            m.normalTexture = mat.normal_texname;
+            outData.materials.push_back(m);
+        }
+
+        // 如果没有材质，添加默认材质
+        if (outData.materials.empty())
+        {
+            Material defaultMat;
+            defaultMat.name = "Default";
+            outData.materials.push_back(defaultMat);
+        }
+
+        BuildIndexedMesh(attrib, shapes, outData, stats);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        stats.parseTimeMs = std::chrono::duration<f32, std::milli>(parseTime - startTime).count();
+        stats.dedupTimeMs = std::chrono::duration<f32, std::milli>(endTime - parseTime).count();
+
+        OptimizeMesh(outData, &stats.optimize);
+
+        SEA_CORE_INFO("Loaded OBJ: {} vertices, {} indices, {} submeshes (parse {:.1f} ms / {} chunks, dedup {:.1f} ms)",
+                      outData.vertices.size(), outData.indices.size(), outData.subMeshes.size(),
+                      stats.parseTimeMs, stats.parseChunks, stats.dedupTimeMs);
+        SEA_CORE_INFO("  Vertex cache: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f} ({} overdraw clusters, {:.1f} ms)",
+                      stats.optimize.before.acmr, stats.optimize.after.acmr,
+                      stats.optimize.before.atvr, stats.optimize.after.atvr,
+                      stats.optimize.clusterCount, stats.optimize.timeMs);
+
+        if (outStats)
+            *outStats = stats;
+        return true;
+    }
+}
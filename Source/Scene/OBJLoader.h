@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include "Scene/MeshOptimizer.h"
+#include <string>
+
+namespace Sea
+{
+    // OBJ 加载统计（最近一次 LoadOBJ）
+    struct OBJLoadStats
+    {
+        u64 indexCount = 0;
+        u64 uniqueVertices = 0;
+        u32 tableCapacity = 0;      // 去重哈希表槽位数
+        u32 tableGrowths = 0;       // 预估不足时的扩容次数
+        u32 parseChunks = 0;        // 并行解析的分块数，0 表示回退到 tinyobjloader
+        f32 parseTimeMs = 0.0f;     // OBJ 文本解析
+        f32 dedupTimeMs = 0.0f;     // 顶点去重 + 索引生成
+        MeshOptimizeStats optimize; // 顶点缓存 / overdraw / 顶点获取优化
+    };
+
+    // 解析 OBJ 到 CPU 端网格数据（不需要图形设备）
+    // 文本解析由 ParseOBJParallel 在 JobSystem 上完成，不支持的文件回退到 tinyobjloader
+    // 去重后经过 OptimizeMesh 重排索引与顶点
+    // 顶点去重使用 (v, n, t) 打包成的 96 位整数键 + 开放寻址哈希表，表按索引数预先分配
+    bool LoadOBJ(const std::string& filepath, MeshData& outData, OBJLoadStats* outStats = nullptr);
+}
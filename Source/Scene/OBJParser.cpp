@@ -0,0 +1,653 @@
+#include "Scene/OBJParser.h"
+#include "Core/MappedFile.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u64 MIN_CHUNK_BYTES = 256 * 1024;
+        constexpr u32 CHUNKS_PER_THREAD = 4;
+        constexpr u32 MAX_FACE_VERTICES = 4;
+
+        // 面顶点索引：正数索引已转成 0 基全局索引；相对索引暂存为块内位置，合并时加上块的起始偏移
+        struct FaceVertex
+        {
+            i32 position;
+            i32 normal;
+            i32 texCoord;
+        };
+
+        // 一段连续的面，共享同一个 shape 与材质
+        struct FaceSegment
+        {
+            bool shapeBreak = false;        // 段前出现了 g / o
+            bool materialChange = false;    // 段前出现了 usemtl
+            std::string materialName;
+            u32 faceBegin = 0;
+            u32 faceEnd = 0;
+            u32 indexBegin = 0;
+            u64 triangleCount = 0;
+
+            // 合并阶段填写
+            u32 shape = 0;
+            i32 material = -1;
+            u64 triangleOffset = 0;         // 在所属 shape 中的第一个三角形
+        };
+
+        struct OBJChunk
+        {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+
+            std::vector<f32> positions;
+            std::vector<f32> normals;
+            std::vector<f32> texCoords;
+            std::vector<FaceVertex> faceVertices;
+            std::vector<u8> faceSizes;
+            std::vector<FaceSegment> segments;
+            std::vector<std::string> materialLibraries;
+
+            // 使用相对索引的面顶点位置（faceVertices 下标）
+            std::vector<u32> positionFixups;
+            std::vector<u32> normalFixups;
+            std::vector<u32> texCoordFixups;
+
+            u64 positionOffset = 0;
+            u64 normalOffset = 0;
+            u64 texCoordOffset = 0;
+
+            bool unsupported = false;
+            bool degenerateFaces = false;
+        };
+
+        inline bool IsSpace(char c) { return c == ' ' || c == '\t'; }
+        inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+        inline void SkipSpaces(const char*& token, const char* lineEnd)
+        {
+            while (token < lineEnd && IsSpace(*token))
+                ++token;
+        }
+
+        inline const char* FindTokenEnd(const char* token, const char* lineEnd)
+        {
+            while (token < lineEnd && !IsSpace(*token))
+                ++token;
+            return token;
+        }
+
+        // 与 tinyobjloader 的 tryParseDouble 使用相同的累加顺序，保证结果逐位一致；不依赖 locale，也不分配内存
+        bool TryParseDouble(const char* s, const char* end, f64& result)
+        {
+            if (s >= end)
+                return false;
+
+            f64 mantissa = 0.0;
+            i32 exponent = 0;
+            char sign = '+';
+            char exponentSign = '+';
+            const char* current = s;
+            i32 read = 0;
+            bool leadingDot = false;
+
+            if (*current == '+' || *current == '-')
+            {
+                sign = *current;
+                ++current;
+                if (current != end && *current == '.')
+                    leadingDot = true;
+            }
+            else if (*current == '.')
+            {
+                leadingDot = true;
+            }
+            else if (!IsDigit(*current))
+            {
+                return false;
+            }
+
+            // 整数部分
+            if (!leadingDot)
+            {
+                while (current != end && IsDigit(*current))
+                {
+                    mantissa *= 10;
+                    mantissa += static_cast<i32>(*current - '0');
+                    ++current;
+                    ++read;
+                }
+                if (read == 0)
+                    return false;
+            }
+
+            // 小数部分
+            if (current != end && *current == '.')
+            {
+                static const f64 POW_LUT[] = { 1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001 };
+                constexpr i32 LUT_ENTRIES = static_cast<i32>(sizeof(POW_LUT) / sizeof(POW_LUT[0]));
+
+                ++current;
+                read = 1;
+                while (current != end && IsDigit(*current))
+                {
+                    mantissa += static_cast<i32>(*current - '0') * (read < LUT_ENTRIES ? POW_LUT[read] : std::pow(10.0, -read));
+                    ++read;
+                    ++current;
+                }
+            }
+
+            // 指数部分
+            if (current != end && (*current == 'e' || *current == 'E'))
+            {
+                ++current;
+                if (current != end && (*current == '+' || *current == '-'))
+                {
+                    exponentSign = *current;
+                    ++current;
+                }
+                else if (current == end || !IsDigit(*current))
+                {
+                    return false;
+                }
+
+                read = 0;
+                while (current != end && IsDigit(*current))
+                {
+                    if (exponent > 2147483647 / 10)
+                        return false;
+                    exponent *= 10;
+                    exponent += static_cast<i32>(*current - '0');
+                    ++current;
+                    ++read;
+                }
+                exponent *= (exponentSign == '+' ? 1 : -1);
+                if (read == 0)
+                    return false;
+            }
+
+            result = (sign == '+' ? 1 : -1) * (exponent ? std::ldexp(mantissa * std::pow(5.0, exponent), exponent) : mantissa);
+            return true;
+        }
+
+        inline f32 ParseReal(const char*& token, const char* lineEnd)
+        {
+            SkipSpaces(token, lineEnd);
+            const char* tokenEnd = FindTokenEnd(token, lineEnd);
+            f64 value = 0.0;
+            TryParseDouble(token, tokenEnd, value);
+            token = tokenEnd;
+            return static_cast<f32>(value);
+        }
+
+        // atoi 语义：读到第一个非数字为止，随后跳到下一个 '/' 或空白
+        inline i32 ParseInt(const char*& token, const char* lineEnd)
+        {
+            i32 sign = 1;
+            if (token < lineEnd && (*token == '+' || *token == '-'))
+            {
+                sign = (*token == '-') ? -1 : 1;
+                ++token;
+            }
+            i32 value = 0;
+            while (token < lineEnd && IsDigit(*token))
+            {
+                value = value * 10 + (*token - '0');
+                ++token;
+            }
+            while (token < lineEnd && *token != '/' && !IsSpace(*token))
+                ++token;
+            return value * sign;
+        }
+
+        // OBJ 索引从 1 开始，负数表示相对当前已读属性数；0 非法
+        inline bool ResolveIndex(i32 raw, u64 localCount, i32& outIndex, std::vector<u32>& fixups, u32 slot)
+        {
+            if (raw > 0)
+            {
+                outIndex = raw - 1;
+                return true;
+            }
+            if (raw == 0)
+                return false;
+
+            outIndex = static_cast<i32>(localCount) + raw;
+            fixups.push_back(slot);
+            return true;
+        }
+
+        bool ParseFaceVertex(OBJChunk& chunk, const char*& token, const char* lineEnd)
+        {
+            const u32 slot = static_cast<u32>(chunk.faceVertices.size());
+            FaceVertex vertex = { -1, -1, -1 };
+
+            if (!ResolveIndex(ParseInt(token, lineEnd), chunk.positions.size() / 3, vertex.position, chunk.positionFixups, slot))
+                return false;
+
+            if (token < lineEnd && *token == '/')
+            {
+                ++token;
+                if (token < lineEnd && *token == '/')
+                {
+                    // i//k
+                    ++token;
+                    if (!ResolveIndex(ParseInt(token, lineEnd), chunk.normals.size() / 3, vertex.normal, chunk.normalFixups, slot))
+                        return false;
+                }
+                else
+                {
+                    // i/j 或 i/j/k
+                    if (!ResolveIndex(ParseInt(token, lineEnd), chunk.texCoords.size() / 2, vertex.texCoord, chunk.texCoordFixups, slot))
+                        return false;
+                    if (token < lineEnd && *token == '/')
+                    {
+                        ++token;
+                        if (!ResolveIndex(ParseInt(token, lineEnd), chunk.normals.size() / 3, vertex.normal, chunk.normalFixups, slot))
+                            return false;
+                    }
+                }
+            }
+
+            chunk.faceVertices.push_back(vertex);
+            return true;
+        }
+
+        // g / o / usemtl 开始新的一段；当前段还没有面时直接合并标记
+        void BeginSegment(OBJChunk& chunk, bool shapeBreak, const std::string* materialName)
+        {
+            FaceSegment* segment = &chunk.segments.back();
+            segment->faceEnd = static_cast<u32>(chunk.faceSizes.size());
+            if (segment->faceEnd != segment->faceBegin)
+            {
+                FaceSegment next;
+                next.faceBegin = next.faceEnd = segment->faceEnd;
+                next.indexBegin = static_cast<u32>(chunk.faceVertices.size());
+                chunk.segments.push_back(next);
+                segment = &chunk.segments.back();
+            }
+
+            segment->shapeBreak |= shapeBreak;
+            if (materialName)
+            {
+                segment->materialChange = true;
+                segment->materialName = *materialName;
+            }
+        }
+
+        void ParseLine(OBJChunk& chunk, const char* token, const char* lineEnd)
+        {
+            SkipSpaces(token, lineEnd);
+            const size_t length = static_cast<size_t>(lineEnd - token);
+            if (length == 0 || token[0] == '#')
+                return;
+
+            auto followedBySpace = [&](size_t offset) { return length > offset && IsSpace(token[offset]); };
+
+            if (token[0] == 'v' && followedBySpace(1))
+            {
+                token += 2;
+                const f32 x = ParseReal(token, lineEnd);
+                const f32 y = ParseReal(token, lineEnd);
+                const f32 z = ParseReal(token, lineEnd);
+                chunk.positions.insert(chunk.positions.end(), { x, y, z });
+            }
+            else if (token[0] == 'v' && length > 1 && token[1] == 'n' && followedBySpace(2))
+            {
+                token += 3;
+                const f32 x = ParseReal(token, lineEnd);
+                const f32 y = ParseReal(token, lineEnd);
+                const f32 z = ParseReal(token, lineEnd);
+                chunk.normals.insert(chunk.normals.end(), { x, y, z });
+            }
+            else if (token[0] == 'v' && length > 1 && token[1] == 't' && followedBySpace(2))
+            {
+                token += 3;
+                const f32 u = ParseReal(token, lineEnd);
+                const f32 v = ParseReal(token, lineEnd);
+                chunk.texCoords.insert(chunk.texCoords.end(), { u, v });
+            }
+            else if (token[0] == 'f' && followedBySpace(1))
+            {
+                token += 2;
+                SkipSpaces(token, lineEnd);
+
+                u32 count = 0;
+                while (token < lineEnd)
+                {
+                    if (!ParseFaceVertex(chunk, token, lineEnd))
+                    {
+                        chunk.unsupported = true;
+                        return;
+                    }
+                    ++count;
+                    SkipSpaces(token, lineEnd);
+                }
+
+                if (count > MAX_FACE_VERTICES)
+                {
+                    // 一般多边形的三角化（耳切法）交给 tinyobjloader
+                    chunk.unsupported = true;
+                    return;
+                }
+
+                chunk.faceSizes.push_back(static_cast<u8>(count));
+                if (count >= 3)
+                    chunk.segments.back().triangleCount += count - 2;
+                else
+                    chunk.degenerateFaces = true;
+            }
+            else if ((token[0] == 'g' || token[0] == 'o') && followedBySpace(1))
+            {
+                BeginSegment(chunk, true, nullptr);
+            }
+            else if (length >= 6 && std::strncmp(token, "usemtl", 6) == 0)
+            {
+                token += 6;
+                SkipSpaces(token, lineEnd);
+                const std::string name(token, FindTokenEnd(token, lineEnd));
+                BeginSegment(chunk, false, &name);
+            }
+            else if (length >= 6 && std::strncmp(token, "mtllib", 6) == 0 && followedBySpace(6))
+            {
+                token += 7;
+                chunk.materialLibraries.emplace_back(token, lineEnd);
+            }
+            else if ((token[0] == 'l' || token[0] == 'p') && followedBySpace(1))
+            {
+                // 线/点图元会生成只含 lines/points 的 shape，交给 tinyobjloader
+                chunk.unsupported = true;
+            }
+        }
+
+        void ParseChunk(OBJChunk& chunk)
+        {
+            // 按平均行长粗略预留，避免小块反复扩容
+            const size_t estimatedLines = static_cast<size_t>(chunk.end - chunk.begin) / 24;
+            chunk.positions.reserve(estimatedLines * 3 / 2);
+            chunk.faceVertices.reserve(estimatedLines * 3 / 2);
+            chunk.faceSizes.reserve(estimatedLines / 2);
+
+            chunk.segments.emplace_back();
+
+            const char* line = chunk.begin;
+            while (line < chunk.end && !chunk.unsupported)
+            {
+                // tinyobjloader 把 "\n"、"\r\n" 与单独的 "\r" 都视为换行
+                const char* lineEnd = line;
+                while (lineEnd < chunk.end && *lineEnd != '\n' && *lineEnd != '\r')
+                    ++lineEnd;
+
+                ParseLine(chunk, line, lineEnd);
+                line = lineEnd + 1;
+            }
+
+            chunk.segments.back().faceEnd = static_cast<u32>(chunk.faceSizes.size());
+        }
+
+        // 按行边界切分，每块的起点都是一行的开头
+        std::vector<OBJChunk> SplitIntoChunks(const char* data, u64 size, u32 chunkCount)
+        {
+            std::vector<OBJChunk> chunks(chunkCount);
+            const char* end = data + size;
+            const char* begin = data;
+            for (u32 i = 0; i < chunkCount; ++i)
+            {
+                const char* split = (i + 1 == chunkCount) ? end : data + size * (i + 1) / chunkCount;
+                split = std::max(split, begin);
+                while (split < end && split > data && split[-1] != '\n')
+                    ++split;
+
+                chunks[i].begin = begin;
+                chunks[i].end = split;
+                begin = split;
+            }
+            return chunks;
+        }
+
+        void LoadMaterialLibraries(const std::vector<OBJChunk>& chunks, const std::string& mtlDirectory,
+                                   std::vector<tinyobj::material_t>& outMaterials, std::map<std::string, int>& outMaterialMap,
+                                   std::string& outWarning)
+        {
+            for (const auto& chunk : chunks)
+            {
+                for (const auto& library : chunk.materialLibraries)
+                {
+                    // 一行可以列出多个候选文件，取第一个能打开的
+                    bool loaded = false;
+                    const char* token = library.data();
+                    const char* lineEnd = token + library.size();
+                    while (!loaded && token < lineEnd)
+                    {
+                        SkipSpaces(token, lineEnd);
+                        const char* tokenEnd = FindTokenEnd(token, lineEnd);
+                        if (tokenEnd == token)
+                            break;
+
+                        std::ifstream stream(mtlDirectory + std::string(token, tokenEnd));
+                        if (stream)
+                        {
+                            std::string warning, error;
+                            tinyobj::LoadMtl(&outMaterialMap, &outMaterials, &stream, &warning, &error);
+                            outWarning += warning;
+                            loaded = true;
+                        }
+                        token = tokenEnd;
+                    }
+
+                    if (!loaded)
+                        outWarning += "Failed to load material file(s) " + library + "\n";
+                }
+            }
+        }
+    }
+
+    OBJParseResult ParseOBJParallel(const std::string& filepath, const std::string& mtlDirectory,
+                                    tinyobj::attrib_t& outAttrib, std::vector<tinyobj::shape_t>& outShapes,
+                                    std::vector<tinyobj::material_t>& outMaterials, std::string& outWarning,
+                                    OBJParseStats* outStats)
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        MappedFile file;
+        if (!file.Open(filepath))
+            return OBJParseResult::Failed;
+
+        const char* data = reinterpret_cast<const char*>(file.GetData());
+        const u64 size = file.GetSize();
+        const u32 threadCount = JobSystem::GetThreadCount();
+        const u32 chunkCount = static_cast<u32>(std::clamp<u64>(size / MIN_CHUNK_BYTES, 1, threadCount * CHUNKS_PER_THREAD));
+
+        // 1. 各块独立解析
+        std::vector<OBJChunk> chunks = SplitIntoChunks(data, size, chunkCount);
+        JobSystem::RunParallelFor(chunkCount, 1, [&chunks](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+                ParseChunk(chunks[i]);
+        });
+
+        auto parseTime = std::chrono::high_resolution_clock::now();
+
+        // 2. 属性偏移、材质、shape 划分（只遍历段，开销很小）
+        u64 positionCount = 0, normalCount = 0, texCoordCount = 0;
+        bool degenerateFaces = false;
+        for (auto& chunk : chunks)
+        {
+            if (chunk.unsupported)
+                return OBJParseResult::Unsupported;
+
+            chunk.positionOffset = positionCount;
+            chunk.normalOffset = normalCount;
+            chunk.texCoordOffset = texCoordCount;
+            positionCount += chunk.positions.size() / 3;
+            normalCount += chunk.normals.size() / 3;
+            texCoordCount += chunk.texCoords.size() / 2;
+            degenerateFaces |= chunk.degenerateFaces;
+        }
+
+        outWarning.clear();
+        outMaterials.clear();
+        std::map<std::string, int> materialMap;
+        LoadMaterialLibraries(chunks, mtlDirectory, outMaterials, materialMap, outWarning);
+
+        // 与 tinyobj::LoadObj 一致：g/o 结束当前 shape（空 shape 丢弃），材质状态跨 shape 保留
+        std::vector<u64> shapeTriangles(1, 0);
+        i32 currentMaterial = -1;
+        for (auto& chunk : chunks)
+        {
+            for (auto& segment : chunk.segments)
+            {
+                if (segment.shapeBreak && shapeTriangles.back() > 0)
+                    shapeTriangles.push_back(0);
+                if (segment.materialChange)
+                {
+                    // 找不到的材质按 -1 处理
+                    auto it = materialMap.find(segment.materialName);
+                    currentMaterial = (it != materialMap.end()) ? it->second : -1;
+                    if (it == materialMap.end())
+                        outWarning += "material [ '" + segment.materialName + "' ] not found in .mtl\n";
+                }
+
+                segment.shape = static_cast<u32>(shapeTriangles.size() - 1);
+                segment.material = currentMaterial;
+                segment.triangleOffset = shapeTriangles.back();
+                shapeTriangles.back() += segment.triangleCount;
+            }
+        }
+        if (shapeTriangles.back() == 0)
+            shapeTriangles.pop_back();
+
+        if (degenerateFaces)
+            outWarning += "Degenerated face found\n";
+
+        outAttrib = tinyobj::attrib_t();
+        outAttrib.vertices.resize(positionCount * 3);
+        outAttrib.normals.resize(normalCount * 3);
+        outAttrib.texcoords.resize(texCoordCount * 2);
+
+        outShapes.assign(shapeTriangles.size(), tinyobj::shape_t());
+        for (size_t i = 0; i < outShapes.size(); ++i)
+        {
+            outShapes[i].mesh.indices.resize(shapeTriangles[i] * 3);
+            outShapes[i].mesh.material_ids.resize(shapeTriangles[i]);
+            outShapes[i].mesh.num_face_vertices.assign(shapeTriangles[i], 3);
+        }
+
+        // 3. 拼接属性并修正相对索引，同时检查越界
+        std::atomic<bool> invalidIndex = false;
+        JobSystem::RunParallelFor(chunkCount, 1, [&](u32 begin, u32 end) {
+            for (u32 c = begin; c < end; ++c)
+            {
+                OBJChunk& chunk = chunks[c];
+                std::copy(chunk.positions.begin(), chunk.positions.end(), outAttrib.vertices.begin() + chunk.positionOffset * 3);
+                std::copy(chunk.normals.begin(), chunk.normals.end(), outAttrib.normals.begin() + chunk.normalOffset * 3);
+                std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), outAttrib.texcoords.begin() + chunk.texCoordOffset * 2);
+
+                for (u32 slot : chunk.positionFixups)
+                    chunk.faceVertices[slot].position += static_cast<i32>(chunk.positionOffset);
+                for (u32 slot : chunk.normalFixups)
+                    chunk.faceVertices[slot].normal += static_cast<i32>(chunk.normalOffset);
+                for (u32 slot : chunk.texCoordFixups)
+                    chunk.faceVertices[slot].texCoord += static_cast<i32>(chunk.texCoordOffset);
+
+                for (const auto& vertex : chunk.faceVertices)
+                {
+                    if (vertex.position < 0 || static_cast<u64>(vertex.position) >= positionCount ||
+                        vertex.normal < -1 || (vertex.normal >= 0 && static_cast<u64>(vertex.normal) >= normalCount) ||
+                        vertex.texCoord < -1 || (vertex.texCoord >= 0 && static_cast<u64>(vertex.texCoord) >= texCoordCount))
+                    {
+                        invalidIndex = true;
+                        break;
+                    }
+                }
+            }
+        });
+
+        // 越界索引的处理（报错或跳过）以 tinyobjloader 为准
+        if (invalidIndex)
+            return OBJParseResult::Unsupported;
+
+        // 4. 三角化，各块直接写入所属 shape 的预留区间
+        const f32* positions = outAttrib.vertices.data();
+        JobSystem::RunParallelFor(chunkCount, 1, [&](u32 begin, u32 end) {
+            for (u32 c = begin; c < end; ++c)
+            {
+                const OBJChunk& chunk = chunks[c];
+                for (const auto& segment : chunk.segments)
+                {
+                    if (segment.triangleCount == 0)
+                        continue;
+
+                    tinyobj::mesh_t& mesh = outShapes[segment.shape].mesh;
+                    u64 triangle = segment.triangleOffset;
+                    u32 vertexIndex = segment.indexBegin;
+
+                    auto emit = [&](const FaceVertex& v0, const FaceVertex& v1, const FaceVertex& v2) {
+                        tinyobj::index_t* out = &mesh.indices[triangle * 3];
+                        for (const FaceVertex* v : { &v0, &v1, &v2 })
+                        {
+                            out->vertex_index = v->position;
+                            out->normal_index = v->normal;
+                            out->texcoord_index = v->texCoord;
+                            ++out;
+                        }
+                        mesh.material_ids[triangle] = segment.material;
+                        ++triangle;
+                    };
+
+                    for (u32 f = segment.faceBegin; f < segment.faceEnd; ++f)
+                    {
+                        const u32 faceSize = chunk.faceSizes[f];
+                        const FaceVertex* face = &chunk.faceVertices[vertexIndex];
+                        vertexIndex += faceSize;
+
+                        if (faceSize == 3)
+                        {
+                            emit(face[0], face[1], face[2]);
+                        }
+                        else if (faceSize == 4)
+                        {
+                            // 沿较短的对角线切分
+                            auto diagonal = [positions](const FaceVertex& a, const FaceVertex& b) {
+                                const f32* pa = positions + a.position * 3;
+                                const f32* pb = positions + b.position * 3;
+                                const f32 dx = pb[0] - pa[0];
+                                const f32 dy = pb[1] - pa[1];
+                                const f32 dz = pb[2] - pa[2];
+                                return dx * dx + dy * dy + dz * dz;
+                            };
+
+                            if (diagonal(face[0], face[2]) < diagonal(face[1], face[3]))
+                            {
+                                emit(face[0], face[1], face[2]);
+                                emit(face[0], face[2], face[3]);
+                            }
+                            else
+                            {
+                                emit(face[0], face[1], face[3]);
+                                emit(face[1], face[2], face[3]);
+                            }
+                        }
+                    }
+                }
+            }
+        });
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        if (outStats)
+        {
+            outStats->chunkCount = chunkCount;
+            outStats->threadCount = threadCount;
+            outStats->parseTimeMs = std::chrono::duration<f32, std::milli>(parseTime - startTime).count();
+            outStats->mergeTimeMs = std::chrono::duration<f32, std::milli>(endTime - parseTime).count();
+        }
+        return OBJParseResult::Success;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <tiny_obj_loader.h>
+#include <string>
+#include <vector>
+
+namespace Sea
+{
+    enum class OBJParseResult
+    {
+        Success,
+        Unsupported,    // 遇到并行解析器不处理的内容（多边形 > 4 边、线/点图元、无效索引等），应回退到 tinyobjloader
+        Failed          // 文件无法打开
+    };
+
+    struct OBJParseStats
+    {
+        u32 chunkCount = 0;
+        u32 threadCount = 0;
+        f32 parseTimeMs = 0.0f;     // 各分块并行解析
+        f32 mergeTimeMs = 0.0f;     // 属性拼接 + 索引修正 + 三角化
+    };
+
+    // 多线程 OBJ 解析
+    // - 文件整体内存映射，按行边界切成若干块，由 JobSystem 并行解析 v/vn/vt/f/g/o/usemtl/mtllib
+    // - 浮点解析与 tinyobjloader 的 tryParseDouble 累加顺序一致，结果逐位相同
+    // - 合并阶段把各块属性拼接起来，并修正相对（负数）索引
+    // - 三角化规则与 tinyobj::LoadObj 相同（四边形取较短对角线），输出可直接交给 OBJLoader 的去重阶段
+    OBJParseResult ParseOBJParallel(const std::string& filepath, const std::string& mtlDirectory,
+                                    tinyobj::attrib_t& outAttrib, std::vector<tinyobj::shape_t>& outShapes,
+                                    std::vector<tinyobj::material_t>& outMaterials, std::string& outWarning,
+                                    OBJParseStats* outStats = nullptr);
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Log.h"
+#include "Graphics/Buffer.h"
+#include "Scene/ObjectSlotAllocator.h"
+#include <cstring>
+
+namespace Sea
+{
+    // 常驻的物体常量表统计（每帧，均为实际计数与计时）
+    struct ObjectConstantTableStats
+    {
+        u32 objectCount = 0;        // 本帧绘制的物体
+        u32 rebuiltObjects = 0;     // 常量被重新打包并上传的物体
+        u64 uploadedBytes = 0;      // 实际写入上传堆的字节数
+        f32 prepareTimeMs = 0.0f;   // 渲染器准备物体数据（剔除 + 常量）的 CPU 耗时
+    };
+
+    // 常驻物体常量表
+    // 槽位按物体 id 分配并在帧间保持（ObjectSlotAllocator），绘制时根 CBV 直接指向本帧副本的地址。
+    // 上传堆常驻映射、原地写入：每个槽位按在途帧数准备多份副本，写入的副本不会正被在途的帧读取，
+    // 回收后交给其它物体的槽位同样只写本帧的副本。revision 没变且本帧副本已写过的物体既不重新打包也不上传。
+    template<typename T>
+    class ObjectConstantTable : public NonCopyable
+    {
+    public:
+        static constexpr u32 SLOT_ALIGNMENT = 256;  // D3D12 常量缓冲区对齐要求
+        static constexpr u32 INVALID_SLOT = ObjectSlotAllocator::INVALID_SLOT;
+        static_assert(sizeof(T) <= SLOT_ALIGNMENT, "Object constants must fit in one CBV slot");
+
+        bool Initialize(Device& device, u32 capacity, const std::string& name)
+        {
+            BufferDesc desc;
+            desc.size = static_cast<u64>(SLOT_ALIGNMENT) * capacity * ObjectSlotAllocator::FRAME_COPIES;
+            desc.type = BufferType::Constant;
+            desc.name = name;
+            m_Buffer = MakeScope<Buffer>(device, desc);
+            if (!m_Buffer->Initialize(nullptr))
+            {
+                SEA_CORE_ERROR("Failed to create object constant table: {}", name);
+                m_Buffer.reset();
+                return false;
+            }
+
+            // Upload 堆可以常驻映射，避免每次写入都 Map/Unmap
+            m_Mapped = static_cast<u8*>(m_Buffer->Map());
+            m_Slots.Initialize(capacity);
+            return m_Mapped != nullptr;
+        }
+
+        void Shutdown()
+        {
+            if (m_Buffer)
+            {
+                m_Buffer->Unmap();
+            }
+            m_Buffer.reset();
+            m_Mapped = nullptr;
+            m_Slots.Shutdown();
+        }
+
+        void BeginFrame()
+        {
+            m_LastFrameStats = m_Stats;
+            m_Stats = {};
+            m_Slots.BeginFrame();
+        }
+
+        // 强制下一次全部重新上传（例如着色器布局变化）
+        void Invalidate() { m_Slots.Invalidate(); }
+
+        // 每帧无条件重建所有物体，用于与增量路径对比实测开销
+        void SetForceRebuild(bool enabled) { m_Slots.SetForceRebuild(enabled); }
+        bool GetForceRebuild() const { return m_Slots.GetForceRebuild(); }
+
+        u32 GetCapacity() const { return m_Slots.GetCapacity(); }
+
+        // 返回物体的槽位，首次出现时分配；容量不足返回 INVALID_SLOT
+        // 会修改分配表，只能在录制线程上调用
+        u32 AcquireSlot(u32 objectId) { return m_Slots.AcquireSlot(objectId); }
+
+        // 槽位的本帧副本是否已经对应物体的这个 revision
+        bool IsCurrent(u32 slot, u32 revision) const { return m_Slots.IsCurrent(slot, revision); }
+
+        // 写入槽位的本帧副本并记录 revision
+        // 不同槽位之间互不影响，可以在多个线程上并发调用；统计由调用方汇总后交给 AddStats
+        void Upload(u32 slot, const T& constants, u32 revision)
+        {
+            const u32 physical = m_Slots.MarkWritten(slot, revision);
+            std::memcpy(m_Mapped + static_cast<u64>(physical) * SLOT_ALIGNMENT, &constants, sizeof(T));
+        }
+
+        void AddStats(u32 objectCount, u32 rebuiltObjects, f32 prepareTimeMs)
+        {
+            m_Stats.objectCount += objectCount;
+            m_Stats.rebuiltObjects += rebuiltObjects;
+            m_Stats.uploadedBytes += static_cast<u64>(rebuiltObjects) * sizeof(T);
+            m_Stats.prepareTimeMs += prepareTimeMs;
+        }
+
+        // 本帧副本的地址，每帧录制时重新取
+        D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddress(u32 slot) const
+        {
+            return m_Buffer->GetGPUAddress() + static_cast<u64>(m_Slots.GetPhysicalSlot(slot)) * SLOT_ALIGNMENT;
+        }
+
+        // 上一帧的统计
+        const ObjectConstantTableStats& GetStats() const { return m_LastFrameStats; }
+
+    private:
+        Scope<Buffer> m_Buffer;
+        u8* m_Mapped = nullptr;
+        ObjectSlotAllocator m_Slots;
+
+        ObjectConstantTableStats m_Stats;
+        ObjectConstantTableStats m_LastFrameStats;
+    };
+}
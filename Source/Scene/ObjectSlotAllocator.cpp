@@ -0,0 +1,67 @@
+#include "Scene/ObjectSlotAllocator.h"
+#include <algorithm>
+
+namespace Sea
+{
+    void ObjectSlotAllocator::Initialize(u32 capacity)
+    {
+        m_Capacity = capacity;
+        m_SlotOwner.assign(capacity, INVALID_OBJECT);
+        m_SlotFrame.assign(capacity, 0);
+        m_CopyRevision.assign(static_cast<size_t>(capacity) * FRAME_COPIES, 0);
+        m_CopyValid.assign(static_cast<size_t>(capacity) * FRAME_COPIES, 0);
+        m_FreeSlots.clear();
+        for (u32 slot = capacity; slot-- > 0;)
+        {
+            m_FreeSlots.push_back(slot);
+        }
+        m_ObjectSlots.clear();
+    }
+
+    void ObjectSlotAllocator::Invalidate()
+    {
+        std::fill(m_CopyValid.begin(), m_CopyValid.end(), u8(0));
+    }
+
+    u32 ObjectSlotAllocator::AcquireSlot(u32 objectId)
+    {
+        auto it = m_ObjectSlots.find(objectId);
+        if (it != m_ObjectSlots.end())
+        {
+            m_SlotFrame[it->second] = m_Frame;
+            return it->second;
+        }
+
+        if (m_FreeSlots.empty())
+        {
+            ReclaimUnusedSlots();
+            if (m_FreeSlots.empty())
+                return INVALID_SLOT;
+        }
+
+        // 新主人的内容还没写入任何副本；旧主人留下的副本仍可能被在途的帧读取，但新主人只写本帧的副本
+        const u32 slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        m_ObjectSlots.emplace(objectId, slot);
+        m_SlotOwner[slot] = objectId;
+        m_SlotFrame[slot] = m_Frame;
+        for (u32 copy = 0; copy < FRAME_COPIES; ++copy)
+        {
+            m_CopyValid[static_cast<size_t>(copy) * m_Capacity + slot] = 0;
+        }
+        return slot;
+    }
+
+    void ObjectSlotAllocator::ReclaimUnusedSlots()
+    {
+        for (u32 slot = 0; slot < m_Capacity; ++slot)
+        {
+            if (m_SlotOwner[slot] == INVALID_OBJECT || m_SlotFrame[slot] == m_Frame)
+                continue;
+
+            m_ObjectSlots.erase(m_SlotOwner[slot]);
+            m_SlotOwner[slot] = INVALID_OBJECT;
+            m_FreeSlots.push_back(slot);
+        }
+    }
+}
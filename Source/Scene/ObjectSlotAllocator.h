@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <unordered_map>
+#include <vector>
+
+namespace Sea
+{
+    // 物体常量表的槽位分配（与设备无关，ObjectConstantTable 在它之上管理缓冲区）
+    // 槽位按物体 id 分配并在帧间保持；每个槽位有 FRAME_COPIES 份物理副本，第 F 帧只读写第 F % FRAME_COPIES 份，
+    // 所以写入的副本上一次被读是 FRAME_COPIES 帧之前，那一帧的 GPU 工作已经结束（与 MeshCache::RETIRE_FRAMES 的约定相同）。
+    // 每份副本记录写入时物体的 revision，revision 没变时不需要重写；槽位换了主人时所有副本都作废。
+    class ObjectSlotAllocator : public NonCopyable
+    {
+    public:
+        static constexpr u32 FRAME_COPIES = 3;      // 不少于同时在途的帧数（FrameResourceManager::kMaxFramesInFlight）
+        static constexpr u32 INVALID_SLOT = ~0u;
+
+        void Initialize(u32 capacity);
+        void Shutdown() { Initialize(0); }
+
+        void BeginFrame() { ++m_Frame; }
+
+        // 作废所有副本，下一次全部重写（例如着色器布局变化）
+        void Invalidate();
+
+        void SetForceRebuild(bool enabled) { m_ForceRebuild = enabled; }
+        bool GetForceRebuild() const { return m_ForceRebuild; }
+
+        u32 GetCapacity() const { return m_Capacity; }
+
+        // 返回物体的槽位，首次出现时分配；槽位用完时回收本帧没有用到的槽位，仍不够时返回 INVALID_SLOT
+        // 会修改分配表，只能在录制线程上调用
+        u32 AcquireSlot(u32 objectId);
+
+        // 本帧副本是否已经是物体的这个 revision
+        bool IsCurrent(u32 slot, u32 revision) const
+        {
+            const u32 physical = GetPhysicalSlot(slot);
+            return !m_ForceRebuild && m_CopyValid[physical] && m_CopyRevision[physical] == revision;
+        }
+
+        // 记录本帧副本写入了 revision，返回要写入的物理槽位
+        // 不同槽位之间互不影响，可以在多个线程上并发调用
+        u32 MarkWritten(u32 slot, u32 revision)
+        {
+            const u32 physical = GetPhysicalSlot(slot);
+            m_CopyRevision[physical] = revision;
+            m_CopyValid[physical] = 1;
+            return physical;
+        }
+
+        // 本帧绘制时读取的物理槽位，范围 [0, capacity * FRAME_COPIES)
+        u32 GetPhysicalSlot(u32 slot) const { return static_cast<u32>(m_Frame % FRAME_COPIES) * m_Capacity + slot; }
+
+    private:
+        static constexpr u32 INVALID_OBJECT = ~0u;
+
+        void ReclaimUnusedSlots();
+
+    private:
+        u32 m_Capacity = 0;
+        std::vector<u32> m_SlotOwner;       // 槽位所属的物体 id
+        std::vector<u64> m_SlotFrame;       // 槽位最近一次被使用的帧
+        std::vector<u32> m_CopyRevision;    // 每份副本内容对应的物体 revision
+        std::vector<u8> m_CopyValid;
+        std::vector<u32> m_FreeSlots;
+        std::unordered_map<u32, u32> m_ObjectSlots;
+        u64 m_Frame = 0;
+        bool m_ForceRebuild = false;
+    };
+}
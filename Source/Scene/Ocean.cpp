@@ -22,6 +22,7 @@ namespace Sea
         XMFLOAT4 scatterColor;      // SSS scatter color
         XMFLOAT4 foamParams;        // x = foam intensity, y = foam scale, z = whitecap threshold, w = unused
         XMFLOAT4 atmosphereParams;  // x = fog density, y = fog height falloff, z = sun disk size, w = unused
+        XMFLOAT4 quadTreeParams;    // x = 四叉树基础网格每边的格数, yzw = unused
     };
 
     struct OceanComputeCBData
@@ -60,7 +61,8 @@ namespace Sea
         }
         
         // 初始化四叉树 LOD
-        m_QuadTree = MakeScope<OceanQuadTree>(m_Device);
+        m_QuadTree = MakeScope<OceanQuadTree>();
+        m_QuadTreeMesh = MakeScope<OceanQuadTreeMesh>(m_Device);
         OceanQuadTreeConfig quadTreeConfig;
         quadTreeConfig.worldSize = m_Params.gridSize * 20.0f;  // 覆盖更大范围
         quadTreeConfig.maxLOD = 5;
@@ -68,7 +70,7 @@ namespace Sea
         quadTreeConfig.lodBaseDistance = 80.0f;
         quadTreeConfig.lodDistanceMultiplier = 2.2f;
         
-        if (!m_QuadTree->Initialize(quadTreeConfig))
+        if (!m_QuadTree->Initialize(quadTreeConfig) || !m_QuadTreeMesh->Initialize(quadTreeConfig))
         {
             SEA_CORE_WARN("Failed to initialize QuadTree LOD, falling back to simple mesh");
             m_UseQuadTree = false;
@@ -349,21 +351,7 @@ namespace Sea
             return false;
         }
 
-        // 创建实例缓冲区的 SRV
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-        srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.Buffer.FirstElement = 0;
-        srvDesc.Buffer.NumElements = 4096;  // 最大实例数
-        srvDesc.Buffer.StructureByteStride = sizeof(OceanQuadInstance);
-        srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
-
-        m_Device.GetDevice()->CreateShaderResourceView(
-            m_QuadTree->GetInstanceBuffer()->GetResource(),
-            &srvDesc,
-            m_QuadTreeSRVHeap->GetCPUHandle(0)
-        );
+        CreateQuadTreeInstanceSRV();
 
         // 编译着色器
         std::string vsPath = "Shaders/Ocean/OceanQuadTree_VS.hlsl";
@@ -427,6 +415,27 @@ namespace Sea
         return true;
     }
 
+    void Ocean::CreateQuadTreeInstanceSRV()
+    {
+        const u32 capacity = m_QuadTreeMesh->GetInstanceCapacity();
+
+        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+        srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        srvDesc.Buffer.FirstElement = 0;
+        srvDesc.Buffer.NumElements = capacity;
+        srvDesc.Buffer.StructureByteStride = sizeof(OceanQuadInstance);
+        srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
+
+        m_Device.GetDevice()->CreateShaderResourceView(
+            m_QuadTreeMesh->GetInstanceBuffer()->GetResource(),
+            &srvDesc,
+            m_QuadTreeSRVHeap->GetCPUHandle(0)
+        );
+        m_QuadTreeSRVCapacity = capacity;
+    }
+
     void Ocean::Update(f32 deltaTime, CommandList& cmdList)
     {
         if (!m_Initialized) return;
@@ -465,8 +474,6 @@ namespace Sea
     {
         if (!m_Initialized) return;
 
-        auto* cmdListPtr = cmdList.GetCommandList();
-
         // 更新常量缓冲
         OceanCBData cbData;
         
@@ -498,13 +505,21 @@ namespace Sea
         // Atmosphere parameters
         cbData.atmosphereParams = { m_Params.fogDensity, m_Params.fogHeightFalloff, m_Params.sunDiskSize, 0.0f };
 
+        // 四叉树着色器按基础网格分辨率做变形与边缘缝合
+        const u32 quadResolution = m_QuadTree ? m_QuadTree->GetConfig().baseMeshResolution : 0;
+        cbData.quadTreeParams = { static_cast<f32>(quadResolution), 0.0f, 0.0f, 0.0f };
+
         m_OceanCB->Update(&cbData, sizeof(cbData));
 
         // 使用四叉树 LOD 渲染
         if (m_UseQuadTree && m_QuadTree && m_QuadTreePSO)
         {
-            // 更新四叉树
+            // 更新四叉树（剔除用的包围盒按当前锐度下的波浪位移扩大）
+            m_QuadTree->SetWaveBounds(ComputeGerstnerWaveBounds(m_Params.choppiness));
             m_QuadTree->Update(camera);
+            m_QuadTreeMesh->UploadInstances(*m_QuadTree);
+            if (m_QuadTreeMesh->GetInstanceCapacity() != m_QuadTreeSRVCapacity)
+                CreateQuadTreeInstanceSRV();
             
             u32 instanceCount = m_QuadTree->GetInstanceCount();
             if (instanceCount == 0) return;
@@ -512,37 +527,34 @@ namespace Sea
             // 选择 PSO
             if (m_ViewMode == 1 && m_QuadTreeWireframePSO)
             {
-                cmdListPtr->SetPipelineState(m_QuadTreeWireframePSO->GetPipelineState());
+                cmdList.SetPipelineState(m_QuadTreeWireframePSO.get());
             }
             else
             {
-                cmdListPtr->SetPipelineState(m_QuadTreePSO->GetPipelineState());
+                cmdList.SetPipelineState(m_QuadTreePSO.get());
             }
-            cmdListPtr->SetGraphicsRootSignature(m_QuadTreeRootSig->GetRootSignature());
+            cmdList.SetGraphicsRootSignature(m_QuadTreeRootSig.get());
 
             // 绑定描述符堆
             ID3D12DescriptorHeap* heaps[] = { m_QuadTreeSRVHeap->GetHeap() };
-            cmdListPtr->SetDescriptorHeaps(1, heaps);
+            cmdList.SetDescriptorHeaps(heaps);
 
             // 绑定常量缓冲
-            cmdListPtr->SetGraphicsRootConstantBufferView(0, m_OceanCB->GetGPUAddress());
+            cmdList.SetGraphicsRootCBV(0, m_OceanCB->GetGPUAddress());
             
             // 绑定实例缓冲 SRV
-            cmdListPtr->SetGraphicsRootDescriptorTable(1, m_QuadTreeSRVHeap->GetGPUHandle(0));
+            cmdList.SetGraphicsRootDescriptorTable(1, m_QuadTreeSRVHeap->GetGPUHandle(0));
 
             // 设置图元类型
-            cmdListPtr->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+            cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
 
             // 绑定基础网格
-            Mesh* baseMesh = m_QuadTree->GetBaseMesh();
-            D3D12_VERTEX_BUFFER_VIEW vbv = baseMesh->GetVertexBuffer()->GetVertexBufferView();
-            D3D12_INDEX_BUFFER_VIEW ibv = baseMesh->GetIndexBuffer()->GetIndexBufferView();
-            
-            cmdListPtr->IASetVertexBuffers(0, 1, &vbv);
-            cmdListPtr->IASetIndexBuffer(&ibv);
+            Mesh* baseMesh = m_QuadTreeMesh->GetBaseMesh();
+            cmdList.SetVertexBuffer(0, baseMesh->GetVertexBuffer()->GetVertexBufferView());
+            cmdList.SetIndexBuffer(baseMesh->GetIndexBuffer()->GetIndexBufferView());
             
             // 实例化绘制
-            cmdListPtr->DrawIndexedInstanced(baseMesh->GetIndexCount(), instanceCount, 0, 0, 0);
+            cmdList.DrawIndexed(baseMesh->GetIndexCount(), instanceCount);
         }
         else
         {
@@ -553,36 +565,27 @@ namespace Sea
             switch (m_ViewMode)
             {
             case 1: // Wireframe
-                if (m_WireframePSO)
-                    cmdListPtr->SetPipelineState(m_WireframePSO->GetPipelineState());
-                else
-                    cmdListPtr->SetPipelineState(m_RenderPSO->GetPipelineState());
+                cmdList.SetPipelineState(m_WireframePSO ? m_WireframePSO.get() : m_RenderPSO.get());
                 break;
             case 2: // Normals
-                if (m_NormalsPSO)
-                    cmdListPtr->SetPipelineState(m_NormalsPSO->GetPipelineState());
-                else
-                    cmdListPtr->SetPipelineState(m_RenderPSO->GetPipelineState());
+                cmdList.SetPipelineState(m_NormalsPSO ? m_NormalsPSO.get() : m_RenderPSO.get());
                 break;
             default: // Lit (0)
-                cmdListPtr->SetPipelineState(m_RenderPSO->GetPipelineState());
+                cmdList.SetPipelineState(m_RenderPSO.get());
                 break;
             }
-            cmdListPtr->SetGraphicsRootSignature(m_RenderRootSig->GetRootSignature());
+            cmdList.SetGraphicsRootSignature(m_RenderRootSig.get());
 
             // 绑定常量缓冲
-            cmdListPtr->SetGraphicsRootConstantBufferView(0, m_OceanCB->GetGPUAddress());
+            cmdList.SetGraphicsRootCBV(0, m_OceanCB->GetGPUAddress());
 
             // 设置图元类型
-            cmdListPtr->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+            cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
 
             // 绑定网格并绘制
-            D3D12_VERTEX_BUFFER_VIEW vbv = m_OceanMesh->GetVertexBuffer()->GetVertexBufferView();
-            D3D12_INDEX_BUFFER_VIEW ibv = m_OceanMesh->GetIndexBuffer()->GetIndexBufferView();
-            
-            cmdListPtr->IASetVertexBuffers(0, 1, &vbv);
-            cmdListPtr->IASetIndexBuffer(&ibv);
-            cmdListPtr->DrawIndexedInstanced(m_OceanMesh->GetIndexCount(), 1, 0, 0, 0);
+            cmdList.SetVertexBuffer(0, m_OceanMesh->GetVertexBuffer()->GetVertexBufferView());
+            cmdList.SetIndexBuffer(m_OceanMesh->GetIndexBuffer()->GetIndexBufferView());
+            cmdList.DrawIndexed(m_OceanMesh->GetIndexCount());
         }
     }
 
@@ -10,6 +10,7 @@
 #include "Scene/Mesh.h"
 #include "Scene/Camera.h"
 #include "Scene/OceanQuadTree.h"
+#include "Scene/OceanQuadTreeMesh.h"
 
 #include <DirectXMath.h>
 
@@ -77,6 +78,8 @@ namespace Sea
         bool CreateComputePipelines();
         bool CreateRenderPipeline();
         bool CreateQuadTreePipeline();
+        // 实例缓冲区扩容后是新的资源，SRV 要重新创建
+        void CreateQuadTreeInstanceSRV();
         bool CreateTextures();
         bool CreateOceanMesh();
         
@@ -123,6 +126,8 @@ namespace Sea
         
         // 四叉树 LOD
         Scope<OceanQuadTree> m_QuadTree;
+        Scope<OceanQuadTreeMesh> m_QuadTreeMesh;
+        u32 m_QuadTreeSRVCapacity = 0;   // 当前 SRV 覆盖的实例数
         bool m_UseQuadTree = true;  // 默认启用四叉树 LOD
         
         // 采样器
@@ -8,8 +8,8 @@
 #include "Graphics/CommandList.h"
 #include "Shader/ShaderCompiler.h"
 
+#include <algorithm>
 #include <cmath>
-#include <random>
 
 using namespace DirectX;
 
@@ -18,9 +18,7 @@ namespace Sea
     // ========================================================================
     // Constants
     // ========================================================================
-    static constexpr u32 FFT_THREAD_GROUP_SIZE = 256;
     static constexpr u32 SPECTRUM_THREAD_GROUP_SIZE = 8;
-    static constexpr u32 TRANSPOSE_TILE_SIZE = 16;
 
     // ========================================================================
     // Constant Buffer Structures
@@ -38,7 +36,8 @@ namespace Sea
         f32 detail;
         f32 spread;
         u32 cascadeIndex;
-        f32 _padding[3];
+        u32 mapSize;
+        f32 _padding[2];
     };
 
     struct ModulateCB
@@ -47,27 +46,21 @@ namespace Sea
         f32 depth;
         f32 time;
         u32 cascadeIndex;
-        f32 _padding[3];
-    };
-
-    struct FFTCB
-    {
-        u32 stage;
-        u32 direction;
-        u32 spectrumIndex;
-        u32 cascadeIndex;
+        u32 spectrumLayer;
         u32 mapSize;
-        u32 logN;
-        u32 pingPong;
         f32 _padding;
     };
 
-    struct TransposeCB
+    struct FFTCB
     {
         u32 mapSize;
-        u32 spectrumIndex;
-        u32 cascadeIndex;
-        f32 _padding;
+        u32 logN;
+        u32 stage;
+        u32 axis;
+        u32 sourceOffset;
+        u32 destOffset;
+        u32 transposeOutput;
+        f32 outputScale;
     };
 
     struct UnpackCB
@@ -77,7 +70,8 @@ namespace Sea
         f32 whitecap;
         f32 foamGrowRate;
         f32 foamDecayRate;
-        f32 _padding[3];
+        u32 fftOffset;
+        f32 _padding[2];
     };
 
     // ========================================================================
@@ -90,27 +84,10 @@ namespace Sea
         while ((1u << result) < n) result++;
         return result;
     }
-
-    f32 OceanFFT::JONSWAPAlpha(f32 windSpeed, f32 fetchLength)
-    {
-        // fetchLength in km, convert to meters
-        f32 F = fetchLength * 1000.0f;
-        f32 U = windSpeed;
-        constexpr f32 g = 9.81f;
-        
-        // α = 0.076 * (U²/(F*g))^0.22
-        return 0.076f * std::pow((U * U) / (F * g), 0.22f);
-    }
-
-    f32 OceanFFT::JONSWAPPeakFrequency(f32 windSpeed, f32 fetchLength)
+    
+    static bool IsValidMapSize(u32 n)
     {
-        // fetchLength in km, convert to meters
-        f32 F = fetchLength * 1000.0f;
-        f32 U = windSpeed;
-        constexpr f32 g = 9.81f;
-        
-        // ω_p = 22 * (g²/(U*F))^(1/3)
-        return 22.0f * std::pow((g * g) / (U * F), 1.0f / 3.0f);
+        return n >= OceanFFT::MIN_MAP_SIZE && n <= OceanFFT::MAX_MAP_SIZE && (n & (n - 1)) == 0;
     }
 
     // ========================================================================
@@ -153,13 +130,8 @@ namespace Sea
         m_Params.cascades[3].displacementScale = 0.05f;
         m_Params.cascades[3].normalScale = 2.0f;
         
-        // Random seeds for reproducibility
-        std::random_device rd;
-        for (u32 i = 0; i < OceanFFTParams::MAX_CASCADES; ++i)
-        {
-            m_Params.cascades[i].spectrumSeedX = rd() % 10000;
-            m_Params.cascades[i].spectrumSeedY = rd() % 10000;
-        }
+        // Deterministic seeds (scene files override them with their own seed)
+        ApplyOceanSeed(m_Params, DEFAULT_OCEAN_SEED);
     }
 
     OceanFFT::~OceanFFT()
@@ -174,17 +146,26 @@ namespace Sea
     bool OceanFFT::Initialize(const OceanFFTParams& params)
     {
         m_Params = params;
+        m_Clock = OceanSimulationClock(m_Params.updatesPerSecond);
+        m_SimulatedStep = NO_STEP;
         
         // Validate map size is power of 2
-        if ((m_Params.mapSize & (m_Params.mapSize - 1)) != 0)
+        if (!IsValidMapSize(m_Params.mapSize))
         {
-            SEA_CORE_ERROR("OceanFFT: Map size must be power of 2, got {}", m_Params.mapSize);
+            SEA_CORE_ERROR("OceanFFT: Map size must be a power of 2 in [{}, {}], got {}", MIN_MAP_SIZE, MAX_MAP_SIZE, m_Params.mapSize);
             return false;
         }
         
         SEA_CORE_INFO("Initializing FFT Ocean simulation ({}x{}, {} cascades)", 
             m_Params.mapSize, m_Params.mapSize, m_Params.numCascades);
         
+        m_FFTPlan = BuildOceanFFTPlan(m_Params.mapSize, m_Params.numCascades, m_FFTPlanMode);
+        if (m_FFTPlan.dispatches.empty())
+        {
+            SEA_CORE_ERROR("OceanFFT: Failed to build the FFT plan");
+            return false;
+        }
+        
         if (!CreateTextures())
         {
             SEA_CORE_ERROR("OceanFFT: Failed to create textures");
@@ -221,6 +202,17 @@ namespace Sea
             return false;
         }
         
+        if (m_Params.queryMapSize > 0)
+        {
+            const u32 querySize = std::min(m_Params.queryMapSize, m_Params.mapSize);
+            m_QuerySimulation = MakeScope<OceanFFTCPU>();
+            if (!m_QuerySimulation->Initialize(MakeReducedResolutionParams(m_Params, querySize)))
+            {
+                SEA_CORE_WARN("OceanFFT: Failed to create the height query simulation - height queries disabled");
+                m_QuerySimulation.reset();
+            }
+        }
+        
         m_Initialized = true;
         SEA_CORE_INFO("FFT Ocean simulation initialized successfully");
         return true;
@@ -232,28 +224,29 @@ namespace Sea
         
         m_SpectrumTexture.reset();
         m_FFTBuffer.reset();
-        m_ButterflyFactors.reset();
+        m_TwiddleBuffer.reset();
+        m_TwiddleUpload.reset();
+        m_FFTTables.reset();
+        m_FFTTablesUploaded = false;
         m_DisplacementMaps.reset();
         m_NormalMaps.reset();
         
         m_SpectrumComputeRS.reset();
         m_SpectrumModulateRS.reset();
-        m_FFTButterflyRS.reset();
         m_FFTComputeRS.reset();
-        m_TransposeRS.reset();
         m_UnpackRS.reset();
         
         m_SpectrumComputePSO.reset();
         m_SpectrumModulatePSO.reset();
-        m_FFTButterflyPSO.reset();
-        m_FFTComputePSO.reset();
-        m_TransposePSO.reset();
+        m_FFTStagePSO.reset();
+        m_FFTSinglePassPSO.reset();
         m_UnpackPSO.reset();
         
         m_ComputeUAVHeap.reset();
         m_ComputeSRVHeap.reset();
         
         m_OceanMesh.reset();
+        m_QuerySimulation.reset();
         m_RenderCB.reset();
         m_RenderRS.reset();
         m_RenderPSO.reset();
@@ -274,10 +267,15 @@ namespace Sea
         
         // Initial spectrum texture (2D Array)
         // Format: RG16F (complex number: real, imaginary)
+        // One cache slot per layer: each active cascade owns a layer, the remaining layers keep recently used spectra
+        m_SpectrumSlotCount = cascades + m_Params.spectrumCacheSize;
+        m_SpectrumCache.Reset(m_SpectrumSlotCount);
+        m_CascadeSpectrumSlots.fill(OceanSpectrumCache::INVALID_SLOT);
+        
         TextureDesc specDesc;
         specDesc.width = N;
         specDesc.height = N;
-        specDesc.arraySize = cascades;
+        specDesc.arraySize = m_SpectrumSlotCount;
         specDesc.format = Format::R16G16B16A16_FLOAT;  // Use RGBA16F for compatibility
         specDesc.usage = TextureUsage::ShaderResource | TextureUsage::UnorderedAccess;
         specDesc.name = "OceanSpectrum";
@@ -330,12 +328,10 @@ namespace Sea
     {
         u32 N = m_Params.mapSize;
         u32 cascades = m_Params.numCascades;
-        u32 logN = Log2(N);
         
-        // FFT buffer: 4 spectra * N*N * 2 (ping-pong) * cascades * sizeof(float2)
-        // But we can simplify by processing one cascade at a time
-        // Layout: [cascade][spectrum][row][col] = [cascade][4][N][N]
-        u64 fftBufferSize = cascades * 4 * N * N * sizeof(f32) * 2;
+        // FFT buffer: 2 halves (ping-pong) of [cascade][spectrum][row][col] = [cascade][4][N][N] float2
+        // All cascades are transformed together, see OceanFFTPlan
+        u64 fftBufferSize = u64(2) * cascades * 4 * N * N * sizeof(f32) * 2;
         
         BufferDesc fftDesc;
         fftDesc.size = fftBufferSize;
@@ -350,23 +346,45 @@ namespace Sea
             return false;
         }
         
-        // Butterfly factors: logN * N * sizeof(float4)
-        u64 butterflySize = logN * N * sizeof(f32) * 4;
+        // Twiddle factors: N * float2, shared with the CPU simulation (OceanFFTTables)
+        // Default heap for shader access, filled from an upload buffer on the first Update
+        m_FFTTables = GetOceanFFTTables(N);
+        if (!m_FFTTables)
+        {
+            return false;
+        }
+        
+        BufferDesc twiddleDesc;
+        twiddleDesc.size = m_FFTTables->gpuTwiddles.size() * sizeof(f32);
+        twiddleDesc.type = BufferType::Structured;
+        twiddleDesc.stride = sizeof(f32) * 2;
+        twiddleDesc.name = "OceanTwiddles";
+        
+        m_TwiddleBuffer = MakeScope<Buffer>(m_Device, twiddleDesc);
+        if (!m_TwiddleBuffer->Initialize())
+        {
+            SEA_CORE_ERROR("Failed to create twiddle buffer");
+            return false;
+        }
         
-        BufferDesc butterflyDesc;
-        butterflyDesc.size = butterflySize;
-        butterflyDesc.type = BufferType::Structured;
-        butterflyDesc.stride = sizeof(f32) * 4;
-        butterflyDesc.name = "OceanButterfly";
+        BufferDesc uploadDesc = twiddleDesc;
+        uploadDesc.type = BufferType::Upload;
+        uploadDesc.name = "OceanTwiddlesUpload";
         
-        m_ButterflyFactors = MakeScope<Buffer>(m_Device, butterflyDesc);
-        if (!m_ButterflyFactors->Initialize())
+        m_TwiddleUpload = MakeScope<Buffer>(m_Device, uploadDesc);
+        if (!m_TwiddleUpload->Initialize(m_FFTTables->gpuTwiddles.data()))
         {
-            SEA_CORE_ERROR("Failed to create butterfly buffer");
+            SEA_CORE_ERROR("Failed to create twiddle upload buffer");
             return false;
         }
+        m_FFTTablesUploaded = false;
+        
+        // Render constant buffer (size independent, kept across SetMapSize)
+        if (m_RenderCB)
+        {
+            return true;
+        }
         
-        // Render constant buffer
         BufferDesc cbDesc;
         cbDesc.size = sizeof(OceanRenderCB);
         cbDesc.type = BufferType::Constant;
@@ -431,7 +449,7 @@ namespace Sea
             uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
             uavDesc.Texture2DArray.MipSlice = 0;
             uavDesc.Texture2DArray.FirstArraySlice = 0;
-            uavDesc.Texture2DArray.ArraySize = cascades;
+            uavDesc.Texture2DArray.ArraySize = m_SpectrumSlotCount;
             
             d3dDevice->CreateUnorderedAccessView(
                 m_SpectrumTexture->GetResource(),
@@ -475,9 +493,9 @@ namespace Sea
             m_NormalUAVIndex = uavIndex - 1;
         }
         
-        // FFT buffer UAV (structured buffer)
+        // FFT buffer UAV (structured buffer, both halves)
         {
-            u32 numElements = cascades * 4 * N * N;
+            u32 numElements = 2 * cascades * 4 * N * N;
             D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
             uavDesc.Format = DXGI_FORMAT_UNKNOWN;
             uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
@@ -493,22 +511,22 @@ namespace Sea
             m_FFTBufferUAVIndex = uavIndex - 1;
         }
         
-        // Butterfly factors UAV
+        // Twiddle SRV (read-only table, FFT shader t0)
+        // Lives in the compute UAV heap because that is the only heap bound while the FFT runs
         {
-            u32 logN = Log2(N);
-            D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
-            uavDesc.Format = DXGI_FORMAT_UNKNOWN;
-            uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
-            uavDesc.Buffer.FirstElement = 0;
-            uavDesc.Buffer.NumElements = logN * N;
-            uavDesc.Buffer.StructureByteStride = sizeof(f32) * 4;
+            D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+            srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+            srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+            srvDesc.Buffer.FirstElement = 0;
+            srvDesc.Buffer.NumElements = N;
+            srvDesc.Buffer.StructureByteStride = sizeof(f32) * 2;
             
-            d3dDevice->CreateUnorderedAccessView(
-                m_ButterflyFactors->GetResource(),
-                nullptr,
-                &uavDesc,
+            d3dDevice->CreateShaderResourceView(
+                m_TwiddleBuffer->GetResource(),
+                &srvDesc,
                 m_ComputeUAVHeap->GetCPUHandle(uavIndex++));
-            m_ButterflyUAVIndex = uavIndex - 1;
+            m_TwiddleSRVIndex = uavIndex - 1;
         }
         
         // ========== Create consecutive UAVs for Unpack shader (u0=FFTBuffer, u1=Displacement, u2=Normal) ==========
@@ -516,7 +534,7 @@ namespace Sea
         
         // FFT buffer UAV for unpack (same as m_FFTBufferUAVIndex but in consecutive group)
         {
-            u32 numElements = cascades * 4 * N * N;
+            u32 numElements = 2 * cascades * 4 * N * N;
             D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
             uavDesc.Format = DXGI_FORMAT_UNKNOWN;
             uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
@@ -573,7 +591,7 @@ namespace Sea
             srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
             srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
             srvDesc.Texture2DArray.MipLevels = 1;
-            srvDesc.Texture2DArray.ArraySize = cascades;
+            srvDesc.Texture2DArray.ArraySize = m_SpectrumSlotCount;
             
             d3dDevice->CreateShaderResourceView(
                 m_SpectrumTexture->GetResource(),
@@ -584,7 +602,7 @@ namespace Sea
         
         // FFT buffer SRV
         {
-            u32 numElements = cascades * 4 * N * N;
+            u32 numElements = 2 * cascades * 4 * N * N;
             D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
             srvDesc.Format = DXGI_FORMAT_UNKNOWN;
             srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
@@ -600,24 +618,6 @@ namespace Sea
             m_FFTBufferSRVIndex = srvIndex - 1;
         }
         
-        // Butterfly factors SRV
-        {
-            u32 logN = Log2(N);
-            D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-            srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-            srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-            srvDesc.Buffer.FirstElement = 0;
-            srvDesc.Buffer.NumElements = logN * N;
-            srvDesc.Buffer.StructureByteStride = sizeof(f32) * 4;
-            
-            d3dDevice->CreateShaderResourceView(
-                m_ButterflyFactors->GetResource(),
-                &srvDesc,
-                m_ComputeSRVHeap->GetCPUHandle(srvIndex++));
-            m_ButterflySRVIndex = srvIndex - 1;
-        }
-        
         // ========== Create SRVs in render heap for pixel shader ==========
         u32 renderSrvIndex = 0;
         
@@ -666,7 +666,7 @@ namespace Sea
             srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
             srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
             srvDesc.Texture2DArray.MipLevels = 1;
-            srvDesc.Texture2DArray.ArraySize = cascades;
+            srvDesc.Texture2DArray.ArraySize = m_SpectrumSlotCount;
             
             d3dDevice->CreateShaderResourceView(
                 m_SpectrumTexture->GetResource(),
@@ -750,7 +750,7 @@ namespace Sea
             }
         }
         
-        // Butterfly RS: Constants(b0), UAV(u0)
+        // FFT compute RS: Constants(b0), UAV(u0) - both FFT buffer halves, SRV(t0) - twiddles
         {
             RootSignatureDesc desc;
             desc.flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
@@ -759,7 +759,7 @@ namespace Sea
             constParam.type = RootParameterDesc::Constants;
             constParam.shaderRegister = 0;
             constParam.registerSpace = 0;
-            constParam.num32BitValues = 4;  // mapSize, logN, padding
+            constParam.num32BitValues = sizeof(FFTCB) / 4;
             desc.parameters.push_back(constParam);
             
             RootParameterDesc uavParam;
@@ -770,26 +770,6 @@ namespace Sea
             uavParam.rangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
             desc.parameters.push_back(uavParam);
             
-            m_FFTButterflyRS = MakeScope<RootSignature>(m_Device, desc);
-            if (!m_FFTButterflyRS->Initialize())
-            {
-                SEA_CORE_ERROR("Failed to create butterfly root signature");
-                return false;
-            }
-        }
-        
-        // FFT compute RS: Constants(b0), SRV(t0), UAV(u0-u1)
-        {
-            RootSignatureDesc desc;
-            desc.flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
-            
-            RootParameterDesc constParam;
-            constParam.type = RootParameterDesc::Constants;
-            constParam.shaderRegister = 0;
-            constParam.registerSpace = 0;
-            constParam.num32BitValues = sizeof(FFTCB) / 4;
-            desc.parameters.push_back(constParam);
-            
             RootParameterDesc srvParam;
             srvParam.type = RootParameterDesc::DescriptorTable;
             srvParam.shaderRegister = 0;
@@ -798,14 +778,6 @@ namespace Sea
             srvParam.rangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
             desc.parameters.push_back(srvParam);
             
-            RootParameterDesc uavParam;
-            uavParam.type = RootParameterDesc::DescriptorTable;
-            uavParam.shaderRegister = 0;
-            uavParam.registerSpace = 0;
-            uavParam.numDescriptors = 2;
-            uavParam.rangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
-            desc.parameters.push_back(uavParam);
-            
             m_FFTComputeRS = MakeScope<RootSignature>(m_Device, desc);
             if (!m_FFTComputeRS->Initialize())
             {
@@ -814,34 +786,6 @@ namespace Sea
             }
         }
         
-        // Transpose RS: Constants(b0), UAV(u0-u1)
-        {
-            RootSignatureDesc desc;
-            desc.flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
-            
-            RootParameterDesc constParam;
-            constParam.type = RootParameterDesc::Constants;
-            constParam.shaderRegister = 0;
-            constParam.registerSpace = 0;
-            constParam.num32BitValues = sizeof(TransposeCB) / 4;
-            desc.parameters.push_back(constParam);
-            
-            RootParameterDesc uavParam;
-            uavParam.type = RootParameterDesc::DescriptorTable;
-            uavParam.shaderRegister = 0;
-            uavParam.registerSpace = 0;
-            uavParam.numDescriptors = 2;
-            uavParam.rangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
-            desc.parameters.push_back(uavParam);
-            
-            m_TransposeRS = MakeScope<RootSignature>(m_Device, desc);
-            if (!m_TransposeRS->Initialize())
-            {
-                SEA_CORE_ERROR("Failed to create transpose root signature");
-                return false;
-            }
-        }
-        
         // Unpack RS: Constants(b0), UAV(u0-u2) - FFT buffer, displacement, normal maps
         {
             RootSignatureDesc desc;
@@ -872,10 +816,10 @@ namespace Sea
         
         // ========== Compile Shaders and Create PSOs ==========
         
-        auto compileCS = [](const std::string& path) -> std::vector<u8> {
+        auto compileCS = [](const std::string& path, const char* entryPoint = "main") -> std::vector<u8> {
             ShaderCompileDesc desc;
             desc.filePath = path;
-            desc.entryPoint = "main";
+            desc.entryPoint = entryPoint;
             desc.stage = ShaderStage::Compute;
             desc.model = ShaderModel::SM_6_0;
             
@@ -921,53 +865,35 @@ namespace Sea
             }
         }
         
-        // Butterfly PSO
+        // FFT compute PSOs (one per OceanFFTPass)
         {
-            auto cs = compileCS("Shaders/Ocean/FFT/FFTButterfly_CS.hlsl");
-            if (cs.empty()) return false;
-            
-            ComputePipelineDesc desc;
-            desc.rootSignature = m_FFTButterflyRS.get();
-            desc.computeShader = std::move(cs);
-            
-            m_FFTButterflyPSO = PipelineState::CreateCompute(m_Device, desc);
-            if (!m_FFTButterflyPSO)
-            {
-                SEA_CORE_ERROR("Failed to create butterfly PSO");
-                return false;
-            }
-        }
-        
-        // FFT compute PSO
-        {
-            auto cs = compileCS("Shaders/Ocean/FFT/FFTCompute_CS.hlsl");
+            auto cs = compileCS("Shaders/Ocean/FFT/FFTCompute_CS.hlsl", "StageMain");
             if (cs.empty()) return false;
             
             ComputePipelineDesc desc;
             desc.rootSignature = m_FFTComputeRS.get();
             desc.computeShader = std::move(cs);
             
-            m_FFTComputePSO = PipelineState::CreateCompute(m_Device, desc);
-            if (!m_FFTComputePSO)
+            m_FFTStagePSO = PipelineState::CreateCompute(m_Device, desc);
+            if (!m_FFTStagePSO)
             {
-                SEA_CORE_ERROR("Failed to create FFT compute PSO");
+                SEA_CORE_ERROR("Failed to create FFT stage PSO");
                 return false;
             }
         }
         
-        // Transpose PSO
         {
-            auto cs = compileCS("Shaders/Ocean/FFT/FFTTranspose_CS.hlsl");
+            auto cs = compileCS("Shaders/Ocean/FFT/FFTCompute_CS.hlsl", "SinglePassMain");
             if (cs.empty()) return false;
             
             ComputePipelineDesc desc;
-            desc.rootSignature = m_TransposeRS.get();
+            desc.rootSignature = m_FFTComputeRS.get();
             desc.computeShader = std::move(cs);
             
-            m_TransposePSO = PipelineState::CreateCompute(m_Device, desc);
-            if (!m_TransposePSO)
+            m_FFTSinglePassPSO = PipelineState::CreateCompute(m_Device, desc);
+            if (!m_FFTSinglePassPSO)
             {
-                SEA_CORE_ERROR("Failed to create transpose PSO");
+                SEA_CORE_ERROR("Failed to create FFT single pass PSO");
                 return false;
             }
         }
@@ -1182,151 +1108,132 @@ namespace Sea
     {
         if (!m_Initialized) return;
         
-        m_Time += deltaTime;
+        if (m_Clock.GetRate() != m_Params.updatesPerSecond)
+            m_Clock.SetRate(m_Params.updatesPerSecond);
+        m_Clock.Advance(deltaTime);
         
-        // Rate limiting for performance
-        bool shouldUpdate = (m_Time >= m_NextUpdateTime);
+        // Fixed-step simulation: only run when the clock has crossed into a new step
+        bool shouldUpdate = (m_Clock.GetStep() != m_SimulatedStep);
         
         if (shouldUpdate)
         {
-            m_NextUpdateTime = m_Time + (1.0f / m_Params.updatesPerSecond);
+            m_SimulatedStep = m_Clock.GetStep();
+            m_Time = m_Clock.GetTime();
             
             // If textures were in SRV state (for rendering), transition back to UAV
             if (m_TexturesReadyForRender)
             {
-                auto* d3dCmdList = cmdList.GetCommandList();
-                D3D12_RESOURCE_BARRIER barriers[2] = {};
-                
-                barriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-                barriers[0].Transition.pResource = m_DisplacementMaps->GetResource();
-                barriers[0].Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
-                barriers[0].Transition.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-                barriers[0].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-                
-                barriers[1].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-                barriers[1].Transition.pResource = m_NormalMaps->GetResource();
-                barriers[1].Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
-                barriers[1].Transition.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-                barriers[1].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-                
-                d3dCmdList->ResourceBarrier(2, barriers);
+                cmdList.TransitionBarrier(m_DisplacementMaps->GetResource(), ResourceState::ShaderResource, ResourceState::UnorderedAccess);
+                cmdList.TransitionBarrier(m_NormalMaps->GetResource(), ResourceState::ShaderResource, ResourceState::UnorderedAccess);
                 m_TexturesReadyForRender = false;
             }
             
-            // Generate butterfly factors once
-            if (!m_ButterflyGenerated)
+            // Upload the twiddle table once per map size
+            if (!m_FFTTablesUploaded)
             {
-                GenerateButterflyFactors(cmdList);
-                m_ButterflyGenerated = true;
+                UploadFFTTables(cmdList);
+                m_FFTTablesUploaded = true;
             }
             
-            // Update each cascade
-            for (u32 i = 0; i < m_Params.numCascades; ++i)
+            // Sync parameters before UpdateCascade clears the rebuild flags
+            if (m_QuerySimulation)
             {
-                UpdateCascade(cmdList, i, deltaTime);
+                SyncQuerySimulation();
+                m_QuerySimulation->Simulate(m_Time);
             }
             
-            // Transition displacement and normal maps from UAV to SRV for rendering
-            auto* d3dCmdList = cmdList.GetCommandList();
-            D3D12_RESOURCE_BARRIER barriers[2] = {};
+            // Update each cascade (spectrum + modulate)
+            u32 spectrumRebuilds = 0;
+            for (u32 i = 0; i < m_Params.numCascades; ++i)
+            {
+                UpdateCascade(cmdList, i, spectrumRebuilds);
+            }
             
-            barriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-            barriers[0].Transition.pResource = m_DisplacementMaps->GetResource();
-            barriers[0].Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-            barriers[0].Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
-            barriers[0].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            // One batched 2D FFT for all cascades
+            PerformFFT(cmdList);
             
-            barriers[1].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-            barriers[1].Transition.pResource = m_NormalMaps->GetResource();
-            barriers[1].Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-            barriers[1].Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
-            barriers[1].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            // Unpack to displacement/normal maps
+            for (u32 i = 0; i < m_Params.numCascades; ++i)
+            {
+                UnpackFFTResults(cmdList, i);
+            }
             
-            d3dCmdList->ResourceBarrier(2, barriers);
+            // Transition displacement and normal maps from UAV to SRV for rendering
+            cmdList.TransitionBarrier(m_DisplacementMaps->GetResource(), ResourceState::UnorderedAccess, ResourceState::ShaderResource);
+            cmdList.TransitionBarrier(m_NormalMaps->GetResource(), ResourceState::UnorderedAccess, ResourceState::ShaderResource);
             m_TexturesReadyForRender = true;
         }
     }
     
-    void OceanFFT::GenerateButterflyFactors(CommandList& cmdList)
+    void OceanFFT::UploadFFTTables(CommandList& cmdList)
     {
-        // This only needs to run once per map size change
-        SEA_CORE_INFO("Generating FFT butterfly factors...");
+        cmdList.TransitionBarrier(m_TwiddleBuffer->GetResource(), ResourceState::Common, ResourceState::CopyDest);
         
-        auto* d3dCmdList = cmdList.GetCommandList();
-        u32 N = m_Params.mapSize;
-        u32 logN = Log2(N);
+        cmdList.CopyBufferRegion(m_TwiddleBuffer->GetResource(), 0, m_TwiddleUpload->GetResource(), 0, m_TwiddleBuffer->GetSize());
         
-        // Set compute pipeline
-        d3dCmdList->SetPipelineState(m_FFTButterflyPSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_FFTButterflyRS->GetRootSignature());
+        // The table is only ever read by the FFT shader, so it stays in a read-only state from here on
+        cmdList.TransitionBarrier(m_TwiddleBuffer->GetResource(), ResourceState::CopyDest, ResourceState::NonPixelShaderResource);
         
-        // Set descriptor heap
-        ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
-        
-        // Root constants: mapSize, logN
-        struct ButterflyConstants {
-            u32 mapSize;
-            u32 logN;
-            u32 _padding[2];
-        } constants;
-        constants.mapSize = N;
-        constants.logN = logN;
-        
-        d3dCmdList->SetComputeRoot32BitConstants(0, 4, &constants, 0);
-        
-        // Set UAV (butterfly factors buffer)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_ButterflyUAVIndex));
-        
-        // Dispatch: one thread per (stage, element) pair
-        // Total elements: logN * N
-        u32 numThreadGroups = (logN * N + FFT_THREAD_GROUP_SIZE - 1) / FFT_THREAD_GROUP_SIZE;
-        d3dCmdList->Dispatch(numThreadGroups, 1, 1);
-        
-        // Barrier for UAV access
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barrier.UAV.pResource = m_ButterflyFactors->GetResource();
-        d3dCmdList->ResourceBarrier(1, &barrier);
-        
-        SEA_CORE_INFO("Butterfly factors generated for {}x{} FFT ({} stages)", N, N, logN);
+        SEA_CORE_INFO("Twiddle table uploaded for {}x{} FFT", m_FFTTables->mapSize, m_FFTTables->mapSize);
     }
     
-    void OceanFFT::UpdateCascade(CommandList& cmdList, u32 cascadeIndex, f32 delta)
+    void OceanFFT::UpdateCascade(CommandList& cmdList, u32 cascadeIndex, u32& spectrumRebuilds)
     {
         auto& cascade = m_Params.cascades[cascadeIndex];
         cascade.time = m_Time;
         
-        // Regenerate spectrum if parameters changed
-        if (cascade.needsSpectrumRebuild)
-        {
-            GenerateSpectrum(cmdList, cascadeIndex);
-            cascade.needsSpectrumRebuild = false;
-        }
+        // Switch to (or regenerate) the spectrum if parameters changed
+        UpdateSpectrumSlot(cmdList, cascadeIndex, spectrumRebuilds);
         
         // Modulate spectrum with time
         ModulateSpectrum(cmdList, cascadeIndex);
+    }
+    
+    void OceanFFT::UpdateSpectrumSlot(CommandList& cmdList, u32 cascadeIndex, u32& spectrumRebuilds)
+    {
+        auto& cascade = m_Params.cascades[cascadeIndex];
+        u32& slot = m_CascadeSpectrumSlots[cascadeIndex];
         
-        // Perform 2D FFT
-        PerformFFT(cmdList, cascadeIndex);
+        // Sliders can set the rebuild flag every frame, so compare parameter hashes to see whether the spectrum actually changed
+        const u64 key = HashSpectrumParams(cascade, m_Params.depth, m_Params.mapSize);
+        if (slot != OceanSpectrumCache::INVALID_SLOT && m_CascadeSpectrumKeys[cascadeIndex] == key)
+        {
+            cascade.needsSpectrumRebuild = false;
+            return;
+        }
+        
+        // On a cache miss after a spectrum was already generated this frame, defer to the next frame (only cascades that already have a spectrum)
+        const bool cached = m_SpectrumCache.Contains(key);
+        if (!cached && slot != OceanSpectrumCache::INVALID_SLOT && spectrumRebuilds >= MAX_SPECTRUM_REBUILDS_PER_FRAME)
+        {
+            cascade.needsSpectrumRebuild = true;
+            return;
+        }
         
-        // Unpack to displacement/normal maps
-        UnpackFFTResults(cmdList, cascadeIndex);
+        m_SpectrumCache.Release(slot);
+        bool hit = false;
+        slot = m_SpectrumCache.Acquire(key, hit);
+        m_CascadeSpectrumKeys[cascadeIndex] = key;
+        if (!hit)
+        {
+            GenerateSpectrum(cmdList, cascadeIndex, slot);
+            spectrumRebuilds++;
+        }
+        cascade.needsSpectrumRebuild = false;
     }
     
-    void OceanFFT::GenerateSpectrum(CommandList& cmdList, u32 cascadeIndex)
+    void OceanFFT::GenerateSpectrum(CommandList& cmdList, u32 cascadeIndex, u32 slot)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& cascade = m_Params.cascades[cascadeIndex];
         u32 N = m_Params.mapSize;
         
         // Set compute pipeline
-        d3dCmdList->SetPipelineState(m_SpectrumComputePSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_SpectrumComputeRS->GetRootSignature());
+        cmdList.SetPipelineState(m_SpectrumComputePSO.get());
+        cmdList.SetComputeRootSignature(m_SpectrumComputeRS.get());
         
         // Set descriptor heap
         ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
+        cmdList.SetDescriptorHeaps(heaps);
         
         // Calculate JONSWAP parameters
         f32 alpha = JONSWAPAlpha(cascade.windSpeed, cascade.fetchLength);
@@ -1347,38 +1254,35 @@ namespace Sea
         cb.swell = cascade.swell;
         cb.detail = cascade.detail;
         cb.spread = cascade.spread;
-        cb.cascadeIndex = cascadeIndex;
+        cb.cascadeIndex = slot;
+        cb.mapSize = N;
         
-        d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
+        cmdList.SetComputeRootConstants(0, &cb, sizeof(cb) / 4);
         
         // Set UAV (spectrum texture)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_SpectrumUAVIndex));
+        cmdList.SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_SpectrumUAVIndex));
         
         // Dispatch: 8x8 thread groups
         u32 groupsX = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
         u32 groupsY = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
-        d3dCmdList->Dispatch(groupsX, groupsY, 1);
+        cmdList.Dispatch(groupsX, groupsY, 1);
         
         // UAV barrier
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barrier.UAV.pResource = m_SpectrumTexture->GetResource();
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.UAVBarrier(m_SpectrumTexture->GetResource());
     }
     
     void OceanFFT::ModulateSpectrum(CommandList& cmdList, u32 cascadeIndex)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& cascade = m_Params.cascades[cascadeIndex];
         u32 N = m_Params.mapSize;
         
         // Set compute pipeline
-        d3dCmdList->SetPipelineState(m_SpectrumModulatePSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_SpectrumModulateRS->GetRootSignature());
+        cmdList.SetPipelineState(m_SpectrumModulatePSO.get());
+        cmdList.SetComputeRootSignature(m_SpectrumModulateRS.get());
         
         // Set descriptor heaps - need both SRV and UAV
         ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
+        cmdList.SetDescriptorHeaps(heaps);
         
         // Fill constant buffer
         ModulateCB cb;
@@ -1387,157 +1291,84 @@ namespace Sea
         cb.depth = m_Params.depth;
         cb.time = m_Time;
         cb.cascadeIndex = cascadeIndex;
+        cb.spectrumLayer = m_CascadeSpectrumSlots[cascadeIndex];
+        cb.mapSize = N;
         
-        d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
+        cmdList.SetComputeRootConstants(0, &cb, sizeof(cb) / 4);
         
         // Set SRV (spectrum texture input)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_SpectrumUAVIndex));
+        cmdList.SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_SpectrumUAVIndex));
         
         // Set UAV (FFT buffer output)
-        d3dCmdList->SetComputeRootDescriptorTable(2, m_ComputeUAVHeap->GetGPUHandle(m_FFTBufferUAVIndex));
+        cmdList.SetComputeRootDescriptorTable(2, m_ComputeUAVHeap->GetGPUHandle(m_FFTBufferUAVIndex));
         
         // Dispatch
         u32 groupsX = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
         u32 groupsY = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
-        d3dCmdList->Dispatch(groupsX, groupsY, 1);
+        cmdList.Dispatch(groupsX, groupsY, 1);
         
-        // UAV barrier
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barrier.UAV.pResource = m_FFTBuffer->GetResource();
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        // Cascades write disjoint parts of the FFT buffer; PerformFFT issues one barrier for all of them
     }
     
-    void OceanFFT::PerformFFT(CommandList& cmdList, u32 cascadeIndex)
+    void OceanFFT::PerformFFT(CommandList& cmdList)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
-        u32 N = m_Params.mapSize;
-        u32 logN = Log2(N);
+        u32 N = m_FFTPlan.mapSize;
         
-        // Set compute pipeline
-        d3dCmdList->SetPipelineState(m_FFTComputePSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_FFTComputeRS->GetRootSignature());
+        // All cascades' modulate output must be visible before the first dispatch
+        ID3D12Resource* fftBuffer = m_FFTBuffer->GetResource();
+        cmdList.UAVBarrier(fftBuffer);
+        
+        cmdList.SetComputeRootSignature(m_FFTComputeRS.get());
         
         // Set descriptor heaps
         ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
-        
-        // Set butterfly factors SRV (use compute SRV heap)
-        // For simplicity, we'll use the UAV heap which also has the data
-        // Root 1: Butterfly factors (SRV-like access via UAV)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_ButterflyUAVIndex));
+        cmdList.SetDescriptorHeaps(heaps);
         
-        // Root 2: FFT buffer UAV (ping-pong)
-        d3dCmdList->SetComputeRootDescriptorTable(2, m_ComputeUAVHeap->GetGPUHandle(m_FFTBufferUAVIndex));
+        // Root 1: FFT buffer UAV (both halves), root 2: twiddle SRV
+        cmdList.SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_FFTBufferUAVIndex));
+        cmdList.SetComputeRootDescriptorTable(2, m_ComputeUAVHeap->GetGPUHandle(m_TwiddleSRVIndex));
         
-        // We need to perform FFT on 4 spectra: Dx, Dy, Dz, and slope
-        // Each spectrum is in a separate "channel" of our FFT buffer
-        
-        // For each spectrum (0-3)
-        for (u32 spectrumIdx = 0; spectrumIdx < 4; ++spectrumIdx)
+        // Every dispatch covers all 4 spectra of all cascades (Z = slices)
+        PipelineState* currentPSO = nullptr;
+        for (const OceanFFTDispatch& dispatch : m_FFTPlan.dispatches)
         {
-            // ============ Horizontal FFT (rows) ============
-            for (u32 stage = 0; stage < logN; ++stage)
+            PipelineState* pso = (dispatch.pass == OceanFFTPass::Stage) ? m_FFTStagePSO.get() : m_FFTSinglePassPSO.get();
+            if (pso != currentPSO)
             {
-                FFTCB cb;
-                cb.stage = stage;
-                cb.direction = 0;  // Horizontal
-                cb.spectrumIndex = spectrumIdx;
-                cb.cascadeIndex = cascadeIndex;
-                cb.mapSize = N;
-                cb.logN = logN;
-                cb.pingPong = stage % 2;
-                
-                d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
-                
-                // Dispatch: one thread per element in a row
-                d3dCmdList->Dispatch(N / FFT_THREAD_GROUP_SIZE, N, 1);
-                
-                // UAV barrier between stages
-                D3D12_RESOURCE_BARRIER barrier = {};
-                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-                barrier.UAV.pResource = m_FFTBuffer->GetResource();
-                d3dCmdList->ResourceBarrier(1, &barrier);
+                cmdList.SetPipelineState(pso);
+                currentPSO = pso;
             }
             
-            // ============ Transpose ============
-            TransposeFFTBuffer(cmdList, cascadeIndex);
+            FFTCB cb;
+            cb.mapSize = N;
+            cb.logN = Log2(N);
+            cb.stage = dispatch.stage;
+            cb.axis = dispatch.axis;
+            cb.sourceOffset = dispatch.sourceHalf * m_FFTPlan.halfElementCount;
+            cb.destOffset = dispatch.destHalf * m_FFTPlan.halfElementCount;
+            cb.transposeOutput = dispatch.transposeOutput ? 1 : 0;
+            cb.outputScale = dispatch.outputScale;
             
-            // ============ Vertical FFT (now horizontal on transposed data) ============
-            for (u32 stage = 0; stage < logN; ++stage)
-            {
-                FFTCB cb;
-                cb.stage = stage;
-                cb.direction = 1;  // Vertical (treated as horizontal on transposed)
-                cb.spectrumIndex = spectrumIdx;
-                cb.cascadeIndex = cascadeIndex;
-                cb.mapSize = N;
-                cb.logN = logN;
-                cb.pingPong = (logN + stage) % 2;
-                
-                d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
-                
-                d3dCmdList->Dispatch(N / FFT_THREAD_GROUP_SIZE, N, 1);
-                
-                D3D12_RESOURCE_BARRIER barrier = {};
-                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-                barrier.UAV.pResource = m_FFTBuffer->GetResource();
-                d3dCmdList->ResourceBarrier(1, &barrier);
-            }
+            cmdList.SetComputeRootConstants(0, &cb, sizeof(cb) / 4);
+            cmdList.Dispatch(dispatch.groupsX, dispatch.groupsY, dispatch.groupsZ);
             
-            // ============ Transpose back ============
-            TransposeFFTBuffer(cmdList, cascadeIndex);
+            if (dispatch.uavBarrierAfter)
+                cmdList.UAVBarrier(fftBuffer);
         }
     }
     
-    void OceanFFT::TransposeFFTBuffer(CommandList& cmdList, u32 cascadeIndex)
-    {
-        auto* d3dCmdList = cmdList.GetCommandList();
-        u32 N = m_Params.mapSize;
-        
-        // Set transpose pipeline
-        d3dCmdList->SetPipelineState(m_TransposePSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_TransposeRS->GetRootSignature());
-        
-        // Set descriptor heap
-        ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
-        
-        TransposeCB cb;
-        cb.mapSize = N;
-        cb.spectrumIndex = 0;  // Transpose all spectra at once
-        cb.cascadeIndex = cascadeIndex;
-        
-        d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
-        
-        // Set UAV (FFT buffer - in-place transpose)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_FFTBufferUAVIndex));
-        
-        // Dispatch: 16x16 tiles
-        u32 groupsX = (N + TRANSPOSE_TILE_SIZE - 1) / TRANSPOSE_TILE_SIZE;
-        u32 groupsY = (N + TRANSPOSE_TILE_SIZE - 1) / TRANSPOSE_TILE_SIZE;
-        d3dCmdList->Dispatch(groupsX, groupsY, 1);
-        
-        // UAV barrier
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barrier.UAV.pResource = m_FFTBuffer->GetResource();
-        d3dCmdList->ResourceBarrier(1, &barrier);
-    }
-    
     void OceanFFT::UnpackFFTResults(CommandList& cmdList, u32 cascadeIndex)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto& cascade = m_Params.cascades[cascadeIndex];
         u32 N = m_Params.mapSize;
         
         // Set unpack pipeline
-        d3dCmdList->SetPipelineState(m_UnpackPSO->GetPipelineState());
-        d3dCmdList->SetComputeRootSignature(m_UnpackRS->GetRootSignature());
+        cmdList.SetPipelineState(m_UnpackPSO.get());
+        cmdList.SetComputeRootSignature(m_UnpackRS.get());
         
         // Set descriptor heap (all descriptors are in UAV heap)
         ID3D12DescriptorHeap* heaps[] = { m_ComputeUAVHeap->GetHeap() };
-        d3dCmdList->SetDescriptorHeaps(1, heaps);
+        cmdList.SetDescriptorHeaps(heaps);
         
         UnpackCB cb;
         cb.mapSize = N;
@@ -1545,24 +1376,21 @@ namespace Sea
         cb.whitecap = cascade.whitecap;
         cb.foamGrowRate = cascade.foamGrowRate;
         cb.foamDecayRate = cascade.foamDecayRate;
+        cb.fftOffset = m_FFTPlan.outputHalf * m_FFTPlan.halfElementCount;
         
-        d3dCmdList->SetComputeRoot32BitConstants(0, sizeof(cb) / 4, &cb, 0);
+        cmdList.SetComputeRootConstants(0, &cb, sizeof(cb) / 4);
         
         // Root 1: UAVs - FFT buffer, displacement, normal maps (consecutive in heap)
-        d3dCmdList->SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_UnpackUAVStartIndex));
+        cmdList.SetComputeRootDescriptorTable(1, m_ComputeUAVHeap->GetGPUHandle(m_UnpackUAVStartIndex));
         
         // Dispatch
         u32 groupsX = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
         u32 groupsY = (N + SPECTRUM_THREAD_GROUP_SIZE - 1) / SPECTRUM_THREAD_GROUP_SIZE;
-        d3dCmdList->Dispatch(groupsX, groupsY, 1);
+        cmdList.Dispatch(groupsX, groupsY, 1);
         
         // UAV barriers for output textures
-        D3D12_RESOURCE_BARRIER barriers[2] = {};
-        barriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barriers[0].UAV.pResource = m_DisplacementMaps->GetResource();
-        barriers[1].Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-        barriers[1].UAV.pResource = m_NormalMaps->GetResource();
-        d3dCmdList->ResourceBarrier(2, barriers);
+        cmdList.UAVBarrier(m_DisplacementMaps->GetResource());
+        cmdList.UAVBarrier(m_NormalMaps->GetResource());
     }
     
     // ========================================================================
@@ -1587,7 +1415,7 @@ namespace Sea
         XMStoreFloat4x4(&cb.world, XMMatrixTranspose(world));
         
         cb.cameraPos = camPos;
-        cb.time = m_Time;
+        cb.time = static_cast<f32>(m_Clock.GetElapsedTime());
         
         XMVECTOR sunDirNorm = XMVector3Normalize(XMLoadFloat3(&m_SunDirection));
         XMStoreFloat3(&cb.sunDirection, sunDirNorm);
@@ -1621,32 +1449,29 @@ namespace Sea
         m_RenderCB->Update(&cb, sizeof(cb));
         
         // Set pipeline state
-        auto* d3dCmdList = cmdList.GetCommandList();
         auto* pso = (m_ViewMode == 1 && m_WireframePSO) ? m_WireframePSO.get() : m_RenderPSO.get();
         
-        d3dCmdList->SetPipelineState(pso->GetPipelineState());
-        d3dCmdList->SetGraphicsRootSignature(m_RenderRS->GetRootSignature());
+        cmdList.SetPipelineState(pso);
+        cmdList.SetGraphicsRootSignature(m_RenderRS.get());
         
         // Bind constant buffer
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_RenderCB->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(0, m_RenderCB->GetGPUAddress());
         
         // Bind textures
         if (m_RenderSRVHeap)
         {
             ID3D12DescriptorHeap* heaps[] = { m_RenderSRVHeap->GetHeap() };
-            d3dCmdList->SetDescriptorHeaps(1, heaps);
-            d3dCmdList->SetGraphicsRootDescriptorTable(1, m_RenderSRVHeap->GetGPUHandle(0));
+            cmdList.SetDescriptorHeaps(heaps);
+            cmdList.SetGraphicsRootDescriptorTable(1, m_RenderSRVHeap->GetGPUHandle(0));
         }
         
         // Draw mesh
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
         
-        D3D12_VERTEX_BUFFER_VIEW vbv = m_OceanMesh->GetVertexBuffer()->GetVertexBufferView();
-        D3D12_INDEX_BUFFER_VIEW ibv = m_OceanMesh->GetIndexBuffer()->GetIndexBufferView();
-        d3dCmdList->IASetVertexBuffers(0, 1, &vbv);
-        d3dCmdList->IASetIndexBuffer(&ibv);
+        cmdList.SetVertexBuffer(0, m_OceanMesh->GetVertexBuffer()->GetVertexBufferView());
+        cmdList.SetIndexBuffer(m_OceanMesh->GetIndexBuffer()->GetIndexBufferView());
         
-        d3dCmdList->DrawIndexedInstanced(m_OceanMesh->GetIndexCount(), 1, 0, 0, 0);
+        cmdList.DrawIndexed(m_OceanMesh->GetIndexCount());
     }
     
     // ========================================================================
@@ -1673,5 +1498,105 @@ namespace Sea
         {
             m_Params.cascades[i].needsSpectrumRebuild = true;
         }
+        m_SpectrumCache.Reset(m_SpectrumSlotCount);
+        m_CascadeSpectrumSlots.fill(OceanSpectrumCache::INVALID_SLOT);
+        
+        if (m_QuerySimulation)
+            m_QuerySimulation->RebuildAllSpectra();
+    }
+    
+    void OceanFFT::SetFFTPlanMode(OceanFFTPlanMode mode)
+    {
+        m_FFTPlanMode = mode;
+        if (!m_Initialized) return;
+        
+        // Both modes use the same two-half buffer, only the recorded dispatches change
+        m_FFTPlan = BuildOceanFFTPlan(m_Params.mapSize, m_Params.numCascades, mode);
+        m_SimulatedStep = NO_STEP;
+    }
+
+    bool OceanFFT::SetMapSize(u32 mapSize)
+    {
+        if (!IsValidMapSize(mapSize))
+        {
+            SEA_CORE_ERROR("OceanFFT: Map size must be a power of 2 in [{}, {}], got {}", MIN_MAP_SIZE, MAX_MAP_SIZE, mapSize);
+            return false;
+        }
+
+        if (!m_Initialized || mapSize == m_Params.mapSize)
+        {
+            m_Params.mapSize = mapSize;
+            return true;
+        }
+
+        const u32 oldMapSize = m_Params.mapSize;
+        m_Params.mapSize = mapSize;
+
+        // Pipelines, root signatures and the mesh do not depend on N - only the size-dependent
+        // resources and the descriptors pointing at them are recreated. CreateTextures also
+        // resets the spectrum cache, since cached spectra are only valid for one size.
+        if (!CreateTextures() || !CreateBuffers() || !CreateDescriptorHeaps())
+        {
+            SEA_CORE_ERROR("OceanFFT: Failed to recreate resources for {}x{}", mapSize, mapSize);
+            m_Initialized = false;
+            return false;
+        }
+
+        m_FFTPlan = BuildOceanFFTPlan(mapSize, m_Params.numCascades, m_FFTPlanMode);
+        for (u32 i = 0; i < m_Params.numCascades; ++i)
+        {
+            m_Params.cascades[i].needsSpectrumRebuild = true;
+        }
+
+        // The query simulation is capped at the render resolution
+        if (m_QuerySimulation)
+        {
+            const u32 querySize = std::min(m_Params.queryMapSize, mapSize);
+            if (m_QuerySimulation->GetMapSize() != querySize &&
+                !m_QuerySimulation->Initialize(MakeReducedResolutionParams(m_Params, querySize)))
+            {
+                SEA_CORE_WARN("OceanFFT: Failed to resize the height query simulation - height queries disabled");
+                m_QuerySimulation.reset();
+            }
+        }
+
+        m_TexturesReadyForRender = false;
+        m_SimulatedStep = NO_STEP;
+
+        SEA_CORE_INFO("OceanFFT: Map size changed {}x{} -> {}x{}", oldMapSize, oldMapSize, mapSize, mapSize);
+        return true;
+    }
+
+    void OceanFFT::ResetClock(u64 step)
+    {
+        m_Clock.Reset(step);
+        m_SimulatedStep = NO_STEP;
+    }
+    
+    // ========================================================================
+    // Height Queries
+    // ========================================================================
+    
+    bool OceanFFT::QueryHeights(std::span<const XMFLOAT2> positions, std::span<f32> outHeights) const
+    {
+        if (!m_QuerySimulation)
+            return false;
+        
+        m_QuerySimulation->QueryHeights(positions, outHeights);
+        return true;
+    }
+    
+    void OceanFFT::SyncQuerySimulation()
+    {
+        // The UI may edit cascade parameters directly, so copy them all before each simulation (seeds shifted for the reduced resolution)
+        auto& queryParams = m_QuerySimulation->GetParams();
+        const OceanFFTParams reduced = MakeReducedResolutionParams(m_Params, queryParams.mapSize);
+        queryParams.depth = m_Params.depth;
+        for (u32 i = 0; i < m_QuerySimulation->GetCascadeCount(); ++i)
+        {
+            const bool rebuild = m_Params.cascades[i].needsSpectrumRebuild || queryParams.cascades[i].needsSpectrumRebuild;
+            queryParams.cascades[i] = reduced.cascades[i];
+            queryParams.cascades[i].needsSpectrumRebuild = rebuild;
+        }
     }
 }
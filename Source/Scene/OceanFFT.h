@@ -15,6 +15,12 @@
 #include "Graphics/CommandList.h"
 #include "Scene/Mesh.h"
 #include "Scene/Camera.h"
+#include "Scene/OceanFFTParams.h"
+#include "Scene/OceanSimulationClock.h"
+#include "Scene/OceanSpectrumCache.h"
+#include "Scene/OceanFFTCPU.h"
+#include "Scene/OceanFFTPlan.h"
+#include "Scene/OceanFFTTables.h"
 
 #include <DirectXMath.h>
 #include <array>
@@ -23,63 +29,6 @@ namespace Sea
 {
     using namespace DirectX;
 
-    // ========================================================================
-    // Wave Cascade Parameters - 每个级联的独立参数
-    // ========================================================================
-    struct WaveCascadeParams
-    {
-        // 频谱参数
-        f32 tileLength = 250.0f;           // 平铺大小 (米)
-        f32 windSpeed = 20.0f;             // 风速 (m/s)
-        f32 windDirection = 0.0f;          // 风向 (角度)
-        f32 fetchLength = 550.0f;          // 风区长度 (km)
-        
-        // 形状控制
-        f32 swell = 0.8f;                  // 涌浪 - 波浪延长
-        f32 spread = 0.2f;                 // 扩展 - 方向性
-        f32 detail = 1.0f;                 // 细节 - 高频衰减
-        
-        // 位移/法线缩放
-        f32 displacementScale = 1.0f;      // 位移缩放
-        f32 normalScale = 1.0f;            // 法线强度
-        
-        // 泡沫参数
-        f32 whitecap = 0.5f;               // 白沫阈值
-        f32 foamAmount = 5.0f;             // 泡沫数量
-        
-        // 运行时状态
-        f32 time = 0.0f;
-        f32 foamGrowRate = 0.0f;
-        f32 foamDecayRate = 0.0f;
-        bool needsSpectrumRebuild = true;
-        i32 spectrumSeedX = 0;
-        i32 spectrumSeedY = 0;
-    };
-
-    // ========================================================================
-    // Ocean FFT Parameters - 全局系统参数
-    // ========================================================================
-    struct OceanFFTParams
-    {
-        static constexpr u32 MAX_CASCADES = 4;
-        
-        u32 mapSize = 256;                 // FFT 分辨率 (2的幂次)
-        u32 numCascades = 3;               // 级联数量
-        f32 depth = 20.0f;                 // 水深 (米)
-        f32 updatesPerSecond = 50.0f;      // 更新频率
-        
-        // 渲染参数
-        f32 roughness = 0.4f;              // 表面粗糙度
-        f32 normalStrength = 1.0f;         // 法线强度
-        
-        // 颜色
-        XMFLOAT4 waterColor = { 0.1f, 0.15f, 0.18f, 1.0f };
-        XMFLOAT4 foamColor = { 0.73f, 0.67f, 0.62f, 1.0f };
-        
-        // 级联参数
-        std::array<WaveCascadeParams, MAX_CASCADES> cascades;
-    };
-
     // ========================================================================
     // Compute Pipeline Push Constants
     // ========================================================================
@@ -97,8 +46,9 @@ namespace Sea
         f32 swell;
         f32 detail;
         f32 spread;
-        u32 cascadeIndex;
-        f32 _padding[3];
+        u32 cascadeIndex;                   // 频谱缓存槽位
+        u32 mapSize;
+        f32 _padding[2];
     };
 
     // 频谱调制 Push Constants
@@ -108,14 +58,22 @@ namespace Sea
         f32 depth;
         f32 time;
         u32 cascadeIndex;
-        f32 _padding[3];
+        u32 spectrumLayer;                  // 频谱缓存槽位
+        u32 mapSize;
+        f32 _padding;
     };
 
-    // FFT Push Constants
+    // FFT Push Constants (one dispatch of OceanFFTPlan)
     struct FFTPushConstants
     {
-        u32 cascadeIndex;
-        f32 _padding[3];
+        u32 mapSize;
+        u32 logN;
+        u32 stage;
+        u32 axis;
+        u32 sourceOffset;                   // FFT 缓冲读取一半的起始元素
+        u32 destOffset;                     // 写入一半的起始元素
+        u32 transposeOutput;
+        f32 outputScale;                    // 最后一个 dispatch 为 1/N
     };
 
     // Unpack Push Constants
@@ -157,8 +115,16 @@ namespace Sea
         OceanFFT(Device& device);
         ~OceanFFT();
 
+        // mapSize 必须是 [MIN_MAP_SIZE, MAX_MAP_SIZE] 内的 2 的幂
+        static constexpr u32 MIN_MAP_SIZE = 16;
+        static constexpr u32 MAX_MAP_SIZE = 1024;
+
         bool Initialize(const OceanFFTParams& params = OceanFFTParams());
         void Shutdown();
+        
+        // 运行时修改 FFT 分辨率：只重建与尺寸有关的贴图、缓冲与描述符，管线与网格保留
+        // 调用前需要等待 GPU 空闲（旧资源可能仍在使用）；失败时海洋停止更新与渲染
+        bool SetMapSize(u32 mapSize);
 
         // 更新波浪模拟
         void Update(f32 deltaTime, CommandList& cmdList);
@@ -174,12 +140,29 @@ namespace Sea
         void SetCascadeParams(u32 index, const WaveCascadeParams& params);
         WaveCascadeParams& GetCascadeParams(u32 index);
         
-        // 强制重新生成频谱
+        // 清空频谱缓存，强制重新生成所有频谱
         void RebuildAllSpectra();
+        OceanSpectrumCacheStats GetSpectrumCacheStats() const { return m_SpectrumCache.GetStats(); }
+        
+        // FFT 调度计划：所有级联的所有频谱在同一批 dispatch 中完成
+        // SharedMemory 每个方向一次 dispatch；mapSize 超过 OceanFFTPlan::MAX_SINGLE_PASS_SIZE 时退化为 Staged
+        void SetFFTPlanMode(OceanFFTPlanMode mode);
+        OceanFFTPlanMode GetFFTPlanMode() const { return m_FFTPlanMode; }
+        const OceanFFTPlan& GetFFTPlan() const { return m_FFTPlan; }
+        
+        // 固定步长时钟：模拟时间 = 步数 / updatesPerSecond，与帧率无关
+        // 回到第 step 步（切换场景、联机同步时使用），下一次 Update 重新模拟
+        void ResetClock(u64 step = 0);
+        const OceanSimulationClock& GetClock() const { return m_Clock; }
         
         // 获取位移/法线贴图 (用于其他系统)
         Texture* GetDisplacementMap() const { return m_DisplacementMaps.get(); }
         Texture* GetNormalMap() const { return m_NormalMaps.get(); }
+
+        // 海面高度查询 (浮力、船只、相机碰撞)：在 CPU 上以 queryMapSize 模拟同一片海的低频部分
+        // queryMapSize 为 0 时返回 false
+        bool QueryHeights(std::span<const XMFLOAT2> positions, std::span<f32> outHeights) const;
+        const OceanFFTCPU* GetQuerySimulation() const { return m_QuerySimulation.get(); }
         
         // 视图模式
         void SetViewMode(int mode) { m_ViewMode = mode; }
@@ -199,17 +182,14 @@ namespace Sea
         bool CreateDescriptorHeaps();
 
         // Compute Pipeline 阶段
-        void GenerateButterflyFactors(CommandList& cmdList);
-        void UpdateCascade(CommandList& cmdList, u32 cascadeIndex, f32 delta);
-        void GenerateSpectrum(CommandList& cmdList, u32 cascadeIndex);
+        void UploadFFTTables(CommandList& cmdList);
+        void UpdateCascade(CommandList& cmdList, u32 cascadeIndex, u32& spectrumRebuilds);
+        void UpdateSpectrumSlot(CommandList& cmdList, u32 cascadeIndex, u32& spectrumRebuilds);
+        void GenerateSpectrum(CommandList& cmdList, u32 cascadeIndex, u32 slot);
         void ModulateSpectrum(CommandList& cmdList, u32 cascadeIndex);
-        void PerformFFT(CommandList& cmdList, u32 cascadeIndex);
-        void TransposeFFTBuffer(CommandList& cmdList, u32 cascadeIndex);
+        void PerformFFT(CommandList& cmdList);
         void UnpackFFTResults(CommandList& cmdList, u32 cascadeIndex);
-
-        // 工具函数
-        static f32 JONSWAPAlpha(f32 windSpeed, f32 fetchLength);
-        static f32 JONSWAPPeakFrequency(f32 windSpeed, f32 fetchLength);
+        void SyncQuerySimulation();
 
     private:
         Device& m_Device;
@@ -217,20 +197,35 @@ namespace Sea
         bool m_Initialized = false;
         
         // 时间/更新控制
-        f32 m_Time = 0.0f;
-        f32 m_NextUpdateTime = 0.0f;
+        static constexpr u64 NO_STEP = ~0ull;
+        f32 m_Time = 0.0f;                      // 最近一次模拟的时间
+        OceanSimulationClock m_Clock;
+        u64 m_SimulatedStep = NO_STEP;          // 贴图对应的步数
         u32 m_CurrentCascade = 0;  // 用于负载均衡
-        bool m_ButterflyGenerated = false;
+        bool m_FFTTablesUploaded = false;
         bool m_TexturesReadyForRender = false;  // 纹理是否已转换为 SRV 状态
+
+        // CPU 上的低分辨率模拟，只用于高度查询
+        Scope<OceanFFTCPU> m_QuerySimulation;
         
         // ========== Compute Resources ==========
         
-        // 频谱纹理 (2D Array - 每层一个级联)
+        // 频谱纹理 (2D Array - 每层一个缓存槽位，级联 + spectrumCacheSize 层)
         Scope<Texture> m_SpectrumTexture;         // 初始频谱 h0(k)
+        u32 m_SpectrumSlotCount = 0;
+        OceanSpectrumCache m_SpectrumCache;
+        std::array<u32, OceanFFTParams::MAX_CASCADES> m_CascadeSpectrumSlots = {};
+        std::array<u64, OceanFFTParams::MAX_CASCADES> m_CascadeSpectrumKeys = {};
+        // 拖动滑条时每帧最多重新生成的频谱数，其余级联沿用旧频谱到下一帧
+        static constexpr u32 MAX_SPECTRUM_REBUILDS_PER_FRAME = 1;
         
         // FFT 缓冲区 (大型 Structured Buffer)
-        Scope<Buffer> m_FFTBuffer;                // FFT ping-pong 缓冲
-        Scope<Buffer> m_ButterflyFactors;         // 蝶形因子
+        Scope<Buffer> m_FFTBuffer;                // 两半 [cascade][spectrum][N][N]，Staged 计划在两半之间乒乓
+        OceanFFTPlanMode m_FFTPlanMode = OceanFFTPlanMode::SharedMemory;
+        OceanFFTPlan m_FFTPlan;
+        Ref<const OceanFFTTables> m_FFTTables;    // 与 CPU 模拟共享的旋转因子表
+        Scope<Buffer> m_TwiddleBuffer;            // 旋转因子 (GPU 只读，每个尺寸上传一次)
+        Scope<Buffer> m_TwiddleUpload;            // 上传用的暂存缓冲
         
         // 输出贴图 (2D Array - 每层一个级联)
         Scope<Texture> m_DisplacementMaps;        // 位移贴图
@@ -239,17 +234,14 @@ namespace Sea
         // Compute Root Signatures
         Scope<RootSignature> m_SpectrumComputeRS;
         Scope<RootSignature> m_SpectrumModulateRS;
-        Scope<RootSignature> m_FFTButterflyRS;
         Scope<RootSignature> m_FFTComputeRS;
-        Scope<RootSignature> m_TransposeRS;
         Scope<RootSignature> m_UnpackRS;
         
         // Compute PSOs
         Ref<PipelineState> m_SpectrumComputePSO;
         Ref<PipelineState> m_SpectrumModulatePSO;
-        Ref<PipelineState> m_FFTButterflyPSO;
-        Ref<PipelineState> m_FFTComputePSO;
-        Ref<PipelineState> m_TransposePSO;
+        Ref<PipelineState> m_FFTStagePSO;         // FFTCompute_CS StageMain
+        Ref<PipelineState> m_FFTSinglePassPSO;    // FFTCompute_CS SinglePassMain
         Ref<PipelineState> m_UnpackPSO;
         
         // Descriptor Heaps for Compute
@@ -261,11 +253,10 @@ namespace Sea
         u32 m_DisplacementUAVIndex = 0;
         u32 m_NormalUAVIndex = 0;
         u32 m_FFTBufferUAVIndex = 0;
-        u32 m_ButterflyUAVIndex = 0;
+        u32 m_TwiddleSRVIndex = 0;      // 计算 UAV 堆中的旋转因子 SRV，FFT 着色器的 t0
         u32 m_UnpackUAVStartIndex = 0;  // Start of consecutive UAVs for unpack shader
         u32 m_SpectrumSRVIndex = 0;
         u32 m_FFTBufferSRVIndex = 0;
-        u32 m_ButterflySRVIndex = 0;
         
         // ========== Render Resources ==========
         
@@ -0,0 +1,800 @@
+// OceanFFTCPU.cpp
+// FFT 海洋模拟的 CPU 实现，逐项对应 Shaders/Ocean/FFT 下的计算着色器
+
+#include "Scene/OceanFFTCPU.h"
+#include "Core/Hash.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace Sea
+{
+    namespace
+    {
+        // 与 OceanCommon.hlsli 相同
+        constexpr f32 PI = 3.14159265358979323846f;
+        constexpr f32 TAU = 2.0f * PI;
+        constexpr f32 GRAVITY = 9.81f;
+
+        constexpr u32 ROW_BATCH_SIZE = 8;
+
+        // 每个级联生成频谱所需的常量（对应 SpectrumComputeCB）
+        struct SpectrumConstants
+        {
+            i32 seedX;
+            i32 seedY;
+            f32 tileLength;
+            f32 alpha;
+            f32 peakFrequency;
+            f32 windSpeed;
+            f32 windAngle;
+            f32 depth;
+            f32 swell;
+            f32 detail;
+            f32 spread;
+        };
+
+        // ====================================================================
+        // OceanSpectrum_CS.hlsl
+        // ====================================================================
+
+        XMFLOAT2 Hash(u32 x, u32 y)
+        {
+            const u32 hx = 1103515245u * ((x >> 1u) ^ y);
+            const u32 hy = 1103515245u * ((y >> 1u) ^ x);
+            u32 h32 = hy + 374761393u + hx * 3266489917u;
+            h32 = 2246822519u * (h32 ^ (h32 >> 15));
+            h32 = 3266489917u * (h32 ^ (h32 >> 13));
+            const u32 n = h32 ^ (h32 >> 16);
+            const u32 rz0 = n;
+            const u32 rz1 = n * 48271u;
+            return { static_cast<f32>((rz0 >> 1) & 0x7FFFFFFFu) / static_cast<f32>(0x7FFFFFFF),
+                     static_cast<f32>((rz1 >> 1) & 0x7FFFFFFFu) / static_cast<f32>(0x7FFFFFFF) };
+        }
+
+        XMFLOAT2 Gaussian(XMFLOAT2 x)
+        {
+            const f32 r = std::sqrt(-2.0f * std::log(std::max(x.x, 1e-10f)));
+            const f32 theta = TAU * x.y;
+            return { r * std::cos(theta), r * std::sin(theta) };
+        }
+
+        f32 LonguetHigginsFunction(f32 s, f32 theta)
+        {
+            const f32 a = std::sqrt(s);
+            const f32 normalization = (s < 0.4f)
+                ? (0.5f / PI) + s * (0.220636f + s * (-0.109f + s * 0.090f))
+                : (1.0f / std::sqrt(PI)) * (a * 0.5f + (1.0f / a) * 0.0625f);
+            return normalization * std::pow(std::abs(std::cos(theta * 0.5f)), 2.0f * s);
+        }
+
+        f32 HasselmannDirectionalSpread(f32 omega, f32 theta, const SpectrumConstants& c)
+        {
+            const f32 p = omega / c.peakFrequency;
+            const f32 s = (omega <= c.peakFrequency)
+                ? 6.97f * std::pow(std::abs(p), 4.06f)
+                : 9.77f * std::pow(std::abs(p), -2.33f - 1.45f * (c.windSpeed * c.peakFrequency / GRAVITY - 1.17f));
+            const f32 sXi = 16.0f * std::tanh(c.peakFrequency / omega) * c.swell * c.swell;
+            return LonguetHigginsFunction(s + sXi, theta - c.windAngle);
+        }
+
+        f32 TMASpectrum(f32 omega, const SpectrumConstants& c)
+        {
+            constexpr f32 beta = 1.25f;
+            constexpr f32 gamma = 3.3f;
+            const f32 omegaP = c.peakFrequency;
+            const f32 sigma = (omega <= omegaP) ? 0.07f : 0.09f;
+            const f32 r = std::exp(-(omega - omegaP) * (omega - omegaP) / (2.0f * sigma * sigma * omegaP * omegaP));
+            const f32 jonswap = (c.alpha * GRAVITY * GRAVITY) / std::pow(omega, 5.0f)
+                              * std::exp(-beta * std::pow(omegaP / omega, 4.0f)) * std::pow(gamma, r);
+
+            const f32 omegaH = std::min(omega * std::sqrt(c.depth / GRAVITY), 2.0f);
+            const f32 tmaAtten = (omegaH <= 1.0f)
+                ? 0.5f * omegaH * omegaH
+                : 1.0f - 0.5f * (2.0f - omegaH) * (2.0f - omegaH);
+            return jonswap * tmaAtten;
+        }
+
+        XMFLOAT2 GetSpectrumAmplitude(i32 idX, i32 idY, i32 mapSize, const SpectrumConstants& c)
+        {
+            const f32 dk = TAU / c.tileLength;
+            const f32 kx = (static_cast<f32>(idX) - static_cast<f32>(mapSize) * 0.5f) * dk;
+            const f32 ky = (static_cast<f32>(idY) - static_cast<f32>(mapSize) * 0.5f) * dk;
+            const f32 k = std::sqrt(kx * kx + ky * ky) + 1e-6f;
+            const f32 theta = std::atan2(kx, ky);
+
+            // 色散关系及其导数
+            const f32 a = k * c.depth;
+            const f32 b = std::tanh(a);
+            const f32 omega = std::sqrt(GRAVITY * k * b);
+            const f32 dOmega = 0.5f * GRAVITY * (b + a * (1.0f - b * b)) / omega;
+            const f32 omegaNorm = dOmega / k * dk * dk;
+
+            const f32 S = TMASpectrum(omega, c);
+            const f32 isotropic = 0.5f / PI;
+            const f32 D = (isotropic + (HasselmannDirectionalSpread(omega, theta, c) - isotropic) * (1.0f - c.spread))
+                        * std::exp(-(1.0f - c.detail) * (1.0f - c.detail) * k * k);
+
+            const XMFLOAT2 g = Gaussian(Hash(static_cast<u32>(idX + c.seedX), static_cast<u32>(idY + c.seedY)));
+            const f32 amplitude = std::sqrt(2.0f * S * D * omegaNorm);
+            return { g.x * amplitude, g.y * amplitude };
+        }
+
+        // ====================================================================
+        // FFT 蝶形运算（XMVECTOR 一次处理相邻 4 列）
+        // ====================================================================
+
+        // (tr + i·ti) * (wr + i·wi)
+        inline void ComplexMultiply(XMVECTOR tr, XMVECTOR ti, XMVECTOR wr, XMVECTOR wi, XMVECTOR& outR, XMVECTOR& outI)
+        {
+            outR = XMVectorNegativeMultiplySubtract(ti, wi, XMVectorMultiply(tr, wr));
+            outI = XMVectorMultiplyAdd(ti, wr, XMVectorMultiply(tr, wi));
+        }
+
+        inline XMVECTOR Load4(const f32* p) { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(p)); }
+        inline void Store4(f32* p, XMVECTOR v) { XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(p), v); }
+    }
+
+    // ========================================================================
+    // Initialization
+    // ========================================================================
+
+    bool OceanFFTCPU::Initialize(const OceanFFTParams& params)
+    {
+        if (params.mapSize < 16 || !std::has_single_bit(params.mapSize))
+        {
+            SEA_CORE_ERROR("OceanFFTCPU: mapSize must be a power of 2 and at least 16 (got {})", params.mapSize);
+            return false;
+        }
+        if (params.numCascades == 0 || params.numCascades > OceanFFTParams::MAX_CASCADES)
+        {
+            SEA_CORE_ERROR("OceanFFTCPU: numCascades must be in [1, {}] (got {})", OceanFFTParams::MAX_CASCADES, params.numCascades);
+            return false;
+        }
+
+        m_Params = params;
+        m_MapSize = params.mapSize;
+        m_CascadeCount = params.numCascades;
+        m_Time = 0.0f;
+        m_Clock = OceanSimulationClock(params.updatesPerSecond);
+        m_SimulatedStep = NO_STEP;
+        m_InterpolationAlpha = 1.0f;
+
+        const size_t texelCount = static_cast<size_t>(m_MapSize) * m_MapSize;
+
+        m_Spectra.assign(m_CascadeCount + params.spectrumCacheSize, std::vector<XMFLOAT4>());
+        m_CascadeSpectrumSlots.assign(m_CascadeCount, OceanSpectrumCache::INVALID_SLOT);
+        m_CascadeSpectrumKeys.assign(m_CascadeCount, 0);
+        m_SpectrumPending.assign(m_CascadeCount, false);
+
+        m_Planes.assign(m_CascadeCount * SPECTRA_PER_CASCADE, ComplexPlane());
+        m_Scratch.assign(m_CascadeCount * SPECTRA_PER_CASCADE, ComplexPlane());
+        for (u32 i = 0; i < m_CascadeCount * SPECTRA_PER_CASCADE; ++i)
+        {
+            m_Planes[i].re.assign(texelCount, 0.0f);
+            m_Planes[i].im.assign(texelCount, 0.0f);
+            m_Scratch[i].re.assign(texelCount, 0.0f);
+            m_Scratch[i].im.assign(texelCount, 0.0f);
+        }
+
+        m_Maps.assign(m_CascadeCount, OceanFFTMaps());
+        for (auto& maps : m_Maps)
+        {
+            maps.displacement.assign(texelCount, XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f));
+            maps.normalFoam.assign(texelCount, XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f));
+        }
+        m_PreviousMaps = m_Maps;
+
+        m_FFTTables = GetOceanFFTTables(m_MapSize);
+
+        RebuildAllSpectra();
+        m_Initialized = true;
+
+        SEA_CORE_INFO("OceanFFTCPU initialized: {}x{}, {} cascades", m_MapSize, m_MapSize, m_CascadeCount);
+        return true;
+    }
+
+    void OceanFFTCPU::Shutdown()
+    {
+        m_Spectra.clear();
+        m_SpectrumCache.Reset(0);
+        m_CascadeSpectrumSlots.clear();
+        m_CascadeSpectrumKeys.clear();
+        m_SpectrumPending.clear();
+        m_Planes.clear();
+        m_Scratch.clear();
+        m_Maps.clear();
+        m_PreviousMaps.clear();
+        m_FFTTables.reset();
+        m_MapSize = 0;
+        m_CascadeCount = 0;
+        m_Initialized = false;
+    }
+
+    // ========================================================================
+    // Update
+    // ========================================================================
+
+    void OceanFFTCPU::Update(f32 deltaTime)
+    {
+        if (!m_Initialized) return;
+
+        if (m_Clock.GetRate() != m_Params.updatesPerSecond)
+            m_Clock.SetRate(m_Params.updatesPerSecond);
+
+        m_Clock.Advance(deltaTime);
+        m_InterpolationAlpha = m_Clock.GetInterpolationAlpha();
+
+        // 帧率高于更新频率时多数帧停在同一步，只更新插值系数
+        const u64 step = m_Clock.GetStep();
+        if (step == m_SimulatedStep)
+            return;
+
+        // 插值需要上一步：刚好前进一步时复用当前结果，否则（首次或一帧跨过多步）重新模拟上一步
+        if (step > 0 && m_SimulatedStep != step - 1)
+            RunSimulation(m_Clock.GetStepTime(step - 1));
+        if (step > 0)
+            std::swap(m_Maps, m_PreviousMaps);
+
+        RunSimulation(m_Clock.GetStepTime(step));
+        if (step == 0)
+            m_PreviousMaps = m_Maps;
+        m_SimulatedStep = step;
+    }
+
+    void OceanFFTCPU::Simulate(f32 time)
+    {
+        if (!m_Initialized) return;
+
+        RunSimulation(time);
+        m_SimulatedStep = NO_STEP;
+        m_InterpolationAlpha = 1.0f;
+    }
+
+    void OceanFFTCPU::ResetClock(u64 step)
+    {
+        m_Clock.Reset(step);
+        m_SimulatedStep = NO_STEP;
+        m_InterpolationAlpha = 1.0f;
+    }
+
+    void OceanFFTCPU::RunSimulation(f32 time)
+    {
+        m_Time = time;
+        m_SimulationCount++;
+        bool anyPending = false;
+        for (u32 i = 0; i < m_CascadeCount; ++i)
+        {
+            auto& cascade = m_Params.cascades[i];
+            cascade.time = time;
+            cascade.needsSpectrumRebuild = false;
+            m_SpectrumPending[i] = false;
+
+            // 重建标记可能由每帧触发的滑条设置，按参数哈希判断频谱是否真的变了
+            const u64 key = HashSpectrumParams(cascade, m_Params.depth, m_MapSize);
+            u32& slot = m_CascadeSpectrumSlots[i];
+            if (slot != OceanSpectrumCache::INVALID_SLOT && m_CascadeSpectrumKeys[i] == key)
+                continue;
+
+            m_SpectrumCache.Release(slot);
+            bool hit = false;
+            slot = m_SpectrumCache.Acquire(key, hit);
+            m_CascadeSpectrumKeys[i] = key;
+            if (!hit)
+            {
+                if (m_Spectra[slot].empty())
+                    m_Spectra[slot].resize(static_cast<size_t>(m_MapSize) * m_MapSize);
+                m_SpectrumPending[i] = true;
+                anyPending = true;
+            }
+        }
+
+        if (anyPending)
+        {
+            GenerateSpectra();
+        }
+        ModulateSpectra();
+        PerformFFT();
+        UnpackFFTResults();
+    }
+
+    // ========================================================================
+    // Spectrum
+    // ========================================================================
+
+    void OceanFFTCPU::GenerateSpectra()
+    {
+        const u32 N = m_MapSize;
+        const i32 dims = static_cast<i32>(N);
+
+        std::array<SpectrumConstants, OceanFFTParams::MAX_CASCADES> constants = {};
+        for (u32 i = 0; i < m_CascadeCount; ++i)
+        {
+            const auto& cascade = m_Params.cascades[i];
+            auto& c = constants[i];
+            c.seedX = cascade.spectrumSeedX;
+            c.seedY = cascade.spectrumSeedY;
+            c.tileLength = cascade.tileLength;
+            c.alpha = JONSWAPAlpha(cascade.windSpeed, cascade.fetchLength);
+            c.peakFrequency = JONSWAPPeakFrequency(cascade.windSpeed, cascade.fetchLength);
+            c.windSpeed = cascade.windSpeed;
+            c.windAngle = cascade.windDirection * XM_PI / 180.0f;
+            c.depth = m_Params.depth;
+            c.swell = cascade.swell;
+            c.detail = cascade.detail;
+            c.spread = cascade.spread;
+        }
+
+        // 级联 × 行并行，跳过不需要重建的级联
+        JobSystem::RunParallelFor(m_CascadeCount * N, ROW_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 job = begin; job < end; ++job)
+            {
+                const u32 cascadeIndex = job / N;
+                if (!m_SpectrumPending[cascadeIndex])
+                    continue;
+
+                const SpectrumConstants& c = constants[cascadeIndex];
+                const i32 y = static_cast<i32>(job % N);
+                XMFLOAT4* row = m_Spectra[m_CascadeSpectrumSlots[cascadeIndex]].data() + static_cast<size_t>(y) * N;
+                for (i32 x = 0; x < dims; ++x)
+                {
+                    // -k 对应的像素：((-id) % dims + dims) % dims
+                    const i32 negX = (dims - x) % dims;
+                    const i32 negY = (dims - y) % dims;
+                    const XMFLOAT2 h0 = GetSpectrumAmplitude(x, y, dims, c);
+                    const XMFLOAT2 h0Neg = GetSpectrumAmplitude(negX, negY, dims, c);
+                    row[x] = XMFLOAT4(h0.x, h0.y, h0Neg.x, -h0Neg.y);
+                }
+            }
+        });
+    }
+
+    // ========================================================================
+    // Modulate (OceanModulate_CS.hlsl)
+    // ========================================================================
+
+    void OceanFFTCPU::ModulateSpectra()
+    {
+        const u32 N = m_MapSize;
+        const f32 depth = m_Params.depth;
+
+        JobSystem::RunParallelFor(m_CascadeCount * N, ROW_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 job = begin; job < end; ++job)
+            {
+                const u32 cascadeIndex = job / N;
+                const u32 y = job % N;
+                const f32 time = m_Params.cascades[cascadeIndex].time;
+                const f32 dk = TAU / m_Params.cascades[cascadeIndex].tileLength;
+                const size_t rowOffset = static_cast<size_t>(y) * N;
+                const XMFLOAT4* spectrum = GetSpectrum(cascadeIndex).data() + rowOffset;
+
+                f32* re[SPECTRA_PER_CASCADE];
+                f32* im[SPECTRA_PER_CASCADE];
+                for (u32 s = 0; s < SPECTRA_PER_CASCADE; ++s)
+                {
+                    re[s] = GetPlane(cascadeIndex, s).re.data() + rowOffset;
+                    im[s] = GetPlane(cascadeIndex, s).im.data() + rowOffset;
+                }
+
+                const f32 kvY = (static_cast<f32>(y) - static_cast<f32>(N) * 0.5f) * dk;
+                for (u32 x = 0; x < N; ++x)
+                {
+                    const f32 kvX = (static_cast<f32>(x) - static_cast<f32>(N) * 0.5f) * dk;
+                    const f32 k = std::sqrt(kvX * kvX + kvY * kvY) + 1e-6f;
+                    const f32 kuX = kvX / k;
+                    const f32 kuY = kvY / k;
+
+                    // h(k,t) = h0(k)·e^{iωt} + conj(h0(-k))·e^{-iωt}
+                    const f32 dispersion = std::sqrt(GRAVITY * k * std::tanh(k * depth)) * time;
+                    const f32 c = std::cos(dispersion);
+                    const f32 s = std::sin(dispersion);
+                    const XMFLOAT4& h0 = spectrum[x];
+                    const f32 hRe = h0.x * c - h0.y * s + h0.z * c + h0.w * s;
+                    const f32 hIm = h0.x * s + h0.y * c - h0.z * s + h0.w * c;
+
+                    // i·h
+                    const f32 hInvRe = -hIm;
+                    const f32 hInvIm = hRe;
+
+                    // 与着色器相同的坐标交换：x 方向的量使用 k_vec.y
+                    const f32 hxRe = hInvRe * kuY, hxIm = hInvIm * kuY;
+                    const f32 hyRe = hRe, hyIm = hIm;
+                    const f32 hzRe = hInvRe * kuX, hzIm = hInvIm * kuX;
+                    const f32 dhyDxRe = hInvRe * kvY, dhyDxIm = hInvIm * kvY;
+                    const f32 dhyDzRe = hInvRe * kvX, dhyDzIm = hInvIm * kvX;
+                    const f32 dhxDxRe = -hRe * kvY * kuY, dhxDxIm = -hIm * kvY * kuY;
+                    const f32 dhzDzRe = -hRe * kvX * kuX, dhzDzIm = -hIm * kvX * kuX;
+                    const f32 dhzDxRe = -hRe * kvY * kuX, dhzDxIm = -hIm * kvY * kuX;
+
+                    // 两个实数场打包成一个复数：a + i·b
+                    re[0][x] = hxRe - hyIm;        im[0][x] = hxIm + hyRe;
+                    re[1][x] = hzRe - dhyDxIm;     im[1][x] = hzIm + dhyDxRe;
+                    re[2][x] = dhyDzRe - dhxDxIm;  im[2][x] = dhyDzIm + dhxDxRe;
+                    re[3][x] = dhzDzRe - dhzDxIm;  im[3][x] = dhzDzIm + dhzDxRe;
+                }
+            }
+        });
+    }
+
+    // ========================================================================
+    // FFT
+    // ========================================================================
+
+    void OceanFFTCPU::InverseFFTColumns(ComplexPlane& plane, ComplexPlane& scratch, u32 colBegin, u32 colEnd) const
+    {
+        // Stockham 自动排序：每级在 plane / scratch 之间乒乓，不需要位反转
+        // 先做 radix-4 级，log2(N) 为奇数时最后补一级 radix-2；旋转因子 w^p = exp(+2πi·p·s/N)
+        const u32 N = m_MapSize;
+        const f32* twiddleRe = m_FFTTables->twiddleRe.data();
+        const f32* twiddleIm = m_FFTTables->twiddleIm.data();
+        f32* xr = plane.re.data();
+        f32* xi = plane.im.data();
+        f32* yr = scratch.re.data();
+        f32* yi = scratch.im.data();
+        bool swapped = false;
+
+        u32 n = N;
+        u32 s = 1;
+        for (; n >= 4; n /= 4, s *= 4)
+        {
+            const u32 n1 = n / 4;
+            for (u32 p = 0; p < n1; ++p)
+            {
+                const XMVECTOR w1r = XMVectorReplicate(twiddleRe[p * s]);
+                const XMVECTOR w1i = XMVectorReplicate(twiddleIm[p * s]);
+                const XMVECTOR w2r = XMVectorReplicate(twiddleRe[2 * p * s]);
+                const XMVECTOR w2i = XMVectorReplicate(twiddleIm[2 * p * s]);
+                const XMVECTOR w3r = XMVectorReplicate(twiddleRe[3 * p * s]);
+                const XMVECTOR w3i = XMVectorReplicate(twiddleIm[3 * p * s]);
+
+                for (u32 q = 0; q < s; ++q)
+                {
+                    const size_t a = static_cast<size_t>(q + s * p) * N;
+                    const size_t b = static_cast<size_t>(q + s * (p + n1)) * N;
+                    const size_t c = static_cast<size_t>(q + s * (p + 2 * n1)) * N;
+                    const size_t d = static_cast<size_t>(q + s * (p + 3 * n1)) * N;
+                    const size_t y0 = static_cast<size_t>(q + s * (4 * p + 0)) * N;
+                    const size_t y1 = static_cast<size_t>(q + s * (4 * p + 1)) * N;
+                    const size_t y2 = static_cast<size_t>(q + s * (4 * p + 2)) * N;
+                    const size_t y3 = static_cast<size_t>(q + s * (4 * p + 3)) * N;
+
+                    for (u32 col = colBegin; col < colEnd; col += 4)
+                    {
+                        const XMVECTOR ar = Load4(xr + a + col), ai = Load4(xi + a + col);
+                        const XMVECTOR br = Load4(xr + b + col), bi = Load4(xi + b + col);
+                        const XMVECTOR cr = Load4(xr + c + col), ci = Load4(xi + c + col);
+                        const XMVECTOR dr = Load4(xr + d + col), di = Load4(xi + d + col);
+
+                        const XMVECTOR apcR = XMVectorAdd(ar, cr), apcI = XMVectorAdd(ai, ci);
+                        const XMVECTOR amcR = XMVectorSubtract(ar, cr), amcI = XMVectorSubtract(ai, ci);
+                        const XMVECTOR bpdR = XMVectorAdd(br, dr), bpdI = XMVectorAdd(bi, di);
+                        const XMVECTOR bmdR = XMVectorSubtract(br, dr), bmdI = XMVectorSubtract(bi, di);
+
+                        Store4(yr + y0 + col, XMVectorAdd(apcR, bpdR));
+                        Store4(yi + y0 + col, XMVectorAdd(apcI, bpdI));
+
+                        // (a - c) + i(b - d)
+                        XMVECTOR outR, outI;
+                        ComplexMultiply(XMVectorSubtract(amcR, bmdI), XMVectorAdd(amcI, bmdR), w1r, w1i, outR, outI);
+                        Store4(yr + y1 + col, outR);
+                        Store4(yi + y1 + col, outI);
+
+                        ComplexMultiply(XMVectorSubtract(apcR, bpdR), XMVectorSubtract(apcI, bpdI), w2r, w2i, outR, outI);
+                        Store4(yr + y2 + col, outR);
+                        Store4(yi + y2 + col, outI);
+
+                        // (a - c) - i(b - d)
+                        ComplexMultiply(XMVectorAdd(amcR, bmdI), XMVectorSubtract(amcI, bmdR), w3r, w3i, outR, outI);
+                        Store4(yr + y3 + col, outR);
+                        Store4(yi + y3 + col, outI);
+                    }
+                }
+            }
+
+            std::swap(xr, yr);
+            std::swap(xi, yi);
+            swapped = !swapped;
+        }
+
+        // 剩下的 radix-2 级不需要旋转因子，直接写回 plane
+        f32* outRe = swapped ? yr : xr;
+        f32* outIm = swapped ? yi : xi;
+        if (n == 2)
+        {
+            for (u32 q = 0; q < s; ++q)
+            {
+                const size_t a = static_cast<size_t>(q) * N;
+                const size_t b = static_cast<size_t>(q + s) * N;
+                for (u32 col = colBegin; col < colEnd; col += 4)
+                {
+                    const XMVECTOR ar = Load4(xr + a + col), ai = Load4(xi + a + col);
+                    const XMVECTOR br = Load4(xr + b + col), bi = Load4(xi + b + col);
+                    Store4(outRe + a + col, XMVectorAdd(ar, br));
+                    Store4(outIm + a + col, XMVectorAdd(ai, bi));
+                    Store4(outRe + b + col, XMVectorSubtract(ar, br));
+                    Store4(outIm + b + col, XMVectorSubtract(ai, bi));
+                }
+            }
+        }
+        else if (swapped)
+        {
+            const size_t count = colEnd - colBegin;
+            for (u32 row = 0; row < N; ++row)
+            {
+                const size_t offset = static_cast<size_t>(row) * N + colBegin;
+                std::memcpy(outRe + offset, xr + offset, count * sizeof(f32));
+                std::memcpy(outIm + offset, xi + offset, count * sizeof(f32));
+            }
+        }
+    }
+
+    void OceanFFTCPU::PerformFFT()
+    {
+        // 列方向 FFT → 转置 → 列方向 FFT，与着色器的 行 FFT → 转置 → 行 FFT 得到相同的结果布局：
+        // 结果第 y 行第 x 列对应 (k_vec.x ↔ y, k_vec.y ↔ x)，解包直接按行主序读取
+        // 列方向的蝶形运算在同一行内连续访问，可以按 4 列一组向量化
+        // 这里不缩放，与 FFTCompute_CS 相同的 1/N 在解包时与 ifftshift 符号一起乘上
+        const u32 N = m_MapSize;
+        const u32 planeCount = m_CascadeCount * SPECTRA_PER_CASCADE;
+        const u32 columnBlocks = std::max(1u, N / FFT_COLUMN_BLOCK);
+        const u32 columnBlock = N / columnBlocks;
+
+        auto columnPass = [&]() {
+            JobSystem::RunParallelFor(planeCount * columnBlocks, 1, [&](u32 begin, u32 end) {
+                for (u32 job = begin; job < end; ++job)
+                {
+                    const u32 planeIndex = job / columnBlocks;
+                    const u32 colBegin = (job % columnBlocks) * columnBlock;
+                    InverseFFTColumns(m_Planes[planeIndex], m_Scratch[planeIndex], colBegin, colBegin + columnBlock);
+                }
+            });
+        };
+
+        columnPass();
+
+        // 分块转置到 scratch，再交换两个缓冲
+        const u32 rowBlocks = N / TRANSPOSE_BLOCK;
+        JobSystem::RunParallelFor(planeCount * rowBlocks, 1, [&](u32 begin, u32 end) {
+            for (u32 job = begin; job < end; ++job)
+            {
+                const ComplexPlane& src = m_Planes[job / rowBlocks];
+                ComplexPlane& dst = m_Scratch[job / rowBlocks];
+                const u32 rowBegin = (job % rowBlocks) * TRANSPOSE_BLOCK;
+                for (u32 colBegin = 0; colBegin < N; colBegin += TRANSPOSE_BLOCK)
+                {
+                    for (u32 row = rowBegin; row < rowBegin + TRANSPOSE_BLOCK; ++row)
+                    {
+                        for (u32 col = colBegin; col < colBegin + TRANSPOSE_BLOCK; ++col)
+                        {
+                            dst.re[static_cast<size_t>(col) * N + row] = src.re[static_cast<size_t>(row) * N + col];
+                            dst.im[static_cast<size_t>(col) * N + row] = src.im[static_cast<size_t>(row) * N + col];
+                        }
+                    }
+                }
+            }
+        });
+        std::swap(m_Planes, m_Scratch);
+
+        columnPass();
+    }
+
+    // ========================================================================
+    // Unpack (FFTUnpack_CS.hlsl)
+    // ========================================================================
+
+    void OceanFFTCPU::UnpackFFTResults()
+    {
+        const u32 N = m_MapSize;
+        const f32 scale = 1.0f / static_cast<f32>(N);
+
+        JobSystem::RunParallelFor(m_CascadeCount * N, ROW_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 job = begin; job < end; ++job)
+            {
+                const u32 cascadeIndex = job / N;
+                const u32 y = job % N;
+                const auto& cascade = m_Params.cascades[cascadeIndex];
+                const size_t rowOffset = static_cast<size_t>(y) * N;
+
+                const f32* re[SPECTRA_PER_CASCADE];
+                const f32* im[SPECTRA_PER_CASCADE];
+                for (u32 s = 0; s < SPECTRA_PER_CASCADE; ++s)
+                {
+                    re[s] = GetPlane(cascadeIndex, s).re.data() + rowOffset;
+                    im[s] = GetPlane(cascadeIndex, s).im.data() + rowOffset;
+                }
+                XMFLOAT4* displacement = m_Maps[cascadeIndex].displacement.data() + rowOffset;
+                XMFLOAT4* normalFoam = m_Maps[cascadeIndex].normalFoam.data() + rowOffset;
+
+                for (u32 x = 0; x < N; ++x)
+                {
+                    // ifftshift：(-1)^(x+y)，与逆变换的 1/N 合并
+                    const f32 signShift = ((x ^ y) & 1) ? -scale : scale;
+                    const f32 hx = re[0][x] * signShift;
+                    const f32 hy = im[0][x] * signShift;
+                    const f32 hz = re[1][x] * signShift;
+                    const f32 dhyDx = im[1][x] * signShift;
+                    const f32 dhyDz = re[2][x] * signShift;
+                    const f32 dhxDx = im[2][x] * signShift;
+                    const f32 dhzDz = re[3][x] * signShift;
+                    const f32 dhzDx = im[3][x] * signShift;
+
+                    displacement[x] = XMFLOAT4(hx, hy, hz, 0.0f);
+
+                    const f32 jacobian = (1.0f + dhxDx) * (1.0f + dhzDz) - dhzDx * dhzDx;
+                    const f32 foamFactor = -std::min(0.0f, jacobian - cascade.whitecap);
+                    const f32 foam = std::clamp(foamFactor * cascade.foamGrowRate, 0.0f, 1.0f);
+
+                    normalFoam[x] = XMFLOAT4(dhyDx / (1.0f + std::abs(dhxDx)), dhyDz / (1.0f + std::abs(dhzDz)), dhxDx, foam);
+                }
+            }
+        });
+    }
+
+    // ========================================================================
+    // Height Queries
+    // ========================================================================
+
+    OceanFFTCPU::QuerySetup OceanFFTCPU::GetQuerySetup() const
+    {
+        f32 texelsPerMeter[4] = {};
+        f32 displacementScale[4] = {};
+        for (u32 i = 0; i < m_CascadeCount; ++i)
+        {
+            texelsPerMeter[i] = static_cast<f32>(m_MapSize) / m_Params.cascades[i].tileLength;
+            displacementScale[i] = m_Params.cascades[i].displacementScale;
+        }
+
+        QuerySetup setup;
+        setup.texelsPerMeter = XMFLOAT4(texelsPerMeter[0], texelsPerMeter[1], texelsPerMeter[2], texelsPerMeter[3]);
+        setup.displacementScale = XMFLOAT4(displacementScale[0], displacementScale[1], displacementScale[2], displacementScale[3]);
+        setup.interpolationAlpha = m_InterpolationAlpha;
+        return setup;
+    }
+
+    XMVECTOR OceanFFTCPU::SampleDisplacement(const QuerySetup& setup, f32 x, f32 z) const
+    {
+        // 所有级联的纹理坐标一次算完（每个分量一个级联），texel 中心在 +0.5 处
+        const XMVECTOR texelsPerMeter = XMLoadFloat4(&setup.texelsPerMeter);
+        const XMVECTOR half = XMVectorReplicate(0.5f);
+        const XMVECTOR u = XMVectorSubtract(XMVectorScale(texelsPerMeter, x), half);
+        const XMVECTOR v = XMVectorSubtract(XMVectorScale(texelsPerMeter, z), half);
+        const XMVECTOR u0 = XMVectorFloor(u);
+        const XMVECTOR v0 = XMVectorFloor(v);
+
+        XMFLOAT4 texelU, texelV, fracU, fracV;
+        XMStoreFloat4(&texelU, u0);
+        XMStoreFloat4(&texelV, v0);
+        XMStoreFloat4(&fracU, XMVectorSubtract(u, u0));
+        XMStoreFloat4(&fracV, XMVectorSubtract(v, v0));
+
+        const f32* tu = &texelU.x;
+        const f32* tv = &texelV.x;
+        const f32* fu = &fracU.x;
+        const f32* fv = &fracV.x;
+        const f32* scale = &setup.displacementScale.x;
+
+        // mapSize 是 2 的幂，环绕寻址用掩码即可（负数按补码同样正确）
+        const u32 mask = m_MapSize - 1;
+        const bool interpolate = setup.interpolationAlpha < 1.0f;
+        XMVECTOR total = XMVectorZero();
+        for (u32 c = 0; c < m_CascadeCount; ++c)
+        {
+            const u32 x0 = static_cast<u32>(static_cast<i32>(tu[c])) & mask;
+            const u32 y0 = static_cast<u32>(static_cast<i32>(tv[c])) & mask;
+            const u32 x1 = (x0 + 1) & mask;
+            const u32 y1 = (y0 + 1) & mask;
+
+            auto bilinear = [&](const XMFLOAT4* map) {
+                const XMVECTOR d00 = XMLoadFloat4(&map[y0 * m_MapSize + x0]);
+                const XMVECTOR d10 = XMLoadFloat4(&map[y0 * m_MapSize + x1]);
+                const XMVECTOR d01 = XMLoadFloat4(&map[y1 * m_MapSize + x0]);
+                const XMVECTOR d11 = XMLoadFloat4(&map[y1 * m_MapSize + x1]);
+                const XMVECTOR top = XMVectorLerp(d00, d10, fu[c]);
+                const XMVECTOR bottom = XMVectorLerp(d01, d11, fu[c]);
+                return XMVectorLerp(top, bottom, fv[c]);
+            };
+
+            XMVECTOR sample = bilinear(m_Maps[c].displacement.data());
+            if (interpolate)
+                sample = XMVectorLerp(bilinear(m_PreviousMaps[c].displacement.data()), sample, setup.interpolationAlpha);
+            total = XMVectorMultiplyAdd(sample, XMVectorReplicate(scale[c]), total);
+        }
+        return total;
+    }
+
+    XMFLOAT3 OceanFFTCPU::SampleDisplacement(f32 x, f32 z) const
+    {
+        XMFLOAT3 result(0.0f, 0.0f, 0.0f);
+        if (m_Initialized)
+            XMStoreFloat3(&result, SampleDisplacement(GetQuerySetup(), x, z));
+        return result;
+    }
+
+    void OceanFFTCPU::QueryHeights(std::span<const XMFLOAT2> positions, std::span<f32> outHeights, u32 iterations) const
+    {
+        const u32 count = static_cast<u32>(std::min(positions.size(), outHeights.size()));
+        if (!m_Initialized)
+        {
+            std::fill_n(outHeights.begin(), count, 0.0f);
+            return;
+        }
+
+        const QuerySetup setup = GetQuerySetup();
+        JobSystem::RunParallelFor(count, QUERY_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+            {
+                const XMVECTOR target = XMVectorSet(positions[i].x, 0.0f, positions[i].y, 0.0f);
+
+                // 从查询点出发，p0 ← p - D(p0)，只修正水平分量
+                XMVECTOR origin = target;
+                for (u32 iteration = 0; iteration < iterations; ++iteration)
+                {
+                    const XMVECTOR displacement = SampleDisplacement(setup, XMVectorGetX(origin), XMVectorGetZ(origin));
+                    origin = XMVectorSubtract(target, displacement);
+                }
+
+                outHeights[i] = XMVectorGetY(SampleDisplacement(setup, XMVectorGetX(origin), XMVectorGetZ(origin)));
+            }
+        });
+    }
+
+    OceanFFTParams MakeReducedResolutionParams(const OceanFFTParams& params, u32 mapSize)
+    {
+        // 像素 id 对应的波矢是 (id - mapSize/2)·dk，频谱哈希的是 id + seed
+        OceanFFTParams reduced = params;
+        reduced.mapSize = mapSize;
+        const i32 seedOffset = (static_cast<i32>(params.mapSize) - static_cast<i32>(mapSize)) / 2;
+        for (auto& cascade : reduced.cascades)
+        {
+            cascade.spectrumSeedX += seedOffset;
+            cascade.spectrumSeedY += seedOffset;
+            cascade.needsSpectrumRebuild = true;
+        }
+        return reduced;
+    }
+
+    // ========================================================================
+    // Parameter Setters
+    // ========================================================================
+
+    void OceanFFTCPU::SetCascadeParams(u32 index, const WaveCascadeParams& params)
+    {
+        if (index >= OceanFFTParams::MAX_CASCADES) return;
+        m_Params.cascades[index] = params;
+        m_Params.cascades[index].needsSpectrumRebuild = true;
+    }
+
+    WaveCascadeParams& OceanFFTCPU::GetCascadeParams(u32 index)
+    {
+        static WaveCascadeParams dummy;
+        if (index >= OceanFFTParams::MAX_CASCADES) return dummy;
+        return m_Params.cascades[index];
+    }
+
+    void OceanFFTCPU::RebuildAllSpectra()
+    {
+        for (u32 i = 0; i < m_Params.numCascades; ++i)
+        {
+            m_Params.cascades[i].needsSpectrumRebuild = true;
+        }
+        m_SpectrumCache.Reset(static_cast<u32>(m_Spectra.size()));
+        std::fill(m_CascadeSpectrumSlots.begin(), m_CascadeSpectrumSlots.end(), OceanSpectrumCache::INVALID_SLOT);
+    }
+
+    u64 OceanFFTCPU::ComputeStateHash() const
+    {
+        u64 hash = HashBytes(&m_MapSize, sizeof(m_MapSize));
+        for (u32 i = 0; i < m_CascadeCount; ++i)
+        {
+            if (m_CascadeSpectrumSlots[i] != OceanSpectrumCache::INVALID_SLOT)
+                hash = HashBytes(GetSpectrum(i).data(), GetSpectrum(i).size() * sizeof(XMFLOAT4), hash);
+            hash = HashBytes(m_Maps[i].displacement.data(), m_Maps[i].displacement.size() * sizeof(XMFLOAT4), hash);
+            hash = HashBytes(m_Maps[i].normalFoam.data(), m_Maps[i].normalFoam.size() * sizeof(XMFLOAT4), hash);
+        }
+        return hash;
+    }
+}
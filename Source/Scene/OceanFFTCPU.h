@@ -0,0 +1,163 @@
+// OceanFFTCPU.h
+// FFT 海洋模拟的 CPU 实现：与 OceanFFT 的计算着色器相同的 频谱 → 时间调制 → 2D IFFT → 解包 流程
+// 用作着色器的参照结果，也可以在没有 GPU 计算管线时作为后备的模拟路径
+
+#pragma once
+#include "Core/Types.h"
+#include "Scene/OceanFFTParams.h"
+#include "Scene/OceanSimulationClock.h"
+#include "Scene/OceanSpectrumCache.h"
+#include "Scene/OceanFFTTables.h"
+
+#include <DirectXMath.h>
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 一个级联的模拟结果，布局与 OceanFFT 贴图数组中的一层相同（行主序，mapSize × mapSize）
+    struct OceanFFTMaps
+    {
+        std::vector<XMFLOAT4> displacement;   // xyz = 位移, w = 0
+        std::vector<XMFLOAT4> normalFoam;     // xy = 坡度, z = dhx_dx, w = 泡沫
+    };
+
+    class OceanFFTCPU : public NonCopyable
+    {
+    public:
+        // 与调制着色器打包方式相同：每个级联 4 个复数频谱，每个同时携带两个实数场
+        static constexpr u32 SPECTRA_PER_CASCADE = 4;
+        // 高度查询反推水平位移的不动点迭代次数
+        static constexpr u32 QUERY_ITERATIONS = 4;
+
+        OceanFFTCPU() = default;
+        ~OceanFFTCPU() = default;
+
+        // 按 params.mapSize / numCascades 分配内存；之后修改这两项需要重新 Initialize（可以直接再次调用）
+        bool Initialize(const OceanFFTParams& params = OceanFFTParams());
+        void Shutdown();
+
+        // 与 OceanFFT::Update 相同的固定步长时钟：只在跨过一步时模拟，保留上一步的结果，
+        // 采样 / 查询在两步之间按时钟的插值系数插值
+        void Update(f32 deltaTime);
+        // 在给定时间模拟所有级联，不做插值
+        // 每次模拟都比较各级联的频谱参数哈希，参数变化且不在缓存中时才重新生成频谱
+        void Simulate(f32 time);
+
+        // 时钟回到第 step 步，下一次 Update 重新模拟
+        void ResetClock(u64 step = 0);
+        const OceanSimulationClock& GetClock() const { return m_Clock; }
+        f32 GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+        u64 GetSimulationCount() const { return m_SimulationCount; }
+
+        // 频谱与当前结果的内容哈希：相同种子、参数与步数应得到相同的值，用于回归测试与联机同步校验
+        u64 ComputeStateHash() const;
+
+        // 参数访问
+        OceanFFTParams& GetParams() { return m_Params; }
+        const OceanFFTParams& GetParams() const { return m_Params; }
+        void SetCascadeParams(u32 index, const WaveCascadeParams& params);
+        WaveCascadeParams& GetCascadeParams(u32 index);
+        // 清空频谱缓存，下一次模拟重新生成所有频谱
+        void RebuildAllSpectra();
+        OceanSpectrumCacheStats GetSpectrumCacheStats() const { return m_SpectrumCache.GetStats(); }
+
+        u32 GetMapSize() const { return m_MapSize; }
+        u32 GetCascadeCount() const { return m_CascadeCount; }
+        f32 GetTime() const { return m_Time; }
+        const OceanFFTMaps& GetCascadeMaps(u32 cascadeIndex) const { return m_Maps[cascadeIndex]; }
+        // 级联当前使用的初始频谱，布局与 GPU 的频谱纹理相同：(h0(k).xy, conj(h0(-k)).zw)；至少模拟过一次后才有效
+        const std::vector<XMFLOAT4>& GetSpectrum(u32 cascadeIndex) const { return m_Spectra[m_CascadeSpectrumSlots[cascadeIndex]]; }
+        const Ref<const OceanFFTTables>& GetFFTTables() const { return m_FFTTables; }
+
+        // 单独运行 Simulate 的后三个阶段（测试与性能测试用）：调制使用各级联参数中的 time，
+        // 之前需要至少模拟过一次以生成频谱
+        void ModulateSpectra();
+        // 对所有复数平面原地做 2D 逆 FFT，不缩放；结果第 y 行第 x 列对应 (k_vec.x ↔ y, k_vec.y ↔ x)
+        void PerformFFT();
+        // 乘以 ifftshift 符号与 1/N 后写出位移 / 法线贴图
+        void UnpackFFTResults();
+
+        // 复数平面（级联 × SPECTRA_PER_CASCADE 个，行主序 mapSize × mapSize），可直接写入任意频域数据后调用 PerformFFT
+        // PerformFFT 会交换内部缓冲，之前取得的 span 随之失效
+        u32 GetPlaneCount() const { return static_cast<u32>(m_Planes.size()); }
+        std::span<f32> GetPlaneReal(u32 planeIndex) { return m_Planes[planeIndex].re; }
+        std::span<f32> GetPlaneImag(u32 planeIndex) { return m_Planes[planeIndex].im; }
+
+        // 网格上 (x, z) 处的顶点被推开的位移：与 OceanFFT_VS 相同，按 uv = xz / tileLength 环绕双线性采样，
+        // 各级联乘 displacementScale 后累加（不含随相机距离的衰减）
+        XMFLOAT3 SampleDisplacement(f32 x, f32 z) const;
+
+        // 批量查询世界坐标 (x, z) 处的海面高度，outHeights 至少与 positions 一样长
+        // 水平位移会把顶点推离原位，用不动点迭代 p0 = p - D(p0).xz 找到落在 p 的顶点再取它的高度
+        // 按查询并行；每个查询内各级联的坐标计算与双线性插值用 XMVECTOR 完成
+        void QueryHeights(std::span<const XMFLOAT2> positions, std::span<f32> outHeights, u32 iterations = QUERY_ITERATIONS) const;
+
+    private:
+        // 复数平面按实部 / 虚部分开存放（SoA），行主序
+        struct ComplexPlane
+        {
+            std::vector<f32> re;
+            std::vector<f32> im;
+        };
+
+        // 各阶段都一次处理所有级联，按 级联 × 行（或列块）并行
+        void GenerateSpectra();
+        void RunSimulation(f32 time);
+
+        // 沿列方向（行与行之间）对 [colBegin, colEnd) 的列做 N 点逆变换，结果写回 plane
+        void InverseFFTColumns(ComplexPlane& plane, ComplexPlane& scratch, u32 colBegin, u32 colEnd) const;
+        ComplexPlane& GetPlane(u32 cascadeIndex, u32 spectrumIndex) { return m_Planes[cascadeIndex * SPECTRA_PER_CASCADE + spectrumIndex]; }
+
+        // 每个级联的 texels/米（x 分量对应级联 0，依此类推）与位移缩放，查询开始时计算一次
+        struct QuerySetup
+        {
+            XMFLOAT4 texelsPerMeter;
+            XMFLOAT4 displacementScale;
+            f32 interpolationAlpha;     // < 1 时与上一步的结果插值
+        };
+        QuerySetup GetQuerySetup() const;
+        XMVECTOR SampleDisplacement(const QuerySetup& setup, f32 x, f32 z) const;
+
+    private:
+        static constexpr u32 FFT_COLUMN_BLOCK = 32;   // 列方向 FFT 每个任务处理的列数（4 的倍数）
+        static constexpr u32 TRANSPOSE_BLOCK = 16;
+        static constexpr u32 QUERY_BATCH_SIZE = 256;
+        static constexpr u64 NO_STEP = ~0ull;
+
+        OceanFFTParams m_Params;
+        u32 m_MapSize = 0;
+        u32 m_CascadeCount = 0;
+        bool m_Initialized = false;
+
+        // 时间/更新控制
+        f32 m_Time = 0.0f;
+        OceanSimulationClock m_Clock;
+        u64 m_SimulatedStep = NO_STEP;      // m_Maps 对应的步数，Simulate 直接指定时间时为 NO_STEP
+        f32 m_InterpolationAlpha = 1.0f;
+        u64 m_SimulationCount = 0;          // 实际运行模拟的次数
+
+        // 初始频谱槽位，与 GPU 的频谱纹理相同：(h0(k).xy, conj(h0(-k)).zw)；槽位在第一次使用时分配
+        std::vector<std::vector<XMFLOAT4>> m_Spectra;
+        OceanSpectrumCache m_SpectrumCache;
+        std::vector<u32> m_CascadeSpectrumSlots;   // 每个级联使用的槽位
+        std::vector<u64> m_CascadeSpectrumKeys;
+        std::vector<bool> m_SpectrumPending;      // 本次模拟需要生成频谱的级联
+
+        // FFT 缓冲：级联 × 4 个复数平面，以及同样大小的乒乓 / 转置缓冲
+        std::vector<ComplexPlane> m_Planes;
+        std::vector<ComplexPlane> m_Scratch;
+
+        // 逆变换的旋转因子，与同一 N 的其他模拟共享
+        Ref<const OceanFFTTables> m_FFTTables;
+
+        std::vector<OceanFFTMaps> m_Maps;
+        std::vector<OceanFFTMaps> m_PreviousMaps;   // 上一步的结果，只用于插值
+    };
+
+    // 用较低分辨率模拟同一片海：种子按 (mapSize - 新 mapSize) / 2 平移，使相同波矢取到相同的随机数，
+    // 结果是原模拟中 |k| 较小的那部分波（高度查询只需要低频波）
+    OceanFFTParams MakeReducedResolutionParams(const OceanFFTParams& params, u32 mapSize);
+}
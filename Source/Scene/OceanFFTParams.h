@@ -0,0 +1,131 @@
+// OceanFFTParams.h
+// FFT 海洋的模拟参数，GPU（OceanFFT）与 CPU（OceanFFTCPU）两条路径共用
+
+#pragma once
+#include "Core/Types.h"
+#include "Core/Hash.h"
+
+#include <DirectXMath.h>
+#include <array>
+#include <cmath>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // ========================================================================
+    // Wave Cascade Parameters - 每个级联的独立参数
+    // ========================================================================
+    struct WaveCascadeParams
+    {
+        // 频谱参数
+        f32 tileLength = 250.0f;           // 平铺大小 (米)
+        f32 windSpeed = 20.0f;             // 风速 (m/s)
+        f32 windDirection = 0.0f;          // 风向 (角度)
+        f32 fetchLength = 550.0f;          // 风区长度 (km)
+        
+        // 形状控制
+        f32 swell = 0.8f;                  // 涌浪 - 波浪延长
+        f32 spread = 0.2f;                 // 扩展 - 方向性
+        f32 detail = 1.0f;                 // 细节 - 高频衰减
+        
+        // 位移/法线缩放
+        f32 displacementScale = 1.0f;      // 位移缩放
+        f32 normalScale = 1.0f;            // 法线强度
+        
+        // 泡沫参数
+        f32 whitecap = 0.5f;               // 白沫阈值
+        f32 foamAmount = 5.0f;             // 泡沫数量
+        
+        // 运行时状态
+        f32 time = 0.0f;
+        f32 foamGrowRate = 0.0f;
+        f32 foamDecayRate = 0.0f;
+        bool needsSpectrumRebuild = true;
+        i32 spectrumSeedX = 0;
+        i32 spectrumSeedY = 0;
+    };
+
+    // ========================================================================
+    // Ocean FFT Parameters - 全局系统参数
+    // ========================================================================
+    struct OceanFFTParams
+    {
+        static constexpr u32 MAX_CASCADES = 4;
+        
+        u32 mapSize = 256;                 // FFT 分辨率 (2的幂次)
+        u32 numCascades = 3;               // 级联数量
+        f32 depth = 20.0f;                 // 水深 (米)
+        f32 updatesPerSecond = 50.0f;      // 更新频率
+        u32 queryMapSize = 64;             // CPU 高度查询用的模拟分辨率 (0 = 不提供查询)
+        u32 spectrumCacheSize = 8;         // 级联之外额外缓存的初始频谱数
+        
+        // 渲染参数
+        f32 roughness = 0.4f;              // 表面粗糙度
+        f32 normalStrength = 1.0f;         // 法线强度
+        
+        // 颜色
+        XMFLOAT4 waterColor = { 0.1f, 0.15f, 0.18f, 1.0f };
+        XMFLOAT4 foamColor = { 0.73f, 0.67f, 0.62f, 1.0f };
+        
+        // 级联参数
+        std::array<WaveCascadeParams, MAX_CASCADES> cascades;
+    };
+
+    // ========================================================================
+    // 随机种子
+    // ========================================================================
+
+    // 场景文件未指定 seed 时使用的种子
+    constexpr u32 DEFAULT_OCEAN_SEED = 1;
+
+    // 由一个场景种子确定性地导出每个级联的频谱种子并标记重建频谱
+    // 只用整数运算，相同的 seed 在任何平台上都得到相同的频谱种子
+    inline void ApplyOceanSeed(OceanFFTParams& params, u32 seed)
+    {
+        for (u32 i = 0; i < OceanFFTParams::MAX_CASCADES; ++i)
+        {
+            const u32 fields[] = { seed, i };
+            const u64 hash = HashBytes(fields, sizeof(fields));
+            // 限制在 [0, 10000)，与 id + seed 相加时不会溢出 i32
+            auto& cascade = params.cascades[i];
+            cascade.spectrumSeedX = static_cast<i32>((hash & 0xFFFFFFFFull) % 10000);
+            cascade.spectrumSeedY = static_cast<i32>((hash >> 32) % 10000);
+            cascade.needsSpectrumRebuild = true;
+        }
+    }
+
+    // 初始频谱只取决于这些参数，相同的键可以直接复用已生成的频谱
+    // 位移 / 法线缩放、泡沫参数只影响解包与渲染，不参与
+    inline u64 HashSpectrumParams(const WaveCascadeParams& cascade, f32 depth, u32 mapSize)
+    {
+        const f32 values[] = {
+            cascade.tileLength, cascade.windSpeed, cascade.windDirection, cascade.fetchLength,
+            cascade.swell, cascade.spread, cascade.detail, depth,
+        };
+        const i32 ids[] = { cascade.spectrumSeedX, cascade.spectrumSeedY, static_cast<i32>(mapSize), 0 };
+        return HashBytes(values, sizeof(values), HashBytes(ids, sizeof(ids)));
+    }
+
+    // ========================================================================
+    // JONSWAP 参数
+    // ========================================================================
+
+    // α = 0.076 * (U²/(F*g))^0.22，fetchLength 单位 km
+    inline f32 JONSWAPAlpha(f32 windSpeed, f32 fetchLength)
+    {
+        f32 F = fetchLength * 1000.0f;
+        f32 U = windSpeed;
+        constexpr f32 g = 9.81f;
+        return 0.076f * std::pow((U * U) / (F * g), 0.22f);
+    }
+
+    // ω_p = 22 * (g²/(U*F))^(1/3)，fetchLength 单位 km
+    inline f32 JONSWAPPeakFrequency(f32 windSpeed, f32 fetchLength)
+    {
+        f32 F = fetchLength * 1000.0f;
+        f32 U = windSpeed;
+        constexpr f32 g = 9.81f;
+        return 22.0f * std::pow((g * g) / (U * F), 1.0f / 3.0f);
+    }
+}
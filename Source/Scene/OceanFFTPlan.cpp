@@ -0,0 +1,89 @@
+// OceanFFTPlan.cpp
+// 2D 逆 FFT 调度计划的生成
+
+#include "Scene/OceanFFTPlan.h"
+#include "Core/Log.h"
+
+#include <bit>
+
+namespace Sea
+{
+    OceanFFTPlan BuildOceanFFTPlan(u32 mapSize, u32 cascadeCount, OceanFFTPlanMode mode)
+    {
+        OceanFFTPlan plan;
+        if (mapSize < 2 || !std::has_single_bit(mapSize) || cascadeCount == 0)
+        {
+            SEA_CORE_ERROR("OceanFFTPlan: invalid size {} x {} cascades", mapSize, cascadeCount);
+            return plan;
+        }
+
+        if (mode == OceanFFTPlanMode::SharedMemory && mapSize > OceanFFTPlan::MAX_SINGLE_PASS_SIZE)
+            mode = OceanFFTPlanMode::Staged;
+
+        const u32 logN = static_cast<u32>(std::countr_zero(mapSize));
+        plan.mode = mode;
+        plan.mapSize = mapSize;
+        plan.sliceCount = cascadeCount * 4;
+        plan.halfElementCount = plan.sliceCount * mapSize * mapSize;
+
+        if (mode == OceanFFTPlanMode::SharedMemory)
+        {
+            // 行方向原地变换；列方向读第 0 半、转置写入第 1 半（原地转置写会覆盖其他线程组还没读的列）
+            for (u32 axis = 0; axis < 2; ++axis)
+            {
+                OceanFFTDispatch dispatch;
+                dispatch.pass = OceanFFTPass::SinglePass;
+                dispatch.axis = axis;
+                dispatch.sourceHalf = 0;
+                dispatch.destHalf = axis;
+                dispatch.transposeOutput = (axis == 1);
+                dispatch.groupsX = mapSize;
+                dispatch.groupsY = 1;
+                dispatch.groupsZ = plan.sliceCount;
+                plan.dispatches.push_back(dispatch);
+            }
+        }
+        else
+        {
+            // 每个阶段在两半之间乒乓，2·log2(N) 个阶段结束后回到第 0 半
+            const u32 butterflies = mapSize / 2;
+            u32 half = 0;
+            for (u32 axis = 0; axis < 2; ++axis)
+            {
+                for (u32 stage = 0; stage < logN; ++stage)
+                {
+                    OceanFFTDispatch dispatch;
+                    dispatch.pass = OceanFFTPass::Stage;
+                    dispatch.axis = axis;
+                    dispatch.stage = stage;
+                    dispatch.sourceHalf = half;
+                    dispatch.destHalf = half ^ 1;
+                    dispatch.transposeOutput = (axis == 1 && stage == logN - 1);
+                    dispatch.groupsX = (butterflies + OceanFFTPlan::STAGE_THREAD_GROUP_SIZE - 1) / OceanFFTPlan::STAGE_THREAD_GROUP_SIZE;
+                    dispatch.groupsY = mapSize;
+                    dispatch.groupsZ = plan.sliceCount;
+                    plan.dispatches.push_back(dispatch);
+                    half ^= 1;
+                }
+            }
+        }
+
+        // 每个 dispatch 都依赖上一个的结果，最后一个之后的屏障供解包使用
+        for (const auto& dispatch : plan.dispatches)
+        {
+            if (dispatch.uavBarrierAfter)
+                ++plan.barrierCount;
+        }
+        // 整个 2D 逆变换只归一化一次，放在最后写出时
+        plan.dispatches.back().outputScale = 1.0f / static_cast<f32>(mapSize);
+        plan.outputHalf = plan.dispatches.back().destHalf;
+        return plan;
+    }
+
+    u32 GetLegacyOceanFFTDispatchCount(u32 mapSize, u32 cascadeCount)
+    {
+        // 每个级联、每个频谱：行方向 log2(N) 次 + 转置 + 列方向 log2(N) 次 + 转置
+        const u32 logN = static_cast<u32>(std::countr_zero(mapSize));
+        return cascadeCount * 4 * (2 * logN + 2);
+    }
+}
@@ -0,0 +1,62 @@
+// OceanFFTPlan.h
+// OceanFFT 的 2D 逆 FFT 调度计划：每个 dispatch 的网格、参数与其后的屏障以数据形式给出，
+// GPU 按计划录制命令，测试可以不依赖 D3D12 检查调度数量并模拟执行
+
+#pragma once
+#include "Core/Types.h"
+
+#include <vector>
+
+namespace Sea
+{
+    enum class OceanFFTPlanMode : u8
+    {
+        Staged,         // 每个 radix-2 阶段一次 dispatch，阶段之间在 FFT 缓冲的两半之间乒乓
+        SharedMemory,   // 每个方向一次 dispatch，一个线程组在 groupshared 中完成一整行 / 列的所有阶段
+    };
+
+    enum class OceanFFTPass : u8
+    {
+        Stage,          // FFTCompute_CS StageMain：一个阶段，每个线程一个蝶形
+        SinglePass,     // FFTCompute_CS SinglePassMain：一整行 / 列
+    };
+
+    // 一次 dispatch；Z 维是 级联 × 4 个频谱 的切片，所有级联的所有频谱一起处理
+    struct OceanFFTDispatch
+    {
+        OceanFFTPass pass = OceanFFTPass::Stage;
+        u32 axis = 0;               // 0 = 沿行（x 方向），1 = 沿列（y 方向）
+        u32 stage = 0;              // 只用于 Stage
+        u32 sourceHalf = 0;         // 从 FFT 缓冲的哪一半读取
+        u32 destHalf = 0;           // 写入哪一半；与 sourceHalf 相同时原地写回（只用于 SinglePass 的行方向）
+        bool transposeOutput = false;   // 按 (x, y) → x * N + y 写出，与 OceanFFTCPU 及解包着色器的布局一致
+        f32 outputScale = 1.0f;         // 写出前乘上的系数：最后一个 dispatch 为 1/N，其余为 1
+        u32 groupsX = 1, groupsY = 1, groupsZ = 1;
+        bool uavBarrierAfter = true;
+    };
+
+    struct OceanFFTPlan
+    {
+        // 与 FFTCompute_CS.hlsl 一致
+        static constexpr u32 STAGE_THREAD_GROUP_SIZE = 64;
+        static constexpr u32 SINGLE_PASS_THREAD_GROUP_SIZE = 128;
+        static constexpr u32 MAX_SINGLE_PASS_SIZE = 1024;       // groupshared 容量
+
+        OceanFFTPlanMode mode = OceanFFTPlanMode::Staged;
+        u32 mapSize = 0;
+        u32 sliceCount = 0;         // 级联数 × 4
+        u32 outputHalf = 0;         // 结果所在的一半，解包从这里读取
+        u32 halfElementCount = 0;   // 每一半的 float2 个数（sliceCount × mapSize²）
+        u32 barrierCount = 0;
+        std::vector<OceanFFTDispatch> dispatches;
+    };
+
+    // 生成 mapSize × mapSize、cascadeCount 个级联的 2D 逆 FFT 计划：先沿行，再沿列，最后一个 dispatch 乘 1/N
+    // （与 OceanFFTCPU 相同，整个 2D 变换只归一化一次）
+    // 列方向按步长 mapSize 访问，不需要单独的转置；最后一个 dispatch 转置写出
+    // mapSize 超过 MAX_SINGLE_PASS_SIZE 时 SharedMemory 退化为 Staged
+    OceanFFTPlan BuildOceanFFTPlan(u32 mapSize, u32 cascadeCount, OceanFFTPlanMode mode);
+
+    // 重构前逐频谱、逐阶段、带转置的调度数（每次 dispatch 后一个屏障），用于对比
+    u32 GetLegacyOceanFFTDispatchCount(u32 mapSize, u32 cascadeCount);
+}
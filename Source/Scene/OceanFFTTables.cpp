@@ -0,0 +1,64 @@
+// OceanFFTTables.cpp
+// FFT 旋转因子表的生成与缓存
+
+#include "Scene/OceanFFTTables.h"
+#include "Core/Log.h"
+
+#include <bit>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace Sea
+{
+    namespace
+    {
+        std::mutex s_TableMutex;
+        std::unordered_map<u32, Ref<const OceanFFTTables>> s_Tables;
+
+        Ref<const OceanFFTTables> BuildTables(u32 mapSize)
+        {
+            auto tables = MakeRef<OceanFFTTables>();
+            tables->mapSize = mapSize;
+            tables->logN = static_cast<u32>(std::countr_zero(mapSize));
+            tables->twiddleRe.resize(mapSize);
+            tables->twiddleIm.resize(mapSize);
+            tables->gpuTwiddles.resize(2 * static_cast<size_t>(mapSize));
+
+            // 旋转因子用 double 计算，避免大 N 时的累积误差
+            for (u32 i = 0; i < mapSize; ++i)
+            {
+                const f64 angle = 2.0 * 3.14159265358979323846 * i / mapSize;
+                tables->twiddleRe[i] = static_cast<f32>(std::cos(angle));
+                tables->twiddleIm[i] = static_cast<f32>(std::sin(angle));
+                tables->gpuTwiddles[2 * i + 0] = tables->twiddleRe[i];
+                tables->gpuTwiddles[2 * i + 1] = tables->twiddleIm[i];
+            }
+            return tables;
+        }
+    }
+
+    Ref<const OceanFFTTables> GetOceanFFTTables(u32 mapSize)
+    {
+        if (mapSize < 2 || !std::has_single_bit(mapSize))
+        {
+            SEA_CORE_ERROR("OceanFFTTables: mapSize must be a power of 2 (got {})", mapSize);
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(s_TableMutex);
+        auto it = s_Tables.find(mapSize);
+        if (it != s_Tables.end())
+            return it->second;
+
+        Ref<const OceanFFTTables> tables = BuildTables(mapSize);
+        s_Tables.emplace(mapSize, tables);
+        return tables;
+    }
+
+    u32 GetOceanFFTTableCacheSize()
+    {
+        std::lock_guard<std::mutex> lock(s_TableMutex);
+        return static_cast<u32>(s_Tables.size());
+    }
+}
@@ -0,0 +1,28 @@
+// OceanFFTTables.h
+// FFT 旋转因子表，按 N 缓存：CPU（OceanFFTCPU）直接使用，GPU（OceanFFT）在每个尺寸上传一次
+
+#pragma once
+#include "Core/Types.h"
+
+#include <vector>
+
+namespace Sea
+{
+    // 逆变换的旋转因子 w^k = exp(+2πik/N)，k ∈ [0, N)，用 double 计算后截断为 f32
+    // 两条路径都是 Stockham 自动排序 FFT，不需要位反转表
+    struct OceanFFTTables
+    {
+        u32 mapSize = 0;
+        u32 logN = 0;
+        std::vector<f32> twiddleRe;     // CPU：实部 / 虚部分开存放（SoA）
+        std::vector<f32> twiddleIm;
+        std::vector<f32> gpuTwiddles;   // GPU：(re, im) 交错，与 StructuredBuffer<float2> 布局相同
+    };
+
+    // 取 mapSize 的表，第一次请求时生成；同一 N 的所有使用者（各级联、各实例、CPU 与 GPU）共享一份
+    // 线程安全；mapSize 必须是 2 的幂，否则返回 nullptr
+    Ref<const OceanFFTTables> GetOceanFFTTables(u32 mapSize);
+
+    // 已缓存的表数量（调试 UI）
+    u32 GetOceanFFTTableCacheSize();
+}
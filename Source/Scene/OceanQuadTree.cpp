@@ -1,135 +1,87 @@
 #include "Scene/OceanQuadTree.h"
 #include "Core/Log.h"
+#include "Core/JobSystem.h"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace Sea
 {
-    // Helper function
-    static inline f32 Saturate(f32 x)
+    namespace
     {
-        return std::max(0.0f, std::min(1.0f, x));
+        // 与 OceanQuadTree_VS.hlsl 的波浪参数一致：每个级联的波长 / 振幅、锐度，以及淡出距离（0 = 不淡出）
+        struct GerstnerCascade
+        {
+            XMFLOAT2 waves[4];     // x = 波长, y = 振幅（乘以 choppiness）
+            f32 steepness;
+            f32 fadeDistance;
+        };
+
+        constexpr GerstnerCascade GERSTNER_CASCADES[OCEAN_WAVE_CASCADE_COUNT] = {
+            { { { 250.0f, 8.0f }, { 180.0f, 5.5f }, { 120.0f, 3.5f }, { 80.0f, 2.2f } }, 0.75f, 0.0f },
+            { { { 45.0f, 1.4f }, { 32.0f, 1.0f }, { 22.0f, 0.7f }, { 15.0f, 0.5f } }, 0.6f, 1000.0f },
+            { { { 8.0f, 0.25f }, { 5.5f, 0.18f }, { 3.5f, 0.12f }, { 2.2f, 0.08f } }, 0.375f, 300.0f },
+        };
     }
 
-    OceanQuadTree::OceanQuadTree(Device& device)
-        : m_Device(device)
+    std::array<OceanWaveCascadeBounds, OCEAN_WAVE_CASCADE_COUNT> ComputeGerstnerWaveBounds(f32 choppiness)
     {
+        // 每个波的竖直位移最大为振幅 A，水平位移最大为 Q * A（与着色器 GerstnerWave 的 Q 相同）
+        // 级联内各波直接相加；级联权重不超过 1，按 1 计
+        std::array<OceanWaveCascadeBounds, OCEAN_WAVE_CASCADE_COUNT> bounds;
+        for (u32 c = 0; c < OCEAN_WAVE_CASCADE_COUNT; ++c)
+        {
+            const GerstnerCascade& cascade = GERSTNER_CASCADES[c];
+            bounds[c].fadeDistance = cascade.fadeDistance;
+            for (const XMFLOAT2& wave : cascade.waves)
+            {
+                const f32 amplitude = wave.y * choppiness;
+                if (amplitude <= 0.0f)
+                    continue;
+
+                const f32 k = XM_2PI / wave.x;
+                const f32 q = std::min(std::clamp(cascade.steepness, 0.0f, 1.0f) / (k * amplitude * 8.0f),
+                                       1.0f / (k * amplitude + 0.0001f));
+                bounds[c].maxHeight += amplitude;
+                bounds[c].maxHorizontal += q * amplitude;
+            }
+        }
+        return bounds;
     }
 
     bool OceanQuadTree::Initialize(const OceanQuadTreeConfig& config)
     {
         m_Config = config;
 
-        // 创建基础网格
-        if (!CreateBaseMesh())
-        {
-            SEA_CORE_ERROR("OceanQuadTree: Failed to create base mesh");
-            return false;
-        }
-
-        // 创建实例缓冲区 (预分配最大可能的实例数)
-        // 最大实例数 = 4^maxLOD (最坏情况)
-        u32 maxInstances = 1;
-        for (u32 i = 0; i < m_Config.maxLOD; ++i)
-            maxInstances *= 4;
-        maxInstances = std::min(maxInstances, 4096u);  // 限制最大实例数
-
-        BufferDesc instanceBufferDesc;
-        instanceBufferDesc.size = sizeof(OceanQuadInstance) * maxInstances;
-        instanceBufferDesc.type = BufferType::Structured;
-        instanceBufferDesc.stride = sizeof(OceanQuadInstance);
+        // 预分配节点池：按 4^maxLOD 个叶子估计，上限 4096（更多时按需增长）
+        u32 expectedLeaves = 1;
+        for (u32 i = 0; i < m_Config.maxLOD && expectedLeaves < 4096; ++i)
+            expectedLeaves *= 4;
+        m_Nodes.reserve(expectedLeaves * 2);
 
-        m_InstanceBuffer = MakeScope<Buffer>(m_Device, instanceBufferDesc);
-        if (!m_InstanceBuffer->Initialize(nullptr))
-        {
-            SEA_CORE_ERROR("OceanQuadTree: Failed to create instance buffer");
-            return false;
-        }
-
-        // 预分配节点池
-        m_Nodes.reserve(maxInstances * 2);
+        // Ocean 每帧按当前锐度设置，单独使用时按锐度 1 估计
+        const auto waveBounds = ComputeGerstnerWaveBounds(1.0f);
+        m_WaveBounds.assign(waveBounds.begin(), waveBounds.end());
+        m_NeedsRebuild = true;
 
-        SEA_CORE_INFO("OceanQuadTree initialized: worldSize={}, maxLOD={}, maxInstances={}",
-                      m_Config.worldSize, m_Config.maxLOD, maxInstances);
+        SEA_CORE_INFO("OceanQuadTree initialized: worldSize={}, maxLOD={}", m_Config.worldSize, m_Config.maxLOD);
         return true;
     }
 
     void OceanQuadTree::Shutdown()
     {
-        m_BaseMesh.reset();
-        m_InstanceBuffer.reset();
         m_Nodes.clear();
+        m_FreeBlocks.clear();
         m_LeafNodeIndices.clear();
         m_RenderInstances.clear();
+        m_InstanceDirty.clear();
+        m_DirtyNodes.clear();
+        m_NeedsRebuild = true;
     }
 
-    bool OceanQuadTree::CreateBaseMesh()
-    {
-        // 创建一个单位大小的网格，渲染时通过实例数据缩放和定位
-        const u32 res = m_Config.baseMeshResolution;
-        const f32 size = 1.0f;  // 单位大小
-        const f32 halfSize = size * 0.5f;
-        const f32 cellSize = size / static_cast<f32>(res);
-
-        std::vector<Vertex> vertices;
-        std::vector<u32> indices;
-
-        // 生成顶点
-        for (u32 z = 0; z <= res; ++z)
-        {
-            for (u32 x = 0; x <= res; ++x)
-            {
-                Vertex v;
-                v.position = {
-                    -halfSize + x * cellSize,
-                    0.0f,
-                    -halfSize + z * cellSize
-                };
-                v.normal = { 0.0f, 1.0f, 0.0f };
-                v.texCoord = {
-                    static_cast<f32>(x) / res,
-                    static_cast<f32>(z) / res
-                };
-                v.color = { 1.0f, 1.0f, 1.0f, 1.0f };
-                vertices.push_back(v);
-            }
-        }
-
-        // 生成索引
-        for (u32 z = 0; z < res; ++z)
-        {
-            for (u32 x = 0; x < res; ++x)
-            {
-                u32 topLeft = z * (res + 1) + x;
-                u32 topRight = topLeft + 1;
-                u32 bottomLeft = (z + 1) * (res + 1) + x;
-                u32 bottomRight = bottomLeft + 1;
-
-                indices.push_back(topLeft);
-                indices.push_back(bottomLeft);
-                indices.push_back(topRight);
-
-                indices.push_back(topRight);
-                indices.push_back(bottomLeft);
-                indices.push_back(bottomRight);
-            }
-        }
-
-        m_BaseMesh = MakeScope<Mesh>();
-        if (!m_BaseMesh->CreateFromVertices(m_Device, vertices, indices))
-        {
-            SEA_CORE_ERROR("OceanQuadTree: Failed to create base mesh geometry");
-            return false;
-        }
-
-        SEA_CORE_INFO("OceanQuadTree: Created base mesh with {} vertices, {} triangles",
-                      vertices.size(), indices.size() / 3);
-        return true;
-    }
-
-    void OceanQuadTree::Update(const Camera& camera)
+    bool OceanQuadTree::Update(const Camera& camera)
     {
-        // 检查是否需要重建
+        // 检查是否需要更新
         XMFLOAT3 camPos = camera.GetPosition();
         f32 moveDist = std::sqrt(
             (camPos.x - m_LastCameraPos.x) * (camPos.x - m_LastCameraPos.x) +
@@ -137,22 +89,57 @@ namespace Sea
             (camPos.z - m_LastCameraPos.z) * (camPos.z - m_LastCameraPos.z)
         );
 
-        // 只有相机移动足够距离时才重建
-        if (moveDist > m_Config.lodBaseDistance * 0.1f || m_NeedsRebuild)
+        // 相机转动或投影改变时视锥体变了，需要重新剔除（平移在门限内时由 m_CullMargin 保守覆盖）
+        const XMFLOAT3& forward = camera.GetForward();
+        const bool viewChanged = forward.x != m_LastCameraForward.x || forward.y != m_LastCameraForward.y ||
+                                 forward.z != m_LastCameraForward.z ||
+                                 memcmp(&camera.GetProjectionMatrix(), &m_LastProjection, sizeof(XMFLOAT4X4)) != 0;
+        const bool needsCull = m_Config.enableFrustumCulling && (viewChanged || m_NeedsCull);
+
+        // 只有相机移动足够距离时才更新；第一次完整构建，之后沿用上一次的树只做分裂与合并
+        if (moveDist > m_Config.lodBaseDistance * 0.1f || m_NeedsRebuild || needsCull)
         {
-            BuildTree(camera);
-            CollectLeafNodes();
-            CalculateNeighborLODs();
-            UpdateInstanceBuffer();
+            if (m_NeedsRebuild)
+                BuildTree(camera);
+            else
+                UpdateTree(camera);
+            UpdateInstances();
 
             m_LastCameraPos = camPos;
+            m_LastCameraForward = forward;
+            m_LastProjection = camera.GetProjectionMatrix();
             m_NeedsRebuild = false;
+            m_NeedsCull = false;
+            return true;
         }
+        return false;
+    }
+
+    void OceanQuadTree::SetWaveBounds(std::span<const OceanWaveCascadeBounds> cascades)
+    {
+        const bool changed = cascades.size() != m_WaveBounds.size() ||
+                             !std::equal(cascades.begin(), cascades.end(), m_WaveBounds.begin(),
+                                         [](const OceanWaveCascadeBounds& a, const OceanWaveCascadeBounds& b) {
+                                             return a.maxHeight == b.maxHeight && a.maxHorizontal == b.maxHorizontal &&
+                                                    a.fadeDistance == b.fadeDistance;
+                                         });
+        if (!changed)
+            return;
+
+        m_WaveBounds.assign(cascades.begin(), cascades.end());
+        m_NeedsCull = true;
     }
 
     void OceanQuadTree::BuildTree(const Camera& camera)
     {
         m_Nodes.clear();
+        m_FreeBlocks.clear();
+        m_LeafNodeIndices.clear();
+        m_RenderInstances.clear();
+        m_InstanceDirty.clear();
+        m_DirtyNodes.clear();
+        UpdateLODRanges();
+        UpdateFrustum(camera);
 
         // 创建根节点
         OceanQuadNode root;
@@ -160,43 +147,138 @@ namespace Sea
         root.size = m_Config.worldSize;
         root.lod = m_Config.maxLOD;
         root.isLeaf = true;
-        root.inFrustum = true;
-        root.distanceToCamera = 0.0f;
+        root.instanceIndex = INVALID_NODE;
+        root.dirty = false;
+        UpdateNodeVisibility(root, IsInFrustum(root), camera);
 
         m_Nodes.push_back(root);
         m_RootNodeIndex = 0;
+        if (root.inFrustum)
+            AddInstance(m_RootNodeIndex);
 
-        // 递归细分
+        // 递归细分，再补齐 2:1 约束；所有叶子都是新的，不需要逐个标记邻居
+        m_Rebuilding = true;
         SubdivideNode(m_RootNodeIndex, camera);
+        BalanceTree(camera);
+        m_Rebuilding = false;
+    }
+
+    void OceanQuadTree::UpdateTree(const Camera& camera)
+    {
+        // 沿用上一次的树：LOD 判断没变的节点原样保留，只分裂 / 合并判断改变了的节点
+        // 新叶子与它们的邻居进入 m_DirtyNodes，BalanceTree 只从这些叶子开始检查
+        UpdateLODRanges();
+        UpdateFrustum(camera);
+        UpdateNode(m_RootNodeIndex, IsInFrustum(m_Nodes[m_RootNodeIndex]), camera);
+        BalanceTree(camera);
+    }
+
+    void OceanQuadTree::UpdateFrustum(const Camera& camera)
+    {
+        // Update 只在相机平移超过门限时重新剔除，门限内平面最多移动门限距离，剔除时留出这段余量
+        m_Frustum.SetFromViewProjection(camera.GetViewProjectionMatrix());
+        m_CullMargin = m_Config.lodBaseDistance * 0.1f;
+    }
+
+    void OceanQuadTree::UpdateLODRanges()
+    {
+        m_LODRanges.resize(m_Config.maxLOD + 1);
+        for (u32 lod = 0; lod <= m_Config.maxLOD; ++lod)
+        {
+            m_LODRanges[lod] = CalculateLODDistance(lod);
+        }
     }
 
     void OceanQuadTree::SubdivideNode(u32 nodeIndex, const Camera& camera)
     {
-        OceanQuadNode& node = m_Nodes[nodeIndex];
+        const OceanQuadNode& node = m_Nodes[nodeIndex];
+        if (!node.inFrustum || !ShouldSubdivide(node, camera))
+            return;
+
+        CreateChildren(nodeIndex, camera);
+
+        // 递归细分子节点（CreateChildren 之后 node 引用可能已失效，按索引访问）
+        for (u32 i = 0; i < 4; ++i)
+        {
+            SubdivideNode(m_Nodes[nodeIndex].childIndices[i], camera);
+        }
+    }
+
+    void OceanQuadTree::UpdateNode(u32 nodeIndex, bool inFrustum, const Camera& camera)
+    {
+        // inFrustum 由父节点对四个子节点一起测试得到（根节点单独测试）
+        const bool wasVisible = m_Nodes[nodeIndex].inFrustum;
+        UpdateNodeVisibility(m_Nodes[nodeIndex], inFrustum, camera);
+        const bool visible = m_Nodes[nodeIndex].inFrustum;
 
-        // 视锥体剔除
-        if (!IsInFrustum(node.center, node.size, camera))
+        if (m_Nodes[nodeIndex].isLeaf)
         {
-            node.inFrustum = false;
+            if (visible != wasVisible)
+            {
+                if (visible)
+                    AddInstance(nodeIndex);
+                else
+                    RemoveInstance(nodeIndex);
+                MarkNeighborsDirty(nodeIndex);
+            }
+            SubdivideNode(nodeIndex, camera);
             return;
         }
-        node.inFrustum = true;
 
-        // 计算到相机的距离
-        XMFLOAT3 camPos = camera.GetPosition();
-        f32 dx = node.center.x - camPos.x;
-        f32 dz = node.center.y - camPos.z;  // center.y 是 world Z
-        node.distanceToCamera = std::sqrt(dx * dx + dz * dz);
+        // 被剔除的子树整体回收
+        if (!visible)
+        {
+            FreeChildren(nodeIndex);
+            MarkNeighborsDirty(nodeIndex);
+            return;
+        }
 
-        // 检查是否需要细分
-        if (!ShouldSubdivide(node, camera))
+        // 先更新子节点，可合并的子树自底向上逐层合并
+        const u32 childMask = CullChildren(m_Nodes[nodeIndex]);
+        for (u32 i = 0; i < 4; ++i)
         {
-            node.isLeaf = true;
+            UpdateNode(m_Nodes[nodeIndex].childIndices[i], (childMask >> i) & 1, camera);
+        }
+
+        const OceanQuadNode& node = m_Nodes[nodeIndex];
+        if (ShouldSubdivide(node, camera))
             return;
+        for (u32 childIndex : node.childIndices)
+        {
+            if (!m_Nodes[childIndex].isLeaf)
+                return;
         }
+        if (!CanMerge(nodeIndex))
+            return;
 
-        // 细分节点
+        FreeChildren(nodeIndex);
+        AddInstance(nodeIndex);
+        MarkNeighborsDirty(nodeIndex);
+    }
+
+    void OceanQuadTree::CreateChildren(u32 nodeIndex, const Camera& camera)
+    {
+        // 四个子节点在节点池中连续存放，优先复用合并时回收的块
+        u32 firstChild;
+        if (!m_FreeBlocks.empty())
+        {
+            firstChild = m_FreeBlocks.back();
+            m_FreeBlocks.pop_back();
+        }
+        else
+        {
+            firstChild = static_cast<u32>(m_Nodes.size());
+            m_Nodes.resize(m_Nodes.size() + 4);
+        }
+
+        // resize 可能导致 m_Nodes 重新分配，之后按索引访问
+        RemoveInstance(nodeIndex);
+        OceanQuadNode& node = m_Nodes[nodeIndex];
         node.isLeaf = false;
+        const u32 childMask = CullChildren(node);
+
+        const XMFLOAT2 center = node.center;
+        const u32 childLod = node.lod - 1;
         f32 childSize = node.size * 0.5f;
         f32 offset = childSize * 0.5f;
 
@@ -208,25 +290,84 @@ namespace Sea
             {  offset,  offset }   // 右上
         };
 
-        for (int i = 0; i < 4; ++i)
+        for (u32 i = 0; i < 4; ++i)
         {
-            OceanQuadNode child;
+            const u32 childIndex = firstChild + i;
+            node.childIndices[i] = childIndex;
+
+            OceanQuadNode& child = m_Nodes[childIndex];
             child.center = {
-                node.center.x + offsets[i].x,
-                node.center.y + offsets[i].y
+                center.x + offsets[i].x,
+                center.y + offsets[i].y
             };
             child.size = childSize;
-            child.lod = node.lod - 1;
+            child.lod = childLod;
             child.isLeaf = true;
-            child.inFrustum = true;
+            child.instanceIndex = INVALID_NODE;
+            child.dirty = false;
+            UpdateNodeVisibility(child, (childMask >> i) & 1, camera);
 
-            u32 childIndex = static_cast<u32>(m_Nodes.size());
-            node.childIndices[i] = childIndex;
-            m_Nodes.push_back(child);
+            if (child.inFrustum)
+                AddInstance(childIndex);
+        }
+
+        MarkNeighborsDirty(nodeIndex);
+    }
 
-            // 递归细分子节点
-            SubdivideNode(childIndex, camera);
+    void OceanQuadTree::FreeChildren(u32 nodeIndex)
+    {
+        for (u32 childIndex : m_Nodes[nodeIndex].childIndices)
+        {
+            if (!m_Nodes[childIndex].isLeaf)
+                FreeChildren(childIndex);
+            RemoveInstance(childIndex);
+
+            // 回收的节点不再参与任何查找
+            m_Nodes[childIndex].isLeaf = true;
+            m_Nodes[childIndex].inFrustum = false;
+        }
+
+        m_FreeBlocks.push_back(m_Nodes[nodeIndex].childIndices[0]);
+        m_Nodes[nodeIndex].isLeaf = true;
+    }
+
+    bool OceanQuadTree::CanMerge(u32 nodeIndex) const
+    {
+        // 合并后这里变成 node 层级的叶子：同层级的邻居如果还有孙节点，就会与它相差两级以上
+        // 保守地检查邻居的全部子节点，不满足时保留子树（BalanceTree 强制细分的节点在这里等到邻居变粗后再合并）
+        static constexpr i32 directions[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+        const OceanQuadNode& node = m_Nodes[nodeIndex];
+        for (const auto& dir : directions)
+        {
+            const u32 neighborIndex = FindNeighborNode(node, dir[0], dir[1]);
+            if (neighborIndex == INVALID_NODE || m_Nodes[neighborIndex].isLeaf)
+                continue;
+
+            for (u32 childIndex : m_Nodes[neighborIndex].childIndices)
+            {
+                const OceanQuadNode& child = m_Nodes[childIndex];
+                if (!child.isLeaf && child.inFrustum)
+                    return false;
+            }
         }
+        return true;
+    }
+
+    void OceanQuadTree::UpdateNodeVisibility(OceanQuadNode& node, bool inFrustum, const Camera& camera) const
+    {
+        // 相机到节点 AABB 的最近距离（海平面 y = 0），相机高度也计入
+        XMFLOAT3 camPos = camera.GetPosition();
+        f32 halfSize = node.size * 0.5f;
+        f32 dx = std::max(std::abs(node.center.x - camPos.x) - halfSize, 0.0f);
+        f32 dz = std::max(std::abs(node.center.y - camPos.z) - halfSize, 0.0f);  // center.y 是 world Z
+        node.distanceToCamera = std::sqrt(dx * dx + camPos.y * camPos.y + dz * dz);
+
+        // 视锥体测试的结果，再加上最大渲染距离（相机飞出海面很远时整块剔除）
+        f32 dist = std::sqrt((node.center.x - camPos.x) * (node.center.x - camPos.x) +
+                             (node.center.y - camPos.z) * (node.center.y - camPos.z));
+        f32 maxRenderDistance = m_Config.worldSize * 1.5f;
+        node.inFrustum = inFrustum && dist <= maxRenderDistance + node.size * 0.707f;  // 对角线距离
     }
 
     bool OceanQuadTree::ShouldSubdivide(const OceanQuadNode& node, const Camera& camera) const
@@ -235,9 +376,53 @@ namespace Sea
         if (node.lod == 0)
             return false;
 
-        // 基于距离的 LOD 判断
-        f32 lodDistance = CalculateLODDistance(node.lod);
-        return node.distanceToCamera < lodDistance;
+        // CDLOD：节点与下一级（更细）的范围球相交时细分
+        return node.distanceToCamera < m_LODRanges[node.lod - 1];
+    }
+
+    void OceanQuadTree::BalanceTree(const Camera& camera)
+    {
+        // 按距离选出的叶子在范围环带比节点小的地方可能与邻居相差多级，着色器的边缘缝合只能对齐相差一级的网格
+        // 检查每个可见叶子的四个方向：邻居比它粗两级以上时把邻居细分一次，新叶子入队继续检查
+        // 每次细分都让树更深，最多细分到 maxLOD 层，一定会终止
+        // 只需从本次新增或邻居有变化的叶子（m_DirtyNodes）开始：其余相邻叶子对上一次已经满足约束
+        static constexpr i32 directions[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+        m_ForcedSplitCount = 0;
+        std::vector<u32> pending = m_DirtyNodes;
+
+        while (!pending.empty())
+        {
+            const u32 index = pending.back();
+            pending.pop_back();
+
+            // 入队后可能已作为别的叶子的邻居被细分
+            if (!m_Nodes[index].isLeaf || !m_Nodes[index].inFrustum)
+                continue;
+
+            for (const auto& dir : directions)
+            {
+                const u32 neighborIndex = FindNeighborNode(m_Nodes[index], dir[0], dir[1]);
+                if (neighborIndex == INVALID_NODE)
+                    continue;
+
+                const OceanQuadNode& neighbor = m_Nodes[neighborIndex];
+                if (!neighbor.isLeaf || !neighbor.inFrustum || neighbor.lod <= m_Nodes[index].lod + 1)
+                    continue;
+
+                CreateChildren(neighborIndex, camera);
+                m_ForcedSplitCount++;
+                for (u32 childIndex : m_Nodes[neighborIndex].childIndices)
+                {
+                    if (m_Nodes[childIndex].inFrustum)
+                        pending.push_back(childIndex);
+                }
+
+                // 邻居只细了一级，可能仍然过粗，重新检查当前叶子
+                pending.push_back(index);
+                break;
+            }
+        }
     }
 
     f32 OceanQuadTree::CalculateLODDistance(u32 lod) const
@@ -252,147 +437,282 @@ namespace Sea
         return distance;
     }
 
-    bool OceanQuadTree::IsInFrustum(const XMFLOAT2& center, f32 size, const Camera& camera) const
+    bool OceanQuadTree::IsInFrustum(const OceanQuadNode& node) const
     {
-        // 简单的 AABB-视锥体检测
-        // 完整实现需要提取视锥体平面
-        // 这里使用简化版本：基于到相机的距离
-        
-        XMFLOAT3 camPos = camera.GetPosition();
-        f32 dx = center.x - camPos.x;
-        f32 dz = center.y - camPos.z;
-        f32 dist = std::sqrt(dx * dx + dz * dz);
+        if (!m_Config.enableFrustumCulling)
+            return true;
+
+        // 节点的包围盒：海平面上的正方形，上下与四周按所有级联的波浪位移扩大
+        f32 waveHeight, waveHorizontal;
+        GetWavePadding(0.0f, waveHeight, waveHorizontal);
+        const f32 extentXZ = node.size * 0.5f + waveHorizontal + m_CullMargin;
+        return m_Frustum.IntersectsAABB({ node.center.x, 0.0f, node.center.y },
+                                        { extentXZ, waveHeight + m_CullMargin, extentXZ });
+    }
 
-        // 如果距离太远，剔除
-        f32 maxRenderDistance = m_Config.worldSize * 1.5f;
-        if (dist > maxRenderDistance + size * 0.707f)  // 对角线距离
-            return false;
+    u32 OceanQuadTree::CullChildren(const OceanQuadNode& node) const
+    {
+        if (!m_Config.enableFrustumCulling)
+            return 0xF;
+
+        // 四个子节点的中心按 SoA 放进四个通道（顺序与 CreateChildren 一致：bit0 = +x，bit1 = +z），每个平面一次测试四个
+        // 子节点大小相同、中心都在海平面上，包围盒在平面法线上的投影半径对四个子节点是同一个标量
+        const f32 offset = node.size * 0.25f;
+        const XMVECTOR centerX = XMVectorAdd(XMVectorReplicate(node.center.x), XMVectorSet(-offset, offset, -offset, offset));
+        const XMVECTOR centerZ = XMVectorAdd(XMVectorReplicate(node.center.y), XMVectorSet(-offset, -offset, offset, offset));
+
+        // 父节点离相机更近，按它的距离选级联对子节点是保守的
+        f32 waveHeight, waveHorizontal;
+        GetWavePadding(node.distanceToCamera, waveHeight, waveHorizontal);
+        const f32 extentXZ = offset + waveHorizontal;
+
+        XMVECTOR outside = XMVectorFalseInt();
+        for (u32 i = 0; i < Frustum::Count; ++i)
+        {
+            const XMFLOAT4& plane = m_Frustum.GetPlane(i);
+            const f32 radius = (std::abs(plane.x) + std::abs(plane.z)) * extentXZ + std::abs(plane.y) * waveHeight + m_CullMargin;
+            const XMVECTOR distance = XMVectorMultiplyAdd(XMVectorReplicate(plane.x), centerX,
+                                                          XMVectorMultiplyAdd(XMVectorReplicate(plane.z), centerZ, XMVectorReplicate(plane.w)));
+            outside = XMVectorOrInt(outside, XMVectorLess(distance, XMVectorReplicate(-radius)));
+        }
 
-        return true;
+        u32 outsideLanes[4];
+        XMStoreInt4(outsideLanes, outside);
+        u32 mask = 0;
+        for (u32 i = 0; i < 4; ++i)
+        {
+            if (outsideLanes[i] == 0)
+                mask |= 1u << i;
+        }
+        return mask;
     }
 
-    void OceanQuadTree::CollectLeafNodes()
+    void OceanQuadTree::GetWavePadding(f32 distance, f32& outHeight, f32& outHorizontal) const
     {
-        m_LeafNodeIndices.clear();
-        m_RenderInstances.clear();
+        outHeight = 0.0f;
+        outHorizontal = 0.0f;
+        for (const OceanWaveCascadeBounds& cascade : m_WaveBounds)
+        {
+            if (cascade.fadeDistance > 0.0f && distance >= cascade.fadeDistance)
+                continue;
+            outHeight += cascade.maxHeight;
+            outHorizontal += cascade.maxHorizontal;
+        }
+    }
+
+    void OceanQuadTree::AddInstance(u32 nodeIndex)
+    {
+        m_Nodes[nodeIndex].instanceIndex = static_cast<u32>(m_LeafNodeIndices.size());
+        m_LeafNodeIndices.push_back(nodeIndex);
+        m_RenderInstances.emplace_back();
+        m_InstanceDirty.push_back(1);
+        MarkDirty(nodeIndex);
+    }
 
-        for (u32 i = 0; i < m_Nodes.size(); ++i)
+    void OceanQuadTree::RemoveInstance(u32 nodeIndex)
+    {
+        const u32 slot = m_Nodes[nodeIndex].instanceIndex;
+        if (slot == INVALID_NODE)
+            return;
+
+        // 用最后一个实例填补空位，只有被移动的那个实例需要重新上传
+        const u32 last = static_cast<u32>(m_LeafNodeIndices.size()) - 1;
+        if (slot != last)
         {
-            const OceanQuadNode& node = m_Nodes[i];
-            if (node.isLeaf && node.inFrustum)
-            {
-                m_LeafNodeIndices.push_back(i);
-
-                OceanQuadInstance instance;
-                instance.positionScale = {
-                    node.center.x,
-                    0.0f,  // Y position
-                    node.center.y,  // World Z
-                    node.size
-                };
-
-                // 计算变形因子
-                f32 lodDistance = CalculateLODDistance(node.lod);
-                f32 nextLodDistance = node.lod > 0 ? CalculateLODDistance(node.lod - 1) : 0.0f;
-                f32 morphStart = nextLodDistance + (lodDistance - nextLodDistance) * (1.0f - m_Config.morphRange);
-                f32 morphFactor = 0.0f;
-                if (m_Config.enableMorphing && node.distanceToCamera > morphStart)
-                {
-                    morphFactor = Saturate((node.distanceToCamera - morphStart) / (lodDistance - morphStart));
-                }
+            const u32 movedNode = m_LeafNodeIndices[last];
+            m_LeafNodeIndices[slot] = movedNode;
+            m_RenderInstances[slot] = m_RenderInstances[last];
+            m_InstanceDirty[slot] = 1;
+            m_Nodes[movedNode].instanceIndex = slot;
+        }
 
-                instance.lodMorph = {
-                    static_cast<f32>(node.lod),
-                    morphFactor,
-                    0.0f,
-                    0.0f
-                };
+        m_LeafNodeIndices.pop_back();
+        m_RenderInstances.pop_back();
+        m_InstanceDirty.pop_back();
+        m_Nodes[nodeIndex].instanceIndex = INVALID_NODE;
+    }
 
-                // 邻居 LOD 将在 CalculateNeighborLODs 中填充
-                instance.neighborLOD = { 0.0f, 0.0f, 0.0f, 0.0f };
+    void OceanQuadTree::MarkDirty(u32 nodeIndex)
+    {
+        OceanQuadNode& node = m_Nodes[nodeIndex];
+        if (!node.dirty)
+        {
+            node.dirty = true;
+            m_DirtyNodes.push_back(nodeIndex);
+        }
+    }
 
-                m_RenderInstances.push_back(instance);
-            }
+    void OceanQuadTree::MarkNeighborsDirty(u32 nodeIndex)
+    {
+        // 节点所在区域的叶子结构变了：四条边外侧紧邻的叶子（可能更粗、同级或更细）的邻居 LOD 需要重新计算
+        if (m_Rebuilding)
+            return;
+
+        static constexpr i32 directions[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        for (const auto& dir : directions)
+        {
+            const u32 neighborIndex = FindNeighborNode(m_Nodes[nodeIndex], dir[0], dir[1]);
+            if (neighborIndex != INVALID_NODE)
+                MarkEdgeLeavesDirty(neighborIndex, dir[0], dir[1]);
         }
     }
 
-    void OceanQuadTree::CalculateNeighborLODs()
+    void OceanQuadTree::MarkEdgeLeavesDirty(u32 nodeIndex, i32 dirX, i32 dirZ)
     {
-        // 为每个叶子节点计算邻居的 LOD
-        // 这用于边缘缝合，防止 T-junction 裂缝
-        
-        for (size_t i = 0; i < m_LeafNodeIndices.size(); ++i)
+        const OceanQuadNode& node = m_Nodes[nodeIndex];
+        if (node.isLeaf)
         {
-            u32 nodeIdx = m_LeafNodeIndices[i];
-            const OceanQuadNode& node = m_Nodes[nodeIdx];
-            OceanQuadInstance& instance = m_RenderInstances[i];
-
-            // 四个方向的邻居偏移
-            XMFLOAT2 neighborOffsets[4] = {
-                { -node.size, 0.0f },   // 左
-                {  node.size, 0.0f },   // 右
-                { 0.0f, -node.size },   // 下
-                { 0.0f,  node.size }    // 上
-            };
+            if (node.inFrustum)
+                MarkDirty(nodeIndex);
+            return;
+        }
 
-            for (int dir = 0; dir < 4; ++dir)
-            {
-                XMFLOAT2 neighborCenter = {
-                    node.center.x + neighborOffsets[dir].x,
-                    node.center.y + neighborOffsets[dir].y
-                };
+        // 邻居在 (dirX, dirZ) 方向上，只有它朝向我们那一侧的子节点与我们相邻（bit0 = +x，bit1 = +z）
+        for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+        {
+            const u32 xbit = quadrant & 1;
+            const u32 zbit = quadrant >> 1;
+            if ((dirX < 0 && xbit == 0) || (dirX > 0 && xbit == 1) || (dirZ < 0 && zbit == 0) || (dirZ > 0 && zbit == 1))
+                continue;
+            MarkEdgeLeavesDirty(node.childIndices[quadrant], dirX, dirZ);
+        }
+    }
 
-                // 查找该位置的叶子节点
-                f32 neighborLOD = static_cast<f32>(node.lod);  // 默认相同 LOD
+    OceanQuadInstance OceanQuadTree::BuildInstance(const OceanQuadNode& node) const
+    {
+        OceanQuadInstance instance;
+        instance.positionScale = {
+            node.center.x,
+            0.0f,  // Y position
+            node.center.y,  // World Z
+            node.size
+        };
 
-                for (size_t j = 0; j < m_LeafNodeIndices.size(); ++j)
-                {
-                    if (i == j) continue;
-                    const OceanQuadNode& other = m_Nodes[m_LeafNodeIndices[j]];
-
-                    // 检查是否相邻
-                    f32 dx = std::abs(other.center.x - neighborCenter.x);
-                    f32 dz = std::abs(other.center.y - neighborCenter.y);
-                    f32 tolerance = (node.size + other.size) * 0.5f * 0.1f;
-
-                    if (dx < tolerance && dz < tolerance)
-                    {
-                        neighborLOD = static_cast<f32>(other.lod);
-                        break;
-                    }
-                }
+        // 变形区间在本级范围环带的外侧 morphRange 部分，到达本级范围时完全变成上一级网格
+        // 着色器按顶点到相机的距离在 [morphStart, morphEnd] 内连续插值；最粗一级没有上一级可变
+        // 实例只存与相机无关的常量，相机移动时不需要重新上传
+        f32 morphStart = 0.0f;
+        f32 morphEnd = 0.0f;
+        f32 morphScale = 0.0f;
+        if (m_Config.enableMorphing && m_Config.morphRange > 0.0f && node.lod < m_Config.maxLOD)
+        {
+            f32 lodDistance = m_LODRanges[node.lod];
+            f32 nextLodDistance = node.lod > 0 ? m_LODRanges[node.lod - 1] : 0.0f;
+            morphEnd = lodDistance;
+            morphStart = lodDistance - (lodDistance - nextLodDistance) * m_Config.morphRange;
+            morphScale = 1.0f / (morphEnd - morphStart);
+        }
 
-                // 存储邻居 LOD
-                switch (dir)
-                {
-                case 0: instance.neighborLOD.x = neighborLOD; break;
-                case 1: instance.neighborLOD.y = neighborLOD; break;
-                case 2: instance.neighborLOD.z = neighborLOD; break;
-                case 3: instance.neighborLOD.w = neighborLOD; break;
-                }
-            }
+        instance.lodMorph = {
+            static_cast<f32>(node.lod),
+            morphScale,
+            morphStart,
+            morphEnd
+        };
+
+        // 邻居的 LOD 用于边缘缝合，防止 T-junction 裂缝（着色器只在邻居更粗时把边上的顶点对齐到邻居）
+        instance.neighborLOD = {
+            static_cast<f32>(FindNeighborLOD(node, -1, 0)),    // 左
+            static_cast<f32>(FindNeighborLOD(node, 1, 0)),     // 右
+            static_cast<f32>(FindNeighborLOD(node, 0, -1)),    // 下
+            static_cast<f32>(FindNeighborLOD(node, 0, 1))      // 上
+        };
+        return instance;
+    }
+
+    void OceanQuadTree::UpdateInstances()
+    {
+        // 去重：同一节点可能被多次标记，失效的（已被细分、合并或剔除的）节点直接跳过
+        m_UpdateList.clear();
+        for (u32 nodeIndex : m_DirtyNodes)
+        {
+            OceanQuadNode& node = m_Nodes[nodeIndex];
+            if (!node.dirty)
+                continue;
+            node.dirty = false;
+            if (node.instanceIndex != INVALID_NODE)
+                m_UpdateList.push_back(nodeIndex);
         }
+        m_DirtyNodes.clear();
+
+        // 只有新叶子与邻居有变化的叶子需要重算；每个叶子只写自己的实例，按叶子并行
+        const u32 updateCount = static_cast<u32>(m_UpdateList.size());
+        JobSystem::RunParallelFor(updateCount, LEAF_BATCH_SIZE, [this](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+            {
+                const OceanQuadNode& node = m_Nodes[m_UpdateList[i]];
+                m_RenderInstances[node.instanceIndex] = BuildInstance(node);
+                m_InstanceDirty[node.instanceIndex] = 1;
+            }
+        });
     }
 
-    void OceanQuadTree::UpdateInstanceBuffer()
+    u32 OceanQuadTree::FindNeighborLOD(const OceanQuadNode& node, i32 dirX, i32 dirZ) const
     {
-        if (m_RenderInstances.empty())
-            return;
+        const u32 index = FindNeighborNode(node, dirX, dirZ);
+        if (index == INVALID_NODE)
+            return node.lod;
 
-        m_InstanceBuffer->Update(
-            m_RenderInstances.data(),
-            sizeof(OceanQuadInstance) * m_RenderInstances.size()
-        );
+        // 同层级的节点：邻居同级或更细，由更细的一侧负责缝合
+        const OceanQuadNode& neighbor = m_Nodes[index];
+        return (neighbor.isLeaf && neighbor.inFrustum && neighbor.lod > node.lod) ? neighbor.lod : node.lod;
     }
 
-    u32 OceanQuadTree::GetLeafCount() const
+    u32 OceanQuadTree::FindNeighborNode(const OceanQuadNode& node, i32 dirX, i32 dirZ) const
     {
-        u32 count = 0;
-        for (const auto& node : m_Nodes)
+        // 节点在自身层级上的整数格坐标：第 depth 层把海面分成 2^depth × 2^depth 格
+        const u32 depth = m_Config.maxLOD - node.lod;
+        const i64 cellCount = 1ll << depth;
+        const f32 halfWorld = m_Config.worldSize * 0.5f;
+        const i64 x = static_cast<i64>(std::floor((node.center.x + halfWorld) / node.size)) + dirX;
+        const i64 z = static_cast<i64>(std::floor((node.center.y + halfWorld) / node.size)) + dirZ;
+        if (x < 0 || z < 0 || x >= cellCount || z >= cellCount)
+            return INVALID_NODE;
+
+        // 从根节点按象限向下，格坐标的第 (depth - 1 - level) 位决定该层的子节点
+        // 子节点顺序与 SubdivideNode 一致：bit0 = +x，bit1 = +z
+        u32 index = m_RootNodeIndex;
+        for (u32 level = 0; level < depth; ++level)
         {
-            if (node.isLeaf && node.inFrustum)
-                ++count;
+            const OceanQuadNode& current = m_Nodes[index];
+            if (current.isLeaf)
+                return index;
+
+            const u32 shift = depth - 1 - level;
+            const u32 quadrant = static_cast<u32>((x >> shift) & 1) | (static_cast<u32>((z >> shift) & 1) << 1);
+            index = current.childIndices[quadrant];
         }
-        return count;
+
+        return index;
+    }
+
+    void OceanQuadTree::GetDirtyRanges(std::vector<OceanInstanceRange>& outRanges) const
+    {
+        // 相邻的脏区间间隔不超过 INSTANCE_PATCH_GAP 时合并成一段，多拷贝几个干净的实例换更少的拷贝次数
+        outRanges.clear();
+        const u32 instanceCount = GetInstanceCount();
+        for (u32 begin = 0; begin < instanceCount;)
+        {
+            if (!m_InstanceDirty[begin])
+            {
+                ++begin;
+                continue;
+            }
+
+            u32 last = begin;
+            for (u32 i = begin + 1; i < instanceCount && i - last <= INSTANCE_PATCH_GAP; ++i)
+            {
+                if (m_InstanceDirty[i])
+                    last = i;
+            }
+
+            outRanges.push_back({ begin, last - begin + 1 });
+            begin = last + 1;
+        }
+    }
+
+    void OceanQuadTree::ClearInstanceDirty()
+    {
+        std::fill(m_InstanceDirty.begin(), m_InstanceDirty.end(), u8(0));
     }
 }
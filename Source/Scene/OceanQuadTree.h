@@ -1,10 +1,11 @@
 #pragma once
 #include "Core/Types.h"
-#include "Graphics/Device.h"
-#include "Graphics/Buffer.h"
-#include "Scene/Mesh.h"
 #include "Scene/Camera.h"
+#include "Scene/Frustum.h"
 #include <DirectXMath.h>
+#include <algorithm>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace Sea
@@ -22,7 +23,11 @@ namespace Sea
         
         // 边界检测用
         bool inFrustum;        // 是否在视锥体内
-        f32 distanceToCamera;  // 到相机的距离
+        f32 distanceToCamera;  // 相机到节点 AABB（海平面上的正方形）的最近距离
+
+        // 增量更新用
+        u32 instanceIndex;     // 可见叶子在实例数组中的位置 (~0u = 没有实例)
+        bool dirty;            // 已在待重算列表中
     };
 
     // 四叉树配置
@@ -32,83 +37,162 @@ namespace Sea
         u32 maxLOD = 6;                 // 最大 LOD 级别 (0-6, 共7级)
         u32 baseMeshResolution = 32;    // 基础网格分辨率 (每个节点的顶点数)
         f32 lodDistanceMultiplier = 2.0f;  // LOD 距离倍增系数
-        f32 lodBaseDistance = 50.0f;    // LOD 0 的距离阈值
+        f32 lodBaseDistance = 50.0f;    // LOD 0 的可见范围（以相机为球心的半径）
         bool enableMorphing = true;     // 是否启用 LOD 过渡（变形）
-        f32 morphRange = 0.3f;          // 变形范围 (0-1, 节点大小的比例)
+        f32 morphRange = 0.3f;          // 变形范围 (0-1, 占本级范围环带宽度的比例)
+        bool enableFrustumCulling = true;  // 用相机视锥体剔除节点（包围盒按波浪最大位移扩大）
     };
 
+    // 一个波浪级联的位移上界（米），用于扩大节点包围盒
+    // fadeDistance > 0 时该级联在离相机这么远处完全淡出，更远的节点不需要为它留余量
+    struct OceanWaveCascadeBounds
+    {
+        f32 maxHeight = 0.0f;
+        f32 maxHorizontal = 0.0f;
+        f32 fadeDistance = 0.0f;
+    };
+
+    constexpr u32 OCEAN_WAVE_CASCADE_COUNT = 3;
+
+    // OceanQuadTree_VS.hlsl 中三个 Gerstner 级联在给定锐度下的位移上界
+    std::array<OceanWaveCascadeBounds, OCEAN_WAVE_CASCADE_COUNT> ComputeGerstnerWaveBounds(f32 choppiness);
+
     // 渲染数据 - 传递给 GPU
     struct OceanQuadInstance
     {
         XMFLOAT4 positionScale;  // xyz = 世界位置, w = 缩放
-        XMFLOAT4 lodMorph;       // x = LOD, y = morph factor, zw = reserved
+        XMFLOAT4 lodMorph;       // x = LOD, y = 1 / (w - z) (0 表示不变形), z/w = 变形区间的起止距离
         XMFLOAT4 neighborLOD;    // 四个邻居的 LOD (用于缝合)
     };
 
+    // 需要上传的一段连续实例
+    struct OceanInstanceRange
+    {
+        u32 begin;
+        u32 count;
+    };
+
+    // 海面四叉树的 CPU 部分：节点选择、剔除与实例数据，不依赖 GPU（基础网格与实例缓冲区见 OceanQuadTreeMesh）
     class OceanQuadTree
     {
     public:
-        OceanQuadTree(Device& device);
+        static constexpr u32 INVALID_NODE = ~0u;
+
+        OceanQuadTree() = default;
         ~OceanQuadTree() = default;
 
         bool Initialize(const OceanQuadTreeConfig& config = OceanQuadTreeConfig());
         void Shutdown();
 
-        // 每帧更新 - 根据相机位置重建四叉树
-        void Update(const Camera& camera);
+        // 每帧更新 - 根据相机位置增量更新四叉树；树有变化时返回 true
+        bool Update(const Camera& camera);
 
-        // 获取渲染实例
+        // 不经过 Update 的移动距离门限：完整重建 / 沿用上一次的树只分裂与合并，之后用 UpdateInstances 重算实例
+        void BuildTree(const Camera& camera);
+        void UpdateTree(const Camera& camera);
+        void UpdateInstances();
+
+        // 波浪位移上界，视锥体剔除时把节点包围盒向上下与四周扩大这么多；改变后下一次 Update 重新剔除
+        void SetWaveBounds(std::span<const OceanWaveCascadeBounds> cascades);
+
+        // 获取渲染实例（顺序不固定：增量更新时删除的实例由最后一个填补）
         const std::vector<OceanQuadInstance>& GetRenderInstances() const { return m_RenderInstances; }
         u32 GetInstanceCount() const { return static_cast<u32>(m_RenderInstances.size()); }
 
-        // 获取基础网格 (所有实例共享)
-        Mesh* GetBaseMesh() const { return m_BaseMesh.get(); }
-
-        // 获取实例缓冲区
-        Buffer* GetInstanceBuffer() const { return m_InstanceBuffer.get(); }
+        // 上次清除以来变化的实例，间隔不超过 INSTANCE_PATCH_GAP 的合并成一段
+        void GetDirtyRanges(std::vector<OceanInstanceRange>& outRanges) const;
+        void ClearInstanceDirty();
 
         // 配置
         OceanQuadTreeConfig& GetConfig() { return m_Config; }
         const OceanQuadTreeConfig& GetConfig() const { return m_Config; }
 
+        // 只读的树结构（节点池中有回收的节点，从根节点遍历才是当前的树），用于测试与调试
+        const std::vector<OceanQuadNode>& GetNodes() const { return m_Nodes; }
+        const std::vector<u32>& GetLeafNodeIndices() const { return m_LeafNodeIndices; }
+        u32 GetRootNodeIndex() const { return m_RootNodeIndex; }
+        f32 GetLODRange(u32 lod) const { return m_LODRanges[lod]; }
+
+        // 按当前配置与树从头计算一个叶子的实例
+        OceanQuadInstance BuildInstance(const OceanQuadNode& node) const;
+        // 离相机 distance 处仍起作用的级联的位移之和
+        void GetWavePadding(f32 distance, f32& outHeight, f32& outHorizontal) const;
+
         // 调试信息
-        u32 GetNodeCount() const { return static_cast<u32>(m_Nodes.size()); }
-        u32 GetLeafCount() const;
+        u32 GetNodeCount() const { return static_cast<u32>(m_Nodes.size() - m_FreeBlocks.size() * 4); }
+        u32 GetLeafCount() const { return static_cast<u32>(m_LeafNodeIndices.size()); }
+        u32 GetForcedSplitCount() const { return m_ForcedSplitCount; }
+        u32 GetTriangleCount() const { return GetInstanceCount() * m_Config.baseMeshResolution * m_Config.baseMeshResolution * 2; }
 
     private:
-        void BuildTree(const Camera& camera);
+        void UpdateNode(u32 nodeIndex, bool inFrustum, const Camera& camera);
+        void UpdateLODRanges();
+        void UpdateFrustum(const Camera& camera);
         void SubdivideNode(u32 nodeIndex, const Camera& camera);
+        void CreateChildren(u32 nodeIndex, const Camera& camera);
+        void FreeChildren(u32 nodeIndex);
+        // 合并后不会与邻居相差两级以上
+        bool CanMerge(u32 nodeIndex) const;
+        void UpdateNodeVisibility(OceanQuadNode& node, bool inFrustum, const Camera& camera) const;
         bool ShouldSubdivide(const OceanQuadNode& node, const Camera& camera) const;
+        // 受限四叉树：细分过粗的叶子，直到相邻的可见叶子最多相差一级
+        void BalanceTree(const Camera& camera);
         f32 CalculateLODDistance(u32 lod) const;
-        void CollectLeafNodes();
-        void CalculateNeighborLODs();
-        void UpdateInstanceBuffer();
-        bool CreateBaseMesh();
 
-        // 视锥体剔除
-        bool IsInFrustum(const XMFLOAT2& center, f32 size, const Camera& camera) const;
+        // 实例槽位：可见叶子各占一个，删除时用最后一个填补
+        void AddInstance(u32 nodeIndex);
+        void RemoveInstance(u32 nodeIndex);
+        void MarkDirty(u32 nodeIndex);
+        // 节点区域的叶子结构变化后，标记四条边外紧邻的可见叶子
+        void MarkNeighborsDirty(u32 nodeIndex);
+        void MarkEdgeLeavesDirty(u32 nodeIndex, i32 dirX, i32 dirZ);
+        // 与 node 同层级、在 (dirX, dirZ) 方向相邻的区域：返回覆盖它的更粗的叶子，或同层级的节点；
+        // 超出海面范围时返回 INVALID_NODE
+        u32 FindNeighborNode(const OceanQuadNode& node, i32 dirX, i32 dirZ) const;
+        // 邻居是更粗的可见叶子时返回它的 LOD，否则（同级、更细、被剔除或在海面之外）返回 node.lod
+        u32 FindNeighborLOD(const OceanQuadNode& node, i32 dirX, i32 dirZ) const;
+
+        // 视锥体剔除：单个节点（根节点）与一个节点的四个子节点（一次 SIMD 测试，返回 4 位可见掩码）
+        bool IsInFrustum(const OceanQuadNode& node) const;
+        u32 CullChildren(const OceanQuadNode& node) const;
 
     private:
-        Device& m_Device;
+        static constexpr u32 LEAF_BATCH_SIZE = 64;   // 叶子处理的并行粒度
+        static constexpr u32 INSTANCE_PATCH_GAP = 8; // 脏实例间隔不超过这么多个时合并成一次拷贝
+
         OceanQuadTreeConfig m_Config;
 
         // 节点池
         std::vector<OceanQuadNode> m_Nodes;
+        std::vector<u32> m_FreeBlocks;    // 合并时回收的子节点块（4 个连续节点的首个索引）
         u32 m_RootNodeIndex = 0;
 
-        // 叶子节点索引 (用于渲染)
+        // 每级的可见范围，每次更新时按配置计算
+        std::vector<f32> m_LODRanges;
+        u32 m_ForcedSplitCount = 0;       // 上次更新中为满足 2:1 约束额外细分的节点数
+
+        // 增量更新：需要重算实例的节点（新叶子及其邻居），以及需要上传的实例槽位
+        std::vector<u32> m_DirtyNodes;
+        std::vector<u32> m_UpdateList;
+        std::vector<u8> m_InstanceDirty;
+        bool m_Rebuilding = false;        // 完整重建时所有叶子都是新的，不用逐个标记邻居
+
+        // 叶子节点索引，与 m_RenderInstances 一一对应
         std::vector<u32> m_LeafNodeIndices;
 
         // 渲染实例数据
         std::vector<OceanQuadInstance> m_RenderInstances;
 
-        // GPU 资源
-        Scope<Mesh> m_BaseMesh;           // 基础网格 (所有实例共享)
-        Scope<Buffer> m_InstanceBuffer;   // 实例数据缓冲区
+        // 剔除用的视锥体，每次更新时从相机提取
+        Frustum m_Frustum;
+        std::vector<OceanWaveCascadeBounds> m_WaveBounds;
+        f32 m_CullMargin = 0.0f;          // 相机在更新门限内平移时，平面最多移动这么远
 
         // 缓存的相机数据
         XMFLOAT3 m_LastCameraPos = { 0, 0, 0 };
-        XMFLOAT4X4 m_LastViewProj = {};
+        XMFLOAT3 m_LastCameraForward = { 0, 0, 0 };
+        XMFLOAT4X4 m_LastProjection = {};
         bool m_NeedsRebuild = true;
+        bool m_NeedsCull = false;         // 波浪位移上界改变，需要重新剔除
     };
 }
@@ -0,0 +1,174 @@
+#include "Scene/OceanQuadTreeMesh.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Sea
+{
+    OceanQuadTreeMesh::OceanQuadTreeMesh(Device& device)
+        : m_Device(device)
+    {
+    }
+
+    bool OceanQuadTreeMesh::Initialize(const OceanQuadTreeConfig& config)
+    {
+        if (!CreateBaseMesh(config.baseMeshResolution))
+        {
+            SEA_CORE_ERROR("OceanQuadTreeMesh: Failed to create base mesh");
+            return false;
+        }
+
+        // 初始容量按 4^maxLOD 个叶子估计，上限 4096；受限四叉树强制细分或配置更细时 UploadInstances 再扩容
+        u32 capacity = 1;
+        for (u32 i = 0; i < config.maxLOD && capacity < 4096; ++i)
+            capacity *= 4;
+        return CreateInstanceBuffer(capacity);
+    }
+
+    void OceanQuadTreeMesh::Shutdown()
+    {
+        m_BaseMesh.reset();
+        m_InstanceBuffer.reset();
+        m_RetiredBuffers.clear();
+        m_InstanceCapacity = 0;
+    }
+
+    bool OceanQuadTreeMesh::CreateBaseMesh(u32 resolution)
+    {
+        // 创建一个单位大小的网格，渲染时通过实例数据缩放和定位
+        const u32 res = resolution;
+        const f32 size = 1.0f;  // 单位大小
+        const f32 halfSize = size * 0.5f;
+        const f32 cellSize = size / static_cast<f32>(res);
+
+        std::vector<Vertex> vertices;
+        std::vector<u32> indices;
+
+        // 生成顶点
+        for (u32 z = 0; z <= res; ++z)
+        {
+            for (u32 x = 0; x <= res; ++x)
+            {
+                Vertex v;
+                v.position = {
+                    -halfSize + x * cellSize,
+                    0.0f,
+                    -halfSize + z * cellSize
+                };
+                v.normal = { 0.0f, 1.0f, 0.0f };
+                v.texCoord = {
+                    static_cast<f32>(x) / res,
+                    static_cast<f32>(z) / res
+                };
+                v.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+                vertices.push_back(v);
+            }
+        }
+
+        // 生成索引
+        for (u32 z = 0; z < res; ++z)
+        {
+            for (u32 x = 0; x < res; ++x)
+            {
+                u32 topLeft = z * (res + 1) + x;
+                u32 topRight = topLeft + 1;
+                u32 bottomLeft = (z + 1) * (res + 1) + x;
+                u32 bottomRight = bottomLeft + 1;
+
+                indices.push_back(topLeft);
+                indices.push_back(bottomLeft);
+                indices.push_back(topRight);
+
+                indices.push_back(topRight);
+                indices.push_back(bottomLeft);
+                indices.push_back(bottomRight);
+            }
+        }
+
+        m_BaseMesh = MakeScope<Mesh>();
+        if (!m_BaseMesh->CreateFromVertices(m_Device, vertices, indices))
+        {
+            SEA_CORE_ERROR("OceanQuadTreeMesh: Failed to create base mesh geometry");
+            return false;
+        }
+
+        SEA_CORE_INFO("OceanQuadTreeMesh: Created base mesh with {} vertices, {} triangles",
+                      vertices.size(), indices.size() / 3);
+        return true;
+    }
+
+    bool OceanQuadTreeMesh::CreateInstanceBuffer(u32 capacity)
+    {
+        // 每帧由 CPU 改写部分实例，放在上传堆里直接映射（默认堆的 Structured 缓冲区不能 Map）
+        BufferDesc instanceBufferDesc;
+        instanceBufferDesc.size = sizeof(OceanQuadInstance) * capacity;
+        instanceBufferDesc.type = BufferType::Upload;
+        instanceBufferDesc.stride = sizeof(OceanQuadInstance);
+        instanceBufferDesc.name = "OceanQuadTreeInstances";
+
+        auto buffer = MakeScope<Buffer>(m_Device, instanceBufferDesc);
+        if (!buffer->Initialize(nullptr))
+        {
+            SEA_CORE_ERROR("OceanQuadTreeMesh: Failed to create instance buffer ({} instances)", capacity);
+            return false;
+        }
+
+        if (m_InstanceBuffer)
+            m_RetiredBuffers.push_back({ std::move(m_InstanceBuffer), RETIRED_BUFFER_FRAMES });
+        m_InstanceBuffer = std::move(buffer);
+        m_InstanceCapacity = capacity;
+        return true;
+    }
+
+    void OceanQuadTreeMesh::UploadInstances(OceanQuadTree& tree)
+    {
+        for (RetiredBuffer& retired : m_RetiredBuffers)
+            retired.framesLeft--;
+        std::erase_if(m_RetiredBuffers, [](const RetiredBuffer& retired) { return retired.framesLeft == 0; });
+
+        m_PatchedInstanceCount = 0;
+        m_PatchRangeCount = 0;
+
+        // 叶子数超出容量：按 2 的幂扩容，新缓冲区里没有任何实例，全部重新上传
+        const u32 instanceCount = tree.GetInstanceCount();
+        bool uploadAll = false;
+        if (instanceCount > m_InstanceCapacity)
+        {
+            u32 capacity = std::max(m_InstanceCapacity, 1u);
+            while (capacity < instanceCount)
+                capacity *= 2;
+
+            SEA_CORE_WARN("OceanQuadTreeMesh: {} leaves exceed instance buffer capacity {}, growing to {}",
+                          instanceCount, m_InstanceCapacity, capacity);
+            if (!CreateInstanceBuffer(capacity))
+                return;
+            uploadAll = true;
+        }
+
+        if (uploadAll)
+            m_DirtyRanges.assign(1, { 0, instanceCount });
+        else
+            tree.GetDirtyRanges(m_DirtyRanges);
+        if (m_DirtyRanges.empty())
+            return;
+
+        u8* mapped = static_cast<u8*>(m_InstanceBuffer->Map());
+        if (!mapped)
+        {
+            SEA_CORE_ERROR("OceanQuadTreeMesh: Failed to map instance buffer");
+            return;
+        }
+
+        const std::vector<OceanQuadInstance>& instances = tree.GetRenderInstances();
+        for (const OceanInstanceRange& range : m_DirtyRanges)
+        {
+            memcpy(mapped + sizeof(OceanQuadInstance) * range.begin, &instances[range.begin],
+                   sizeof(OceanQuadInstance) * range.count);
+            m_PatchedInstanceCount += range.count;
+        }
+        m_PatchRangeCount = static_cast<u32>(m_DirtyRanges.size());
+
+        m_InstanceBuffer->Unmap();
+        tree.ClearInstanceDirty();
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Core/Types.h"
+#include "Graphics/Device.h"
+#include "Graphics/Buffer.h"
+#include "Scene/Mesh.h"
+#include "Scene/OceanQuadTree.h"
+#include <vector>
+
+namespace Sea
+{
+    // 海面四叉树的 GPU 资源：所有实例共享的基础网格与实例缓冲区
+    class OceanQuadTreeMesh : public NonCopyable
+    {
+    public:
+        OceanQuadTreeMesh(Device& device);
+        ~OceanQuadTreeMesh() = default;
+
+        bool Initialize(const OceanQuadTreeConfig& config);
+        void Shutdown();
+
+        // 上传 tree 中变化的实例；叶子数超出容量时扩大实例缓冲区并重新上传全部实例
+        void UploadInstances(OceanQuadTree& tree);
+
+        // 获取基础网格 (所有实例共享)
+        Mesh* GetBaseMesh() const { return m_BaseMesh.get(); }
+
+        // 获取实例缓冲区；扩容后是一个新的资源，容量变化时需要重新创建 SRV
+        Buffer* GetInstanceBuffer() const { return m_InstanceBuffer.get(); }
+        u32 GetInstanceCapacity() const { return m_InstanceCapacity; }
+
+        // 上次上传的实例数与区间数
+        u32 GetPatchedInstanceCount() const { return m_PatchedInstanceCount; }
+        u32 GetPatchRangeCount() const { return m_PatchRangeCount; }
+
+    private:
+        bool CreateBaseMesh(u32 resolution);
+        bool CreateInstanceBuffer(u32 capacity);
+
+    private:
+        static constexpr u32 RETIRED_BUFFER_FRAMES = 3;   // 与 FrameResourceManager::kMaxFramesInFlight 一致
+
+        // 扩容前的实例缓冲区：还在飞行中的帧可能在读，过 RETIRED_BUFFER_FRAMES 次上传后再释放
+        struct RetiredBuffer
+        {
+            Scope<Buffer> buffer;
+            u32 framesLeft;
+        };
+
+        Device& m_Device;
+
+        Scope<Mesh> m_BaseMesh;
+        Scope<Buffer> m_InstanceBuffer;
+        u32 m_InstanceCapacity = 0;
+        std::vector<RetiredBuffer> m_RetiredBuffers;
+
+        std::vector<OceanInstanceRange> m_DirtyRanges;
+        u32 m_PatchedInstanceCount = 0;
+        u32 m_PatchRangeCount = 0;
+    };
+}
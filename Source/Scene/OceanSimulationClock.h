@@ -0,0 +1,69 @@
+// OceanSimulationClock.h
+// 固定步长的海洋模拟时钟，GPU（OceanFFT）与 CPU（OceanFFTCPU）两条路径共用
+
+#pragma once
+#include "Core/Types.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Sea
+{
+    // 模拟只在 t = n / updatesPerSecond 处进行，n 为整数步数：
+    // - 模拟时间由步数算出，不受帧间隔累加误差影响，同一步数在任何机器上得到相同的 t
+    // - 帧率高于更新频率时多数帧不跨步，可以跳过模拟
+    // - 渲染 / 查询落后一步，在上一步与当前步之间按 GetInterpolationAlpha() 插值
+    class OceanSimulationClock
+    {
+    public:
+        explicit OceanSimulationClock(f32 updatesPerSecond = 50.0f) { SetRate(updatesPerSecond); }
+
+        // 修改更新频率时保持已经过的时间不变
+        void SetRate(f32 updatesPerSecond)
+        {
+            const f64 elapsed = GetElapsedTime();
+            m_Rate = std::max(updatesPerSecond, 1.0f);
+            m_StepSeconds = 1.0 / m_Rate;
+            m_Step = static_cast<u64>(std::floor(elapsed / m_StepSeconds));
+            m_Accumulator = std::clamp(elapsed - static_cast<f64>(m_Step) * m_StepSeconds, 0.0, m_StepSeconds);
+        }
+
+        void Reset(u64 step = 0)
+        {
+            m_Step = step;
+            m_Accumulator = 0.0;
+        }
+
+        // 推进实际经过的时间，返回跨过的步数（0 表示当前步不变，不需要重新模拟）
+        u64 Advance(f64 deltaTime)
+        {
+            m_Accumulator += std::max(deltaTime, 0.0);
+            if (m_Accumulator < m_StepSeconds)
+                return 0;
+
+            const u64 steps = static_cast<u64>(std::floor(m_Accumulator / m_StepSeconds));
+            m_Step += steps;
+            m_Accumulator = std::max(m_Accumulator - static_cast<f64>(steps) * m_StepSeconds, 0.0);
+            return steps;
+        }
+
+        f32 GetRate() const { return m_Rate; }
+        f64 GetStepSeconds() const { return m_StepSeconds; }
+        u64 GetStep() const { return m_Step; }
+
+        // 第 step 步的模拟时间
+        f32 GetStepTime(u64 step) const { return static_cast<f32>(static_cast<f64>(step) * m_StepSeconds); }
+        // 当前步（最新一次模拟）的时间
+        f32 GetTime() const { return GetStepTime(m_Step); }
+        // 实际经过的时间（当前步之后的余量也计入）
+        f64 GetElapsedTime() const { return static_cast<f64>(m_Step) * m_StepSeconds + m_Accumulator; }
+        // 0 = 上一步，1 = 当前步
+        f32 GetInterpolationAlpha() const { return static_cast<f32>(std::min(m_Accumulator / m_StepSeconds, 1.0)); }
+
+    private:
+        f32 m_Rate = 50.0f;
+        f64 m_StepSeconds = 1.0 / 50.0;
+        u64 m_Step = 0;
+        f64 m_Accumulator = 0.0;    // 当前步之后经过的实际时间，[0, m_StepSeconds)
+    };
+}
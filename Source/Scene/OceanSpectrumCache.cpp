@@ -0,0 +1,76 @@
+#include "Scene/OceanSpectrumCache.h"
+
+namespace Sea
+{
+    void OceanSpectrumCache::Reset(u32 slotCount)
+    {
+        m_SlotInfo.assign(slotCount, SlotInfo());
+        m_Slots.clear();
+        m_LRU.clear();
+        m_FreeSlots.clear();
+        // 倒序放入，先分配编号小的槽位
+        for (u32 i = slotCount; i > 0; --i)
+            m_FreeSlots.push_back(i - 1);
+    }
+
+    u32 OceanSpectrumCache::Acquire(u64 key, bool& outHit)
+    {
+        auto it = m_Slots.find(key);
+        if (it != m_Slots.end())
+        {
+            SlotInfo& info = m_SlotInfo[it->second];
+            if (info.refCount++ == 0)
+                m_LRU.erase(info.lruPosition);
+            m_Stats.hits++;
+            outHit = true;
+            return it->second;
+        }
+
+        outHit = false;
+        u32 slot = INVALID_SLOT;
+        if (!m_FreeSlots.empty())
+        {
+            slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else if (!m_LRU.empty())
+        {
+            slot = m_LRU.front();
+            m_LRU.pop_front();
+            m_Slots.erase(m_SlotInfo[slot].key);
+            m_Stats.evictions++;
+        }
+        else
+        {
+            return INVALID_SLOT;
+        }
+
+        SlotInfo& info = m_SlotInfo[slot];
+        info.key = key;
+        info.refCount = 1;
+        m_Slots[key] = slot;
+        m_Stats.misses++;
+        return slot;
+    }
+
+    void OceanSpectrumCache::Release(u32 slot)
+    {
+        if (slot >= m_SlotInfo.size())
+            return;
+
+        SlotInfo& info = m_SlotInfo[slot];
+        if (info.refCount == 0)
+            return;
+        if (--info.refCount == 0)
+            info.lruPosition = m_LRU.insert(m_LRU.end(), slot);
+    }
+
+    OceanSpectrumCacheStats OceanSpectrumCache::GetStats() const
+    {
+        OceanSpectrumCacheStats stats = m_Stats;
+        stats.slotCount = GetSlotCount();
+        stats.cachedCount = static_cast<u32>(m_Slots.size());
+        stats.referencedCount = static_cast<u32>(m_Slots.size() - m_LRU.size());
+        return stats;
+    }
+}
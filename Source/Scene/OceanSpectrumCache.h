@@ -0,0 +1,62 @@
+// OceanSpectrumCache.h
+// 初始频谱 h0(k) 的槽位缓存，GPU（OceanFFT，贴图数组的层）与 CPU（OceanFFTCPU，内存缓冲）两条路径共用
+
+#pragma once
+#include "Core/Types.h"
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace Sea
+{
+    struct OceanSpectrumCacheStats
+    {
+        u32 slotCount = 0;
+        u32 cachedCount = 0;        // 存有频谱的槽位
+        u32 referencedCount = 0;    // 正被级联使用的槽位
+        u64 hits = 0;               // 回到缓存中的参数，只需切换槽位
+        u64 misses = 0;             // 需要重新生成频谱
+        u64 evictions = 0;
+    };
+
+    // 键 = HashSpectrumParams，值 = 槽位编号；频谱数据由调用方按槽位存放
+    // 每个级联引用一个槽位，引用计数为 0 的槽位保留内容，需要空槽位时按 LRU 淘汰
+    // 槽位数不少于级联数即可保证 Acquire 总能成功（先 Release 旧槽位再 Acquire）
+    class OceanSpectrumCache : public NonCopyable
+    {
+    public:
+        static constexpr u32 INVALID_SLOT = ~0u;
+
+        explicit OceanSpectrumCache(u32 slotCount = 0) { Reset(slotCount); }
+
+        // 清空所有槽位（包括正被引用的），统计保留
+        void Reset(u32 slotCount);
+
+        bool Contains(u64 key) const { return m_Slots.find(key) != m_Slots.end(); }
+
+        // 返回存有 key 的槽位并加一个引用（outHit = true）；
+        // 否则取空槽位或淘汰最久未用的槽位并绑定到 key（outHit = false，调用方必须生成频谱写入该槽位）
+        // 所有槽位都被引用时返回 INVALID_SLOT
+        u32 Acquire(u64 key, bool& outHit);
+        void Release(u32 slot);
+
+        u32 GetSlotCount() const { return static_cast<u32>(m_SlotInfo.size()); }
+        OceanSpectrumCacheStats GetStats() const;
+
+    private:
+        struct SlotInfo
+        {
+            u64 key = 0;
+            u32 refCount = 0;
+            std::list<u32>::iterator lruPosition;   // 只在存有频谱且 refCount == 0 时有效
+        };
+
+    private:
+        std::vector<SlotInfo> m_SlotInfo;
+        std::unordered_map<u64, u32> m_Slots;
+        std::vector<u32> m_FreeSlots;
+        std::list<u32> m_LRU;                       // 无引用的槽位，最近释放的在尾部
+        OceanSpectrumCacheStats m_Stats;
+    };
+}
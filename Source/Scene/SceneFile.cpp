@@ -1,6 +1,7 @@
 #include "Scene/SceneFile.h"
 #include "Core/Log.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
 
@@ -48,6 +49,83 @@ namespace Sea
         }
     }
 
+    // FFT 海洋参数：只读写场景文件中出现的字段，其余保持默认值
+    static void ReadOceanFFTParams(const json& env, OceanFFTParams& params)
+    {
+        if (env.contains("fftOceanParams"))
+        {
+            auto& p = env["fftOceanParams"];
+            params.mapSize = p.value("mapSize", params.mapSize);
+            params.numCascades = std::min(p.value("numCascades", params.numCascades), OceanFFTParams::MAX_CASCADES);
+            params.depth = p.value("depth", params.depth);
+            params.updatesPerSecond = p.value("updatesPerSecond", params.updatesPerSecond);
+            params.queryMapSize = p.value("queryMapSize", params.queryMapSize);
+            params.roughness = p.value("roughness", params.roughness);
+            params.normalStrength = p.value("normalStrength", params.normalStrength);
+        }
+
+        if (env.contains("cascades") && env["cascades"].is_array())
+        {
+            auto& cascades = env["cascades"];
+            const u32 count = std::min(static_cast<u32>(cascades.size()), OceanFFTParams::MAX_CASCADES);
+            for (u32 i = 0; i < count; ++i)
+            {
+                auto& c = cascades[i];
+                auto& cascade = params.cascades[i];
+                cascade.tileLength = c.value("tileLength", cascade.tileLength);
+                cascade.windSpeed = c.value("windSpeed", cascade.windSpeed);
+                cascade.windDirection = c.value("windDirection", cascade.windDirection);
+                cascade.fetchLength = c.value("fetchLength", cascade.fetchLength);
+                cascade.swell = c.value("swell", cascade.swell);
+                cascade.spread = c.value("spread", cascade.spread);
+                cascade.detail = c.value("detail", cascade.detail);
+                cascade.displacementScale = c.value("displacementScale", cascade.displacementScale);
+                cascade.normalScale = c.value("normalScale", cascade.normalScale);
+                cascade.whitecap = c.value("whitecap", cascade.whitecap);
+                cascade.foamAmount = c.value("foamAmount", cascade.foamAmount);
+            }
+        }
+
+        if (env.contains("waterColor")) from_json(env["waterColor"], params.waterColor);
+        if (env.contains("foamColor")) from_json(env["foamColor"], params.foamColor);
+    }
+
+    static void WriteOceanFFTParams(json& env, const OceanFFTParams& params)
+    {
+        json p;
+        p["mapSize"] = params.mapSize;
+        p["numCascades"] = params.numCascades;
+        p["depth"] = params.depth;
+        p["updatesPerSecond"] = params.updatesPerSecond;
+        p["queryMapSize"] = params.queryMapSize;
+        p["roughness"] = params.roughness;
+        p["normalStrength"] = params.normalStrength;
+        env["fftOceanParams"] = p;
+
+        json cascades = json::array();
+        for (u32 i = 0; i < params.numCascades; ++i)
+        {
+            const auto& cascade = params.cascades[i];
+            json c;
+            c["tileLength"] = cascade.tileLength;
+            c["windSpeed"] = cascade.windSpeed;
+            c["windDirection"] = cascade.windDirection;
+            c["fetchLength"] = cascade.fetchLength;
+            c["swell"] = cascade.swell;
+            c["spread"] = cascade.spread;
+            c["detail"] = cascade.detail;
+            c["displacementScale"] = cascade.displacementScale;
+            c["normalScale"] = cascade.normalScale;
+            c["whitecap"] = cascade.whitecap;
+            c["foamAmount"] = cascade.foamAmount;
+            cascades.push_back(c);
+        }
+        env["cascades"] = cascades;
+
+        to_json(env["waterColor"], params.waterColor);
+        to_json(env["foamColor"], params.foamColor);
+    }
+
     bool SceneFile::Load(const std::string& filepath, SceneDef& outScene)
     {
         std::ifstream file(filepath);
@@ -85,7 +163,13 @@ namespace Sea
                 if (env.contains("ambient")) from_json(env["ambient"], outScene.ambientColor);
                 if (env.contains("clearColor")) from_json(env["clearColor"], outScene.clearColor);
                 outScene.showGrid = env.value("showGrid", true);
+                
+                outScene.environmentType = env.value("type", std::string());
+                outScene.oceanSeed = env.value("seed", DEFAULT_OCEAN_SEED);
+                outScene.hasFFTOceanParams = env.contains("fftOceanParams") || env.contains("cascades");
+                ReadOceanFFTParams(env, outScene.fftOceanParams);
             }
+            ApplyOceanSeed(outScene.fftOceanParams, outScene.oceanSeed);
 
             // 光源
             if (root.contains("lights") && root["lights"].is_array())
@@ -111,6 +195,7 @@ namespace Sea
                     obj.name = objJson.value("name", "Object");
                     obj.meshType = objJson.value("type", "sphere");
                     obj.meshPath = objJson.value("mesh", "");
+                    obj.parent = objJson.value("parent", "");
                     
                     if (objJson.contains("position")) from_json(objJson["position"], obj.position);
                     if (objJson.contains("rotation")) from_json(objJson["rotation"], obj.rotation);
@@ -166,6 +251,13 @@ namespace Sea
         to_json(env["ambient"], scene.ambientColor);
         to_json(env["clearColor"], scene.clearColor);
         env["showGrid"] = scene.showGrid;
+        if (!scene.environmentType.empty())
+        {
+            env["type"] = scene.environmentType;
+            env["seed"] = scene.oceanSeed;
+        }
+        if (scene.hasFFTOceanParams)
+            WriteOceanFFTParams(env, scene.fftOceanParams);
         root["environment"] = env;
 
         // 光源
@@ -191,6 +283,8 @@ namespace Sea
             o["type"] = obj.meshType;
             if (!obj.meshPath.empty())
                 o["mesh"] = obj.meshPath;
+            if (!obj.parent.empty())
+                o["parent"] = obj.parent;
             
             to_json(o["position"], obj.position);
             to_json(o["rotation"], obj.rotation);
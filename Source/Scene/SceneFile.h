@@ -3,6 +3,7 @@
 #include "Core/Types.h"
 #include "Scene/Mesh.h"
 #include "Graphics/Material.h"
+#include "Scene/OceanFFTParams.h"
 #include <DirectXMath.h>
 #include <string>
 #include <vector>
@@ -17,7 +18,8 @@ namespace Sea
     {
         std::string name;
         std::string meshPath;           // OBJ 文件路径
-        std::string meshType;           // "sphere", "cube", "plane", "torus", "mesh"
+        std::string meshType;           // "sphere", "cube", "plane", "torus", "mesh", "group"
+        std::string parent;             // 父对象名称（可选），变换相对于父对象
         XMFLOAT3 position = { 0, 0, 0 };
         XMFLOAT3 rotation = { 0, 0, 0 };  // 欧拉角（度）
         XMFLOAT3 scale = { 1, 1, 1 };
@@ -66,6 +68,12 @@ namespace Sea
         XMFLOAT3 ambientColor = { 0.1f, 0.1f, 0.15f };
         XMFLOAT4 clearColor = { 0.1f, 0.1f, 0.15f, 1.0f };
         bool showGrid = true;
+        
+        // 海洋环境："ocean" / "oceanfft"，其他场景为空
+        std::string environmentType;
+        u32 oceanSeed = DEFAULT_OCEAN_SEED;     // 决定各级联的频谱种子，相同种子得到相同的海面
+        bool hasFFTOceanParams = false;         // 文件中是否给出了 fftOceanParams / cascades
+        OceanFFTParams fftOceanParams;          // 已按 oceanSeed 设置频谱种子
     };
 
     class Device;
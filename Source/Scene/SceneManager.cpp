@@ -1,6 +1,7 @@
 #include "Scene/SceneManager.h"
 #include "Scene/Camera.h"
 #include "Core/Log.h"
+#include <algorithm>
 #include <filesystem>
 
 namespace Sea
@@ -10,20 +11,26 @@ namespace Sea
     SceneManager::SceneManager(Device& device)
         : m_Device(device)
     {
-        // 创建内置几何体
-        m_SphereMesh = Mesh::CreateSphere(device, 0.5f, 48, 24);
+        // 创建内置几何体（曲面几何体带 LOD 链，远处的物体用更少的三角形）
+        MeshUploadOptions lodOptions;
+        lodOptions.lodCount = 4;
+        m_SphereMesh = Mesh::CreateSphere(device, 0.5f, 48, 24, lodOptions);
         m_CubeMesh = Mesh::CreateCube(device, 1.0f);
         m_PlaneMesh = Mesh::CreatePlane(device, 10.0f, 10.0f);
-        m_TorusMesh = Mesh::CreateTorus(device, 0.6f, 0.2f, 32, 24);
+        m_TorusMesh = Mesh::CreateTorus(device, 0.6f, 0.2f, 32, 24, lodOptions);
         m_GridMesh = Mesh::CreatePlane(device, 100.0f, 100.0f);
+        m_MeshLoader = MakeScope<AsyncMeshLoader>();
         
         SEA_CORE_INFO("SceneManager initialized");
     }
 
     SceneManager::~SceneManager()
     {
+        // 先停掉加载线程，回调里会访问网格缓存
+        m_MeshLoader.reset();
         m_SceneObjects.clear();
-        m_MeshCache.clear();
+        m_SceneMeshRefs.clear();
+        m_MeshCache.Clear();
     }
 
     void SceneManager::ScanScenes(const std::string& directory)
@@ -51,15 +58,28 @@ namespace Sea
         m_CurrentScene = newScene;
         m_SceneObjects.clear();
 
+        // 新场景的网格先加引用、再释放旧场景的引用，两个场景共用的网格不会被淘汰或重新加载
+        std::vector<Mesh*> previousMeshRefs = std::move(m_SceneMeshRefs);
+        m_SceneMeshRefs.clear();
+
+        // 构建变换层级（父节点在前）
+        std::vector<u32> nodes = BuildTransformHierarchy(m_CurrentScene.objects);
+        m_Transforms.Update();
+
         // 创建场景对象
-        for (const auto& def : m_CurrentScene.objects)
+        for (size_t i = 0; i < m_CurrentScene.objects.size(); ++i)
         {
+            const auto& def = m_CurrentScene.objects[i];
             SceneObject obj;
-            obj.mesh = CreateMeshFromDef(def);
+            MeshLoadId pendingLoad = INVALID_MESH_LOAD;
+            obj.mesh = CreateMeshFromDef(def, pendingLoad);
             if (!obj.mesh) continue;
+            obj.pendingMeshLoad = pendingLoad;
             
-            XMMATRIX transform = ComputeTransform(def);
-            XMStoreFloat4x4(&obj.transform, transform);
+            obj.transformNode = nodes[i];
+            obj.transform = m_Transforms.GetWorldMatrix(nodes[i]);
+            obj.worldInvTranspose = m_Transforms.GetWorldInvTranspose(nodes[i]);
+            obj.hasWorldInvTranspose = true;
             
             obj.color = def.color;
             obj.metallic = def.metallic;
@@ -71,6 +91,12 @@ namespace Sea
             m_SceneObjects.push_back(obj);
         }
 
+        for (Mesh* mesh : previousMeshRefs)
+        {
+            m_MeshCache.Release(mesh);
+        }
+        CancelUnusedLoads();
+
         // 更新当前索引
         for (size_t i = 0; i < m_SceneFiles.size(); ++i)
         {
@@ -128,6 +154,13 @@ namespace Sea
         m_CurrentScene.showGrid = true;
         
         m_SceneObjects.clear();
+        m_Transforms.Clear();
+        for (Mesh* mesh : m_SceneMeshRefs)
+        {
+            m_MeshCache.Release(mesh);
+        }
+        m_SceneMeshRefs.clear();
+        CancelUnusedLoads();
 
         // 7x7 球体阵列
         const int gridSize = 7;
@@ -251,8 +284,63 @@ namespace Sea
         camera.SetPerspective(m_CurrentScene.camera.fov, aspectRatio, camera.GetNearZ(), camera.GetFarZ());
     }
 
-    Mesh* SceneManager::CreateMeshFromDef(const SceneObjectDef& def)
+    void SceneManager::CancelUnusedLoads()
+    {
+        // 当前场景用不到的后台加载直接取消
+        for (auto it = m_PendingMeshes.begin(); it != m_PendingMeshes.end();)
+        {
+            const MeshLoadId id = it->second;
+            const bool used = std::any_of(m_SceneObjects.begin(), m_SceneObjects.end(),
+                                          [id](const SceneObject& obj) { return obj.pendingMeshLoad == id; });
+            if (!used)
+            {
+                m_MeshLoader->Cancel(id);
+                it = m_PendingMeshes.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void SceneManager::UpdateStreaming(std::vector<SceneObject>& objects)
     {
+        m_MeshLoader->Update(m_Device);
+        m_MeshCache.Update();
+        if (m_StreamedMeshes.empty())
+            return;
+
+        PatchStreamedMeshes(objects);
+        if (&objects != &m_SceneObjects)
+        {
+            PatchStreamedMeshes(m_SceneObjects);
+        }
+        m_StreamedMeshes.clear();
+    }
+
+    void SceneManager::PatchStreamedMeshes(std::vector<SceneObject>& objects) const
+    {
+        for (SceneObject& obj : objects)
+        {
+            if (obj.pendingMeshLoad == INVALID_MESH_LOAD)
+                continue;
+
+            auto it = m_StreamedMeshes.find(obj.pendingMeshLoad);
+            if (it != m_StreamedMeshes.end())
+            {
+                obj.mesh = it->second;
+                obj.pendingMeshLoad = INVALID_MESH_LOAD;
+                obj.MarkDirty();
+            }
+        }
+    }
+
+    Mesh* SceneManager::CreateMeshFromDef(const SceneObjectDef& def, MeshLoadId& outPendingLoad)
+    {
+        // 分组节点只提供变换，不渲染
+        if (def.meshType == "group") return nullptr;
+        
         // 内置几何体
         if (def.meshType == "sphere") return m_SphereMesh.get();
         if (def.meshType == "cube") return m_CubeMesh.get();
@@ -262,40 +350,115 @@ namespace Sea
         // 外部 OBJ 文件
         if (def.meshType == "mesh" && !def.meshPath.empty())
         {
-            // 检查缓存
-            auto it = m_MeshCache.find(def.meshPath);
-            if (it != m_MeshCache.end())
-            {
-                return it->second.get();
-            }
-            
-            // 加载新网格
-            auto mesh = MakeScope<Mesh>();
-            if (mesh->LoadFromOBJ(m_Device, def.meshPath))
-            {
-                Mesh* ptr = mesh.get();
-                m_MeshCache[def.meshPath] = std::move(mesh);
-                return ptr;
-            }
-            else
+            MeshUploadOptions options;
+            options.lodCount = 4;
+
+            // 同一路径已经在加载时不再查缓存，避免重复计 miss
+            auto pending = m_PendingMeshes.find(def.meshPath);
+            if (pending == m_PendingMeshes.end())
             {
-                SEA_CORE_ERROR("Failed to load mesh: {}", def.meshPath);
-                return m_SphereMesh.get();  // 回退到球体
+                // 检查缓存（命中时加一个由当前场景持有的引用）
+                if (Mesh* cached = m_MeshCache.Acquire(def.meshPath, options))
+                {
+                    m_SceneMeshRefs.push_back(cached);
+                    return cached;
+                }
+
+                // 后台加载新网格，同一路径只发起一次；完成前用球体占位
+                const std::string path = def.meshPath;
+                MeshLoadId id = m_MeshLoader->Load(path, options, [this, path, options](MeshLoadId id, Scope<Mesh> mesh) {
+                    m_PendingMeshes.erase(path);
+                    if (!mesh)
+                    {
+                        m_StreamedMeshes[id] = m_SphereMesh.get();  // 回退到球体，下次加载场景时重试
+                        return;
+                    }
+
+                    // 内容与已缓存的网格相同时 Insert 返回已有的网格
+                    Mesh* cached = m_MeshCache.Insert(path, options, std::move(mesh));
+                    m_SceneMeshRefs.push_back(cached);
+                    m_StreamedMeshes[id] = cached;
+                });
+                pending = m_PendingMeshes.emplace(path, id).first;
             }
+
+            outPendingLoad = pending->second;
+            return m_SphereMesh.get();
         }
         
         return m_SphereMesh.get();  // 默认返回球体
     }
 
-    XMMATRIX SceneManager::ComputeTransform(const SceneObjectDef& def)
+    std::vector<u32> SceneManager::BuildTransformHierarchy(const std::vector<SceneObjectDef>& defs)
     {
-        // 角度转弧度
-        float radX = def.rotation.x * 3.14159265f / 180.0f;
-        float radY = def.rotation.y * 3.14159265f / 180.0f;
-        float radZ = def.rotation.z * 3.14159265f / 180.0f;
-        
-        return XMMatrixScaling(def.scale.x, def.scale.y, def.scale.z) *
-               XMMatrixRotationRollPitchYaw(radX, radY, radZ) *
-               XMMatrixTranslation(def.position.x, def.position.y, def.position.z);
+        m_Transforms.Clear();
+        m_Transforms.Reserve(static_cast<u32>(defs.size()));
+
+        std::unordered_map<std::string, size_t> nameToDef;
+        for (size_t i = 0; i < defs.size(); ++i)
+        {
+            nameToDef.emplace(defs[i].name, i);
+        }
+
+        // 场景文件中父对象可以写在子对象之后，这里递归保证父节点先创建
+        std::vector<u32> nodes(defs.size(), TransformHierarchy::INVALID_NODE);
+        std::vector<u8> visiting(defs.size(), 0);
+
+        std::function<u32(size_t)> createNode = [&](size_t index) -> u32
+        {
+            if (nodes[index] != TransformHierarchy::INVALID_NODE)
+                return nodes[index];
+
+            const auto& def = defs[index];
+            u32 parentNode = TransformHierarchy::INVALID_NODE;
+            if (!def.parent.empty())
+            {
+                auto it = nameToDef.find(def.parent);
+                if (it == nameToDef.end())
+                {
+                    SEA_CORE_WARN("Scene object '{}' references unknown parent '{}'", def.name, def.parent);
+                }
+                else if (visiting[it->second])
+                {
+                    SEA_CORE_WARN("Scene object '{}' has a cyclic parent chain, treating as root", def.name);
+                }
+                else
+                {
+                    visiting[index] = 1;
+                    parentNode = createNode(it->second);
+                    visiting[index] = 0;
+                }
+            }
+
+            u32 node = m_Transforms.CreateNode(parentNode);
+            m_Transforms.SetLocalPosition(node, def.position);
+            m_Transforms.SetLocalRotationEuler(node, def.rotation);
+            m_Transforms.SetLocalScale(node, def.scale);
+            nodes[index] = node;
+            return node;
+        };
+
+        for (size_t i = 0; i < defs.size(); ++i)
+        {
+            createNode(i);
+        }
+        return nodes;
+    }
+
+    void SceneManager::UpdateTransforms(std::vector<SceneObject>& objects)
+    {
+        if (m_Transforms.Update() == 0)
+            return;
+
+        for (auto& obj : objects)
+        {
+            if (m_Transforms.IsValid(obj.transformNode) && m_Transforms.WasUpdated(obj.transformNode))
+            {
+                obj.transform = m_Transforms.GetWorldMatrix(obj.transformNode);
+                obj.worldInvTranspose = m_Transforms.GetWorldInvTranspose(obj.transformNode);
+                obj.hasWorldInvTranspose = true;
+                obj.MarkDirty();
+            }
+        }
     }
 }
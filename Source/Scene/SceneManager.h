@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/Types.h"
+#include "Scene/AsyncMeshLoader.h"
+#include "Scene/MeshCache.h"
 #include "Scene/SceneFile.h"
 #include "Scene/SimpleRenderer.h"
 #include <functional>
@@ -52,6 +54,21 @@ namespace Sea
         // 获取网格
         Mesh* GetGridMesh() const { return m_GridMesh.get(); }
         
+        // 变换层级：修改节点局部变换后调用 UpdateTransforms，
+        // 只有发生变化的子树会被重新计算并写回到对象的 transform
+        TransformHierarchy& GetTransformHierarchy() { return m_Transforms; }
+        const TransformHierarchy& GetTransformHierarchy() const { return m_Transforms; }
+        void UpdateTransforms(std::vector<SceneObject>& objects);
+        void UpdateTransforms() { UpdateTransforms(m_SceneObjects); }
+        
+        // 外部网格在后台加载，完成前场景对象使用占位网格（pendingMeshLoad 记录请求）
+        // 每帧调用 UpdateStreaming：上传已加载完的网格，并把 objects 与内部场景对象中的占位网格换成真正的网格
+        AsyncMeshLoader& GetMeshLoader() { return *m_MeshLoader; }
+        // 外部网格按内容缓存并跨场景保留，当前场景持有引用，其余的在超出预算时按 LRU 淘汰
+        MeshCache& GetMeshCache() { return m_MeshCache; }
+        Mesh* GetPlaceholderMesh() const { return m_SphereMesh.get(); }
+        void UpdateStreaming(std::vector<SceneObject>& objects);
+        
         // 应用场景设置到渲染器和相机
         void ApplyToRenderer(SimpleRenderer& renderer);
         void ApplyToCamera(Camera& camera);
@@ -61,8 +78,11 @@ namespace Sea
         void SetOnSceneChanged(SceneChangedCallback callback) { m_OnSceneChanged = callback; }
 
     private:
-        Mesh* CreateMeshFromDef(const SceneObjectDef& def);
-        XMMATRIX ComputeTransform(const SceneObjectDef& def);
+        // 外部网格未加载完时返回占位网格，并通过 outPendingLoad 返回加载请求
+        Mesh* CreateMeshFromDef(const SceneObjectDef& def, MeshLoadId& outPendingLoad);
+        void PatchStreamedMeshes(std::vector<SceneObject>& objects) const;
+        void CancelUnusedLoads();
+        std::vector<u32> BuildTransformHierarchy(const std::vector<SceneObjectDef>& defs);
 
     private:
         Device& m_Device;
@@ -75,9 +95,14 @@ namespace Sea
         // 当前场景数据
         SceneDef m_CurrentScene;
         std::vector<SceneObject> m_SceneObjects;
+        TransformHierarchy m_Transforms;
         
         // 缓存的网格
-        std::unordered_map<std::string, Scope<Mesh>> m_MeshCache;
+        MeshCache m_MeshCache;
+        std::vector<Mesh*> m_SceneMeshRefs;                             // 当前场景在 m_MeshCache 中持有的引用
+        Scope<AsyncMeshLoader> m_MeshLoader;
+        std::unordered_map<std::string, MeshLoadId> m_PendingMeshes;   // 路径 -> 进行中的加载请求
+        std::unordered_map<MeshLoadId, Mesh*> m_StreamedMeshes;        // 本帧完成的请求 -> 网格（失败时为占位网格）
         Scope<Mesh> m_GridMesh;
         
         // 内置几何体
@@ -171,27 +171,25 @@ namespace Sea
                                     const std::vector<SceneObject>& objects,
                                     Mesh* gridMesh)
     {
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 获取 RTV 和 DSV
         D3D12_CPU_DESCRIPTOR_HANDLE rtv = m_RTVHeap->GetCPUHandle(0);
         D3D12_CPU_DESCRIPTOR_HANDLE dsv = m_Config.enableDepth ? m_DSVHeap->GetCPUHandle(0) : D3D12_CPU_DESCRIPTOR_HANDLE{};
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &rtv, FALSE, m_Config.enableDepth ? &dsv : nullptr);
+        cmdList.SetRenderTarget(rtv, m_Config.enableDepth ? &dsv : nullptr);
 
         // 设置视口和裁剪矩形
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(m_Config.width), static_cast<float>(m_Config.height), 0.0f, 1.0f };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(m_Config.width), static_cast<LONG>(m_Config.height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(m_Config.width), static_cast<f32>(m_Config.height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(m_Config.width), static_cast<i32>(m_Config.height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 清除
         const float clearColor[] = { 0.1f, 0.1f, 0.15f, 1.0f };
-        d3dCmdList->ClearRenderTargetView(rtv, clearColor, 0, nullptr);
+        cmdList.ClearRenderTarget(rtv, clearColor);
         if (m_Config.enableDepth)
         {
-            d3dCmdList->ClearDepthStencilView(dsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+            cmdList.ClearDepth(dsv);
         }
 
         // 渲染网格
@@ -218,23 +216,21 @@ namespace Sea
     {
         m_Renderer->BeginFrame(camera, time);
 
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &rtv, FALSE, dsv.ptr != 0 ? &dsv : nullptr);
+        cmdList.SetRenderTarget(rtv, dsv.ptr != 0 ? &dsv : nullptr);
 
         // 设置视口和裁剪矩形
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(width), static_cast<f32>(height), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(width), static_cast<i32>(height) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 清除
         const float clearColor[] = { 0.1f, 0.1f, 0.15f, 1.0f };
-        d3dCmdList->ClearRenderTargetView(rtv, clearColor, 0, nullptr);
+        cmdList.ClearRenderTarget(rtv, clearColor);
         if (dsv.ptr != 0)
         {
-            d3dCmdList->ClearDepthStencilView(dsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+            cmdList.ClearDepth(dsv);
         }
 
         // 渲染网格
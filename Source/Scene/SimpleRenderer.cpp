@@ -2,9 +2,18 @@
 #include "Shader/ShaderCompiler.h"
 #include "Core/Log.h"
 #include "Core/FileSystem.h"
+#include "Core/JobSystem.h"
+#include <atomic>
+#include <chrono>
 
 namespace Sea
 {
+    u32 AllocateSceneObjectId()
+    {
+        static std::atomic<u32> s_NextId{ 0 };
+        return s_NextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
     SimpleRenderer::SimpleRenderer(Device& device)
         : m_Device(device)
     {
@@ -32,13 +41,10 @@ namespace Sea
 
     void SimpleRenderer::Shutdown()
     {
-        m_ObjectConstantBuffer.reset();
+        m_ObjectConstants.Shutdown();
         m_FrameConstantBuffer.reset();
         m_GridPSO.reset();
-        m_NormalsPSO.reset();
-        m_WireframePSO.reset();
-        m_PBRPSO.reset();
-        m_BasicPSO.reset();
+        ResetPipelineStates();
         m_RootSignature.reset();
     }
 
@@ -48,10 +54,7 @@ namespace Sea
         
         // 释放旧的 PSO
         m_GridPSO.reset();
-        m_NormalsPSO.reset();
-        m_WireframePSO.reset();
-        m_PBRPSO.reset();
-        m_BasicPSO.reset();
+        ResetPipelineStates();
         
         // 重新创建 PSO
         if (!CreatePipelineStates())
@@ -64,6 +67,53 @@ namespace Sea
         return true;
     }
 
+    void SimpleRenderer::ResetPipelineStates()
+    {
+        m_NormalsPSO.reset();
+        m_WireframePSO.reset();
+        m_PBRPSO.reset();
+        m_BasicPSO.reset();
+        m_NormalsQuantizedPSO.reset();
+        m_WireframeQuantizedPSO.reset();
+        m_PBRQuantizedPSO.reset();
+        m_BasicQuantizedPSO.reset();
+    }
+
+    Ref<PipelineState> SimpleRenderer::CreateQuantizedVariant(const GraphicsPipelineDesc& desc, const std::string& shaderPath)
+    {
+        // 压缩顶点只影响顶点着色器与输入布局，像素着色器和其余状态沿用标准 PSO
+        std::vector<D3D12_INPUT_ELEMENT_DESC> quantizedLayout = {
+            { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 16, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        };
+
+        ShaderCompileDesc vsDesc;
+        vsDesc.filePath = shaderPath;
+        vsDesc.entryPoint = "VSMain";
+        vsDesc.stage = ShaderStage::Vertex;
+        vsDesc.model = ShaderModel::SM_6_0;
+        vsDesc.defines.push_back({ "QUANTIZED_VERTEX", "1" });
+        auto vsResult = ShaderCompiler::Compile(vsDesc);
+        if (!vsResult.success)
+        {
+            SEA_CORE_WARN("Failed to compile quantized vertex shader {}: {}", shaderPath, vsResult.errors);
+            return nullptr;
+        }
+
+        GraphicsPipelineDesc quantizedDesc = desc;
+        quantizedDesc.vertexShader = vsResult.bytecode;
+        quantizedDesc.inputLayout = quantizedLayout;
+
+        auto pso = PipelineState::CreateGraphics(m_Device, quantizedDesc);
+        if (!pso)
+        {
+            SEA_CORE_WARN("Failed to create quantized PSO for {}", shaderPath);
+        }
+        return pso;
+    }
+
     bool SimpleRenderer::CreateRootSignature()
     {
         RootSignatureDesc rsDesc;
@@ -156,6 +206,7 @@ namespace Sea
             SEA_CORE_ERROR("Failed to create Basic PSO");
             return false;
         }
+        m_BasicQuantizedPSO = CreateQuantizedVariant(basicDesc, basicShaderPath);
 
         // Grid shader
         std::string gridShaderPath = "Shaders/Grid.hlsl";
@@ -221,6 +272,7 @@ namespace Sea
                          pbrVsResult.errors, pbrPsResult.errors);
             // 如果 PBR 编译失败，使用 Basic 作为后备
             m_PBRPSO = m_BasicPSO;
+            m_PBRQuantizedPSO = m_BasicQuantizedPSO;
         }
         else
         {
@@ -243,10 +295,12 @@ namespace Sea
             {
                 SEA_CORE_WARN("Failed to create PBR PSO, falling back to Basic");
                 m_PBRPSO = m_BasicPSO;
+                m_PBRQuantizedPSO = m_BasicQuantizedPSO;
             }
             else
             {
                 SEA_CORE_INFO("PBR pipeline created successfully");
+                m_PBRQuantizedPSO = CreateQuantizedVariant(pbrDesc, pbrShaderPath);
             }
         }
 
@@ -272,6 +326,7 @@ namespace Sea
         else
         {
             SEA_CORE_INFO("Wireframe pipeline created successfully");
+            m_WireframeQuantizedPSO = CreateQuantizedVariant(wireframeDesc, basicShaderPath);
         }
 
         // ========== Debug Normals PSO ==========
@@ -317,6 +372,7 @@ namespace Sea
             else
             {
                 SEA_CORE_INFO("Debug Normals pipeline created successfully");
+                m_NormalsQuantizedPSO = CreateQuantizedVariant(normalsDesc, normalsShaderPath);
             }
         }
 
@@ -336,15 +392,9 @@ namespace Sea
             return false;
         }
 
-        // Object constant buffer - 足够大以容纳所有对象
-        // 每个对象的常量数据需要 256 字节对齐
-        BufferDesc objDesc;
-        objDesc.size = OBJECT_CB_ALIGNMENT * MAX_OBJECTS_PER_FRAME;
-        objDesc.type = BufferType::Constant;
-        m_ObjectConstantBuffer = MakeScope<Buffer>(m_Device, objDesc);
-        if (!m_ObjectConstantBuffer->Initialize(nullptr))
+        // Object constant table - 常驻，每个对象一个 256 字节对齐的槽位
+        if (!m_ObjectConstants.Initialize(m_Device, MAX_OBJECTS_PER_FRAME, "SimpleRenderer_ObjectConstants"))
         {
-            SEA_CORE_ERROR("Failed to create object constant buffer");
             return false;
         }
 
@@ -355,8 +405,13 @@ namespace Sea
     {
         camera.Update();
         
-        // 重置对象索引
-        m_CurrentObjectIndex = 0;
+        m_ObjectConstants.BeginFrame();
+        m_LastCulledObjectCount = m_CulledObjectCount;
+        m_CulledObjectCount = 0;
+        m_LastMeshletStats = m_MeshletStats;
+        m_MeshletStats = {};
+        m_LastLODObjectCounts = m_LODObjectCounts;
+        m_LODObjectCounts = {};
 
         m_FrameConstants.View = camera.GetViewMatrix();
         m_FrameConstants.Projection = camera.GetProjectionMatrix();
@@ -369,27 +424,34 @@ namespace Sea
         m_FrameConstants.AmbientColor = m_AmbientColor;
 
         m_FrameConstantBuffer->Update(&m_FrameConstants, sizeof(FrameConstants));
+        m_Frustum.SetFromViewProjection(m_FrameConstants.ViewProjection);
+        m_LODScreenScale = Mesh::GetLODScreenScale(camera, m_ViewportHeight);
     }
 
-    void SimpleRenderer::RenderObject(CommandList& cmdList, const SceneObject& obj)
+    void SimpleRenderer::BuildObjectConstants(const SceneObject& obj, ObjectConstants& objConst) const
     {
-        if (!obj.mesh) return;
-        
-        // 检查对象索引是否超出限制
-        if (m_CurrentObjectIndex >= MAX_OBJECTS_PER_FRAME)
+        objConst = {};
+        objConst.World = obj.transform;
+
+        // 压缩顶点的位置是包围盒内的 UNORM，反量化矩阵左乘到世界矩阵上
+        // 法线的逆转置矩阵仍由原始变换计算
+        if (obj.mesh && obj.mesh->IsQuantized())
         {
-            SEA_CORE_WARN("Too many objects to render in one frame!");
-            return;
+            XMMATRIX world = obj.mesh->GetQuantization().GetDequantizeMatrix() * XMLoadFloat4x4(&obj.transform);
+            XMStoreFloat4x4(&objConst.World, world);
         }
-
-        // 更新 object constants
-        ObjectConstants objConst = {};
-        objConst.World = obj.transform;
         
-        // 计算逆转置矩阵用于法线变换
-        XMMATRIX world = XMLoadFloat4x4(&obj.transform);
-        XMMATRIX worldInvTrans = XMMatrixTranspose(XMMatrixInverse(nullptr, world));
-        XMStoreFloat4x4(&objConst.WorldInvTranspose, worldInvTrans);
+        // 逆转置矩阵用于法线变换：挂在变换层级上的物体直接用层级缓存的结果
+        if (obj.hasWorldInvTranspose)
+        {
+            objConst.WorldInvTranspose = obj.worldInvTranspose;
+        }
+        else
+        {
+            XMMATRIX world = XMLoadFloat4x4(&obj.transform);
+            XMMATRIX worldInvTrans = XMMatrixTranspose(XMMatrixInverse(nullptr, world));
+            XMStoreFloat4x4(&objConst.WorldInvTranspose, worldInvTrans);
+        }
         
         // 使用材质或直接参数
         if (obj.material)
@@ -414,101 +476,212 @@ namespace Sea
             objConst.NormalScale = 1.0f;
         }
         objConst.TextureFlags = 0;  // 暂时不使用贴图
+    }
+
+    bool SimpleRenderer::UpdateObjectConstants(const SceneObject& obj, u32 slot)
+    {
+        if (m_ObjectConstants.IsCurrent(slot, obj.revision))
+            return false;
 
-        // 计算当前对象在缓冲区中的偏移量
-        u32 objectOffset = m_CurrentObjectIndex * OBJECT_CB_ALIGNMENT;
-        m_ObjectConstantBuffer->Update(&objConst, sizeof(ObjectConstants), objectOffset);
+        ObjectConstants objConst;
+        BuildObjectConstants(obj, objConst);
+        m_ObjectConstants.Upload(slot, objConst, obj.revision);
+        return true;
+    }
 
-        // 设置管线状态
-        auto* d3dCmdList = cmdList.GetCommandList();
-        d3dCmdList->SetGraphicsRootSignature(m_RootSignature->GetRootSignature());
+    void SimpleRenderer::RecordDraw(CommandList& cmdList, const SceneObject& obj, u32 slot,
+                                    const std::vector<MeshletDrawRange>* meshletRanges, u32 lod)
+    {
+        // 设置管线状态（CommandList 会过滤与上一个物体相同的状态）
+        cmdList.SetGraphicsRootSignature(m_RootSignature.get());
         
-        // 根据视图模式选择 PSO
+        // 根据视图模式与顶点格式选择 PSO
+        PipelineState* pso = SelectPipelineState(obj.mesh->IsQuantized());
+        if (!pso)
+            return;
+        cmdList.SetPipelineState(pso);
+
+        // 设置常量缓冲 - 使用偏移后的地址
+        cmdList.SetGraphicsRootCBV(0, m_FrameConstantBuffer->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(1, m_ObjectConstants.GetGPUAddress(slot));
+
+        // 设置顶点和索引缓冲
+        cmdList.SetVertexBuffer(0, obj.mesh->GetVertexBuffer()->GetVertexBufferView());
+        cmdList.SetIndexBuffer(obj.mesh->GetIndexBuffer()->GetIndexBufferView());
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+
+        // 绘制
+        if (meshletRanges)
+            obj.mesh->Draw(cmdList, *meshletRanges);
+        else
+            obj.mesh->DrawLOD(cmdList, lod);
+    }
+
+    PipelineState* SimpleRenderer::SelectPipelineState(bool quantized) const
+    {
+        const Ref<PipelineState>& basic = quantized ? m_BasicQuantizedPSO : m_BasicPSO;
+        const Ref<PipelineState>& pbr = quantized ? m_PBRQuantizedPSO : m_PBRPSO;
+        const Ref<PipelineState>& wireframe = quantized ? m_WireframeQuantizedPSO : m_WireframePSO;
+        const Ref<PipelineState>& normals = quantized ? m_NormalsQuantizedPSO : m_NormalsPSO;
+
+        // 压缩格式的 PSO 创建失败时返回空，不能退回到标准布局的 PSO
         switch (m_ViewMode)
         {
         case 1: // Wireframe
-            if (m_WireframePSO)
-            {
-                d3dCmdList->SetPipelineState(m_WireframePSO->GetPipelineState());
-            }
-            else
-            {
-                d3dCmdList->SetPipelineState(m_BasicPSO->GetPipelineState());
-            }
-            break;
+            return wireframe ? wireframe.get() : basic.get();
         case 2: // Normals
-            if (m_NormalsPSO)
-            {
-                d3dCmdList->SetPipelineState(m_NormalsPSO->GetPipelineState());
-            }
-            else
-            {
-                d3dCmdList->SetPipelineState(m_BasicPSO->GetPipelineState());
-            }
-            break;
+            return normals ? normals.get() : basic.get();
         default: // Lit (0)
-            if (m_UsePBR && m_PBRPSO)
+            return (m_UsePBR && pbr) ? pbr.get() : basic.get();
+        }
+    }
+
+    void SimpleRenderer::RenderObject(CommandList& cmdList, const SceneObject& obj)
+    {
+        if (!obj.mesh) return;
+        
+        const u32 slot = m_ObjectConstants.AcquireSlot(obj.id);
+        if (slot == ObjectConstantTable<ObjectConstants>::INVALID_SLOT)
+        {
+            SEA_CORE_WARN("Too many objects to render in one frame!");
+            return;
+        }
+
+        // 常量表里已经是这个 revision 的内容时不重新打包
+        auto startTime = std::chrono::high_resolution_clock::now();
+        const bool rebuilt = UpdateObjectConstants(obj, slot);
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_ObjectConstants.AddStats(1, rebuilt ? 1 : 0, std::chrono::duration<f32, std::milli>(endTime - startTime).count());
+
+        RecordDraw(cmdList, obj, slot);
+    }
+
+    void SimpleRenderer::RenderObjects(CommandList& cmdList, const std::vector<SceneObject>& objects)
+    {
+        // 槽位按物体 id 分配（会修改分配表，在录制线程上完成）。
+        // 被剔除的物体也保留槽位，下一帧重新可见时常量表里的内容仍然有效
+        const u32 count = static_cast<u32>(objects.size());
+        m_ObjectSlots.resize(count);
+        bool overflow = false;
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_ObjectSlots[i] = objects[i].mesh ? m_ObjectConstants.AcquireSlot(objects[i].id)
+                                               : ObjectConstantTable<ObjectConstants>::INVALID_SLOT;
+            overflow |= objects[i].mesh && m_ObjectSlots[i] == ObjectConstantTable<ObjectConstants>::INVALID_SLOT;
+        }
+        if (overflow)
+        {
+            SEA_CORE_WARN("Too many objects to render in one frame!");
+        }
+
+        m_VisibleObjects.assign(count, 0);
+        if (m_MeshletRanges.size() < count)
+            m_MeshletRanges.resize(count);
+        m_ObjectMeshletStats.assign(count, {});
+        m_ObjectLODs.assign(count, 0);
+        // 线框管线不剔除背面，簇剔除也只能做视锥测试
+        const bool meshletBackfaceCulling = m_ViewMode != 1;
+
+        // 并行阶段：剔除 + 重建变化物体的常量（每个物体只写自己的槽位）
+        auto startTime = std::chrono::high_resolution_clock::now();
+        std::atomic<u32> drawnObjects = 0;
+        std::atomic<u32> rebuiltObjects = 0;
+        std::atomic<u32> culledObjects = 0;
+        JobSystem::RunParallelFor(count, PREPARE_BATCH_SIZE, [&](u32 begin, u32 end) {
+            u32 drawn = 0, rebuilt = 0, culled = 0;
+            for (u32 i = begin; i < end; ++i)
             {
-                d3dCmdList->SetPipelineState(m_PBRPSO->GetPipelineState());
+                const SceneObject& obj = objects[i];
+                const u32 slot = m_ObjectSlots[i];
+                if (slot == ObjectConstantTable<ObjectConstants>::INVALID_SLOT)
+                    continue;
+
+                if (m_FrustumCulling &&
+                    !m_Frustum.IntersectsTransformedAABB(obj.mesh->GetBoundsMin(), obj.mesh->GetBoundsMax(), obj.transform))
+                {
+                    ++culled;
+                    continue;
+                }
+
+                // 簇剔除：所有 meshlet 都不可见时按整个物体被剔除处理
+                // LOD 按投影误差选择；meshlet 只对应 LOD0，选中更粗的级别时整体绘制
+                u32 lod = 0;
+                if (m_MeshLOD && obj.mesh->GetLODCount() > 1)
+                    lod = obj.mesh->SelectLOD(obj.transform, m_FrameConstants.CameraPosition, m_LODScreenScale, m_LODPixelError);
+                m_ObjectLODs[i] = static_cast<u8>(lod);
+
+                if (lod == 0 && m_MeshletCulling && obj.mesh->HasMeshlets())
+                {
+                    CullMeshlets(obj.mesh->GetMeshlets(), m_Frustum, m_FrameConstants.CameraPosition, obj.transform,
+                                 m_MeshletRanges[i], &m_ObjectMeshletStats[i], meshletBackfaceCulling);
+                    if (m_MeshletRanges[i].empty())
+                    {
+                        ++culled;
+                        continue;
+                    }
+                    m_VisibleObjects[i] = 2;
+                }
+                else
+                {
+                    m_VisibleObjects[i] = 1;
+                }
+
+                if (UpdateObjectConstants(obj, slot))
+                    ++rebuilt;
+
+                ++drawn;
             }
-            else
+            drawnObjects += drawn;
+            rebuiltObjects += rebuilt;
+            culledObjects += culled;
+        });
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        m_ObjectConstants.AddStats(drawnObjects, rebuiltObjects, std::chrono::duration<f32, std::milli>(endTime - startTime).count());
+        m_CulledObjectCount += culledObjects;
+
+        // 录制阶段：命令列表只能单线程录制，按原顺序提交可见物体
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_MeshletStats.Add(m_ObjectMeshletStats[i]);
+            if (m_VisibleObjects[i])
             {
-                d3dCmdList->SetPipelineState(m_BasicPSO->GetPipelineState());
+                ++m_LODObjectCounts[m_ObjectLODs[i]];
+                RecordDraw(cmdList, objects[i], m_ObjectSlots[i], m_VisibleObjects[i] == 2 ? &m_MeshletRanges[i] : nullptr,
+                           m_ObjectLODs[i]);
             }
-            break;
         }
-
-        // 设置常量缓冲 - 使用偏移后的地址
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_FrameConstantBuffer->GetGPUAddress());
-        d3dCmdList->SetGraphicsRootConstantBufferView(1, m_ObjectConstantBuffer->GetGPUAddress() + objectOffset);
-
-        // 设置顶点和索引缓冲
-        D3D12_VERTEX_BUFFER_VIEW vbv = obj.mesh->GetVertexBuffer()->GetVertexBufferView();
-        D3D12_INDEX_BUFFER_VIEW ibv = obj.mesh->GetIndexBuffer()->GetIndexBufferView();
-        d3dCmdList->IASetVertexBuffers(0, 1, &vbv);
-        d3dCmdList->IASetIndexBuffer(&ibv);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
-        // 绘制
-        d3dCmdList->DrawIndexedInstanced(obj.mesh->GetIndexCount(), 1, 0, 0, 0);
-        
-        // 增加对象索引
-        m_CurrentObjectIndex++;
     }
 
     void SimpleRenderer::RenderGrid(CommandList& cmdList, Mesh& gridMesh)
     {
-        if (m_CurrentObjectIndex >= MAX_OBJECTS_PER_FRAME)
+        const u32 slot = m_ObjectConstants.AcquireSlot(m_GridObjectId);
+        if (slot == ObjectConstantTable<ObjectConstants>::INVALID_SLOT)
         {
             SEA_CORE_WARN("Too many objects to render grid!");
             return;
         }
         
-        auto* d3dCmdList = cmdList.GetCommandList();
-        d3dCmdList->SetGraphicsRootSignature(m_RootSignature->GetRootSignature());
-        d3dCmdList->SetPipelineState(m_GridPSO->GetPipelineState());
+        cmdList.SetGraphicsRootSignature(m_RootSignature.get());
+        cmdList.SetPipelineState(m_GridPSO.get());
 
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_FrameConstantBuffer->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(0, m_FrameConstantBuffer->GetGPUAddress());
 
-        // 创建一个单位世界矩阵
-        ObjectConstants objConst = {};
-        XMStoreFloat4x4(&objConst.World, XMMatrixIdentity());
-        XMStoreFloat4x4(&objConst.WorldInvTranspose, XMMatrixIdentity());
-        objConst.BaseColor = { 1, 1, 1, 1 };
-        
-        // 使用偏移量
-        u32 objectOffset = m_CurrentObjectIndex * OBJECT_CB_ALIGNMENT;
-        m_ObjectConstantBuffer->Update(&objConst, sizeof(ObjectConstants), objectOffset);
-        d3dCmdList->SetGraphicsRootConstantBufferView(1, m_ObjectConstantBuffer->GetGPUAddress() + objectOffset);
-
-        D3D12_VERTEX_BUFFER_VIEW vbv = gridMesh.GetVertexBuffer()->GetVertexBufferView();
-        D3D12_INDEX_BUFFER_VIEW ibv = gridMesh.GetIndexBuffer()->GetIndexBufferView();
-        d3dCmdList->IASetVertexBuffers(0, 1, &vbv);
-        d3dCmdList->IASetIndexBuffer(&ibv);
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
-        d3dCmdList->DrawIndexedInstanced(gridMesh.GetIndexCount(), 1, 0, 0, 0);
-        
-        m_CurrentObjectIndex++;
+        // 网格的常量不会变化，每份帧副本只在首次使用时写入单位世界矩阵
+        if (!m_ObjectConstants.IsCurrent(slot, 0))
+        {
+            ObjectConstants objConst = {};
+            XMStoreFloat4x4(&objConst.World, XMMatrixIdentity());
+            XMStoreFloat4x4(&objConst.WorldInvTranspose, XMMatrixIdentity());
+            objConst.BaseColor = { 1, 1, 1, 1 };
+            m_ObjectConstants.Upload(slot, objConst, 0);
+        }
+        cmdList.SetGraphicsRootCBV(1, m_ObjectConstants.GetGPUAddress(slot));
+
+        cmdList.SetVertexBuffer(0, gridMesh.GetVertexBuffer()->GetVertexBufferView());
+        cmdList.SetIndexBuffer(gridMesh.GetIndexBuffer()->GetIndexBufferView());
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+
+        cmdList.DrawIndexed(gridMesh.GetIndexCount());
     }
 }
@@ -4,15 +4,26 @@
 #include "Graphics/Graphics.h"
 #include "Graphics/Material.h"
 #include "Scene/Scene.h"
+#include "Scene/TransformHierarchy.h"
+#include "Scene/ObjectConstantTable.h"
+#include "Scene/Frustum.h"
+#include "Scene/Meshlet.h"
+#include "Scene/MeshSimplifier.h"
 #include <DirectXMath.h>
+#include <array>
 #include <vector>
 
 namespace Sea
 {
     using namespace DirectX;
 
+    // 分配进程内唯一的场景对象 id
+    u32 AllocateSceneObjectId();
+
     struct SceneObject
     {
+        u32 id = AllocateSceneObjectId();           // 渲染器按 id 保留常量槽位，复制出的新对象需要重新分配
+        u32 revision = 0;                           // transform / 材质 / 网格改变后调用 MarkDirty
         Mesh* mesh = nullptr;
         XMFLOAT4X4 transform;
         XMFLOAT4 color = { 1, 1, 1, 1 };
@@ -22,6 +33,13 @@ namespace Sea
         XMFLOAT3 emissiveColor = { 0, 0, 0 };       // 自发光颜色
         f32 emissiveIntensity = 0.0f;               // 自发光强度
         Ref<PBRMaterial> material = nullptr;         // PBR 材质 (可选)
+        u32 transformNode = TransformHierarchy::INVALID_NODE;  // 变换层级节点 (可选)
+        XMFLOAT4X4 worldInvTranspose;               // 法线用的逆转置矩阵，由变换层级缓存提供
+        bool hasWorldInvTranspose = false;          // 为 false 时渲染器自行由 transform 求逆
+        u64 pendingMeshLoad = 0;                    // 后台加载中的网格请求，完成前 mesh 指向占位网格
+
+        // 渲染器只为 revision 变化的物体重新打包常量
+        void MarkDirty() { ++revision; }
     };
 
     struct FrameConstants
@@ -69,6 +87,8 @@ namespace Sea
 
         void BeginFrame(Camera& camera, f32 time);
         void RenderObject(CommandList& cmdList, const SceneObject& obj);
+        // 批量绘制：剔除与常量打包在任务系统上并行完成，之后按顺序录制命令
+        void RenderObjects(CommandList& cmdList, const std::vector<SceneObject>& objects);
         void RenderGrid(CommandList& cmdList, Mesh& gridMesh);
 
         // PBR 设置
@@ -80,15 +100,51 @@ namespace Sea
         int GetViewMode() const { return m_ViewMode; }
 
         void SetLightDirection(const XMFLOAT3& dir) { m_LightDirection = dir; }
+        const XMFLOAT3& GetLightDirection() const { return m_LightDirection; }
         void SetLightColor(const XMFLOAT3& color) { m_LightColor = color; }
         void SetLightIntensity(f32 intensity) { m_LightIntensity = intensity; }
         void SetAmbientColor(const XMFLOAT3& color) { m_AmbientColor = color; }
 
+        // 物体常量上传统计（上一帧）
+        const ObjectConstantTableStats& GetObjectConstantStats() const { return m_ObjectConstants.GetStats(); }
+        // 每帧重建全部物体常量，用于实测增量更新省下的开销
+        void SetRebuildAllObjectConstants(bool enabled) { m_ObjectConstants.SetForceRebuild(enabled); }
+        bool GetRebuildAllObjectConstants() const { return m_ObjectConstants.GetForceRebuild(); }
+
+        // 视锥剔除（仅 RenderObjects 生效）
+        void SetFrustumCulling(bool enabled) { m_FrustumCulling = enabled; }
+        bool GetFrustumCulling() const { return m_FrustumCulling; }
+        u32 GetCulledObjectCount() const { return m_LastCulledObjectCount; }   // 上一帧
+
+        // meshlet 簇剔除（仅 RenderObjects 生效，网格需以 buildMeshlets 上传）
+        void SetMeshletCulling(bool enabled) { m_MeshletCulling = enabled; }
+        bool GetMeshletCulling() const { return m_MeshletCulling; }
+        const MeshletCullStats& GetMeshletCullStats() const { return m_LastMeshletStats; }     // 上一帧
+
+        // 网格 LOD（仅 RenderObjects 生效）：选择投影误差不超过 pixelError 个像素的最粗一级
+        void SetMeshLOD(bool enabled) { m_MeshLOD = enabled; }
+        bool GetMeshLOD() const { return m_MeshLOD; }
+        void SetLODPixelError(f32 pixels) { m_LODPixelError = pixels; }
+        f32 GetLODPixelError() const { return m_LODPixelError; }
+        void SetViewportHeight(u32 height) { m_ViewportHeight = height; }  // 用于把 LOD 误差换算成像素
+        const std::array<u32, MESH_MAX_LODS>& GetLODObjectCounts() const { return m_LastLODObjectCounts; }   // 上一帧各级物体数
+
     private:
         bool CreateRootSignature();
         bool CreatePipelineStates();
+        void ResetPipelineStates();
+        // 以标准 PSO 为模板，换成 QUANTIZED_VERTEX 版本的顶点着色器与压缩输入布局
+        Ref<PipelineState> CreateQuantizedVariant(const GraphicsPipelineDesc& desc, const std::string& shaderPath);
+        PipelineState* SelectPipelineState(bool quantized) const;
         bool CreateConstantBuffers();
 
+        void BuildObjectConstants(const SceneObject& obj, ObjectConstants& objConst) const;
+        // 物体常量不是最新时重新打包并上传，返回是否上传
+        bool UpdateObjectConstants(const SceneObject& obj, u32 slot);
+        // meshletRanges 非空时只绘制簇剔除后的可见区间
+        void RecordDraw(CommandList& cmdList, const SceneObject& obj, u32 slot,
+                        const std::vector<MeshletDrawRange>* meshletRanges = nullptr, u32 lod = 0);
+
     private:
         Device& m_Device;
 
@@ -98,14 +154,39 @@ namespace Sea
         Ref<PipelineState> m_WireframePSO;     // Wireframe 管线
         Ref<PipelineState> m_NormalsPSO;       // Normals 可视化管线
         Ref<PipelineState> m_GridPSO;
+        // 压缩顶点（VertexFormat::Quantized）的对应管线
+        Ref<PipelineState> m_BasicQuantizedPSO;
+        Ref<PipelineState> m_PBRQuantizedPSO;
+        Ref<PipelineState> m_WireframeQuantizedPSO;
+        Ref<PipelineState> m_NormalsQuantizedPSO;
 
         Scope<Buffer> m_FrameConstantBuffer;
-        Scope<Buffer> m_ObjectConstantBuffer;
+        ObjectConstantTable<ObjectConstants> m_ObjectConstants;   // 常驻，按物体 id 分配槽位
         
-        // 动态常量缓冲区分配
+        // 常量表容量（每帧最多绘制的物体数）
         static constexpr u32 MAX_OBJECTS_PER_FRAME = 256;
-        static constexpr u32 OBJECT_CB_ALIGNMENT = 256;  // D3D12 常量缓冲区对齐要求
-        u32 m_CurrentObjectIndex = 0;
+        const u32 m_GridObjectId = AllocateSceneObjectId();
+
+        // 批量绘制的并行准备
+        static constexpr u32 PREPARE_BATCH_SIZE = 32;
+        std::vector<u32> m_ObjectSlots;        // 每个物体在常量表中的槽位
+        std::vector<u8> m_VisibleObjects;      // 0 = 剔除，1 = 整体绘制，2 = 按 meshlet 区间绘制
+        Frustum m_Frustum;
+        bool m_FrustumCulling = true;
+        u32 m_CulledObjectCount = 0;
+        u32 m_LastCulledObjectCount = 0;
+        bool m_MeshletCulling = true;
+        std::vector<std::vector<MeshletDrawRange>> m_MeshletRanges;    // 按物体下标，容量跨帧复用
+        std::vector<MeshletCullStats> m_ObjectMeshletStats;
+        MeshletCullStats m_MeshletStats;
+        MeshletCullStats m_LastMeshletStats;
+        bool m_MeshLOD = true;
+        f32 m_LODPixelError = 1.0f;
+        f32 m_LODScreenScale = 1.0f;
+        u32 m_ViewportHeight = 1080;
+        std::vector<u8> m_ObjectLODs;
+        std::array<u32, MESH_MAX_LODS> m_LODObjectCounts = {};
+        std::array<u32, MESH_MAX_LODS> m_LastLODObjectCounts = {};
 
         FrameConstants m_FrameConstants;
         
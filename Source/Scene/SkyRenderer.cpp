@@ -281,23 +281,22 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(SkyConstants));
 
         // 渲染
-        auto* d3dCmdList = cmdList.GetCommandList();
-        d3dCmdList->SetGraphicsRootSignature(m_RootSignature->GetRootSignature());
+        cmdList.SetGraphicsRootSignature(m_RootSignature.get());
         
         // 选择带云或不带云的 PSO
         if (m_Settings.EnableClouds && m_CloudsPSO)
         {
-            d3dCmdList->SetPipelineState(m_CloudsPSO->GetPipelineState());
+            cmdList.SetPipelineState(m_CloudsPSO.get());
         }
         else
         {
-            d3dCmdList->SetPipelineState(m_SkyPSO->GetPipelineState());
+            cmdList.SetPipelineState(m_SkyPSO.get());
         }
         
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_ConstantBuffer->GetGPUAddress());
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cmdList.SetGraphicsRootCBV(0, m_ConstantBuffer->GetGPUAddress());
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
         
         // 绘制全屏三角形 (3 个顶点)
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.Draw(3);
     }
 }
@@ -179,16 +179,8 @@ namespace Sea
         if (!m_Settings.Enabled)
             return;
 
-        auto* d3dCmdList = cmdList.GetCommandList();
-
         // 转换输出资源到 RenderTarget 状态
-        D3D12_RESOURCE_BARRIER barrier = {};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Transition.pResource = outputResource;
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COMMON;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(outputResource, ResourceState::Common, ResourceState::RenderTarget);
 
         // 更新常量缓冲区
         TonemapConstants constants = {};
@@ -204,34 +196,32 @@ namespace Sea
         m_ConstantBuffer->Update(&constants, sizeof(TonemapConstants));
 
         // 设置渲染目标
-        d3dCmdList->OMSetRenderTargets(1, &outputRTV, FALSE, nullptr);
+        cmdList.SetRenderTarget(outputRTV);
 
         // 设置视口
-        D3D12_VIEWPORT viewport = { 0, 0, static_cast<float>(outputWidth), 
-                                    static_cast<float>(outputHeight), 0, 1 };
-        D3D12_RECT scissor = { 0, 0, static_cast<LONG>(outputWidth), 
-                               static_cast<LONG>(outputHeight) };
-        d3dCmdList->RSSetViewports(1, &viewport);
-        d3dCmdList->RSSetScissorRects(1, &scissor);
+        Viewport viewport = { 0, 0, static_cast<f32>(outputWidth), 
+                              static_cast<f32>(outputHeight), 0, 1 };
+        ScissorRect scissor = { 0, 0, static_cast<i32>(outputWidth), 
+                                static_cast<i32>(outputHeight) };
+        cmdList.SetViewport(viewport);
+        cmdList.SetScissorRect(scissor);
 
         // 设置 PSO 和根签名
-        d3dCmdList->SetPipelineState(m_PSO->GetPipelineState());
-        d3dCmdList->SetGraphicsRootSignature(m_RootSignature->GetRootSignature());
+        cmdList.SetPipelineState(m_PSO.get());
+        cmdList.SetGraphicsRootSignature(m_RootSignature.get());
 
         // 设置常量缓冲区
-        d3dCmdList->SetGraphicsRootConstantBufferView(0, m_ConstantBuffer->GetGPUAddress());
+        cmdList.SetGraphicsRootCBV(0, m_ConstantBuffer->GetGPUAddress());
 
         // 设置描述符堆和 SRV
         // 注意：调用者需要确保描述符堆已设置且 SRV 正确绑定
-        d3dCmdList->SetGraphicsRootDescriptorTable(1, inputSRV);
+        cmdList.SetGraphicsRootDescriptorTable(1, inputSRV);
 
         // 绘制全屏三角形
-        d3dCmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        d3dCmdList->DrawInstanced(3, 1, 0, 0);
+        cmdList.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        cmdList.Draw(3);
 
         // 转换输出资源回 Common 状态
-        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_COMMON;
-        d3dCmdList->ResourceBarrier(1, &barrier);
+        cmdList.TransitionBarrier(outputResource, ResourceState::RenderTarget, ResourceState::Common);
     }
 }
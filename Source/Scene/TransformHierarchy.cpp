@@ -0,0 +1,251 @@
+#include "Scene/TransformHierarchy.h"
+#include "Core/Log.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Sea
+{
+    static inline XMMATRIX ComposeLocalMatrix(const XMFLOAT3& position, const XMFLOAT4& rotation, const XMFLOAT3& scale)
+    {
+        // 与场景文件约定一致：S * R * T
+        return XMMatrixScaling(scale.x, scale.y, scale.z) *
+               XMMatrixRotationQuaternion(XMLoadFloat4(&rotation)) *
+               XMMatrixTranslation(position.x, position.y, position.z);
+    }
+
+    void TransformHierarchy::Clear()
+    {
+        m_Parent.clear();
+        m_LocalPosition.clear();
+        m_LocalRotation.clear();
+        m_LocalScale.clear();
+        m_World.clear();
+        m_WorldInvTranspose.clear();
+        m_Dirty.clear();
+        m_Updated.clear();
+        m_Depth.clear();
+        m_FirstChild.clear();
+        m_NextSibling.clear();
+        m_DirtyNodes.clear();
+        m_UpdatedNodes.clear();
+        m_TraversalStack.clear();
+        m_Levels.clear();
+        m_Stats = {};
+    }
+
+    void TransformHierarchy::Reserve(u32 count)
+    {
+        m_Parent.reserve(count);
+        m_LocalPosition.reserve(count);
+        m_LocalRotation.reserve(count);
+        m_LocalScale.reserve(count);
+        m_World.reserve(count);
+        m_WorldInvTranspose.reserve(count);
+        m_Dirty.reserve(count);
+        m_Updated.reserve(count);
+        m_Depth.reserve(count);
+        m_FirstChild.reserve(count);
+        m_NextSibling.reserve(count);
+    }
+
+    u32 TransformHierarchy::CreateNode(u32 parent)
+    {
+        u32 node = GetNodeCount();
+        if (parent != INVALID_NODE && parent >= node)
+        {
+            SEA_CORE_WARN("TransformHierarchy: parent {} must be created before child {}, treating as root", parent, node);
+            parent = INVALID_NODE;
+        }
+
+        XMFLOAT4X4 identity;
+        XMStoreFloat4x4(&identity, XMMatrixIdentity());
+
+        m_Parent.push_back(parent);
+        m_LocalPosition.push_back({ 0.0f, 0.0f, 0.0f });
+        m_LocalRotation.push_back({ 0.0f, 0.0f, 0.0f, 1.0f });
+        m_LocalScale.push_back({ 1.0f, 1.0f, 1.0f });
+        m_World.push_back(identity);
+        m_WorldInvTranspose.push_back(identity);
+        m_Dirty.push_back(0);
+        m_Updated.push_back(0);
+
+        m_Depth.push_back((parent != INVALID_NODE) ? m_Depth[parent] + 1 : 0);
+
+        m_FirstChild.push_back(INVALID_NODE);
+        m_NextSibling.push_back(INVALID_NODE);
+        if (parent != INVALID_NODE)
+        {
+            m_NextSibling[node] = m_FirstChild[parent];
+            m_FirstChild[parent] = node;
+        }
+
+        // 新节点需要继承父节点的世界矩阵
+        MarkDirty(node);
+        return node;
+    }
+
+    void TransformHierarchy::SetLocalPosition(u32 node, const XMFLOAT3& position)
+    {
+        m_LocalPosition[node] = position;
+        MarkDirty(node);
+    }
+
+    void TransformHierarchy::SetLocalRotation(u32 node, const XMFLOAT4& rotation)
+    {
+        m_LocalRotation[node] = rotation;
+        MarkDirty(node);
+    }
+
+    void TransformHierarchy::SetLocalRotationEuler(u32 node, const XMFLOAT3& degrees)
+    {
+        XMVECTOR q = XMQuaternionRotationRollPitchYaw(
+            XMConvertToRadians(degrees.x),
+            XMConvertToRadians(degrees.y),
+            XMConvertToRadians(degrees.z));
+        XMStoreFloat4(&m_LocalRotation[node], q);
+        MarkDirty(node);
+    }
+
+    void TransformHierarchy::SetLocalScale(u32 node, const XMFLOAT3& scale)
+    {
+        m_LocalScale[node] = scale;
+        MarkDirty(node);
+    }
+
+    void TransformHierarchy::SetLocalTransform(u32 node, const XMFLOAT3& position, const XMFLOAT4& rotation, const XMFLOAT3& scale)
+    {
+        m_LocalPosition[node] = position;
+        m_LocalRotation[node] = rotation;
+        m_LocalScale[node] = scale;
+        MarkDirty(node);
+    }
+
+    void TransformHierarchy::MarkDirty(u32 node)
+    {
+        if (m_Dirty[node])
+            return;
+
+        m_Dirty[node] = 1;
+        m_DirtyNodes.push_back(node);
+    }
+
+    void TransformHierarchy::ClearUpdatedFlags()
+    {
+        for (u32 node : m_UpdatedNodes)
+        {
+            m_Updated[node] = 0;
+        }
+        m_UpdatedNodes.clear();
+    }
+
+    void TransformHierarchy::CollectAffectedNodes()
+    {
+        // 父节点索引总是小于子节点，按索引升序处理脏节点时祖先一定先被处理；
+        // 已经在祖先的子树里收集过的脏节点直接跳过，每个节点最多访问一次
+        std::sort(m_DirtyNodes.begin(), m_DirtyNodes.end());
+        for (u32 dirty : m_DirtyNodes)
+        {
+            m_Dirty[dirty] = 0;
+            if (m_Updated[dirty])
+                continue;
+
+            m_TraversalStack.push_back(dirty);
+            while (!m_TraversalStack.empty())
+            {
+                const u32 node = m_TraversalStack.back();
+                m_TraversalStack.pop_back();
+
+                m_Updated[node] = 1;
+                m_UpdatedNodes.push_back(node);
+                for (u32 child = m_FirstChild[node]; child != INVALID_NODE; child = m_NextSibling[child])
+                {
+                    m_TraversalStack.push_back(child);
+                }
+            }
+        }
+        m_DirtyNodes.clear();
+
+        // 升序即“父在子前”，串行路径可以直接按这个顺序计算
+        std::sort(m_UpdatedNodes.begin(), m_UpdatedNodes.end());
+    }
+
+    void TransformHierarchy::ComputeNode(u32 node)
+    {
+        // XMMatrixMultiply / XMMatrixInverse 走 DirectXMath 的 SIMD 路径
+        XMMATRIX world = ComposeLocalMatrix(m_LocalPosition[node], m_LocalRotation[node], m_LocalScale[node]);
+        const u32 parent = m_Parent[node];
+        if (parent != INVALID_NODE)
+        {
+            world = XMMatrixMultiply(world, XMLoadFloat4x4(&m_World[parent]));
+        }
+
+        XMStoreFloat4x4(&m_World[node], world);
+        XMStoreFloat4x4(&m_WorldInvTranspose[node], XMMatrixTranspose(XMMatrixInverse(nullptr, world)));
+    }
+
+    void TransformHierarchy::UpdateSerial()
+    {
+        for (u32 node : m_UpdatedNodes)
+        {
+            ComputeNode(node);
+        }
+    }
+
+    void TransformHierarchy::UpdateParallel()
+    {
+        for (auto& level : m_Levels)
+        {
+            level.clear();
+        }
+        for (u32 node : m_UpdatedNodes)
+        {
+            const u32 depth = m_Depth[node];
+            if (depth >= m_Levels.size())
+            {
+                m_Levels.resize(depth + 1);
+            }
+            m_Levels[depth].push_back(node);
+        }
+
+        // 逐层推进：上一层全部完成后，本层节点读取的父节点矩阵已经就绪
+        for (const auto& level : m_Levels)
+        {
+            JobSystem::RunParallelFor(static_cast<u32>(level.size()), PARALLEL_BATCH_SIZE, [this, &level](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    ComputeNode(level[i]);
+                }
+            });
+        }
+    }
+
+    u32 TransformHierarchy::Update()
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        ClearUpdatedFlags();
+
+        m_Stats.nodeCount = GetNodeCount();
+        m_Stats.dirtyNodes = static_cast<u32>(m_DirtyNodes.size());
+
+        if (!m_DirtyNodes.empty())
+        {
+            CollectAffectedNodes();
+            if (JobSystem::GetThreadCount() > 1 && m_UpdatedNodes.size() >= PARALLEL_THRESHOLD)
+            {
+                UpdateParallel();
+            }
+            else
+            {
+                UpdateSerial();
+            }
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        m_Stats.updatedNodes = static_cast<u32>(m_UpdatedNodes.size());
+        m_Stats.updateTimeMs = std::chrono::duration<f32, std::milli>(endTime - startTime).count();
+
+        return m_Stats.updatedNodes;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <DirectXMath.h>
+#include <vector>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // 变换层级统计
+    struct TransformHierarchyStats
+    {
+        u32 nodeCount = 0;
+        u32 dirtyNodes = 0;         // 本次更新前被直接修改的节点
+        u32 updatedNodes = 0;       // 实际重新计算的节点（含被传播的子树）
+        f32 updateTimeMs = 0.0f;
+    };
+
+    // 数据导向的变换层级
+    // - 局部 TRS / 世界矩阵按 SoA 存储
+    // - 父节点必须先于子节点创建，索引小的节点不可能是索引大的节点的后代
+    // - 被修改的节点记录在脏列表里，Update 只遍历脏节点的子树，
+    //   开销与受影响的节点数成正比，与层级总节点数无关
+    // - 只重新计算受影响的节点（世界矩阵 + 法线用的逆转置矩阵）
+    // - 受影响的节点较多时按深度分层，在任务系统上逐层并行计算
+    class TransformHierarchy
+    {
+    public:
+        static constexpr u32 INVALID_NODE = ~0u;
+        static constexpr u32 PARALLEL_THRESHOLD = 4096;    // 受影响的节点少于此数时串行更新
+        static constexpr u32 PARALLEL_BATCH_SIZE = 512;
+
+        TransformHierarchy() = default;
+
+        void Clear();
+        void Reserve(u32 count);
+
+        // 创建节点，parent 必须是已存在的节点或 INVALID_NODE
+        u32 CreateNode(u32 parent = INVALID_NODE);
+
+        u32 GetNodeCount() const { return static_cast<u32>(m_Parent.size()); }
+        u32 GetParent(u32 node) const { return m_Parent[node]; }
+        u32 GetDepth(u32 node) const { return m_Depth[node]; }
+        bool IsValid(u32 node) const { return node < GetNodeCount(); }
+
+        // 局部变换（旋转为四元数）
+        void SetLocalPosition(u32 node, const XMFLOAT3& position);
+        void SetLocalRotation(u32 node, const XMFLOAT4& rotation);
+        void SetLocalRotationEuler(u32 node, const XMFLOAT3& degrees);   // 与场景文件一致：Roll/Pitch/Yaw（度）
+        void SetLocalScale(u32 node, const XMFLOAT3& scale);
+        void SetLocalTransform(u32 node, const XMFLOAT3& position, const XMFLOAT4& rotation, const XMFLOAT3& scale);
+
+        const XMFLOAT3& GetLocalPosition(u32 node) const { return m_LocalPosition[node]; }
+        const XMFLOAT4& GetLocalRotation(u32 node) const { return m_LocalRotation[node]; }
+        const XMFLOAT3& GetLocalScale(u32 node) const { return m_LocalScale[node]; }
+
+        void MarkDirty(u32 node);
+        bool HasDirtyNodes() const { return !m_DirtyNodes.empty(); }
+
+        // 传播脏标记并重新计算受影响的世界矩阵，返回重新计算的节点数
+        u32 Update();
+
+        // 世界矩阵（行主序，与 SceneObject::transform 约定一致）
+        const XMFLOAT4X4& GetWorldMatrix(u32 node) const { return m_World[node]; }
+        const XMFLOAT4X4& GetWorldInvTranspose(u32 node) const { return m_WorldInvTranspose[node]; }
+
+        // 最近一次 Update 中世界矩阵发生变化的节点（按索引升序）
+        bool WasUpdated(u32 node) const { return m_Updated[node] != 0; }
+        const std::vector<u32>& GetUpdatedNodes() const { return m_UpdatedNodes; }
+
+        const TransformHierarchyStats& GetStats() const { return m_Stats; }
+
+    private:
+        void ClearUpdatedFlags();
+        void CollectAffectedNodes();
+        void ComputeNode(u32 node);
+        void UpdateSerial();
+        void UpdateParallel();
+
+    private:
+        // SoA 数据
+        std::vector<u32> m_Parent;
+        std::vector<XMFLOAT3> m_LocalPosition;
+        std::vector<XMFLOAT4> m_LocalRotation;
+        std::vector<XMFLOAT3> m_LocalScale;
+        std::vector<XMFLOAT4X4> m_World;
+        std::vector<XMFLOAT4X4> m_WorldInvTranspose;
+        std::vector<u8> m_Dirty;
+        std::vector<u8> m_Updated;
+        std::vector<u32> m_Depth;
+
+        // 子节点链表，用于从脏节点向下遍历子树
+        std::vector<u32> m_FirstChild;
+        std::vector<u32> m_NextSibling;
+
+        std::vector<u32> m_DirtyNodes;      // 自上次 Update 以来被直接修改的节点
+        std::vector<u32> m_UpdatedNodes;
+        std::vector<u32> m_TraversalStack;
+
+        // 并行路径按深度分组的受影响节点，同层节点互不依赖
+        std::vector<std::vector<u32>> m_Levels;
+
+        TransformHierarchyStats m_Stats;
+    };
+}
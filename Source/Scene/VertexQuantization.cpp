@@ -0,0 +1,142 @@
+#include "Scene/VertexQuantization.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u32 QUANTIZE_BATCH_SIZE = 4096;
+
+        inline f32 SignNotZero(f32 v)
+        {
+            return v >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        inline u16 EncodeUnorm16(f32 v)
+        {
+            return static_cast<u16>(std::lround(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+        }
+
+        inline i16 EncodeSnorm16(f32 v)
+        {
+            return static_cast<i16>(std::lround(std::clamp(v, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        // 与 D3D 的 SNORM 解码规则一致：-32768 与 -32767 都解码为 -1
+        inline f32 DecodeSnorm16(i16 v)
+        {
+            return std::max(static_cast<f32>(v) / 32767.0f, -1.0f);
+        }
+
+        inline u32 EncodeColorRGBA8(const XMFLOAT4& c)
+        {
+            auto channel = [](f32 v) { return static_cast<u32>(std::lround(std::clamp(v, 0.0f, 1.0f) * 255.0f)); };
+            return channel(c.x) | (channel(c.y) << 8) | (channel(c.z) << 16) | (channel(c.w) << 24);
+        }
+
+        inline XMFLOAT4 DecodeColorRGBA8(u32 c)
+        {
+            auto channel = [c](u32 shift) { return static_cast<f32>((c >> shift) & 0xFF) / 255.0f; };
+            return { channel(0), channel(8), channel(16), channel(24) };
+        }
+
+        inline f32 InverseScale(f32 scale)
+        {
+            return scale > 0.0f ? 1.0f / scale : 0.0f;
+        }
+    }
+
+    VertexQuantization ComputeVertexQuantization(const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax)
+    {
+        VertexQuantization q;
+        q.offset = boundsMin;
+        q.scale = { std::max(boundsMax.x - boundsMin.x, 0.0f),
+                    std::max(boundsMax.y - boundsMin.y, 0.0f),
+                    std::max(boundsMax.z - boundsMin.z, 0.0f) };
+        return q;
+    }
+
+    u32 GetVertexStride(VertexFormat format)
+    {
+        return format == VertexFormat::Quantized ? sizeof(QuantizedVertex) : sizeof(Vertex);
+    }
+
+    void EncodeOctahedralNormal(const XMFLOAT3& normal, i16 outEncoded[2])
+    {
+        // 投影到八面体 |x|+|y|+|z|=1，下半球沿对角线折叠到外侧三角形
+        f32 invL1 = 1.0f / std::max(std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z), 1e-20f);
+        f32 x = normal.x * invL1;
+        f32 y = normal.y * invL1;
+        if (normal.z < 0.0f)
+        {
+            f32 foldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+            f32 foldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+            x = foldedX;
+            y = foldedY;
+        }
+        outEncoded[0] = EncodeSnorm16(x);
+        outEncoded[1] = EncodeSnorm16(y);
+    }
+
+    XMFLOAT3 DecodeOctahedralNormal(const i16 encoded[2])
+    {
+        // 与 Shaders/VertexQuantization.hlsli 中的 DecodeOctahedralNormal 保持一致
+        f32 x = DecodeSnorm16(encoded[0]);
+        f32 y = DecodeSnorm16(encoded[1]);
+        f32 z = 1.0f - std::abs(x) - std::abs(y);
+        f32 t = std::max(-z, 0.0f);
+        x += x >= 0.0f ? -t : t;
+        y += y >= 0.0f ? -t : t;
+        f32 invLen = 1.0f / std::sqrt(x * x + y * y + z * z);
+        return { x * invLen, y * invLen, z * invLen };
+    }
+
+    QuantizedVertex QuantizeVertex(const Vertex& vertex, const VertexQuantization& quantization)
+    {
+        QuantizedVertex out;
+        out.position[0] = EncodeUnorm16((vertex.position.x - quantization.offset.x) * InverseScale(quantization.scale.x));
+        out.position[1] = EncodeUnorm16((vertex.position.y - quantization.offset.y) * InverseScale(quantization.scale.y));
+        out.position[2] = EncodeUnorm16((vertex.position.z - quantization.offset.z) * InverseScale(quantization.scale.z));
+        out.position[3] = 0;
+        EncodeOctahedralNormal(vertex.normal, out.normal);
+        out.texCoord[0] = PackedVector::XMConvertFloatToHalf(vertex.texCoord.x);
+        out.texCoord[1] = PackedVector::XMConvertFloatToHalf(vertex.texCoord.y);
+        out.color = EncodeColorRGBA8(vertex.color);
+        return out;
+    }
+
+    Vertex DequantizeVertex(const QuantizedVertex& vertex, const VertexQuantization& quantization)
+    {
+        Vertex out;
+        out.position = { vertex.position[0] / 65535.0f * quantization.scale.x + quantization.offset.x,
+                         vertex.position[1] / 65535.0f * quantization.scale.y + quantization.offset.y,
+                         vertex.position[2] / 65535.0f * quantization.scale.z + quantization.offset.z };
+        out.normal = DecodeOctahedralNormal(vertex.normal);
+        out.texCoord = { PackedVector::XMConvertHalfToFloat(vertex.texCoord[0]),
+                         PackedVector::XMConvertHalfToFloat(vertex.texCoord[1]) };
+        out.color = DecodeColorRGBA8(vertex.color);
+        return out;
+    }
+
+    void QuantizeVertices(std::span<const Vertex> vertices, const VertexQuantization& quantization,
+                          std::span<QuantizedVertex> output)
+    {
+        if (output.size() != vertices.size())
+        {
+            SEA_CORE_ERROR("QuantizeVertices: output size {} does not match vertex count {}", output.size(), vertices.size());
+            return;
+        }
+
+        JobSystem::RunParallelFor(static_cast<u32>(vertices.size()), QUANTIZE_BATCH_SIZE, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+            {
+                output[i] = QuantizeVertex(vertices[i], quantization);
+            }
+        });
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include <DirectXMath.h>
+#include <span>
+
+namespace Sea
+{
+    using namespace DirectX;
+
+    // GPU 顶点格式
+    enum class VertexFormat : u8
+    {
+        Standard,   // Vertex，48 字节全 float
+        Quantized   // QuantizedVertex，20 字节
+    };
+
+    // 压缩顶点，对应的输入布局：
+    //   position  R16G16B16A16_UNORM  包围盒内归一化，w 未使用
+    //   normal    R16G16_SNORM        八面体编码
+    //   texCoord  R16G16_FLOAT        半精度，支持 [0,1] 以外的平铺 UV
+    //   color     R8G8B8A8_UNORM
+    struct QuantizedVertex
+    {
+        u16 position[4];
+        i16 normal[2];
+        u16 texCoord[2];
+        u32 color;
+    };
+    static_assert(sizeof(QuantizedVertex) == 20, "QuantizedVertex layout must match the input layout");
+
+    // 位置量化参数：position = unorm * scale + offset
+    // 反量化矩阵折叠进世界矩阵，着色器里不需要额外的常量
+    struct VertexQuantization
+    {
+        XMFLOAT3 offset = { 0, 0, 0 };
+        XMFLOAT3 scale = { 1, 1, 1 };
+
+        XMMATRIX GetDequantizeMatrix() const
+        {
+            return XMMatrixScaling(scale.x, scale.y, scale.z) * XMMatrixTranslation(offset.x, offset.y, offset.z);
+        }
+    };
+
+    VertexQuantization ComputeVertexQuantization(const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax);
+
+    u32 GetVertexStride(VertexFormat format);
+
+    // 八面体法线编码（Cigolle et al. 2014），输入需为单位向量
+    void EncodeOctahedralNormal(const XMFLOAT3& normal, i16 outEncoded[2]);
+    XMFLOAT3 DecodeOctahedralNormal(const i16 encoded[2]);
+
+    QuantizedVertex QuantizeVertex(const Vertex& vertex, const VertexQuantization& quantization);
+    Vertex DequantizeVertex(const QuantizedVertex& vertex, const VertexQuantization& quantization);
+
+    // 批量量化（在 JobSystem 上并行），output 大小需与 vertices 相同
+    void QuantizeVertices(std::span<const Vertex> vertices, const VertexQuantization& quantization,
+                          std::span<QuantizedVertex> output);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core/Types.h"
+#include <string>
+#include <vector>
+
+namespace Sea
+{
+    // 基准测试注册表
+    // 每个基准是一个无参函数，结果输出到日志；SeaBenchmarks 按名字筛选运行
+    struct BenchmarkEntry
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    std::vector<BenchmarkEntry>& GetBenchmarkRegistry();
+
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(const char* name, void (*function)())
+        {
+            GetBenchmarkRegistry().push_back({ name, function });
+        }
+    };
+}
+
+// 定义并注册一个基准：SEA_BENCHMARK(TransformHierarchy) { ... }
+#define SEA_BENCHMARK(Name) \
+    static void Benchmark##Name(); \
+    static ::Sea::BenchmarkRegistrar s_Benchmark##Name##Registrar(#Name, &Benchmark##Name); \
+    static void Benchmark##Name()
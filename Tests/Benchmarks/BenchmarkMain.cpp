@@ -0,0 +1,42 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/Log.h"
+#include <cstring>
+
+namespace Sea
+{
+    std::vector<BenchmarkEntry>& GetBenchmarkRegistry()
+    {
+        static std::vector<BenchmarkEntry> registry;
+        return registry;
+    }
+}
+
+// 用法：SeaBenchmarks [名字子串 ...]，不带参数时运行全部基准
+int main(int argc, char** argv)
+{
+    Sea::Log::Initialize("SeaBenchmarks.log");
+
+    int ran = 0;
+    for (const auto& entry : Sea::GetBenchmarkRegistry())
+    {
+        bool selected = (argc <= 1);
+        for (int i = 1; i < argc && !selected; ++i)
+        {
+            selected = std::strstr(entry.name, argv[i]) != nullptr;
+        }
+        if (!selected)
+            continue;
+
+        SEA_CORE_INFO("=== {} ===", entry.name);
+        entry.function();
+        ++ran;
+    }
+
+    if (ran == 0)
+    {
+        SEA_CORE_WARN("No benchmark matched the given names");
+    }
+
+    Sea::Log::Shutdown();
+    return ran > 0 ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshReference.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace Sea
+{
+    // 模型相关基准的输入文件
+    // 环境变量 SEA_BENCHMARK_OBJ 指定了模型时直接使用，否则在临时目录生成一个细分球体（约 59 万三角形），析构时删除
+    class BenchmarkOBJFile : public NonCopyable
+    {
+    public:
+        explicit BenchmarkOBJFile(const char* name)
+        {
+            const char* path = std::getenv("SEA_BENCHMARK_OBJ");
+            if (path && *path)
+            {
+                m_Path = path;
+                return;
+            }
+
+            m_Generated = std::filesystem::temp_directory_path() / (std::string("SeaBenchmark_") + name + ".obj");
+            std::ofstream(m_Generated, std::ios::binary) << MakeSphereOBJ(384, 768, 8);
+            m_Path = m_Generated.string();
+        }
+
+        ~BenchmarkOBJFile()
+        {
+            if (!m_Generated.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove(m_Generated, error);
+            }
+        }
+
+        const std::string& GetPath() const { return m_Path; }
+
+    private:
+        std::string m_Path;
+        std::filesystem::path m_Generated;
+    };
+}
@@ -0,0 +1,57 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/JobSystem.h"
+#include <cmath>
+#include <vector>
+
+namespace Sea
+{
+    // 任务系统自身的基准：纯计算的 ParallelFor 与带依赖的任务图
+    SEA_BENCHMARK(JobSystem)
+    {
+        // 纯计算：每个元素一段不可约的浮点运算
+        constexpr u32 ELEMENT_COUNT = 1u << 20;
+        std::vector<f32> data(ELEMENT_COUNT);
+
+        BenchmarkJobScaling("ParallelFor (1M elements)", [&data]() {
+            JobSystem::RunParallelFor(ELEMENT_COUNT, 4096, [&data](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    f32 x = static_cast<f32>(i) * 0.001f;
+                    for (u32 k = 0; k < 16; ++k)
+                    {
+                        x = std::sqrt(x * x + 1.0f) * 0.5f + std::sin(x);
+                    }
+                    data[i] = x;
+                }
+            });
+        });
+
+        // 任务图：多条 A -> B -> C 依赖链并行执行
+        constexpr u32 CHAIN_COUNT = 64;
+        constexpr u32 CHAIN_LENGTH = 8;
+        std::vector<f32> chainResults(CHAIN_COUNT);
+
+        BenchmarkJobScaling("Dependency chains (64 x 8)", [&chainResults]() {
+            std::vector<JobHandle> tails;
+            tails.reserve(CHAIN_COUNT);
+            for (u32 chain = 0; chain < CHAIN_COUNT; ++chain)
+            {
+                JobHandle previous;
+                for (u32 step = 0; step < CHAIN_LENGTH; ++step)
+                {
+                    JobHandle dependency[] = { previous };
+                    previous = JobSystem::Schedule([&chainResults, chain, step]() {
+                        f32 x = chainResults[chain] + static_cast<f32>(step);
+                        for (u32 k = 0; k < 2000; ++k)
+                        {
+                            x = std::sqrt(x * x + 1.0f) * 0.5f;
+                        }
+                        chainResults[chain] = x;
+                    }, dependency);
+                }
+                tails.push_back(previous);
+            }
+            JobSystem::WaitAll(tails);
+        });
+    }
+}
@@ -0,0 +1,94 @@
+#include "Benchmarks/Benchmark.h"
+#include "Benchmarks/BenchmarkOBJ.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/MeshCooker.h"
+#include "Scene/OBJLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace Sea
+{
+    // OBJ 解析 / 冷加载（解析 + 烘焙 + 映射）/ 热加载（哈希校验 + 映射）
+    SEA_BENCHMARK(CookedMeshLoad)
+    {
+        constexpr u32 ITERATIONS = 3;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+        };
+
+        // 每条路径最后都把顶点/索引复制到一块暂存内存，模拟上传到 GPU 的那一次拷贝
+        std::vector<u8> uploadScratch;
+        auto simulateUpload = [&uploadScratch](std::span<const Vertex> vertices, std::span<const u32> indices) {
+            const size_t vertexBytes = vertices.size_bytes();
+            uploadScratch.resize(vertexBytes + indices.size_bytes());
+            std::memcpy(uploadScratch.data(), vertices.data(), vertexBytes);
+            std::memcpy(uploadScratch.data() + vertexBytes, indices.data(), indices.size_bytes());
+        };
+
+        JobSystem::Initialize();
+        BenchmarkOBJFile file("CookedMeshLoad");
+        const std::string& objPath = file.GetPath();
+        const std::filesystem::path cookedPath = GetCookedMeshPath(objPath);
+
+        f64 objMs = 0.0;
+        f64 coldMs = 0.0;
+        f64 warmMs = 0.0;
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        bool identical = true;
+
+        for (u32 i = 0; i < ITERATIONS; ++i)
+        {
+            auto start = Clock::now();
+            MeshData data;
+            if (!LoadOBJ(objPath, data))
+                break;
+            simulateUpload(data.vertices, data.indices);
+            objMs += elapsedMs(start);
+
+            std::error_code ec;
+            std::filesystem::remove(cookedPath, ec);
+
+            start = Clock::now();
+            CookedMesh cold;
+            if (!LoadMeshCached(objPath, cold))
+                break;
+            simulateUpload(cold.GetVertices(), cold.GetIndices());
+            coldMs += elapsedMs(start);
+            cold.Close();
+
+            start = Clock::now();
+            CookedMesh warm;
+            if (!LoadMeshCached(objPath, warm))
+                break;
+            simulateUpload(warm.GetVertices(), warm.GetIndices());
+            warmMs += elapsedMs(start);
+
+            identical &= warm.GetVertices().size() == data.vertices.size() &&
+                         std::equal(data.indices.begin(), data.indices.end(), warm.GetIndices().begin(), warm.GetIndices().end()) &&
+                         std::memcmp(data.vertices.data(), warm.GetVertices().data(), warm.GetVertices().size_bytes()) == 0;
+            vertexCount = data.vertices.size();
+            indexCount = data.indices.size();
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(cookedPath, ec);
+        JobSystem::Shutdown();
+
+        SEA_CORE_INFO("Cooked mesh benchmark: {} ({} vertices, {} indices, {} iterations)",
+                      objPath, vertexCount, indexCount, ITERATIONS);
+        SEA_CORE_INFO("  OBJ parse:                  {:.2f} ms", objMs / ITERATIONS);
+        SEA_CORE_INFO("  Cold (parse + cook + mmap): {:.2f} ms", coldMs / ITERATIONS);
+        SEA_CORE_INFO("  Warm (hash + mmap):         {:.2f} ms ({:.1f}x vs OBJ)",
+                      warmMs / ITERATIONS, warmMs > 0.0 ? objMs / warmMs : 0.0);
+        if (!identical)
+        {
+            SEA_CORE_ERROR("  Cooked mesh contents differ from OBJ load!");
+        }
+    }
+}
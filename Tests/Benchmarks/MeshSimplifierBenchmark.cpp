@@ -0,0 +1,342 @@
+#include "Benchmarks/Benchmark.h"
+#include "Benchmarks/BenchmarkOBJ.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/MeshCooker.h"
+#include "Scene/MeshSimplifier.h"
+#include "Scene/OBJLoader.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        f32 Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        f32 Length(const XMFLOAT3& v) { return std::sqrt(Dot(v, v)); }
+
+        // 点到三角形的最近距离（Ericson, Real-Time Collision Detection 5.1.5）
+        f32 PointTriangleDistance(const XMFLOAT3& p, const XMFLOAT3& a, const XMFLOAT3& b, const XMFLOAT3& c)
+        {
+            const XMFLOAT3 ab = Sub(b, a), ac = Sub(c, a), ap = Sub(p, a);
+            const f32 d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+            if (d1 <= 0.0f && d2 <= 0.0f)
+                return Length(ap);
+
+            const XMFLOAT3 bp = Sub(p, b);
+            const f32 d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+            if (d3 >= 0.0f && d4 <= d3)
+                return Length(bp);
+
+            const f32 vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+            {
+                const f32 v = d1 / (d1 - d3);
+                return Length(Sub(ap, { ab.x * v, ab.y * v, ab.z * v }));
+            }
+
+            const XMFLOAT3 cp = Sub(p, c);
+            const f32 d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+            if (d6 >= 0.0f && d5 <= d6)
+                return Length(cp);
+
+            const f32 vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+            {
+                const f32 w = d2 / (d2 - d6);
+                return Length(Sub(ap, { ac.x * w, ac.y * w, ac.z * w }));
+            }
+
+            const f32 va = d3 * d6 - d5 * d4;
+            if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+            {
+                const f32 w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                const XMFLOAT3 bc = Sub(c, b);
+                return Length(Sub(bp, { bc.x * w, bc.y * w, bc.z * w }));
+            }
+
+            const f32 denom = 1.0f / (va + vb + vc);
+            const f32 v = vb * denom, w = vc * denom;
+            const XMFLOAT3 q = { a.x + ab.x * v + ac.x * w, a.y + ab.y * v + ac.y * w, a.z + ab.z * v + ac.z * w };
+            return Length(Sub(p, q));
+        }
+
+        // 均匀网格加速的点到三角形集合最近距离，用于测量 LOD 的实际误差
+        class TriangleGrid
+        {
+        public:
+            TriangleGrid(std::span<const Vertex> vertices, std::span<const u32> indices)
+                : m_Vertices(vertices), m_Indices(indices)
+            {
+                XMFLOAT3 boundsMax;
+                ComputeMeshBounds(vertices, m_Origin, boundsMax);
+                const u32 triangleCount = static_cast<u32>(indices.size() / 3);
+                const f32 diagonal = std::max(Length(Sub(boundsMax, m_Origin)), 1e-6f);
+                const f32 cellsPerAxis = std::clamp(std::cbrt(static_cast<f32>(triangleCount)) * 2.0f, 1.0f, 256.0f);
+
+                // 格子不小于三角形的平均尺寸，否则细长 / 巨大的三角形会被插入成千上万个格子
+                f64 extentSum = 0.0;
+                for (u32 t = 0; t < triangleCount; ++t)
+                {
+                    const XMFLOAT3& a = Position(t, 0);
+                    const XMFLOAT3& b = Position(t, 1);
+                    const XMFLOAT3& c = Position(t, 2);
+                    extentSum += std::max({ std::max({ a.x, b.x, c.x }) - std::min({ a.x, b.x, c.x }),
+                                            std::max({ a.y, b.y, c.y }) - std::min({ a.y, b.y, c.y }),
+                                            std::max({ a.z, b.z, c.z }) - std::min({ a.z, b.z, c.z }) });
+                }
+                const f32 meanExtent = triangleCount ? static_cast<f32>(extentSum / triangleCount) : 0.0f;
+                m_CellSize = std::max(diagonal / cellsPerAxis, meanExtent);
+
+                const XMFLOAT3 extent = Sub(boundsMax, m_Origin);
+                m_Dims[0] = std::max(1u, static_cast<u32>(extent.x / m_CellSize) + 1);
+                m_Dims[1] = std::max(1u, static_cast<u32>(extent.y / m_CellSize) + 1);
+                m_Dims[2] = std::max(1u, static_cast<u32>(extent.z / m_CellSize) + 1);
+
+                // 两遍：先计数再填充（CSR）
+                m_Offsets.assign(static_cast<size_t>(m_Dims[0]) * m_Dims[1] * m_Dims[2] + 1, 0);
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    std::vector<u32> cursor;
+                    if (pass == 1)
+                    {
+                        for (size_t i = 1; i < m_Offsets.size(); ++i)
+                            m_Offsets[i] += m_Offsets[i - 1];
+                        m_Items.resize(m_Offsets.back());
+                        cursor.assign(m_Offsets.begin(), m_Offsets.end() - 1);
+                    }
+
+                    for (u32 t = 0; t < triangleCount; ++t)
+                    {
+                        u32 lo[3], hi[3];
+                        TriangleCellRange(t, lo, hi);
+                        for (u32 z = lo[2]; z <= hi[2]; ++z)
+                            for (u32 y = lo[1]; y <= hi[1]; ++y)
+                                for (u32 x = lo[0]; x <= hi[0]; ++x)
+                                {
+                                    const size_t cell = CellIndex(x, y, z);
+                                    if (pass == 0)
+                                        ++m_Offsets[cell + 1];
+                                    else
+                                        m_Items[cursor[cell]++] = t;
+                                }
+                    }
+                }
+            }
+
+            f32 Distance(const XMFLOAT3& p) const
+            {
+                i32 center[3];
+                for (u32 a = 0; a < 3; ++a)
+                {
+                    const f32 coord = (a == 0 ? p.x - m_Origin.x : a == 1 ? p.y - m_Origin.y : p.z - m_Origin.z) / m_CellSize;
+                    center[a] = std::clamp(static_cast<i32>(coord), 0, static_cast<i32>(m_Dims[a]) - 1);
+                }
+
+                // 按切比雪夫距离一圈一圈向外找，已找到的距离不超过下一圈的下界时停止
+                const i32 maxRing = static_cast<i32>(std::max({ m_Dims[0], m_Dims[1], m_Dims[2] }));
+                f32 best = FLT_MAX;
+                for (i32 ring = 0; ring <= maxRing; ++ring)
+                {
+                    for (i32 z = center[2] - ring; z <= center[2] + ring; ++z)
+                        for (i32 y = center[1] - ring; y <= center[1] + ring; ++y)
+                            for (i32 x = center[0] - ring; x <= center[0] + ring; ++x)
+                            {
+                                if (std::max({ std::abs(x - center[0]), std::abs(y - center[1]), std::abs(z - center[2]) }) != ring)
+                                    continue;
+                                if (x < 0 || y < 0 || z < 0 || x >= static_cast<i32>(m_Dims[0]) ||
+                                    y >= static_cast<i32>(m_Dims[1]) || z >= static_cast<i32>(m_Dims[2]))
+                                    continue;
+                                const size_t cell = CellIndex(x, y, z);
+                                for (u32 i = m_Offsets[cell]; i < m_Offsets[cell + 1]; ++i)
+                                {
+                                    const u32 t = m_Items[i];
+                                    best = std::min(best, PointTriangleDistance(p, Position(t, 0), Position(t, 1), Position(t, 2)));
+                                }
+                            }
+                    if (best <= ring * m_CellSize)
+                        break;
+                }
+                return best;
+            }
+
+            // 一次查询大约要测试的三角形数（中心格子及一圈邻居）
+            f32 GetQueryCost() const
+            {
+                const f32 cellCount = static_cast<f32>(m_Offsets.size() - 1);
+                return std::min(static_cast<f32>(m_Items.size()), static_cast<f32>(m_Items.size()) / cellCount * 27.0f);
+            }
+
+        private:
+            const XMFLOAT3& Position(u32 t, u32 k) const { return m_Vertices[m_Indices[t * 3 + k]].position; }
+
+            size_t CellIndex(u32 x, u32 y, u32 z) const
+            {
+                return (static_cast<size_t>(z) * m_Dims[1] + y) * m_Dims[0] + x;
+            }
+
+            void TriangleCellRange(u32 t, u32 lo[3], u32 hi[3]) const
+            {
+                for (u32 a = 0; a < 3; ++a)
+                {
+                    f32 minCoord = FLT_MAX, maxCoord = -FLT_MAX;
+                    for (u32 k = 0; k < 3; ++k)
+                    {
+                        const XMFLOAT3& p = Position(t, k);
+                        const f32 coord = a == 0 ? p.x - m_Origin.x : a == 1 ? p.y - m_Origin.y : p.z - m_Origin.z;
+                        minCoord = std::min(minCoord, coord);
+                        maxCoord = std::max(maxCoord, coord);
+                    }
+                    lo[a] = std::min(static_cast<u32>(std::max(minCoord / m_CellSize, 0.0f)), m_Dims[a] - 1);
+                    hi[a] = std::min(static_cast<u32>(std::max(maxCoord / m_CellSize, 0.0f)), m_Dims[a] - 1);
+                }
+            }
+
+            std::span<const Vertex> m_Vertices;
+            std::span<const u32> m_Indices;
+            XMFLOAT3 m_Origin = {};
+            f32 m_CellSize = 1.0f;
+            u32 m_Dims[3] = { 1, 1, 1 };
+            std::vector<u32> m_Offsets;
+            std::vector<u32> m_Items;
+        };
+    }
+
+    // 各级 LOD 的简化吞吐、QEM 误差与实测误差（原网格顶点到 LOD 表面的最大 / 平均距离），
+    // 并检查接缝两侧的顶点没有被混用、每个子网格都还有三角形
+    SEA_BENCHMARK(MeshSimplification)
+    {
+        constexpr u32 LEVEL_COUNT = 5;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+        };
+
+        JobSystem::Initialize();
+        BenchmarkOBJFile file("MeshSimplification");
+        const std::string& objPath = file.GetPath();
+
+        MeshData data;
+        const bool loaded = LoadOBJ(objPath, data);
+        JobSystem::Shutdown();
+        if (!loaded)
+            return;
+
+        XMFLOAT3 boundsMin, boundsMax;
+        ComputeMeshBounds(data.vertices, boundsMin, boundsMax);
+        const f32 diagonal = std::max(Length(Sub(boundsMax, boundsMin)), 1e-6f);
+
+        // 全局编号的 LOD0 与分组，用于逐级单独计时
+        SubMesh whole;
+        whole.indexCount = static_cast<u32>(data.indices.size());
+        std::span<const SubMesh> ranges = data.subMeshes.empty() ? std::span<const SubMesh>(&whole, 1)
+                                                                  : std::span<const SubMesh>(data.subMeshes);
+        std::vector<u32> current;
+        std::vector<u32> currentGroups;
+        for (u32 s = 0; s < ranges.size(); ++s)
+        {
+            for (u32 i = 0; i + 2 < ranges[s].indexCount; i += 3)
+            {
+                for (u32 k = 0; k < 3; ++k)
+                    current.push_back(data.indices[ranges[s].indexOffset + i + k] + ranges[s].baseVertex);
+                currentGroups.push_back(s);
+            }
+        }
+
+        // UV 朝向与几何朝向不一致的三角形数：接缝两侧的顶点被混用时通常会产生跨图块、反向的 UV 三角形
+        auto countUVFlips = [&](std::span<const u32> indices) {
+            u32 flips = 0, oriented = 0;
+            for (size_t t = 0; t + 2 < indices.size(); t += 3)
+            {
+                const XMFLOAT2& a = data.vertices[indices[t]].texCoord;
+                const XMFLOAT2& b = data.vertices[indices[t + 1]].texCoord;
+                const XMFLOAT2& c = data.vertices[indices[t + 2]].texCoord;
+                const f32 uvArea = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+                oriented += uvArea != 0.0f ? 1 : 0;
+                flips += uvArea < 0.0f ? 1 : 0;
+            }
+            return std::min(flips, oriented - flips);   // 少数方向的数量
+        };
+
+        SEA_CORE_INFO("Simplification benchmark: {} ({} triangles, {} vertices, {} submeshes)",
+                      objPath, current.size() / 3, data.vertices.size(), ranges.size());
+        SEA_CORE_INFO("  LOD0: {} triangles, {} minority-UV-winding triangles", current.size() / 3, countUVFlips(current));
+
+        // 误差测量的采样点：原网格顶点（大模型按步长抽样，三角形分布很差时按查询代价再减少）
+        constexpr u32 MAX_ERROR_SAMPLES = 16384;
+        constexpr f32 ERROR_TEST_BUDGET = 2e8f;    // 每级最多做的点-三角形测试次数
+
+        LODChainOptions options;
+        f32 cumulativeError = 0.0f;
+        std::vector<u32> next;
+        std::vector<u32> nextGroups;
+        for (u32 level = 1; level < std::min(LEVEL_COUNT, MESH_MAX_LODS); ++level)
+        {
+            const u32 previousTriangles = static_cast<u32>(current.size() / 3);
+            const u32 target = static_cast<u32>(previousTriangles * options.reduction);
+
+            SimplifyStats stats;
+            auto start = Clock::now();
+            const f32 levelError = SimplifyMesh(data.vertices, current, currentGroups, target, 1.0f, next, nextGroups, &stats);
+            const f64 ms = elapsedMs(start);
+            cumulativeError += levelError;
+
+            const u32 triangleCount = static_cast<u32>(next.size() / 3);
+            if (triangleCount == 0)
+            {
+                SEA_CORE_WARN("  LOD{}: simplification produced no triangles", level);
+                break;
+            }
+
+            // 实测误差：原网格顶点到 LOD 表面的距离（单向 Hausdorff 的近似）
+            TriangleGrid grid(data.vertices, next);
+            const f32 maxSamples = std::clamp(ERROR_TEST_BUDGET / std::max(grid.GetQueryCost(), 1.0f), 64.0f,
+                                              static_cast<f32>(MAX_ERROR_SAMPLES));
+            const u32 sampleStride = std::max<u32>(1, static_cast<u32>(data.vertices.size() / maxSamples));
+            f64 errorSum = 0.0;
+            f32 errorMax = 0.0f;
+            u32 samples = 0;
+            for (u32 v = 0; v < data.vertices.size(); v += sampleStride)
+            {
+                const f32 distance = grid.Distance(data.vertices[v].position);
+                errorSum += distance;
+                errorMax = std::max(errorMax, distance);
+                ++samples;
+            }
+
+            u32 emptyGroups = 0;
+            std::vector<u8> groupUsed(ranges.size(), 0);
+            for (u32 g : currentGroups)
+                groupUsed[g] = 1;
+            for (u32 g : nextGroups)
+                groupUsed[g] = 2;
+            for (u8 used : groupUsed)
+                emptyGroups += used == 1 ? 1 : 0;
+
+            SEA_CORE_INFO("  LOD{}: {} -> {} triangles (target {}) in {:.2f} ms ({:.2f} M triangles/s), {} passes, {} collapses",
+                          level, previousTriangles, triangleCount, target, ms,
+                          ms > 0.0 ? previousTriangles / (ms * 1000.0) : 0.0, stats.passCount, stats.collapseCount);
+            SEA_CORE_INFO("        QEM error {:.4f}% (cumulative {:.4f}%), measured max {:.4f}% / mean {:.5f}% of diagonal",
+                          levelError * 100.0f, cumulativeError * 100.0f,
+                          errorMax / diagonal * 100.0f, samples ? errorSum / samples / diagonal * 100.0 : 0.0);
+            SEA_CORE_INFO("        {} seam / {} border / {} locked positions, {} minority-UV-winding triangles, {} empty submeshes",
+                          stats.seamVertices, stats.borderVertices, stats.lockedVertices, countUVFlips(next), emptyGroups);
+            if (emptyGroups > 0)
+                SEA_CORE_ERROR("        Simplification removed {} submeshes entirely", emptyGroups);
+
+            if (triangleCount > previousTriangles * 0.9f)
+            {
+                SEA_CORE_INFO("  Stopped: LOD{} reduced by less than 10%", level);
+                break;
+            }
+            current.swap(next);
+            currentGroups.swap(nextGroups);
+        }
+    }
+}
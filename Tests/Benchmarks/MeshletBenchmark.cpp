@@ -0,0 +1,106 @@
+#include "Benchmarks/Benchmark.h"
+#include "Benchmarks/BenchmarkOBJ.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/MeshCooker.h"
+#include "Scene/Meshlet.h"
+#include "Scene/MeshletReference.h"
+#include "Scene/OBJLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace Sea
+{
+    // meshlet 构建耗时与填充率，以及绕模型一圈的测试视角下被剔除的三角形比例
+    // 同时逐三角形检查剔除结果是否保守（被剔除的 meshlet 里不能有可见三角形）
+    SEA_BENCHMARK(Meshlets)
+    {
+        constexpr u32 BUILD_ITERATIONS = 3;
+        constexpr u32 VIEW_COUNT = 16;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+        };
+
+        JobSystem::Initialize();
+        BenchmarkOBJFile file("Meshlets");
+        const std::string& objPath = file.GetPath();
+
+        MeshData data;
+        if (!LoadOBJ(objPath, data))
+        {
+            JobSystem::Shutdown();
+            return;
+        }
+
+        // 构建
+        MeshletData meshlets;
+        f64 buildMs = 0.0;
+        for (u32 i = 0; i < BUILD_ITERATIONS; ++i)
+        {
+            auto start = Clock::now();
+            BuildMeshlets(data.vertices, data.indices, data.subMeshes, meshlets);
+            buildMs += elapsedMs(start);
+        }
+        buildMs /= BUILD_ITERATIONS;
+        const u32 threadCount = JobSystem::GetThreadCount();
+        JobSystem::Shutdown();
+
+        if (meshlets.IsEmpty())
+        {
+            SEA_CORE_WARN("Meshlet benchmark: {} produced no meshlets", objPath);
+            return;
+        }
+
+        const u64 triangleCount = data.indices.size() / 3;
+        u32 noConeCount = 0;
+        for (const MeshletBounds& bounds : meshlets.bounds)
+            noConeCount += bounds.coneCutoff >= 1.0f ? 1 : 0;
+        const f64 meshletCount = static_cast<f64>(meshlets.meshlets.size());
+
+        SEA_CORE_INFO("Meshlet benchmark: {} ({} triangles, {} threads)", objPath, triangleCount, threadCount);
+        SEA_CORE_INFO("  Build: {:.2f} ms ({:.1f} M triangles/s), {} meshlets",
+                      buildMs, buildMs > 0.0 ? triangleCount / (buildMs * 1000.0) : 0.0, meshlets.meshlets.size());
+        SEA_CORE_INFO("  Fill:  {:.1f}/{} vertices, {:.1f}/{} triangles per meshlet, {:.1f}% without usable cone",
+                      meshlets.vertices.size() / meshletCount, MESHLET_MAX_VERTICES,
+                      triangleCount / meshletCount, MESHLET_MAX_TRIANGLES, 100.0 * noConeCount / meshletCount);
+
+        XMFLOAT3 boundsMin, boundsMax;
+        ComputeMeshBounds(data.vertices, boundsMin, boundsMax);
+        const XMFLOAT3 center = { (boundsMin.x + boundsMax.x) * 0.5f, (boundsMin.y + boundsMax.y) * 0.5f, (boundsMin.z + boundsMax.z) * 0.5f };
+        const XMFLOAT3 extent = { boundsMax.x - boundsMin.x, boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z };
+        const f32 radius = std::max(std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z) * 0.5f, 1e-3f);
+
+        std::vector<MeshletDrawRange> ranges;
+        MeshletCullStats total;
+        f64 cullMs = 0.0;
+        u64 nonConservative = 0;
+
+        for (u32 v = 0; v < VIEW_COUNT; ++v)
+        {
+            const MeshletTestView view = MakeMeshletTestView(center, radius, v, VIEW_COUNT);
+
+            MeshletCullStats stats;
+            auto start = Clock::now();
+            CullMeshlets(meshlets, view.frustum, view.eye, view.world, ranges, &stats);
+            cullMs += elapsedMs(start);
+            total.Add(stats);
+
+            nonConservative += CountRejectedVisibleTriangles(data.vertices, data.indices, data.subMeshes, ranges, view, radius);
+        }
+
+        const f64 totalTriangles = static_cast<f64>(std::max<u64>(total.triangleCount, 1));
+        const f64 totalMeshlets = static_cast<f64>(std::max(total.meshletCount, 1u));
+        SEA_CORE_INFO("  Cull ({} views): {:.3f} ms/view, {:.1f}% of triangles rejected",
+                      VIEW_COUNT, cullMs / VIEW_COUNT, 100.0 * (total.triangleCount - total.visibleTriangles) / totalTriangles);
+        SEA_CORE_INFO("  Meshlets: {:.1f}% outside frustum, {:.1f}% back-facing",
+                      100.0 * total.frustumCulled / totalMeshlets, 100.0 * total.backfaceCulled / totalMeshlets);
+        if (nonConservative > 0)
+        {
+            SEA_CORE_ERROR("  {} visible triangles were rejected by meshlet culling!", nonConservative);
+        }
+    }
+}
@@ -0,0 +1,224 @@
+#include "Benchmarks/Benchmark.h"
+#include "Benchmarks/BenchmarkOBJ.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/MeshOptimizer.h"
+#include "Scene/OBJLoader.h"
+#include "Scene/OBJParser.h"
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        // 旧实现：每个索引拼一个字符串键去重，作为打包键哈希表的对照
+        void BuildIndexedMeshStringKeys(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::shape_t>& shapes,
+                                        std::vector<Vertex>& vertices, std::vector<u32>& indices)
+        {
+            std::unordered_map<std::string, u32> uniqueVertices;
+            for (const auto& shape : shapes)
+            {
+                for (const auto& index : shape.mesh.indices)
+                {
+                    std::string key = std::to_string(index.vertex_index) + "_" +
+                                      std::to_string(index.normal_index) + "_" +
+                                      std::to_string(index.texcoord_index);
+
+                    if (uniqueVertices.count(key) == 0)
+                    {
+                        uniqueVertices[key] = static_cast<u32>(vertices.size());
+
+                        Vertex vertex{};
+                        vertex.position = { attrib.vertices[3 * index.vertex_index + 0],
+                                            attrib.vertices[3 * index.vertex_index + 1],
+                                            attrib.vertices[3 * index.vertex_index + 2] };
+                        if (index.normal_index >= 0)
+                        {
+                            vertex.normal = { attrib.normals[3 * index.normal_index + 0],
+                                              attrib.normals[3 * index.normal_index + 1],
+                                              attrib.normals[3 * index.normal_index + 2] };
+                        }
+                        if (index.texcoord_index >= 0)
+                        {
+                            vertex.texCoord = { attrib.texcoords[2 * index.texcoord_index + 0],
+                                                1.0f - attrib.texcoords[2 * index.texcoord_index + 1] };
+                        }
+                        vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+                        vertices.push_back(vertex);
+                    }
+
+                    indices.push_back(uniqueVertices[key]);
+                }
+            }
+        }
+    }
+
+    // 同一份 OBJ 分别用字符串键 unordered_map 与 LoadOBJ 的打包键哈希表去重，并报告网格优化各阶段的 ACMR/ATVR
+    SEA_BENCHMARK(OBJLoad)
+    {
+        constexpr u32 ITERATIONS = 3;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start, Clock::time_point end) {
+            return std::chrono::duration<f64, std::milli>(end - start).count();
+        };
+
+        JobSystem::Initialize();
+        BenchmarkOBJFile file("OBJLoad");
+        const std::string& filepath = file.GetPath();
+
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::string warning;
+        if (ParseOBJParallel(filepath, "", attrib, shapes, materials, warning) != OBJParseResult::Success)
+        {
+            SEA_CORE_WARN("OBJ load benchmark: {} needs the tinyobjloader fallback", filepath);
+            JobSystem::Shutdown();
+            return;
+        }
+
+        f64 stringKeyMs = 0.0;
+        f64 packedKeyMs = 0.0;
+        f64 parseMs = 0.0;
+        f64 loadMs = 0.0;
+        bool identical = true;
+        OBJLoadStats stats;
+        std::vector<Vertex> vertices;
+        std::vector<u32> indices;
+
+        for (u32 i = 0; i < ITERATIONS; ++i)
+        {
+            vertices.clear();
+            indices.clear();
+            auto t0 = Clock::now();
+            BuildIndexedMeshStringKeys(attrib, shapes, vertices, indices);
+            auto t1 = Clock::now();
+
+            MeshData data;
+            LoadOBJ(filepath, data, &stats);
+            auto t2 = Clock::now();
+
+            stringKeyMs += elapsedMs(t0, t1);
+            parseMs += stats.parseTimeMs;
+            packedKeyMs += stats.dedupTimeMs;
+            loadMs += elapsedMs(t1, t2);
+
+            // 两种去重都按首次出现顺序编号，唯一顶点数必须一致
+            identical &= stats.uniqueVertices == vertices.size() && stats.indexCount == indices.size();
+        }
+
+        SEA_CORE_INFO("OBJ load benchmark: {} ({} indices -> {} vertices, {} iterations, {} threads)",
+                      filepath, stats.indexCount, stats.uniqueVertices, ITERATIONS, JobSystem::GetThreadCount());
+        SEA_CORE_INFO("  Parse:                 {:.1f} ms ({} chunks)", parseMs / ITERATIONS, stats.parseChunks);
+        SEA_CORE_INFO("  Dedup string keys:     {:.1f} ms", stringKeyMs / ITERATIONS);
+        SEA_CORE_INFO("  Dedup packed keys:     {:.1f} ms (table {} slots, {} growths)",
+                      packedKeyMs / ITERATIONS, stats.tableCapacity, stats.tableGrowths);
+        SEA_CORE_INFO("  Full LoadOBJ:          {:.1f} ms", loadMs / ITERATIONS);
+        if (!identical)
+        {
+            SEA_CORE_ERROR("  Packed-key dedup result differs from string-key dedup!");
+        }
+        JobSystem::Shutdown();
+
+        // 网格优化各阶段（整块索引，不区分子网格）
+        const u32 vertexCount = static_cast<u32>(vertices.size());
+        const VertexCacheStats original = AnalyzeVertexCache(indices, vertexCount);
+
+        auto t0 = Clock::now();
+        std::vector<u32> clusters;
+        OptimizeVertexCache(indices, vertexCount, &clusters);
+        auto t1 = Clock::now();
+        const VertexCacheStats tipsify = AnalyzeVertexCache(indices, vertexCount);
+
+        u32 clusterCount = 0;
+        OptimizeOverdraw(indices, vertices, clusters, 1.05f, &clusterCount);
+        auto t2 = Clock::now();
+        const VertexCacheStats overdraw = AnalyzeVertexCache(indices, vertexCount);
+
+        OptimizeVertexFetch(vertices, indices);
+        auto t3 = Clock::now();
+        const VertexCacheStats fetch = AnalyzeVertexCache(indices, static_cast<u32>(vertices.size()));
+
+        SEA_CORE_INFO("  Mesh optimization (FIFO {}):", VERTEX_CACHE_SIZE);
+        SEA_CORE_INFO("    Original:      ACMR {:.3f}  ATVR {:.3f}", original.acmr, original.atvr);
+        SEA_CORE_INFO("    Tipsify:       ACMR {:.3f}  ATVR {:.3f}  {:.1f} ms ({} hard clusters)",
+                      tipsify.acmr, tipsify.atvr, elapsedMs(t0, t1), clusters.size());
+        SEA_CORE_INFO("    + Overdraw:    ACMR {:.3f}  ATVR {:.3f}  {:.1f} ms ({} clusters)",
+                      overdraw.acmr, overdraw.atvr, elapsedMs(t1, t2), clusterCount);
+        SEA_CORE_INFO("    + Fetch remap: ACMR {:.3f}  ATVR {:.3f}  {:.1f} ms", fetch.acmr, fetch.atvr, elapsedMs(t2, t3));
+    }
+
+    // 多线程解析与 tinyobjloader 的结果比对，并在 1..16 个线程下测量解析耗时
+    SEA_BENCHMARK(OBJParse)
+    {
+        constexpr u32 ITERATIONS = 3;
+        constexpr u32 MAX_THREADS = 16;
+
+        BenchmarkOBJFile file("OBJParse");
+        const std::string& filepath = file.GetPath();
+        const std::string directory = filepath.substr(0, filepath.find_last_of("/\\") + 1);
+
+        // 参照：tinyobjloader 单线程解析
+        tinyobj::attrib_t referenceAttrib;
+        std::vector<tinyobj::shape_t> referenceShapes;
+        std::vector<tinyobj::material_t> referenceMaterials;
+        std::string warning, error;
+        auto serialStart = std::chrono::high_resolution_clock::now();
+        if (!tinyobj::LoadObj(&referenceAttrib, &referenceShapes, &referenceMaterials, &warning, &error,
+                              filepath.c_str(), directory.c_str()))
+        {
+            SEA_CORE_ERROR("OBJ parse benchmark: cannot load {} ({})", filepath, error);
+            return;
+        }
+        auto serialEnd = std::chrono::high_resolution_clock::now();
+
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        if (ParseOBJParallel(filepath, directory, attrib, shapes, materials, warning) != OBJParseResult::Success)
+        {
+            SEA_CORE_WARN("OBJ parse benchmark: {} uses features the parallel parser leaves to tinyobjloader", filepath);
+            return;
+        }
+
+        bool identical = attrib.vertices == referenceAttrib.vertices &&
+                         attrib.normals == referenceAttrib.normals &&
+                         attrib.texcoords == referenceAttrib.texcoords &&
+                         materials.size() == referenceMaterials.size() &&
+                         shapes.size() == referenceShapes.size();
+        size_t triangleCount = 0;
+        for (size_t s = 0; identical && s < shapes.size(); ++s)
+        {
+            const auto& actual = shapes[s].mesh;
+            const auto& expected = referenceShapes[s].mesh;
+            identical = actual.material_ids == expected.material_ids && actual.indices.size() == expected.indices.size();
+            for (size_t i = 0; identical && i < actual.indices.size(); ++i)
+            {
+                identical = actual.indices[i].vertex_index == expected.indices[i].vertex_index &&
+                            actual.indices[i].normal_index == expected.indices[i].normal_index &&
+                            actual.indices[i].texcoord_index == expected.indices[i].texcoord_index;
+            }
+            triangleCount += actual.indices.size() / 3;
+        }
+
+        SEA_CORE_INFO("OBJ parse benchmark: {} ({} positions, {} triangles)",
+                      filepath, attrib.vertices.size() / 3, triangleCount);
+        SEA_CORE_INFO("  tinyobjloader: {:.1f} ms", std::chrono::duration<f64, std::milli>(serialEnd - serialStart).count());
+        if (!identical)
+        {
+            SEA_CORE_ERROR("  Parallel parser output differs from tinyobjloader!");
+        }
+
+        BenchmarkJobScaling("Parallel OBJ parse", [&]() {
+            tinyobj::attrib_t scratchAttrib;
+            std::vector<tinyobj::shape_t> scratchShapes;
+            std::vector<tinyobj::material_t> scratchMaterials;
+            std::string scratchWarning;
+            ParseOBJParallel(filepath, directory, scratchAttrib, scratchShapes, scratchMaterials, scratchWarning);
+        }, ITERATIONS, MAX_THREADS);
+    }
+}
@@ -0,0 +1,112 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/OceanFFTCPU.h"
+#include "Scene/OceanFFTReference.h"
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    // mapSize 从 64 到 512，测量三个级联下调制、FFT、解包各阶段的耗时
+    SEA_BENCHMARK(OceanFFTCPU)
+    {
+        constexpr u32 ITERATIONS = 20;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start, Clock::time_point end) {
+            return std::chrono::duration<f64, std::milli>(end - start).count();
+        };
+
+        JobSystem::Initialize();
+        SEA_CORE_INFO("OceanFFTCPU benchmark ({} iterations, {} threads)", ITERATIONS, JobSystem::GetThreadCount());
+
+        for (u32 mapSize = 64; mapSize <= 512; mapSize *= 2)
+        {
+            OceanFFTCPU ocean;
+            if (!ocean.Initialize(MakeReferenceOceanParams(mapSize)))
+                break;
+
+            auto t0 = Clock::now();
+            ocean.Simulate(0.0f);
+            const f64 firstMs = elapsedMs(t0, Clock::now());
+
+            f64 modulateMs = 0.0, fftMs = 0.0, unpackMs = 0.0;
+            for (u32 i = 0; i < ITERATIONS; ++i)
+            {
+                for (u32 c = 0; c < ocean.GetCascadeCount(); ++c)
+                    ocean.GetCascadeParams(c).time = (i + 1) * 0.02f;
+
+                auto s0 = Clock::now();
+                ocean.ModulateSpectra();
+                auto s1 = Clock::now();
+                ocean.PerformFFT();
+                auto s2 = Clock::now();
+                ocean.UnpackFFTResults();
+                auto s3 = Clock::now();
+
+                modulateMs += elapsedMs(s0, s1);
+                fftMs += elapsedMs(s1, s2);
+                unpackMs += elapsedMs(s2, s3);
+            }
+            modulateMs /= ITERATIONS;
+            fftMs /= ITERATIONS;
+            unpackMs /= ITERATIONS;
+
+            // 复数 2D FFT 按 5·N²·log2(N²) 次浮点运算估算
+            const u32 fftCount = ocean.GetCascadeCount() * OceanFFTCPU::SPECTRA_PER_CASCADE;
+            const f64 flops = 5.0 * mapSize * mapSize * (2.0 * std::log2(static_cast<f64>(mapSize))) * fftCount;
+            const f64 totalMs = modulateMs + fftMs + unpackMs;
+            const f64 budgetMs = 1000.0 / ocean.GetParams().updatesPerSecond;
+
+            SEA_CORE_INFO("  {}x{} x{} cascades: spectrum+first frame {:.2f} ms | modulate {:.3f} ms, FFT {:.3f} ms ({:.2f} GFLOP/s), unpack {:.3f} ms, total {:.3f} ms ({} {:.0f} Hz budget)",
+                          mapSize, mapSize, ocean.GetCascadeCount(), firstMs, modulateMs, fftMs, flops / (fftMs * 1e6),
+                          unpackMs, totalMs, totalMs <= budgetMs ? "within" : "over", ocean.GetParams().updatesPerSecond);
+        }
+
+        JobSystem::Shutdown();
+    }
+
+    // 不同查询数量下 QueryHeights 的耗时（64x64，三个级联）
+    SEA_BENCHMARK(OceanHeightQueries)
+    {
+        constexpr u32 ITERATIONS = 20;
+        constexpr u32 COUNTS[] = { 1000, 10000, 100000 };
+        constexpr u32 MAP_SIZE = 64;
+
+        using Clock = std::chrono::high_resolution_clock;
+
+        JobSystem::Initialize();
+        OceanFFTCPU ocean;
+        if (!ocean.Initialize(MakeReferenceOceanParams(MAP_SIZE)))
+        {
+            JobSystem::Shutdown();
+            return;
+        }
+        ocean.Simulate(1.0f);
+
+        SEA_CORE_INFO("Ocean height query benchmark ({}x{}, {} cascades, {} iterations per query, {} threads)",
+                      MAP_SIZE, MAP_SIZE, ocean.GetCascadeCount(), OceanFFTCPU::QUERY_ITERATIONS, JobSystem::GetThreadCount());
+
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<f32> positionDist(-2000.0f, 2000.0f);
+        for (u32 count : COUNTS)
+        {
+            std::vector<XMFLOAT2> positions(count);
+            std::vector<f32> heights(count);
+            for (auto& position : positions)
+                position = XMFLOAT2(positionDist(rng), positionDist(rng));
+
+            auto start = Clock::now();
+            for (u32 i = 0; i < ITERATIONS; ++i)
+                ocean.QueryHeights(positions, heights);
+            const f64 ms = std::chrono::duration<f64, std::milli>(Clock::now() - start).count() / ITERATIONS;
+
+            SEA_CORE_INFO("  {:>6} queries: {:.3f} ms ({:.1f} ns/query)", count, ms, ms * 1e6 / count);
+        }
+
+        JobSystem::Shutdown();
+    }
+}
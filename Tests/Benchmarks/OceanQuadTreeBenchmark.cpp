@@ -0,0 +1,331 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/Log.h"
+#include "Scene/OceanQuadTree.h"
+#include "Scene/OceanQuadTreeReference.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        using Clock = std::chrono::high_resolution_clock;
+
+        f64 ElapsedMs(Clock::time_point start, Clock::time_point end)
+        {
+            return std::chrono::duration<f64, std::milli>(end - start).count();
+        }
+
+        // 相机路径：按 60 FPS 逐帧给出的相机位置与注视点
+        struct CameraPath
+        {
+            const char* name;
+            std::vector<XMFLOAT3> positions;
+            std::vector<XMFLOAT3> targets;
+        };
+
+        // 与示例程序相同的透视投影，远平面覆盖整个海面
+        Camera MakePathCamera(const CameraPath& path, u32 frame, f32 worldSize)
+        {
+            Camera camera;
+            camera.SetPerspective(60.0f, 16.0f / 9.0f, 0.1f, worldSize);
+            camera.SetPosition(path.positions[frame]);
+
+            // 按 Camera::UpdateVectors 的约定（forward.y = sin(pitch)）换算成欧拉角
+            const XMFLOAT3& position = path.positions[frame];
+            const XMFLOAT3& target = path.targets[frame];
+            XMFLOAT3 forward;
+            XMStoreFloat3(&forward, XMVector3Normalize(XMVectorSubtract(XMLoadFloat3(&target), XMLoadFloat3(&position))));
+            camera.SetRotation(XMConvertToDegrees(std::asin(forward.y)), XMConvertToDegrees(std::atan2(forward.x, forward.z)), 0.0f);
+            camera.Update();
+            return camera;
+        }
+
+        // 用解析公式合成的三条飞行路径（不是从示例程序中录下来的），覆盖低空平移、持续转向与快速下降
+        std::vector<CameraPath> SynthesizeFlythroughPaths(f32 worldSize, u32 frameCount)
+        {
+            std::vector<CameraPath> paths(3);
+            const f32 halfWorld = worldSize * 0.5f;
+            for (u32 frame = 0; frame < frameCount; ++frame)
+            {
+                const f32 t = static_cast<f32>(frame) / static_cast<f32>(frameCount - 1);
+
+                // 低空直线飞越海面，看向前方略低处
+                const XMFLOAT3 flyover = { -halfWorld * 0.8f + worldSize * 0.8f * t, 30.0f, halfWorld * 0.1f };
+                paths[0].positions.push_back(flyover);
+                paths[0].targets.push_back({ flyover.x + 200.0f, 0.0f, flyover.z });
+                // 绕中心盘旋，始终看向中心
+                const f32 angle = t * XM_2PI;
+                paths[1].positions.push_back({ std::cos(angle) * worldSize * 0.15f, 60.0f, std::sin(angle) * worldSize * 0.15f });
+                paths[1].targets.push_back({ 0.0f, 0.0f, 0.0f });
+                // 从高空俯冲到贴近水面，看向俯冲方向前方的海面
+                const XMFLOAT3 dive = { halfWorld * 0.3f * t, 400.0f - 398.0f * t, -halfWorld * 0.2f * t };
+                paths[2].positions.push_back(dive);
+                paths[2].targets.push_back({ dive.x + 300.0f, 0.0f, dive.z - 200.0f });
+            }
+            paths[0].name = "flyover";
+            paths[1].name = "orbit";
+            paths[2].name = "dive";
+            return paths;
+        }
+
+        // 一帧需要上传的实例数与区间数（与 OceanQuadTreeMesh::UploadInstances 的拷贝相同）
+        void CountUpload(OceanQuadTree& tree, std::vector<OceanInstanceRange>& ranges, u64& outInstances, u64& outRanges)
+        {
+            tree.GetDirtyRanges(ranges);
+            for (const OceanInstanceRange& range : ranges)
+                outInstances += range.count;
+            outRanges += ranges.size();
+            tree.ClearInstanceDirty();
+        }
+    }
+
+    // maxLOD 从 6 到 10，在几个相机位置下测量重建各阶段的耗时（目标 < 1 ms），
+    // 并与 O(L²) 的逐叶子暴力查找对比邻居 LOD 是否一致
+    SEA_BENCHMARK(OceanQuadTree)
+    {
+        constexpr u32 minLOD = 6;
+        constexpr u32 maxLOD = 10;
+        constexpr u32 iterations = 20;
+        constexpr f64 budgetMs = 1.0;
+
+        // 海面中心、偏离中心、靠近边界三个相机位置
+        const XMFLOAT3 cameraPositions[] = {
+            { 0.0f, 10.0f, 0.0f },
+            { 731.0f, 25.0f, -412.0f },
+            { 1890.0f, 5.0f, 1650.0f },
+        };
+
+        SEA_CORE_INFO("Ocean quadtree rebuild benchmark ({} iterations, budget {:.1f} ms)", iterations, budgetMs);
+        for (u32 lod = minLOD; lod <= maxLOD; ++lod)
+        {
+            // 不剔除：测的是所有节点都可见时的最坏情况
+            OceanQuadTreeConfig config;
+            config.maxLOD = lod;
+            config.enableFrustumCulling = false;
+
+            OceanQuadTree tree;
+            tree.Initialize(config);
+
+            for (const XMFLOAT3& position : cameraPositions)
+            {
+                Camera camera;
+                camera.SetPosition(position);
+                camera.Update();
+
+                f64 buildMs = 0.0, instanceMs = 0.0;
+                for (u32 i = 0; i < iterations; ++i)
+                {
+                    auto t0 = Clock::now();
+                    tree.BuildTree(camera);
+                    auto t1 = Clock::now();
+                    tree.UpdateInstances();
+                    auto t2 = Clock::now();
+
+                    buildMs += ElapsedMs(t0, t1);
+                    instanceMs += ElapsedMs(t1, t2);
+                }
+                buildMs /= iterations;
+                instanceMs /= iterations;
+
+                // 暴力查找作为参照：耗时与结果
+                u32 mismatches = 0;
+                u32 coarserEdges = 0;
+                auto t0 = Clock::now();
+                for (size_t i = 0; i < tree.GetLeafNodeIndices().size(); ++i)
+                {
+                    const OceanQuadNode& node = tree.GetNodes()[tree.GetLeafNodeIndices()[i]];
+                    const XMFLOAT4& fast = tree.GetRenderInstances()[i].neighborLOD;
+                    f32 reference[4];
+                    FindNeighborLODsBruteForce(tree, node, reference);
+                    const f32 result[4] = { fast.x, fast.y, fast.z, fast.w };
+                    for (u32 dir = 0; dir < 4; ++dir)
+                    {
+                        mismatches += (result[dir] != reference[dir]) ? 1 : 0;
+                        coarserEdges += (result[dir] > static_cast<f32>(node.lod)) ? 1 : 0;
+                    }
+                }
+                const f64 bruteForceMs = ElapsedMs(t0, Clock::now());
+
+                const f64 totalMs = buildMs + instanceMs;
+                SEA_CORE_INFO("  maxLOD {:2} camera ({:6.0f}, {:6.0f}): {:5} nodes {:5} leaves  build {:.3f} + instances {:.3f} = {:.3f} ms {}  "
+                              "(brute force neighbors {:.3f} ms)  stitched edges {}  mismatches {}",
+                              lod, position.x, position.z, tree.GetNodeCount(), tree.GetLeafCount(),
+                              buildMs, instanceMs, totalMs, totalMs <= budgetMs ? "OK" : "OVER BUDGET",
+                              bruteForceMs, coarserEdges, mismatches);
+                if (mismatches > 0)
+                {
+                    SEA_CORE_ERROR("Ocean quadtree neighbor LODs differ from the brute-force reference");
+                }
+            }
+        }
+    }
+
+    // 在合成的飞行路径（飞越、盘旋、俯冲）上逐帧对比完整重建与增量更新的耗时与上传量
+    SEA_BENCHMARK(OceanQuadTreeUpdate)
+    {
+        constexpr u32 frameCount = 600;
+
+        OceanQuadTreeConfig config;
+        config.maxLOD = 8;
+        const std::vector<CameraPath> paths = SynthesizeFlythroughPaths(config.worldSize, frameCount);
+        std::vector<OceanInstanceRange> ranges;
+
+        SEA_CORE_INFO("Ocean quadtree update benchmark: full rebuild vs incremental (maxLOD {}, {} frames per path)",
+                      config.maxLOD, frameCount);
+        for (const CameraPath& path : paths)
+        {
+            // 同一条路径分别用完整重建与增量更新回放，每帧都更新（不经过 Update 的移动距离门限）
+            f64 totalMs[2] = {};
+            f64 maxMs[2] = {};
+            u64 uploadedInstances[2] = {};
+            u64 patchRanges[2] = {};
+            u64 leafFrames[2] = {};
+
+            for (u32 mode = 0; mode < 2; ++mode)
+            {
+                const bool incremental = (mode == 1);
+                OceanQuadTree tree;
+                tree.Initialize(config);
+
+                for (u32 frame = 0; frame < path.positions.size(); ++frame)
+                {
+                    const Camera camera = MakePathCamera(path, frame, config.worldSize);
+
+                    auto t0 = Clock::now();
+                    if (incremental && frame > 0)
+                        tree.UpdateTree(camera);
+                    else
+                        tree.BuildTree(camera);
+                    tree.UpdateInstances();
+                    CountUpload(tree, ranges, uploadedInstances[mode], patchRanges[mode]);
+                    const f64 ms = ElapsedMs(t0, Clock::now());
+
+                    totalMs[mode] += ms;
+                    maxMs[mode] = std::max(maxMs[mode], ms);
+                    leafFrames[mode] += tree.GetLeafCount();
+                }
+            }
+
+            const f64 frames = static_cast<f64>(path.positions.size());
+            for (u32 mode = 0; mode < 2; ++mode)
+            {
+                SEA_CORE_INFO("  {:8} {:11}: avg {:.3f} ms  max {:.3f} ms  {:6.0f} leaves  upload {:7.2f} KB/frame in {:5.1f} ranges",
+                              path.name, mode == 0 ? "rebuild" : "incremental", totalMs[mode] / frames, maxMs[mode],
+                              leafFrames[mode] / frames,
+                              uploadedInstances[mode] * sizeof(OceanQuadInstance) / 1024.0 / frames, patchRanges[mode] / frames);
+            }
+            SEA_CORE_INFO("  {:8} speedup {:.1f}x, upload reduced {:.1f}x", path.name,
+                          totalMs[0] / std::max(totalMs[1], 1e-6),
+                          static_cast<f64>(uploadedInstances[0]) / std::max<u64>(uploadedInstances[1], 1));
+        }
+    }
+
+    // 在合成的飞行路径上对比只按距离选择与视锥体剔除的瓦片数、三角形数与更新耗时，
+    // 并检查剔除是保守的（未剔除时与视锥体相交的叶子，剔除后仍被可见叶子覆盖）
+    SEA_BENCHMARK(OceanQuadTreeCulling)
+    {
+        constexpr u32 frameCount = 600;
+        constexpr u32 coverageCheckInterval = 30;   // 覆盖检查每隔这么多帧做一次
+
+        OceanQuadTreeConfig config;
+        config.maxLOD = 8;
+        OceanQuadTreeConfig distanceConfig = config;
+        distanceConfig.enableFrustumCulling = false;
+
+        const std::vector<CameraPath> paths = SynthesizeFlythroughPaths(config.worldSize, frameCount);
+        const auto waveBounds = ComputeGerstnerWaveBounds(2.0f);   // Ocean 的默认锐度
+        const f32 trianglesPerTile = static_cast<f32>(config.baseMeshResolution * config.baseMeshResolution * 2);
+
+        f32 waveHeight = 0.0f, waveHorizontal = 0.0f;
+        for (const OceanWaveCascadeBounds& cascade : waveBounds)
+        {
+            waveHeight += cascade.maxHeight;
+            waveHorizontal += cascade.maxHorizontal;
+        }
+
+        SEA_CORE_INFO("Ocean quadtree culling benchmark: distance-only vs frustum culling (maxLOD {}, {} frames per path, "
+                      "wave padding {:.1f} m vertical / {:.1f} m horizontal)", config.maxLOD, frameCount, waveHeight, waveHorizontal);
+        u64 totalTiles[2] = {};
+        u32 totalMissing = 0;
+        for (const CameraPath& path : paths)
+        {
+            // 两棵树走同一条路径、都用增量更新；mode 0 = 只按距离，mode 1 = 视锥体剔除
+            OceanQuadTree distanceTree;
+            OceanQuadTree frustumTree;
+            distanceTree.Initialize(distanceConfig);
+            frustumTree.Initialize(config);
+            OceanQuadTree* trees[2] = { &distanceTree, &frustumTree };
+
+            f64 totalMs[2] = {};
+            u64 tiles[2] = {};
+            u32 missingTiles = 0;
+            for (u32 frame = 0; frame < path.positions.size(); ++frame)
+            {
+                const Camera camera = MakePathCamera(path, frame, config.worldSize);
+                for (u32 mode = 0; mode < 2; ++mode)
+                {
+                    OceanQuadTree& tree = *trees[mode];
+                    tree.SetWaveBounds(waveBounds);
+
+                    auto t0 = Clock::now();
+                    if (frame > 0)
+                        tree.UpdateTree(camera);
+                    else
+                        tree.BuildTree(camera);
+                    tree.UpdateInstances();
+                    tree.ClearInstanceDirty();
+                    totalMs[mode] += ElapsedMs(t0, Clock::now());
+                    tiles[mode] += tree.GetLeafCount();
+                }
+
+                if (frame % coverageCheckInterval != 0)
+                    continue;
+
+                // 剔除必须是保守的：只按距离选出的叶子，扩大后的包围盒与视锥体相交时，剔除后的树在它中心处也要有可见叶子
+                const Frustum frustum(camera.GetViewProjectionMatrix());
+                const std::vector<OceanQuadNode>& frustumNodes = frustumTree.GetNodes();
+                for (u32 leafIndex : distanceTree.GetLeafNodeIndices())
+                {
+                    const OceanQuadNode& leaf = distanceTree.GetNodes()[leafIndex];
+                    f32 leafHeight, leafHorizontal;
+                    distanceTree.GetWavePadding(leaf.distanceToCamera, leafHeight, leafHorizontal);
+                    const f32 extent = leaf.size * 0.5f + leafHorizontal;
+                    if (!frustum.IntersectsAABB({ leaf.center.x, 0.0f, leaf.center.y }, { extent, leafHeight, extent }))
+                        continue;
+
+                    u32 index = frustumTree.GetRootNodeIndex();
+                    while (!frustumNodes[index].isLeaf)
+                    {
+                        const OceanQuadNode& node = frustumNodes[index];
+                        const u32 quadrant = (leaf.center.x > node.center.x ? 1u : 0u) | (leaf.center.y > node.center.y ? 2u : 0u);
+                        index = node.childIndices[quadrant];
+                    }
+                    missingTiles += frustumNodes[index].inFrustum ? 0 : 1;
+                }
+            }
+
+            const f64 frames = static_cast<f64>(path.positions.size());
+            const f64 avgTiles[2] = { tiles[0] / frames, tiles[1] / frames };
+            SEA_CORE_INFO("  {:8}: tiles {:6.0f} -> {:6.0f} ({:4.1f}% saved)  triangles {:6.2f}M -> {:6.2f}M  "
+                          "update {:.3f} -> {:.3f} ms  missing tiles {}",
+                          path.name, avgTiles[0], avgTiles[1], 100.0 * (1.0 - avgTiles[1] / std::max(avgTiles[0], 1.0)),
+                          avgTiles[0] * trianglesPerTile / 1e6, avgTiles[1] * trianglesPerTile / 1e6,
+                          totalMs[0] / frames, totalMs[1] / frames, missingTiles);
+
+            totalTiles[0] += tiles[0];
+            totalTiles[1] += tiles[1];
+            totalMissing += missingTiles;
+        }
+
+        const u64 savedTiles = totalTiles[0] - std::min(totalTiles[0], totalTiles[1]);
+        SEA_CORE_INFO("  all paths: {} tile-frames and {:.1f}M triangle-frames saved ({:.1f}%)", savedTiles,
+                      savedTiles * trianglesPerTile / 1e6, 100.0 * savedTiles / std::max<u64>(totalTiles[0], 1));
+        if (totalMissing > 0)
+        {
+            SEA_CORE_ERROR("Ocean quadtree frustum culling removed {} tiles that intersect the view", totalMissing);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/TransformHierarchy.h"
+#include <algorithm>
+#include <random>
+
+namespace Sea
+{
+    // 100k 个节点的随机层级，每帧随机修改 1% 的节点：增量更新对比全量重算，
+    // 并测试全量重算在 1..N 线程下的扩展性
+    SEA_BENCHMARK(TransformHierarchy)
+    {
+        constexpr u32 nodeCount = 100000;
+        constexpr f32 dirtyFraction = 0.01f;
+        constexpr u32 frames = 60;
+
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<f32> offset(-1.0f, 1.0f);
+
+        // 随机树：每个节点的父节点从前面的节点中选取（约 10% 为根节点）
+        TransformHierarchy hierarchy;
+        hierarchy.Reserve(nodeCount);
+        for (u32 i = 0; i < nodeCount; ++i)
+        {
+            u32 parent = TransformHierarchy::INVALID_NODE;
+            if (i > 0 && (rng() % 10) != 0)
+            {
+                parent = rng() % i;
+            }
+            u32 node = hierarchy.CreateNode(parent);
+            hierarchy.SetLocalPosition(node, { offset(rng), offset(rng), offset(rng) });
+        }
+        hierarchy.Update();
+
+        const u32 dirtyPerFrame = std::max(1u, static_cast<u32>(nodeCount * dirtyFraction));
+        f64 incrementalMs = 0.0;
+        u64 updatedTotal = 0;
+
+        for (u32 frame = 0; frame < frames; ++frame)
+        {
+            for (u32 i = 0; i < dirtyPerFrame; ++i)
+            {
+                u32 node = rng() % nodeCount;
+                hierarchy.SetLocalPosition(node, { offset(rng), offset(rng), offset(rng) });
+            }
+            updatedTotal += hierarchy.Update();
+            incrementalMs += hierarchy.GetStats().updateTimeMs;
+        }
+
+        // 对照组：每帧全部标记为脏（等价于原先逐物体重算）
+        f64 fullMs = 0.0;
+        for (u32 frame = 0; frame < frames; ++frame)
+        {
+            for (u32 i = 0; i < nodeCount; ++i)
+            {
+                hierarchy.MarkDirty(i);
+            }
+            hierarchy.Update();
+            fullMs += hierarchy.GetStats().updateTimeMs;
+        }
+
+        SEA_CORE_INFO("TransformHierarchy benchmark: {} nodes, {} dirty/frame, {} frames", nodeCount, dirtyPerFrame, frames);
+        SEA_CORE_INFO("  Incremental: {:.3f} ms/frame ({} nodes updated/frame)",
+                      incrementalMs / frames, updatedTotal / frames);
+        SEA_CORE_INFO("  Full:        {:.3f} ms/frame", fullMs / frames);
+
+        BenchmarkJobScaling("TransformHierarchy full update", [&hierarchy]() {
+            for (u32 i = 0; i < nodeCount; ++i)
+            {
+                hierarchy.MarkDirty(i);
+            }
+            hierarchy.Update();
+        }, frames);
+    }
+}
@@ -0,0 +1,76 @@
+#include "Benchmarks/Benchmark.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include "Scene/RandomVertices.h"
+#include "Scene/VertexQuantization.h"
+#include <chrono>
+
+namespace Sea
+{
+    // 两种顶点格式的显存占用、顺序读取带宽以及编码吞吐
+    SEA_BENCHMARK(VertexQuantization)
+    {
+        constexpr u32 vertexCount = 1 << 20;
+        constexpr u32 iterations = 5;
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+        };
+
+        const XMFLOAT3 boundsMin = { -10.0f, -10.0f, -10.0f };
+        const XMFLOAT3 boundsMax = { 10.0f, 10.0f, 10.0f };
+        std::vector<Vertex> vertices = GenerateRandomVertices(vertexCount, boundsMin, boundsMax, 42);
+        std::vector<QuantizedVertex> quantized(vertexCount);
+        VertexQuantization q = ComputeVertexQuantization(boundsMin, boundsMax);
+
+        JobSystem::Initialize();
+        f64 encodeMs = 0.0;
+        for (u32 i = 0; i < iterations; ++i)
+        {
+            auto start = Clock::now();
+            QuantizeVertices(vertices, q, quantized);
+            encodeMs += elapsedMs(start);
+        }
+        const u32 threadCount = JobSystem::GetThreadCount();
+        JobSystem::Shutdown();
+
+        // 顺序读完整个顶点缓冲，近似顶点获取阶段的带宽需求
+        volatile u64 sink = 0;
+        auto streamRead = [&](const void* data, size_t bytes) {
+            auto start = Clock::now();
+            const u32* words = static_cast<const u32*>(data);
+            u64 sum = 0;
+            for (size_t w = 0; w < bytes / sizeof(u32); ++w)
+                sum += words[w];
+            sink = sink + sum;
+            return elapsedMs(start);
+        };
+
+        f64 standardReadMs = 0.0;
+        f64 quantizedReadMs = 0.0;
+        for (u32 i = 0; i < iterations; ++i)
+        {
+            standardReadMs += streamRead(vertices.data(), vertices.size() * sizeof(Vertex));
+            quantizedReadMs += streamRead(quantized.data(), quantized.size() * sizeof(QuantizedVertex));
+        }
+
+        const f64 standardMB = vertices.size() * sizeof(Vertex) / (1024.0 * 1024.0);
+        const f64 quantizedMB = quantized.size() * sizeof(QuantizedVertex) / (1024.0 * 1024.0);
+        encodeMs /= iterations;
+        standardReadMs /= iterations;
+        quantizedReadMs /= iterations;
+
+        SEA_CORE_INFO("Vertex quantization benchmark ({} vertices, {} iterations, {} threads)",
+                      vertexCount, iterations, threadCount);
+        SEA_CORE_INFO("  Memory:  Standard {:.2f} MB ({} B/vertex), Quantized {:.2f} MB ({} B/vertex), {:.1f}% saved",
+                      standardMB, sizeof(Vertex), quantizedMB, sizeof(QuantizedVertex),
+                      100.0 * (1.0 - quantizedMB / standardMB));
+        SEA_CORE_INFO("  Stream read: Standard {:.2f} ms ({:.2f} GB/s), Quantized {:.2f} ms ({:.2f} GB/s), {:.2f}x faster",
+                      standardReadMs, standardMB / 1024.0 / (standardReadMs / 1000.0),
+                      quantizedReadMs, quantizedMB / 1024.0 / (quantizedReadMs / 1000.0),
+                      quantizedReadMs > 0.0 ? standardReadMs / quantizedReadMs : 0.0);
+        SEA_CORE_INFO("  Encode:  {:.2f} ms ({:.1f} M vertices/s)",
+                      encodeMs, encodeMs > 0.0 ? vertexCount / (encodeMs * 1000.0) : 0.0);
+    }
+}
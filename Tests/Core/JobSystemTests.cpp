@@ -0,0 +1,152 @@
+#include "Core/JobSystem.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        // 每个测试独立初始化全局任务系统
+        class JobSystemTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override { JobSystem::Initialize(4); }
+            void TearDown() override { JobSystem::Shutdown(); }
+        };
+
+        void ExpectEachIndexOnce(u32 count)
+        {
+            std::vector<std::atomic<u32>> hits(count);
+            JobSystem::RunParallelFor(count, 7, [&hits](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    hits[i].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            for (u32 i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(hits[i].load(), 1u) << "index " << i;
+            }
+        }
+    }
+
+    TEST(JobSystemUninitializedTest, RunsInlineOnCallingThread)
+    {
+        ASSERT_FALSE(JobSystem::IsInitialized());
+        EXPECT_EQ(JobSystem::GetThreadCount(), 1u);
+
+        const auto caller = std::this_thread::get_id();
+        bool sameThread = true;
+        JobHandle handle = JobSystem::ParallelFor(100, 10, [&](u32, u32) {
+            sameThread &= (std::this_thread::get_id() == caller);
+        });
+        EXPECT_TRUE(handle.IsComplete());
+        EXPECT_TRUE(sameThread);
+    }
+
+    TEST_F(JobSystemTest, ParallelForCoversEveryIndexOnce)
+    {
+        EXPECT_EQ(JobSystem::GetThreadCount(), 4u);
+        ExpectEachIndexOnce(10007);
+    }
+
+    TEST_F(JobSystemTest, DependenciesRunInOrder)
+    {
+        std::vector<u32> order;
+        std::mutex mutex;
+        auto record = [&](u32 value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(value);
+        };
+
+        JobHandle first = JobSystem::Schedule([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            record(1);
+        });
+        JobHandle firstDependency[] = { first };
+        JobHandle second = JobSystem::Schedule([&] { record(2); }, firstDependency);
+        JobHandle secondDependency[] = { second };
+        JobHandle third = JobSystem::ParallelFor(4, 1, [&](u32, u32) { record(3); }, secondDependency);
+
+        JobSystem::Wait(third);
+        ASSERT_EQ(order.size(), 6u);
+        EXPECT_EQ(order[0], 1u);
+        EXPECT_EQ(order[1], 2u);
+        EXPECT_TRUE(second.IsComplete());
+    }
+
+    TEST_F(JobSystemTest, WaitBlocksUntilLongJobFinishes)
+    {
+        // 只有一个任务且正在别的线程上执行：Wait 没有可帮忙的工作，必须阻塞到完成
+        std::atomic<bool> done{ false };
+        JobHandle handle = JobSystem::Schedule([&done] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            done = true;
+        });
+        JobSystem::Wait(handle);
+        EXPECT_TRUE(done.load());
+        EXPECT_TRUE(handle.IsComplete());
+    }
+
+    TEST_F(JobSystemTest, ExternalThreadsSubmitConcurrently)
+    {
+        // 非工作线程（如加载线程）与主线程同时提交 ParallelFor
+        std::vector<std::thread> threads;
+        std::atomic<u32> failures{ 0 };
+        for (u32 t = 0; t < 3; ++t)
+        {
+            threads.emplace_back([&failures] {
+                EXPECT_EQ(JobSystem::GetCurrentThreadIndex(), 0u);
+                for (u32 iteration = 0; iteration < 50; ++iteration)
+                {
+                    std::atomic<u32> sum{ 0 };
+                    JobSystem::RunParallelFor(1000, 16, [&sum](u32 begin, u32 end) {
+                        sum.fetch_add(end - begin, std::memory_order_relaxed);
+                    });
+                    if (sum.load() != 1000u)
+                        failures.fetch_add(1);
+                }
+            });
+        }
+        for (u32 iteration = 0; iteration < 50; ++iteration)
+        {
+            ExpectEachIndexOnce(1000);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(failures.load(), 0u);
+    }
+
+    TEST_F(JobSystemTest, ScopedInstanceLeavesGlobalUntouched)
+    {
+        // 另一个线程持续使用全局实例，同时当前线程换用独立实例
+        std::atomic<bool> stop{ false };
+        std::atomic<u32> globalRuns{ 0 };
+        std::thread user([&] {
+            while (!stop.load())
+            {
+                JobSystem::RunParallelFor(256, 8, [](u32, u32) {});
+                globalRuns.fetch_add(1);
+            }
+        });
+
+        for (u32 threads = 1; threads <= 3; ++threads)
+        {
+            ScopedJobSystem scoped(threads);
+            EXPECT_EQ(JobSystem::GetThreadCount(), threads);
+            ExpectEachIndexOnce(5000);
+        }
+        EXPECT_EQ(JobSystem::GetThreadCount(), 4u);
+
+        stop = true;
+        user.join();
+        EXPECT_GT(globalRuns.load(), 0u);
+        EXPECT_TRUE(JobSystem::IsInitialized());
+    }
+}
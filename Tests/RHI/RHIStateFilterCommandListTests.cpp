@@ -0,0 +1,326 @@
+#include "RHI/RHIStateFilterCommandList.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        //! 把收到的每个调用记录成一行文本，便于断言过滤后真正到达后端的命令序列
+        class RecordingCommandList : public RHICommandList
+        {
+        public:
+            std::vector<std::string> calls;
+
+            void Reset() override { Record("Reset"); }
+            void Close() override { Record("Close"); }
+
+            void TransitionBarrier(RHITexture*, RHIResourceState, RHIResourceState) override { Record("TransitionBarrier"); }
+            void TransitionBarrier(RHIBuffer*, RHIResourceState, RHIResourceState) override { Record("TransitionBarrier"); }
+            void UAVBarrier(RHIResource*) override { Record("UAVBarrier"); }
+            void FlushBarriers() override { Record("FlushBarriers"); }
+
+            void ClearRenderTarget(RHIDescriptorHandle, const f32[4]) override { Record("ClearRenderTarget"); }
+            void ClearDepthStencil(RHIDescriptorHandle, f32, u8) override { Record("ClearDepthStencil"); }
+
+            void SetRenderTargets(std::span<RHIDescriptorHandle> rtvs, const RHIDescriptorHandle*) override
+            {
+                Record("SetRenderTargets", rtvs.size());
+            }
+            void SetViewport(const RHIViewport&) override { Record("SetViewport"); }
+            void SetScissorRect(const RHIScissorRect&) override { Record("SetScissorRect"); }
+            void SetPipelineState(RHIPipelineState* pso) override { Record("SetPipelineState", Id(pso)); }
+            void SetGraphicsRootSignature(RHIRootSignature* rootSig) override { Record("SetGraphicsRootSignature", Id(rootSig)); }
+            void SetComputeRootSignature(RHIRootSignature* rootSig) override { Record("SetComputeRootSignature", Id(rootSig)); }
+            void SetDescriptorHeaps(std::span<RHIDescriptorHeap*> heaps) override { Record("SetDescriptorHeaps", heaps.size()); }
+
+            void SetGraphicsRootConstant(u32 rootIndex, u32, u32) override { Record("SetGraphicsRootConstant", rootIndex); }
+            void SetGraphicsRootConstants(u32 rootIndex, const void*, u32) override { Record("SetGraphicsRootConstants", rootIndex); }
+            void SetGraphicsRootCBV(u32 rootIndex, u64 address) override { Record("SetGraphicsRootCBV", rootIndex, address); }
+            void SetGraphicsRootSRV(u32 rootIndex, u64 address) override { Record("SetGraphicsRootSRV", rootIndex, address); }
+            void SetGraphicsRootUAV(u32 rootIndex, u64 address) override { Record("SetGraphicsRootUAV", rootIndex, address); }
+            void SetGraphicsRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle handle) override
+            {
+                Record("SetGraphicsRootDescriptorTable", rootIndex, handle.gpuHandle);
+            }
+            void SetComputeRootConstant(u32 rootIndex, u32, u32) override { Record("SetComputeRootConstant", rootIndex); }
+            void SetComputeRootConstants(u32 rootIndex, const void*, u32) override { Record("SetComputeRootConstants", rootIndex); }
+            void SetComputeRootCBV(u32 rootIndex, u64 address) override { Record("SetComputeRootCBV", rootIndex, address); }
+            void SetComputeRootSRV(u32 rootIndex, u64 address) override { Record("SetComputeRootSRV", rootIndex, address); }
+            void SetComputeRootUAV(u32 rootIndex, u64 address) override { Record("SetComputeRootUAV", rootIndex, address); }
+            void SetComputeRootDescriptorTable(u32 rootIndex, RHIDescriptorHandle handle) override
+            {
+                Record("SetComputeRootDescriptorTable", rootIndex, handle.gpuHandle);
+            }
+
+            void SetVertexBuffer(u32 slot, const RHIVertexBufferView& view) override { Record("SetVertexBuffer", slot, view.gpuAddress); }
+            void SetIndexBuffer(const RHIIndexBufferView& view) override { Record("SetIndexBuffer", view.gpuAddress); }
+            void SetPrimitiveTopology(RHIPrimitiveTopology topology) override { Record("SetPrimitiveTopology", static_cast<u64>(topology)); }
+
+            void Draw(u32 vertexCount, u32, u32, u32) override { Record("Draw", vertexCount); }
+            void DrawIndexed(u32 indexCount, u32, u32, i32, u32) override { Record("DrawIndexed", indexCount); }
+            void Dispatch(u32 x, u32, u32) override { Record("Dispatch", x); }
+
+            void CopyBuffer(RHIBuffer*, RHIBuffer*) override { Record("CopyBuffer"); }
+            void CopyBufferRegion(RHIBuffer*, u64, RHIBuffer*, u64, u64) override { Record("CopyBufferRegion"); }
+            void CopyTexture(RHITexture*, RHITexture*) override { Record("CopyTexture"); }
+            void CopyTextureRegion(RHITexture*, u32, u32, u32, RHITexture*, const RHISubResource*) override { Record("CopyTextureRegion"); }
+
+            void BeginEvent(const char* name) override { Record(std::string("BeginEvent ") + name); }
+            void EndEvent() override { Record("EndEvent"); }
+            void SetMarker(const char* name) override { Record(std::string("SetMarker ") + name); }
+
+        private:
+            template<typename... Args>
+            void Record(std::string call, Args... args)
+            {
+                ((call += " " + std::to_string(args)), ...);
+                calls.push_back(std::move(call));
+            }
+
+            static u64 Id(const RHIResource* resource)
+            {
+                return resource ? std::stoull(resource->GetName()) : 0;
+            }
+        };
+
+        class FakePipelineState : public RHIPipelineState
+        {
+        public:
+            explicit FakePipelineState(const char* id) { SetName(id); }
+            bool IsValid() const override { return true; }
+        };
+
+        class FakeRootSignature : public RHIRootSignature
+        {
+        public:
+            explicit FakeRootSignature(const char* id) { SetName(id); }
+            bool IsValid() const override { return true; }
+        };
+
+        class FakeDescriptorHeap : public RHIDescriptorHeap
+        {
+        public:
+            bool IsValid() const override { return true; }
+            RHIDescriptorHeapType GetType() const override { return RHIDescriptorHeapType::CBV_SRV_UAV; }
+            u32 GetDescriptorCount() const override { return 0; }
+            RHIDescriptorHandle GetCPUHandle(u32) const override { return {}; }
+            RHIDescriptorHandle GetGPUHandle(u32) const override { return {}; }
+            u32 Allocate() override { return 0; }
+            void Free(u32) override {}
+        };
+
+        class RHIStateFilterCommandListTest : public ::testing::Test
+        {
+        protected:
+            RecordingCommandList backend;
+            RHIStateFilterCommandList filter{backend};
+
+            FakePipelineState psoA{"1"};
+            FakePipelineState psoB{"2"};
+            FakeRootSignature rootSigA{"10"};
+            FakeRootSignature rootSigB{"11"};
+            FakeDescriptorHeap srvHeap;
+            FakeDescriptorHeap samplerHeap;
+
+            static RHIDescriptorHandle Table(u64 gpuHandle) { return {gpuHandle, gpuHandle}; }
+        };
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, DropsRepeatedPipelineAndRootSignature)
+    {
+        filter.SetPipelineState(&psoA);
+        filter.SetPipelineState(&psoA);
+        filter.SetGraphicsRootSignature(&rootSigA);
+        filter.SetGraphicsRootSignature(&rootSigA);
+        filter.SetPipelineState(&psoB);
+        filter.SetPipelineState(&psoA);
+
+        std::vector<std::string> expected = {
+            "SetPipelineState 1",
+            "SetGraphicsRootSignature 10",
+            "SetPipelineState 2",
+            "SetPipelineState 1",
+        };
+        EXPECT_EQ(backend.calls, expected);
+        EXPECT_EQ(filter.GetStats().GetFiltered(RHIStateCategory::PipelineState), 1u);
+        EXPECT_EQ(filter.GetStats().GetFiltered(RHIStateCategory::GraphicsRootSignature), 1u);
+        EXPECT_EQ(filter.GetStats().GetIssued(RHIStateCategory::PipelineState), 3u);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, RootSignatureChangeRebindsRootParameters)
+    {
+        filter.SetGraphicsRootSignature(&rootSigA);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+        filter.SetGraphicsRootSignature(&rootSigB);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+
+        std::vector<std::string> expected = {
+            "SetGraphicsRootSignature 10",
+            "SetGraphicsRootCBV 0 4096",
+            "SetGraphicsRootSignature 11",
+            "SetGraphicsRootCBV 0 4096",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, RootParameterKindIsPartOfTheKey)
+    {
+        filter.SetComputeRootSignature(&rootSigA);
+        filter.SetComputeRootSRV(2, 0x2000);
+        filter.SetComputeRootUAV(2, 0x2000);
+        filter.SetComputeRootUAV(2, 0x2000);
+        filter.SetComputeRootDescriptorTable(3, Table(0x40));
+        filter.SetComputeRootDescriptorTable(3, Table(0x40));
+
+        std::vector<std::string> expected = {
+            "SetComputeRootSignature 10",
+            "SetComputeRootSRV 2 8192",
+            "SetComputeRootUAV 2 8192",
+            "SetComputeRootDescriptorTable 3 64",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, GraphicsAndComputeRootTablesAreIndependent)
+    {
+        filter.SetGraphicsRootCBV(0, 0x1000);
+        filter.SetComputeRootCBV(0, 0x1000);
+        filter.SetComputeRootCBV(0, 0x1000);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+
+        std::vector<std::string> expected = {
+            "SetGraphicsRootCBV 0 4096",
+            "SetComputeRootCBV 0 4096",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, DescriptorHeapChangeRebindsDescriptorTables)
+    {
+        RHIDescriptorHeap* heaps[] = {&srvHeap, &samplerHeap};
+        RHIDescriptorHeap* swapped[] = {&samplerHeap, &srvHeap};
+        RHIDescriptorHeap* srvOnly[] = {&srvHeap};
+
+        filter.SetDescriptorHeaps(heaps);
+        filter.SetGraphicsRootDescriptorTable(1, Table(0x80));
+        filter.SetGraphicsRootCBV(0, 0x1000);
+        // 同一组堆换个顺序不算变化
+        filter.SetDescriptorHeaps(swapped);
+        filter.SetGraphicsRootDescriptorTable(1, Table(0x80));
+        // 换堆之后描述符表必须重新绑定，根 CBV 不受影响
+        filter.SetDescriptorHeaps(srvOnly);
+        filter.SetGraphicsRootDescriptorTable(1, Table(0x80));
+        filter.SetGraphicsRootCBV(0, 0x1000);
+
+        std::vector<std::string> expected = {
+            "SetDescriptorHeaps 2",
+            "SetGraphicsRootDescriptorTable 1 128",
+            "SetGraphicsRootCBV 0 4096",
+            "SetDescriptorHeaps 1",
+            "SetGraphicsRootDescriptorTable 1 128",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, InputAssemblyComparesWholeViews)
+    {
+        RHIVertexBufferView vb{0x3000, 256, 32};
+        RHIVertexBufferView vbStride{0x3000, 256, 16};
+        RHIIndexBufferView ib16{0x4000, 128, false};
+        RHIIndexBufferView ib32{0x4000, 128, true};
+
+        filter.SetVertexBuffer(0, vb);
+        filter.SetVertexBuffer(0, vb);
+        filter.SetVertexBuffer(1, vb);
+        filter.SetVertexBuffer(0, vbStride);
+        filter.SetIndexBuffer(ib16);
+        filter.SetIndexBuffer(ib16);
+        filter.SetIndexBuffer(ib32);
+        filter.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+        filter.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+        filter.SetPrimitiveTopology(RHIPrimitiveTopology::LineList);
+
+        std::vector<std::string> expected = {
+            "SetVertexBuffer 0 12288",
+            "SetVertexBuffer 1 12288",
+            "SetVertexBuffer 0 12288",
+            "SetIndexBuffer 16384",
+            "SetIndexBuffer 16384",
+            "SetPrimitiveTopology 3",
+            "SetPrimitiveTopology 1",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, NonStateCommandsAreAlwaysForwarded)
+    {
+        const f32 color[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+        u32 constants[4] = {};
+
+        filter.SetGraphicsRootConstants(0, constants, 4);
+        filter.SetGraphicsRootConstants(0, constants, 4);
+        filter.SetComputeRootConstant(1, 7, 0);
+        filter.SetComputeRootConstant(1, 7, 0);
+        filter.ClearRenderTarget({1, 0}, color);
+        filter.ClearRenderTarget({1, 0}, color);
+        filter.UAVBarrier(nullptr);
+        filter.Draw(3);
+        filter.Draw(3);
+        filter.DrawIndexed(6);
+        filter.Dispatch(8, 8, 1);
+        filter.SetMarker("frame");
+
+        std::vector<std::string> expected = {
+            "SetGraphicsRootConstants 0",
+            "SetGraphicsRootConstants 0",
+            "SetComputeRootConstant 1",
+            "SetComputeRootConstant 1",
+            "ClearRenderTarget",
+            "ClearRenderTarget",
+            "UAVBarrier",
+            "Draw 3",
+            "Draw 3",
+            "DrawIndexed 6",
+            "Dispatch 8",
+            "SetMarker frame",
+        };
+        EXPECT_EQ(backend.calls, expected);
+        EXPECT_EQ(filter.GetStats().GetTotalFiltered(), 0u);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, ResetAndInvalidateForgetBoundState)
+    {
+        filter.SetPipelineState(&psoA);
+        filter.Reset();
+        filter.SetPipelineState(&psoA);
+        // 外部绕过过滤层直接录制后，缓存必须失效
+        filter.InvalidateState();
+        filter.SetPipelineState(&psoA);
+        filter.SetPipelineState(&psoA);
+
+        std::vector<std::string> expected = {
+            "SetPipelineState 1",
+            "Reset",
+            "SetPipelineState 1",
+            "SetPipelineState 1",
+        };
+        EXPECT_EQ(backend.calls, expected);
+    }
+
+    TEST_F(RHIStateFilterCommandListTest, DisabledCacheForwardsEverything)
+    {
+        filter.GetStateCache().SetEnabled(false);
+        filter.SetPipelineState(&psoA);
+        filter.SetPipelineState(&psoA);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+        filter.SetGraphicsRootCBV(0, 0x1000);
+
+        EXPECT_EQ(backend.calls.size(), 4u);
+        EXPECT_EQ(filter.GetStats().GetTotalFiltered(), 0u);
+        EXPECT_EQ(filter.GetStats().GetTotalIssued(), 4u);
+    }
+
+} // namespace Sea
@@ -0,0 +1,122 @@
+#include "Scene/CascadedShadows.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        // 世界原点投影到阴影贴图后是否落在整 texel 上
+        bool IsTexelAligned(const ShadowCascade& cascade, u32 mapSize)
+        {
+            XMVECTOR origin = XMVector3TransformCoord(XMVectorZero(), XMLoadFloat4x4(&cascade.viewProjection));
+            const f32 halfSize = static_cast<f32>(mapSize) * 0.5f;
+            f32 x = XMVectorGetX(origin) * halfSize;
+            f32 y = XMVectorGetY(origin) * halfSize;
+            return std::abs(x - std::round(x)) < 0.01f && std::abs(y - std::round(y)) < 0.01f;
+        }
+
+        // 固定相机与光源下的级联拟合
+        class CascadedShadowsTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override
+            {
+                m_Camera.SetPerspective(60.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+                PlaceCamera({ 3.0f, 8.0f, -20.0f }, -15.0f, 25.0f);
+
+                m_Settings.cascadeCount = 4;
+                m_Settings.shadowMapSize = 2048;
+                m_Settings.splitLambda = 0.75f;
+                m_Settings.maxShadowDistance = 150.0f;
+                m_Shadows.SetSettings(m_Settings);
+                m_Shadows.Update(m_Camera, m_LightDirection);
+            }
+
+            void PlaceCamera(const XMFLOAT3& position, f32 pitch, f32 yaw)
+            {
+                m_Camera.SetRotation(pitch, yaw, 0.0f);
+                m_Camera.SetPosition(position);
+                m_Camera.Update();
+            }
+
+            Camera m_Camera;
+            CascadedShadowSettings m_Settings;
+            CascadedShadows m_Shadows;
+            const XMFLOAT3 m_LightDirection = { -0.5f, -1.0f, 0.5f };
+        };
+
+        constexpr f32 GOLDEN_RADIUS[4] = { 12.625f, 26.25f, 55.8125f, 184.125f };
+    }
+
+    TEST(CascadeSplitsTest, MatchesGoldenValues)
+    {
+        // near 0.1, far 100, 4 级, lambda 0.5
+        const f32 golden[5] = { 0.1f, 12.818671f, 26.606138f, 46.403900f, 100.0f };
+        f32 splits[5];
+        ComputeCascadeSplits(0.1f, 100.0f, 4, 0.5f, splits);
+        for (u32 i = 0; i < 5; ++i)
+        {
+            EXPECT_NEAR(splits[i], golden[i], 1e-4f * std::max(1.0f, golden[i])) << "split " << i;
+        }
+    }
+
+    TEST_F(CascadedShadowsTest, RadiiMatchGoldenAndAreTexelAligned)
+    {
+        for (u32 i = 0; i < 4; ++i)
+        {
+            const ShadowCascade& cascade = m_Shadows.GetCascade(i);
+            EXPECT_NEAR(cascade.radius, GOLDEN_RADIUS[i], 1e-4f * GOLDEN_RADIUS[i]) << "cascade " << i;
+            EXPECT_TRUE(IsTexelAligned(cascade, m_Settings.shadowMapSize)) << "cascade " << i;
+        }
+    }
+
+    TEST_F(CascadedShadowsTest, StableUnderCameraRotationAndMovement)
+    {
+        f32 radii[4];
+        for (u32 i = 0; i < 4; ++i)
+        {
+            radii[i] = m_Shadows.GetCascade(i).radius;
+        }
+
+        // 相机旋转不改变半径，平移后仍然 texel 对齐
+        PlaceCamera({ 3.37f, 8.0f, -19.89f }, -5.0f, 140.0f);
+        m_Shadows.Update(m_Camera, m_LightDirection);
+        for (u32 i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(m_Shadows.GetCascade(i).radius, radii[i]) << "cascade " << i;
+            EXPECT_TRUE(IsTexelAligned(m_Shadows.GetCascade(i), m_Settings.shadowMapSize)) << "cascade " << i;
+        }
+    }
+
+    TEST_F(CascadedShadowsTest, MultiViewCullMasksMatchGolden)
+    {
+        // 主相机 + 4 级阴影，一次遍历得到掩码
+        std::vector<Frustum> views;
+        views.emplace_back(m_Camera.GetViewProjectionMatrix());
+        for (u32 i = 0; i < m_Shadows.GetCascadeCount(); ++i)
+        {
+            views.push_back(m_Shadows.GetCascade(i).frustum);
+        }
+
+        const CullBounds bounds[] = {
+            { { 5.0f, 5.0f, -12.0f }, { 0.5f, 0.5f, 0.5f } },      // 相机前方很近
+            { { 20.0f, 0.0f, 15.0f }, { 2.0f, 2.0f, 2.0f } },      // 中距离
+            { { 60.0f, 0.0f, 100.0f }, { 3.0f, 3.0f, 3.0f } },     // 远处
+            { { 3.0f, 8.0f, -60.0f }, { 1.0f, 1.0f, 1.0f } },      // 相机正后方
+            { { 300.0f, 0.0f, 600.0f }, { 5.0f, 5.0f, 5.0f } },    // 阴影距离之外
+            { { 5.0f, 60.0f, -10.0f }, { 1.0f, 1.0f, 1.0f } },     // 视锥上方、光源一侧的投影物
+        };
+        const u32 goldenMasks[] = { 0x1F, 0x1D, 0x11, 0x10, 0x01, 0x18 };   // bit0 = 主相机, bit1..4 = 级联 0..3
+
+        u32 masks[std::size(bounds)] = {};
+        CullMultiView(views, bounds, masks);
+        for (u32 i = 0; i < std::size(bounds); ++i)
+        {
+            EXPECT_EQ(masks[i], goldenMasks[i]) << "bounds " << i;
+        }
+    }
+}
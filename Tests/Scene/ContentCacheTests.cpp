@@ -0,0 +1,258 @@
+#include "Scene/ContentCache.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u64 CONTENT_A = 0xA11CEull;
+        constexpr u64 CONTENT_B = 0xB0Bull;
+
+        // 代替 Mesh 的缓存条目，析构时计数
+        struct CachedItem
+        {
+            explicit CachedItem(u32* destroyed) : destroyed(destroyed) {}
+            ~CachedItem() { ++*destroyed; }
+            u32* destroyed;
+        };
+
+        using TestCache = ContentCache<CachedItem>;
+
+        // 每个测试在临时目录下使用自己的文件名，结束时删除
+        class ContentCacheTest : public ::testing::Test
+        {
+        protected:
+            void TearDown() override
+            {
+                for (const auto& path : m_Files)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                }
+            }
+
+            std::string MakeFile(const std::string& contents)
+            {
+                const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+                auto path = std::filesystem::temp_directory_path() /
+                            (std::string("SeaContentCache_") + info->name() + "_" + std::to_string(m_Files.size()) + ".obj");
+                m_Files.push_back(path);
+                WriteFile(path.string(), contents);
+                return path.string();
+            }
+
+            void WriteFile(const std::string& path, const std::string& contents)
+            {
+                std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            }
+
+            Scope<CachedItem> MakeItem() { return MakeScope<CachedItem>(&m_Destroyed); }
+
+            std::vector<std::filesystem::path> m_Files;
+            u32 m_Destroyed = 0;
+        };
+    }
+
+    TEST_F(ContentCacheTest, CountsHitsMissesAndDuplicates)
+    {
+        TestCache cache(1ull << 30);
+        const std::string a = MakeFile("v 0 0 0");
+        const std::string copyOfA = MakeFile("v 0 0 0");
+        const std::string b = MakeFile("v 1 1 1");
+
+        // 从未加载过的路径
+        EXPECT_EQ(cache.Acquire(a, 0), nullptr);
+        CachedItem* itemA = cache.Insert(a, 0, CONTENT_A, 100, MakeItem());
+        ASSERT_NE(itemA, nullptr);
+        EXPECT_EQ(cache.Acquire(a, 0), itemA);
+
+        // 同一内容的另一个 variant 是另一个条目
+        EXPECT_EQ(cache.Acquire(a, 1), nullptr);
+        CachedItem* itemA1 = cache.Insert(a, 1, CONTENT_A, 40, MakeItem());
+        EXPECT_NE(itemA1, itemA);
+
+        // 另一个路径加载出相同内容：丢弃新条目，复用已有的；之后这个路径直接命中
+        EXPECT_EQ(cache.Acquire(copyOfA, 0), nullptr);
+        EXPECT_EQ(cache.Insert(copyOfA, 0, CONTENT_A, 100, MakeItem()), itemA);
+        EXPECT_EQ(m_Destroyed, 1u);
+        EXPECT_EQ(cache.Acquire(copyOfA, 0), itemA);
+
+        CachedItem* itemB = cache.Insert(b, 0, CONTENT_B, 10, MakeItem());
+        EXPECT_NE(itemB, itemA);
+        EXPECT_EQ(cache.Insert(b, 0, CONTENT_B, 10, nullptr), nullptr);
+
+        // 读不到内容哈希时按路径寻址，相同内容的两个路径不会合并
+        const std::string unhashed0 = MakeFile("o x");
+        const std::string unhashed1 = MakeFile("o x");
+        CachedItem* byPath0 = cache.Insert(unhashed0, 0, 0, 1, MakeItem());
+        CachedItem* byPath1 = cache.Insert(unhashed1, 0, 0, 1, MakeItem());
+        EXPECT_NE(byPath0, byPath1);
+        EXPECT_EQ(cache.Acquire(unhashed0, 0), byPath0);
+
+        const ContentCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.hits, 3u);
+        EXPECT_EQ(stats.misses, 3u);
+        EXPECT_EQ(stats.duplicates, 1u);
+        EXPECT_EQ(stats.entryCount, 5u);
+        EXPECT_EQ(stats.referencedCount, 5u);
+        EXPECT_EQ(stats.residentBytes, 152u);
+        EXPECT_EQ(stats.insertedBytes, 152u);
+        EXPECT_EQ(stats.evictions, 0u);
+    }
+
+    TEST_F(ContentCacheTest, EvictsLeastRecentlyReleasedOverBudget)
+    {
+        TestCache cache(250);
+        const std::string paths[] = { MakeFile("a"), MakeFile("b"), MakeFile("c") };
+        CachedItem* items[3];
+        for (u32 i = 0; i < 3; ++i)
+            items[i] = cache.Insert(paths[i], 0, CONTENT_A + i, 100, MakeItem());
+
+        // 全部有引用：超出预算也不淘汰
+        cache.Update();
+        EXPECT_EQ(cache.GetStats().residentBytes, 300u);
+        EXPECT_EQ(cache.GetStats().evictions, 0u);
+
+        // 释放顺序 b、a、c：最早释放的 b 先被淘汰，回到预算内就停止
+        cache.Release(items[1]);
+        cache.Release(items[0]);
+        cache.Release(items[2]);
+        EXPECT_EQ(cache.GetStats().referencedCount, 0u);
+        cache.Update();
+        ContentCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.evictions, 1u);
+        EXPECT_EQ(stats.evictedBytes, 100u);
+        EXPECT_EQ(stats.residentBytes, 200u);
+        EXPECT_EQ(cache.Acquire(paths[1], 0), nullptr);
+
+        // 重新引用 a 再释放，a 变成最近使用的，下一个被淘汰的是 c
+        EXPECT_EQ(cache.Acquire(paths[0], 0), items[0]);
+        cache.Release(items[0]);
+        cache.SetMemoryBudget(150);
+        cache.Update();
+        EXPECT_EQ(cache.GetStats().evictions, 2u);
+        EXPECT_EQ(cache.Acquire(paths[2], 0), nullptr);
+        EXPECT_EQ(cache.Acquire(paths[0], 0), items[0]);
+        cache.Release(items[0]);
+
+        cache.SetMemoryBudget(0);
+        cache.Update();
+        stats = cache.GetStats();
+        EXPECT_EQ(stats.evictions, 3u);
+        EXPECT_EQ(stats.entryCount, 0u);
+        EXPECT_EQ(stats.residentBytes, 0u);
+    }
+
+    TEST_F(ContentCacheTest, ReferencedEntriesAreNeverEvicted)
+    {
+        TestCache cache(0);
+        const std::string a = MakeFile("a");
+        const std::string b = MakeFile("b");
+        CachedItem* itemA = cache.Insert(a, 0, CONTENT_A, 100, MakeItem());
+        CachedItem* itemB = cache.Insert(b, 0, CONTENT_B, 100, MakeItem());
+        EXPECT_EQ(cache.Acquire(a, 0), itemA);
+
+        // a 有两个引用，释放一个后仍不能淘汰；b 无引用，预算为 0 时立即淘汰
+        cache.Release(itemA);
+        cache.Release(itemB);
+        for (u32 frame = 0; frame < TestCache::RETIRE_FRAMES * 2; ++frame)
+            cache.Update();
+        ContentCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.evictions, 1u);
+        EXPECT_EQ(stats.referencedCount, 1u);
+        EXPECT_EQ(m_Destroyed, 1u);
+        EXPECT_EQ(cache.Acquire(a, 0), itemA);
+
+        // 重复插入相同内容会增加引用，已在 LRU 中的条目也会被重新保护
+        cache.Release(itemA);
+        cache.Release(itemA);
+        EXPECT_EQ(cache.GetStats().referencedCount, 0u);
+        EXPECT_EQ(cache.Insert(a, 0, CONTENT_A, 100, MakeItem()), itemA);
+        cache.Update();
+        stats = cache.GetStats();
+        EXPECT_EQ(stats.evictions, 1u);
+        EXPECT_EQ(stats.referencedCount, 1u);
+
+        // 多余的 Release 与不属于缓存的指针都被忽略，引用计数不会下溢
+        cache.Release(itemA);
+        cache.Release(itemA);
+        CachedItem outsider(&m_Destroyed);
+        cache.Release(&outsider);
+        EXPECT_EQ(cache.GetStats().referencedCount, 0u);
+        EXPECT_EQ(cache.Acquire(a, 0), itemA);
+        EXPECT_EQ(cache.GetStats().referencedCount, 1u);
+    }
+
+    TEST_F(ContentCacheTest, EvictedEntriesLiveForRetireFrames)
+    {
+        TestCache cache(0);
+        const std::string a = MakeFile("a");
+        cache.Release(cache.Insert(a, 0, CONTENT_A, 100, MakeItem()));
+
+        // 淘汰所在的 Update 算第一帧，满 RETIRE_FRAMES 帧才销毁
+        for (u32 frame = 1; frame < TestCache::RETIRE_FRAMES; ++frame)
+        {
+            cache.Update();
+            EXPECT_EQ(cache.GetStats().evictions, 1u);
+            EXPECT_EQ(m_Destroyed, 0u) << "frame " << frame;
+        }
+        cache.Update();
+        EXPECT_EQ(m_Destroyed, 1u);
+
+        // Clear 立即销毁所有条目，包括退役中的
+        cache.SetMemoryBudget(1ull << 30);
+        cache.Insert(a, 0, CONTENT_A, 100, MakeItem());
+        cache.Release(cache.Insert(MakeFile("b"), 0, CONTENT_B, 100, MakeItem()));
+        cache.SetMemoryBudget(100);
+        cache.Update();
+        EXPECT_EQ(m_Destroyed, 1u);
+        cache.Clear();
+        EXPECT_EQ(m_Destroyed, 3u);
+        EXPECT_EQ(cache.GetStats().entryCount, 0u);
+        EXPECT_EQ(cache.GetStats().residentBytes, 0u);
+    }
+
+    TEST_F(ContentCacheTest, PathIsRevalidatedBySizeAndWriteTime)
+    {
+        TestCache cache(1ull << 30);
+        const std::string path = MakeFile("v 0 0 0");
+        const std::string copy = MakeFile("v 0 0 0");
+        CachedItem* original = cache.Insert(path, 0, CONTENT_A, 100, MakeItem());
+        EXPECT_EQ(cache.Insert(copy, 0, CONTENT_A, 100, MakeItem()), original);
+        EXPECT_EQ(cache.Acquire(path, 0), original);
+
+        // 大小不变、修改时间变化：内容哈希失效，需要重新加载
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::hours(1));
+        EXPECT_EQ(cache.Acquire(path, 0), nullptr);
+        EXPECT_EQ(cache.Acquire(path, 0), nullptr);
+
+        // 重新加载出不同的内容，路径指向新条目；另一个路径仍指向原来的内容
+        CachedItem* reloaded = cache.Insert(path, 0, CONTENT_B, 100, MakeItem());
+        EXPECT_NE(reloaded, original);
+        EXPECT_EQ(cache.Acquire(path, 0), reloaded);
+        EXPECT_EQ(cache.Acquire(copy, 0), original);
+
+        // 修改时间不变、大小变化
+        const auto writeTime = std::filesystem::last_write_time(path);
+        WriteFile(path, "v 0 0 0\nv 1 1 1");
+        std::filesystem::last_write_time(path, writeTime);
+        EXPECT_EQ(cache.Acquire(path, 0), nullptr);
+        EXPECT_EQ(cache.Insert(path, 0, CONTENT_B, 100, MakeItem()), reloaded);
+        EXPECT_EQ(cache.Acquire(path, 0), reloaded);
+
+        // 文件被删除
+        std::filesystem::remove(copy);
+        EXPECT_EQ(cache.Acquire(copy, 0), nullptr);
+
+        const ContentCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.entryCount, 2u);
+        EXPECT_EQ(stats.hits, 4u);
+        EXPECT_EQ(stats.misses, 4u);
+        EXPECT_EQ(stats.duplicates, 2u);
+    }
+}
@@ -0,0 +1,319 @@
+#include "Scene/MeshCooker.h"
+#include "Scene/MeshReference.h"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u64 SOURCE_HASH = 0x1234567890ABCDEFull;
+        constexpr u64 SOURCE_SIZE = 4096;
+
+        // 每个测试在临时目录下使用自己的文件名，结束时删除
+        class MeshCookerTest : public ::testing::Test
+        {
+        protected:
+            void TearDown() override
+            {
+                for (const auto& path : m_Files)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                }
+            }
+
+            std::filesystem::path MakePath(const char* extension)
+            {
+                const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+                auto path = std::filesystem::temp_directory_path() /
+                            (std::string("SeaCooker_") + info->name() + "_" + std::to_string(m_Files.size()) + extension);
+                m_Files.push_back(path);
+                return path;
+            }
+
+            std::vector<u8> ReadFile(const std::filesystem::path& path)
+            {
+                std::ifstream file(path, std::ios::binary);
+                return std::vector<u8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            }
+
+            void WriteFile(const std::filesystem::path& path, const std::vector<u8>& bytes)
+            {
+                std::ofstream(path, std::ios::binary | std::ios::trunc)
+                    .write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            }
+
+            // 烘焙后按 patch 改写文件内容，返回能否再次打开
+            template<typename Patch>
+            bool OpenPatched(const MeshData& data, Patch&& patch)
+            {
+                const auto path = MakePath(".seamesh");
+                EXPECT_TRUE(CookMesh(data, SOURCE_HASH, SOURCE_SIZE, path));
+                std::vector<u8> bytes = ReadFile(path);
+                patch(bytes);
+                WriteFile(path, bytes);
+
+                CookedMesh cooked;
+                return cooked.Open(path, SOURCE_HASH);
+            }
+
+            std::vector<std::filesystem::path> m_Files;
+        };
+
+        template<typename T>
+        void WriteField(std::vector<u8>& bytes, size_t offset, T value)
+        {
+            std::memcpy(bytes.data() + offset, &value, sizeof(T));
+        }
+
+        template<typename T>
+        T ReadField(const std::vector<u8>& bytes, size_t offset)
+        {
+            T value;
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            return value;
+        }
+
+        // 两个子网格：第二个使用 baseVertex，两个材质带纹理名
+        MeshData MakeTestMesh()
+        {
+            MeshData data;
+            for (u32 i = 0; i < 8; ++i)
+            {
+                Vertex v = {};
+                v.position = { static_cast<f32>(i), static_cast<f32>(i % 3) - 1.0f, -0.5f * i };
+                v.normal = { 0.0f, 1.0f, 0.0f };
+                v.texCoord = { 0.125f * i, 1.0f - 0.125f * i };
+                v.color = { 1.0f, 0.5f, 0.25f, 1.0f };
+                data.vertices.push_back(v);
+            }
+            data.indices = { 0, 1, 2, 2, 1, 3, 0, 1, 2, 1, 3, 2 };
+            data.subMeshes.push_back({ 0, 6, 0, 0 });
+            data.subMeshes.push_back({ 6, 6, 1, 4 });
+
+            Material first;
+            first.name = "Stone";
+            first.albedo = { 0.5f, 0.4f, 0.3f, 1.0f };
+            first.albedoTexture = "stone_albedo.png";
+            first.normalTexture = "stone_normal.png";
+            Material second;
+            second.name = "Metal";
+            second.metallic = 1.0f;
+            second.roughness = 0.2f;
+            data.materials = { first, second };
+            return data;
+        }
+    }
+
+    TEST_F(MeshCookerTest, CookThenOpenRoundTrip)
+    {
+        const MeshData data = MakeTestMesh();
+        const auto path = MakePath(".seamesh");
+        ASSERT_TRUE(CookMesh(data, SOURCE_HASH, SOURCE_SIZE, path));
+
+        CookedMesh cooked;
+        ASSERT_TRUE(cooked.Open(path, SOURCE_HASH));
+        EXPECT_EQ(cooked.GetHeader().sourceHash, SOURCE_HASH);
+        EXPECT_EQ(cooked.GetHeader().sourceSize, SOURCE_SIZE);
+
+        ASSERT_EQ(cooked.GetVertices().size(), data.vertices.size());
+        EXPECT_EQ(std::memcmp(cooked.GetVertices().data(), data.vertices.data(), cooked.GetVertices().size_bytes()), 0);
+        EXPECT_TRUE(std::equal(data.indices.begin(), data.indices.end(), cooked.GetIndices().begin(), cooked.GetIndices().end()));
+        ASSERT_EQ(cooked.GetSubMeshes().size(), data.subMeshes.size());
+        for (size_t i = 0; i < data.subMeshes.size(); ++i)
+        {
+            EXPECT_EQ(cooked.GetSubMeshes()[i].indexOffset, data.subMeshes[i].indexOffset);
+            EXPECT_EQ(cooked.GetSubMeshes()[i].indexCount, data.subMeshes[i].indexCount);
+            EXPECT_EQ(cooked.GetSubMeshes()[i].materialIndex, data.subMeshes[i].materialIndex);
+            EXPECT_EQ(cooked.GetSubMeshes()[i].baseVertex, data.subMeshes[i].baseVertex);
+        }
+
+        ASSERT_EQ(cooked.GetMaterialCount(), data.materials.size());
+        for (u32 i = 0; i < cooked.GetMaterialCount(); ++i)
+        {
+            const Material material = cooked.GetMaterial(i);
+            EXPECT_EQ(material.name, data.materials[i].name);
+            EXPECT_EQ(material.albedoTexture, data.materials[i].albedoTexture);
+            EXPECT_EQ(material.normalTexture, data.materials[i].normalTexture);
+            EXPECT_EQ(material.metallic, data.materials[i].metallic);
+            EXPECT_EQ(material.roughness, data.materials[i].roughness);
+            EXPECT_EQ(material.albedo.x, data.materials[i].albedo.x);
+        }
+
+        // 包围盒在烘焙时写入头部
+        EXPECT_EQ(cooked.GetBoundsMin().x, 0.0f);
+        EXPECT_EQ(cooked.GetBoundsMax().x, 7.0f);
+        EXPECT_EQ(cooked.GetBoundsMin().y, -1.0f);
+        EXPECT_EQ(cooked.GetBoundsMax().y, 1.0f);
+        EXPECT_EQ(cooked.GetBoundsMin().z, -3.5f);
+        EXPECT_EQ(cooked.GetBoundsMax().z, 0.0f);
+
+        // 数据区段都按 64 字节对齐，可以直接当作数组使用
+        EXPECT_EQ(cooked.GetHeader().vertexOffset % 64, 0u);
+        EXPECT_EQ(cooked.GetHeader().indexOffset % 64, 0u);
+    }
+
+    TEST_F(MeshCookerTest, RejectsStaleSourceHash)
+    {
+        const auto path = MakePath(".seamesh");
+        ASSERT_TRUE(CookMesh(MakeTestMesh(), SOURCE_HASH, SOURCE_SIZE, path));
+
+        CookedMesh cooked;
+        EXPECT_FALSE(cooked.Open(path, SOURCE_HASH + 1));
+        EXPECT_FALSE(cooked.IsOpen());
+        EXPECT_TRUE(cooked.Open(path, 0));
+        EXPECT_TRUE(cooked.Open(path, SOURCE_HASH));
+    }
+
+    TEST_F(MeshCookerTest, LoadMeshCachedRecooksChangedSource)
+    {
+        const auto objPath = MakePath(".obj");
+        m_Files.push_back(GetCookedMeshPath(objPath));
+        std::ofstream(objPath, std::ios::binary) << MakeSphereOBJ(4, 6);
+
+        CookedMesh first;
+        ASSERT_TRUE(LoadMeshCached(objPath.string(), first));
+        const size_t firstIndexCount = first.GetIndices().size();
+        const u64 firstHash = first.GetHeader().sourceHash;
+        first.Close();
+
+        // 源文件内容变化后缓存的哈希不再匹配，重新解析并烘焙
+        std::ofstream(objPath, std::ios::binary | std::ios::trunc) << MakeSphereOBJ(6, 8);
+        CookedMesh second;
+        ASSERT_TRUE(LoadMeshCached(objPath.string(), second));
+        EXPECT_NE(second.GetHeader().sourceHash, firstHash);
+        EXPECT_GT(second.GetIndices().size(), firstIndexCount);
+
+        u64 hash = 0, size = 0;
+        ASSERT_TRUE(HashSourceFile(objPath, hash, size));
+        EXPECT_EQ(second.GetHeader().sourceHash, hash);
+        EXPECT_EQ(second.GetHeader().sourceSize, size);
+    }
+
+    TEST_F(MeshCookerTest, RejectsTruncatedOrBadHeader)
+    {
+        const MeshData data = MakeTestMesh();
+
+        // 比头部还短
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) { bytes.resize(sizeof(CookedMeshHeader) - 1); }));
+        // 截掉尾部：与头部记录的文件大小不符
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) { bytes.pop_back(); }));
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, offsetof(CookedMeshHeader, magic), 0x4A424F57);
+        }));
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, offsetof(CookedMeshHeader, version), CookedMeshHeader::VERSION - 1);
+        }));
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, offsetof(CookedMeshHeader, vertexStride), 32);
+        }));
+
+        // 空文件与不存在的文件
+        const auto empty = MakePath(".seamesh");
+        std::ofstream(empty, std::ios::binary);
+        CookedMesh cooked;
+        EXPECT_FALSE(cooked.Open(empty));
+        EXPECT_FALSE(cooked.Open(MakePath(".seamesh")));
+
+        // 未改动的文件仍然可以打开
+        EXPECT_TRUE(OpenPatched(data, [](std::vector<u8>&) {}));
+    }
+
+    TEST_F(MeshCookerTest, RejectsBadSectionOffset)
+    {
+        const MeshData data = MakeTestMesh();
+
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u64>(bytes, offsetof(CookedMeshHeader, vertexOffset), bytes.size() + 64);
+        }));
+        // 未对齐
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u64>(bytes, offsetof(CookedMeshHeader, indexOffset),
+                            ReadField<u64>(bytes, offsetof(CookedMeshHeader, indexOffset)) + 1);
+        }));
+        // 起点在文件内但元素数超出文件
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, offsetof(CookedMeshHeader, indexCount), 1u << 30);
+        }));
+        EXPECT_FALSE(OpenPatched(data, [](std::vector<u8>& bytes) {
+            WriteField<u64>(bytes, offsetof(CookedMeshHeader, stringOffset), ~0ull - 7);
+        }));
+    }
+
+    TEST_F(MeshCookerTest, RejectsSubMeshOrIndexOutOfRange)
+    {
+        const MeshData data = MakeTestMesh();
+        auto subMeshField = [](const std::vector<u8>& bytes, u32 subMesh, size_t field) {
+            return static_cast<size_t>(ReadField<u64>(bytes, offsetof(CookedMeshHeader, subMeshOffset))) +
+                   subMesh * sizeof(SubMesh) + field;
+        };
+        auto indexField = [](const std::vector<u8>& bytes, u32 index) {
+            return static_cast<size_t>(ReadField<u64>(bytes, offsetof(CookedMeshHeader, indexOffset))) + index * sizeof(u32);
+        };
+
+        // 子网格区间超出索引数
+        EXPECT_FALSE(OpenPatched(data, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, subMeshField(bytes, 1, offsetof(SubMesh, indexCount)), 7);
+        }));
+        EXPECT_FALSE(OpenPatched(data, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, subMeshField(bytes, 1, offsetof(SubMesh, indexOffset)), ~0u - 2);
+        }));
+        // 索引超出顶点数
+        EXPECT_FALSE(OpenPatched(data, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, indexField(bytes, 2), 8);
+        }));
+        // 索引本身在范围内，加上 baseVertex 后越界
+        EXPECT_FALSE(OpenPatched(data, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, indexField(bytes, 7), 4);
+        }));
+        EXPECT_FALSE(OpenPatched(data, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, subMeshField(bytes, 1, offsetof(SubMesh, baseVertex)), ~0u);
+        }));
+
+        // 没有子网格时按全局索引检查
+        MeshData noSubMeshes = data;
+        noSubMeshes.subMeshes.clear();
+        EXPECT_TRUE(OpenPatched(noSubMeshes, [](std::vector<u8>&) {}));
+        EXPECT_FALSE(OpenPatched(noSubMeshes, [&](std::vector<u8>& bytes) {
+            WriteField<u32>(bytes, indexField(bytes, 0), 100);
+        }));
+    }
+
+    TEST_F(MeshCookerTest, ConcurrentCooksOfSameSourceStayValid)
+    {
+        // 多个加载线程同时烘焙同一个源文件：各自写自己的临时文件再改名，最终文件总是完整的
+        const MeshData data = MakeTestMesh();
+        const auto path = MakePath(".seamesh");
+        constexpr u32 THREAD_COUNT = 4;
+        constexpr u32 COOKS_PER_THREAD = 25;
+
+        std::vector<std::thread> threads;
+        for (u32 t = 0; t < THREAD_COUNT; ++t)
+        {
+            threads.emplace_back([&]() {
+                for (u32 i = 0; i < COOKS_PER_THREAD; ++i)
+                    CookMesh(data, SOURCE_HASH, SOURCE_SIZE, path);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        CookedMesh cooked;
+        ASSERT_TRUE(cooked.Open(path, SOURCE_HASH));
+        EXPECT_EQ(cooked.GetIndices().size(), data.indices.size());
+
+        // 临时文件都已改名，不会留在目录里
+        for (const auto& entry : std::filesystem::directory_iterator(path.parent_path()))
+        {
+            const std::string name = entry.path().filename().string();
+            EXPECT_FALSE(name.rfind(path.filename().string() + ".", 0) == 0 && entry.path().extension() == ".tmp") << name;
+        }
+    }
+}
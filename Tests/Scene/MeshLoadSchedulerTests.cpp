@@ -0,0 +1,331 @@
+#include "Scene/MeshLoadScheduler.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        // 测试控制的闸门：打开前 StubTask::Prepare 一直停在读取中
+        struct Gate
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool open = false;
+
+            void Open()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    open = true;
+                }
+                condition.notify_all();
+            }
+
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return open; });
+            }
+        };
+
+        // 记录开始读取的顺序（加载线程上写入）
+        struct StartLog
+        {
+            std::mutex mutex;
+            std::vector<MeshLoadId> order;
+
+            void Add(MeshLoadId id)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(id);
+            }
+
+            std::vector<MeshLoadId> GetOrder()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                return order;
+            }
+        };
+
+        // 代替 Mesh::PrepareOBJ：等闸门打开后返回固定的结果与大小
+        struct StubTask : public MeshLoadTask
+        {
+            StartLog* log = nullptr;
+            Gate* gate = nullptr;
+            u64 bytes = 0;
+            bool succeed = true;
+
+            bool Prepare() override
+            {
+                if (log)
+                    log->Add(id);
+                if (gate)
+                    gate->Wait();
+                return succeed && !cancelled;
+            }
+
+            u64 GetResidentBytes() const override { return bytes; }
+        };
+
+        Ref<StubTask> MakeTask(u64 bytes, Gate* gate = nullptr, StartLog* log = nullptr)
+        {
+            auto task = MakeRef<StubTask>();
+            task->bytes = bytes;
+            task->gate = gate;
+            task->log = log;
+            return task;
+        }
+
+        // 等待加载线程推进到条件成立，超时返回 false
+        bool WaitFor(const MeshLoadScheduler& scheduler, const std::function<bool(const MeshLoaderStats&)>& predicate)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!predicate(scheduler.GetStats()))
+            {
+                if (std::chrono::steady_clock::now() > deadline)
+                    return false;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return true;
+        }
+
+        // 模拟 AsyncMeshLoader::Update：取出所有等待上传的任务并按 success 结束，返回结束的任务
+        std::vector<Ref<MeshLoadTask>> FinishReady(MeshLoadScheduler& scheduler, u64 uploadBudget = ~0ull)
+        {
+            std::vector<Ref<MeshLoadTask>> batch;
+            scheduler.AcquireReady(uploadBudget, batch);
+            for (const auto& task : batch)
+                scheduler.Finish(*task, task->success);
+            return batch;
+        }
+    }
+
+    TEST(MeshLoadSchedulerTest, HigherPriorityStartsFirst)
+    {
+        MeshLoadScheduler scheduler(1ull << 30);
+        StartLog log;
+        Gate blocker;
+        Gate open;
+        open.Open();
+
+        // 第一个任务占住唯一的加载线程，其余任务都在排队时才做选择
+        scheduler.Submit(MakeTask(16, &blocker, &log), MeshLoadPriority::Normal, 16);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 1; }));
+
+        const MeshLoadId low = scheduler.Submit(MakeTask(16, &open, &log), MeshLoadPriority::Low, 16);
+        const MeshLoadId normal0 = scheduler.Submit(MakeTask(16, &open, &log), MeshLoadPriority::Normal, 16);
+        const MeshLoadId high = scheduler.Submit(MakeTask(16, &open, &log), MeshLoadPriority::High, 16);
+        const MeshLoadId normal1 = scheduler.Submit(MakeTask(16, &open, &log), MeshLoadPriority::Normal, 16);
+        const MeshLoadId promoted = scheduler.Submit(MakeTask(16, &open, &log), MeshLoadPriority::Low, 16);
+        EXPECT_TRUE(scheduler.SetPriority(promoted, MeshLoadPriority::High));
+        EXPECT_EQ(scheduler.GetStats().queued, 5u);
+
+        blocker.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.queued == 0 && s.loading == 0; }));
+        EXPECT_FALSE(scheduler.SetPriority(low, MeshLoadPriority::High));
+
+        // 高优先级先开始，同一优先级先到先得
+        const std::vector<MeshLoadId> order = log.GetOrder();
+        ASSERT_EQ(order.size(), 6u);
+        EXPECT_EQ(std::vector<MeshLoadId>(order.begin() + 1, order.end()),
+                  (std::vector<MeshLoadId>{ high, promoted, normal0, normal1, low }));
+
+        // 上传按读取完成的顺序
+        const std::vector<Ref<MeshLoadTask>> finished = FinishReady(scheduler);
+        ASSERT_EQ(finished.size(), 6u);
+        for (size_t i = 0; i < finished.size(); ++i)
+            EXPECT_EQ(finished[i]->id, order[i]);
+        EXPECT_EQ(scheduler.GetStats().completed, 6u);
+        EXPECT_TRUE(scheduler.IsIdle());
+    }
+
+    TEST(MeshLoadSchedulerTest, CancelInEveryState)
+    {
+        MeshLoadScheduler scheduler(1ull << 30);
+        StartLog log;
+        Gate blocker;
+
+        // 读取中：标记后由加载线程在 Prepare 返回时丢弃
+        const MeshLoadId loading = scheduler.Submit(MakeTask(100, &blocker, &log), MeshLoadPriority::Normal, 1000);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 1; }));
+        EXPECT_EQ(scheduler.GetStats().inFlightBytes, 1000u);
+
+        // 排队中：直接移除，不会开始读取
+        const MeshLoadId queued = scheduler.Submit(MakeTask(100, nullptr, &log), MeshLoadPriority::High, 10);
+        EXPECT_EQ(scheduler.GetStats().queued, 1u);
+        EXPECT_TRUE(scheduler.Cancel(queued));
+        EXPECT_FALSE(scheduler.Cancel(queued));
+        MeshLoaderStats stats = scheduler.GetStats();
+        EXPECT_EQ(stats.queued, 0u);
+        EXPECT_EQ(stats.cancelled, 1u);
+
+        EXPECT_TRUE(scheduler.Cancel(loading));
+        EXPECT_EQ(scheduler.GetStats().cancelled, 1u);     // 加载线程停下后才计数
+        blocker.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.cancelled == 2; }));
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.loading, 0u);
+        EXPECT_EQ(stats.ready, 0u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+        EXPECT_TRUE(FinishReady(scheduler).empty());
+
+        // 等待上传：直接丢弃并归还内存
+        const MeshLoadId ready = scheduler.Submit(MakeTask(300, nullptr, &log), MeshLoadPriority::Normal, 1000);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 1; }));
+        EXPECT_EQ(scheduler.GetStats().inFlightBytes, 300u);
+        EXPECT_TRUE(scheduler.Cancel(ready));
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.ready, 0u);
+        EXPECT_EQ(stats.cancelled, 3u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+        EXPECT_TRUE(FinishReady(scheduler).empty());
+
+        // 上传中：同一批里前面任务的回调取消后面的任务，Finish 按取消计数
+        const MeshLoadId first = scheduler.Submit(MakeTask(200, nullptr, &log), MeshLoadPriority::Normal, 1);
+        const MeshLoadId second = scheduler.Submit(MakeTask(200, nullptr, &log), MeshLoadPriority::Normal, 1);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 2; }));
+        std::vector<Ref<MeshLoadTask>> batch;
+        scheduler.AcquireReady(~0ull, batch);
+        ASSERT_EQ(batch.size(), 2u);
+        ASSERT_EQ(batch[0]->id, first);
+        scheduler.Finish(*batch[0], true);
+        EXPECT_FALSE(scheduler.Cancel(first));
+        EXPECT_TRUE(scheduler.Cancel(second));
+        EXPECT_TRUE(batch[1]->cancelled);
+        scheduler.Finish(*batch[1], true);
+
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.completed, 1u);
+        EXPECT_EQ(stats.cancelled, 4u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+        EXPECT_TRUE(scheduler.IsIdle());
+        EXPECT_FALSE(scheduler.Cancel(12345));
+
+        // 取消的排队任务没有开始读取
+        for (MeshLoadId id : log.GetOrder())
+            EXPECT_NE(id, queued);
+    }
+
+    TEST(MeshLoadSchedulerTest, InFlightBytesReturnToZero)
+    {
+        MeshLoadScheduler scheduler(1ull << 30, 2);
+        Gate gate;
+
+        // 读取中按估算计，读完换成实际大小，上传后归还；失败的任务不占用等待上传的内存
+        scheduler.Submit(MakeTask(40, &gate), MeshLoadPriority::Normal, 100);
+        scheduler.Submit(MakeTask(70, &gate), MeshLoadPriority::Normal, 200);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 2; }));
+        EXPECT_EQ(scheduler.GetStats().inFlightBytes, 300u);
+
+        auto failing = MakeTask(500, nullptr);
+        failing->succeed = false;
+        scheduler.Submit(failing, MeshLoadPriority::Low, 50);
+
+        gate.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 3; }));
+        MeshLoaderStats stats = scheduler.GetStats();
+        EXPECT_EQ(stats.inFlightBytes, 110u);
+        EXPECT_GE(stats.peakInFlightBytes, 300u);
+
+        // 上传预算只够一个：每次至少取出一个，剩下的留到下一帧
+        EXPECT_EQ(FinishReady(scheduler, 1).size(), 1u);
+        while (!FinishReady(scheduler, 1).empty())
+        {
+        }
+
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.completed, 2u);
+        EXPECT_EQ(stats.failed, 1u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+        EXPECT_TRUE(scheduler.IsIdle());
+
+        // CancelAll 归还等待上传的内存，读取中的任务停下后归还估算
+        Gate blocker;
+        scheduler.Submit(MakeTask(10, nullptr), MeshLoadPriority::Normal, 30);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 1; }));
+        scheduler.Submit(MakeTask(10, &blocker), MeshLoadPriority::Normal, 30);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 1; }));
+        scheduler.CancelAll();
+        blocker.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 0; }));
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.cancelled, 2u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+        EXPECT_TRUE(scheduler.IsIdle());
+    }
+
+    TEST(MeshLoadSchedulerTest, OverBudgetRequestRunsWhenNothingInFlight)
+    {
+        MeshLoadScheduler scheduler(100, 2);
+        Gate gate;
+
+        // 单个任务超出预算，没有其它任务占用内存时照样放行
+        const MeshLoadId large = scheduler.Submit(MakeTask(500, &gate), MeshLoadPriority::Normal, 1000);
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 1; }));
+
+        // 其余任务要等到内存归还：读取中和等待上传期间都不开始，即使还有空闲的加载线程
+        const MeshLoadId small = scheduler.Submit(MakeTask(10, nullptr), MeshLoadPriority::High, 10);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_EQ(scheduler.GetStats().queued, 1u);
+
+        gate.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 1; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        MeshLoaderStats stats = scheduler.GetStats();
+        EXPECT_EQ(stats.queued, 1u);
+        EXPECT_EQ(stats.inFlightBytes, 500u);
+        EXPECT_EQ(stats.peakInFlightBytes, 1000u);
+
+        std::vector<Ref<MeshLoadTask>> finished = FinishReady(scheduler);
+        ASSERT_EQ(finished.size(), 1u);
+        EXPECT_EQ(finished[0]->id, large);
+
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 1; }));
+        finished = FinishReady(scheduler);
+        ASSERT_EQ(finished.size(), 1u);
+        EXPECT_EQ(finished[0]->id, small);
+
+        // 调高预算后可以同时占用
+        scheduler.SetMemoryBudget(2000);
+        EXPECT_EQ(scheduler.GetMemoryBudget(), 2000u);
+        Gate second;
+        scheduler.Submit(MakeTask(10, &second), MeshLoadPriority::Normal, 1000);
+        scheduler.Submit(MakeTask(10, &second), MeshLoadPriority::Normal, 1000);
+        EXPECT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 2; }));
+        second.Open();
+        ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.ready == 2; }));
+        FinishReady(scheduler);
+
+        stats = scheduler.GetStats();
+        EXPECT_EQ(stats.completed, 4u);
+        EXPECT_EQ(stats.inFlightBytes, 0u);
+    }
+
+    TEST(MeshLoadSchedulerTest, DestructorCancelsPendingWork)
+    {
+        // 析构时标记读取中的任务并等它在阶段边界停下，排队中的任务不再开始
+        Gate gate;
+        StartLog log;
+        auto loading = MakeTask(10, &gate, &log);
+        std::thread opener;
+        {
+            MeshLoadScheduler scheduler(1ull << 30);
+            scheduler.Submit(loading, MeshLoadPriority::Normal, 10);
+            ASSERT_TRUE(WaitFor(scheduler, [](const MeshLoaderStats& s) { return s.loading == 1; }));
+            scheduler.Submit(MakeTask(10, nullptr, &log), MeshLoadPriority::Normal, 10);
+            opener = std::thread([&gate] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                gate.Open();
+            });
+        }
+        opener.join();
+        EXPECT_TRUE(loading->cancelled);
+        EXPECT_EQ(log.GetOrder().size(), 1u);
+    }
+}
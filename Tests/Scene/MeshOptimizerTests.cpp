@@ -0,0 +1,267 @@
+#include "Scene/MeshOptimizer.h"
+#include "Scene/MeshReference.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        using Triangle = std::array<u32, 3>;
+
+        std::string VertexBytes(const Vertex& vertex)
+        {
+            return std::string(reinterpret_cast<const char*>(&vertex), sizeof(Vertex));
+        }
+
+        // 顶点按内容映射回原始编号，三角形旋转到最小编号在前（保留绕序），各子网格的三角形排序后比较
+        std::vector<std::vector<Triangle>> CollectTriangles(const MeshData& mesh, const std::map<std::string, u32>& originalIds)
+        {
+            std::vector<std::vector<Triangle>> result;
+            for (const SubMesh& subMesh : mesh.subMeshes)
+            {
+                std::vector<Triangle> triangles;
+                for (u32 i = subMesh.indexOffset; i + 2 < subMesh.indexOffset + subMesh.indexCount; i += 3)
+                {
+                    Triangle triangle;
+                    for (u32 k = 0; k < 3; ++k)
+                    {
+                        const auto it = originalIds.find(VertexBytes(mesh.vertices[subMesh.baseVertex + mesh.indices[i + k]]));
+                        triangle[k] = it != originalIds.end() ? it->second : ~0u;
+                    }
+                    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+                    triangles.push_back(triangle);
+                }
+                std::sort(triangles.begin(), triangles.end());
+                result.push_back(std::move(triangles));
+            }
+            return result;
+        }
+
+        std::map<std::string, u32> MapVertexIds(const MeshData& mesh)
+        {
+            std::map<std::string, u32> ids;
+            for (u32 i = 0; i < mesh.vertices.size(); ++i)
+                ids.emplace(VertexBytes(mesh.vertices[i]), i);
+            return ids;
+        }
+
+        // 子网格内三角形随机打乱，得到缓存不友好的输入
+        void ShuffleTriangles(MeshData& mesh, u32 seed)
+        {
+            std::mt19937 rng(seed);
+            for (const SubMesh& subMesh : mesh.subMeshes)
+            {
+                std::vector<Triangle> triangles(subMesh.indexCount / 3);
+                std::memcpy(triangles.data(), mesh.indices.data() + subMesh.indexOffset, triangles.size() * sizeof(Triangle));
+                std::shuffle(triangles.begin(), triangles.end(), rng);
+                std::memcpy(mesh.indices.data() + subMesh.indexOffset, triangles.data(), triangles.size() * sizeof(Triangle));
+            }
+        }
+
+        // 网格 + 球 + 网格三个子网格，中间插入一些没有被引用的顶点
+        MeshData MakeMultiSubMeshMesh()
+        {
+            MeshData mesh;
+            AppendSubMesh(mesh, MakeGridMesh(24, 16), 0);
+            for (u32 i = 0; i < 10; ++i)
+            {
+                Vertex unused = {};
+                unused.position = { 100.0f + i, 0.0f, 0.0f };
+                mesh.vertices.push_back(unused);
+            }
+            AppendSubMesh(mesh, MakeSphereMesh(12, 20), 1);
+            AppendSubMesh(mesh, MakeGridMesh(8, 30, 0.5f), 2);
+            return mesh;
+        }
+    }
+
+    TEST(MeshOptimizerTest, OptimizeMeshPreservesTrianglesPerSubMesh)
+    {
+        MeshData mesh = MakeMultiSubMeshMesh();
+        ShuffleTriangles(mesh, 7);
+        const std::map<std::string, u32> ids = MapVertexIds(mesh);
+        const auto expected = CollectTriangles(mesh, ids);
+        const std::vector<SubMesh> subMeshes = mesh.subMeshes;
+
+        MeshOptimizeStats stats;
+        OptimizeMesh(mesh, &stats);
+
+        // 子网格的索引区间不变，区间内的三角形集合（含绕序）不变
+        ASSERT_EQ(mesh.subMeshes.size(), subMeshes.size());
+        for (size_t i = 0; i < subMeshes.size(); ++i)
+        {
+            EXPECT_EQ(mesh.subMeshes[i].indexOffset, subMeshes[i].indexOffset);
+            EXPECT_EQ(mesh.subMeshes[i].indexCount, subMeshes[i].indexCount);
+        }
+        const auto actual = CollectTriangles(mesh, ids);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(actual[i], expected[i]) << "submesh " << i;
+        }
+
+        // 输入被打乱，缓存重排之后必须明显更好
+        EXPECT_LT(stats.after.acmr, stats.before.acmr * 0.75f);
+        EXPECT_GT(stats.clusterCount, 0u);
+    }
+
+    TEST(MeshOptimizerTest, AcmrDoesNotRegressOnGridAndSphere)
+    {
+        const MeshData inputs[] = { MakeGridMesh(64, 64), MakeSphereMesh(48, 96) };
+        for (const MeshData& input : inputs)
+        {
+            SCOPED_TRACE(std::to_string(input.vertices.size()) + " vertices");
+            const u32 vertexCount = static_cast<u32>(input.vertices.size());
+            const VertexCacheStats original = AnalyzeVertexCache(input.indices, vertexCount);
+
+            // 单独的 Tipsify 与完整流程都不比按行扫描的原始顺序差
+            std::vector<u32> indices = input.indices;
+            std::vector<u32> clusters;
+            OptimizeVertexCache(indices, vertexCount, &clusters);
+            const VertexCacheStats tipsify = AnalyzeVertexCache(indices, vertexCount);
+            EXPECT_LE(tipsify.acmr, original.acmr);
+            ASSERT_FALSE(clusters.empty());
+            EXPECT_EQ(clusters[0], 0u);
+            EXPECT_TRUE(std::is_sorted(clusters.begin(), clusters.end()));
+
+            MeshData mesh = input;
+            MeshOptimizeStats stats;
+            OptimizeMesh(mesh, &stats);
+            EXPECT_FLOAT_EQ(stats.before.acmr, original.acmr);
+            EXPECT_LE(stats.after.acmr, original.acmr);
+            EXPECT_LE(stats.after.atvr, original.atvr);
+
+            // 统计值与重新分析的结果一致
+            const VertexCacheStats after = AnalyzeVertexCache(mesh.indices, static_cast<u32>(mesh.vertices.size()));
+            EXPECT_FLOAT_EQ(stats.after.acmr, after.acmr);
+        }
+    }
+
+    TEST(MeshOptimizerTest, VertexFetchDropsUnreferencedVerticesAndKeepsRanges)
+    {
+        MeshData mesh = MakeMultiSubMeshMesh();
+        ShuffleTriangles(mesh, 11);
+        const MeshData original = mesh;
+
+        const u32 vertexCount = OptimizeVertexFetch(mesh.vertices, mesh.indices);
+
+        // 没有被引用的 10 个顶点被丢弃，其余顶点按首次使用顺序编号
+        EXPECT_EQ(vertexCount, original.vertices.size() - 10);
+        EXPECT_EQ(mesh.vertices.size(), vertexCount);
+        u32 next = 0;
+        for (u32 index : mesh.indices)
+        {
+            ASSERT_LE(index, next);
+            if (index == next)
+                ++next;
+        }
+        EXPECT_EQ(next, vertexCount);
+
+        // 每个索引位置引用的顶点内容不变，所以任何子网格区间内的三角形都原样保留
+        ASSERT_EQ(mesh.indices.size(), original.indices.size());
+        for (size_t i = 0; i < mesh.indices.size(); ++i)
+        {
+            ASSERT_EQ(VertexBytes(mesh.vertices[mesh.indices[i]]), VertexBytes(original.vertices[original.indices[i]])) << "index " << i;
+        }
+
+        // 完整流程同样丢弃未引用顶点
+        MeshData optimized = original;
+        OptimizeMesh(optimized);
+        EXPECT_EQ(optimized.vertices.size(), vertexCount);
+    }
+
+    TEST(MeshOptimizerTest, SplitForIndex16KeepsTrianglesAndFitsU16)
+    {
+        // 大网格按默认上限拆分；小网格用很小的上限，每个子网格都要切成很多段
+        struct SplitCase
+        {
+            MeshData mesh;
+            u32 maxVertices;
+        };
+        SplitCase cases[2];
+        AppendSubMesh(cases[0].mesh, MakeGridMesh(300, 300), 0);
+        AppendSubMesh(cases[0].mesh, MakeSphereMesh(64, 128), 1);
+        cases[0].maxVertices = INDEX16_MAX_VERTICES;
+        AppendSubMesh(cases[1].mesh, MakeSphereMesh(16, 32), 3);
+        AppendSubMesh(cases[1].mesh, MakeGridMesh(10, 10), 4);
+        cases[1].maxVertices = 100;
+
+        for (SplitCase& splitCase : cases)
+        {
+            SCOPED_TRACE("max " + std::to_string(splitCase.maxVertices) + " vertices");
+            MeshData& mesh = splitCase.mesh;
+            const MeshData original = mesh;
+            ASSERT_GT(original.vertices.size(), splitCase.maxVertices);
+            EXPECT_EQ(FitsIndex16(original.indices), splitCase.maxVertices != INDEX16_MAX_VERTICES);
+
+            const u32 segmentCount = SplitMeshForIndex16(mesh, splitCase.maxVertices);
+            ASSERT_EQ(segmentCount, mesh.subMeshes.size());
+            EXPECT_GT(segmentCount, original.subMeshes.size());
+            EXPECT_TRUE(FitsIndex16(mesh.indices));
+
+            // 每段的顶点连续存放且不超过上限，段内索引都是局部编号
+            for (u32 s = 0; s < segmentCount; ++s)
+            {
+                const SubMesh& segment = mesh.subMeshes[s];
+                const u32 vertexEnd = s + 1 < segmentCount ? mesh.subMeshes[s + 1].baseVertex : static_cast<u32>(mesh.vertices.size());
+                ASSERT_LE(segment.baseVertex, vertexEnd);
+                EXPECT_LE(vertexEnd - segment.baseVertex, splitCase.maxVertices) << "segment " << s;
+                EXPECT_EQ(segment.indexCount % 3, 0u);
+                for (u32 i = segment.indexOffset; i < segment.indexOffset + segment.indexCount; ++i)
+                {
+                    ASSERT_LT(mesh.indices[i], vertexEnd - segment.baseVertex) << "segment " << s;
+                    ASSERT_LE(mesh.indices[i], 0xFFFFu);
+                }
+            }
+
+            // 段按原子网格与三角形顺序排列，index + baseVertex 还原出的三角形与输入逐个相同
+            ASSERT_EQ(mesh.indices.size(), original.indices.size());
+            u32 sourceSubMesh = 0;
+            u32 sourceEnd = original.subMeshes[0].indexOffset + original.subMeshes[0].indexCount;
+            u32 cursor = 0;
+            for (const SubMesh& segment : mesh.subMeshes)
+            {
+                if (cursor == sourceEnd)
+                {
+                    ++sourceSubMesh;
+                    ASSERT_LT(sourceSubMesh, original.subMeshes.size());
+                    sourceEnd = original.subMeshes[sourceSubMesh].indexOffset + original.subMeshes[sourceSubMesh].indexCount;
+                }
+                EXPECT_EQ(segment.materialIndex, original.subMeshes[sourceSubMesh].materialIndex);
+                ASSERT_EQ(segment.indexOffset, cursor);
+                for (u32 i = 0; i < segment.indexCount; ++i, ++cursor)
+                {
+                    const Vertex& actual = mesh.vertices[segment.baseVertex + mesh.indices[segment.indexOffset + i]];
+                    const Vertex& expected = original.vertices[original.indices[cursor]];
+                    ASSERT_EQ(VertexBytes(actual), VertexBytes(expected)) << "index " << cursor;
+                }
+            }
+            EXPECT_EQ(cursor, original.indices.size());
+            EXPECT_EQ(sourceSubMesh + 1, original.subMeshes.size());
+        }
+    }
+
+    TEST(MeshOptimizerTest, SplitForIndex16LeavesSmallMeshUnchanged)
+    {
+        MeshData mesh = MakeSphereMesh(32, 64);
+        const MeshData original = mesh;
+        EXPECT_EQ(SplitMeshForIndex16(mesh), 1u);
+        EXPECT_EQ(mesh.indices, original.indices);
+        EXPECT_EQ(mesh.vertices.size(), original.vertices.size());
+        EXPECT_EQ(mesh.subMeshes.size(), 1u);
+        EXPECT_TRUE(FitsIndex16(mesh.indices));
+
+        // R16 的选择只看最大索引
+        const u32 boundary[] = { 0, INDEX16_MAX_VERTICES - 1 };
+        const u32 overflow[] = { 0, INDEX16_MAX_VERTICES };
+        EXPECT_TRUE(FitsIndex16(boundary));
+        EXPECT_FALSE(FitsIndex16(overflow));
+    }
+}
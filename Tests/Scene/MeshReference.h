@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Scene/MeshData.h"
+#include <cmath>
+#include <sstream>
+#include <string>
+
+namespace Sea
+{
+    // 单位球的 OBJ 文本：位置与法线按经纬网格共享，UV 在接缝处不共享，按纬度带分成 groups 个 g 分组
+    // 两极只输出一个三角形，不产生退化三角形
+    inline std::string MakeSphereOBJ(u32 rings, u32 segments, u32 groups = 1)
+    {
+        constexpr f32 PI = 3.14159265358979f;
+
+        // 位置编号（从 1 开始）：北极、rings-1 个中间纬圈、南极
+        auto position = [&](u32 ring, u32 segment) -> u32 {
+            if (ring == 0)
+                return 1;
+            if (ring == rings)
+                return 2 + (rings - 1) * segments;
+            return 2 + (ring - 1) * segments + segment % segments;
+        };
+        auto texCoord = [&](u32 ring, u32 segment) { return 1 + ring * (segments + 1) + segment; };
+
+        std::ostringstream text;
+        text << "o Sphere\n";
+        auto writePoint = [&](const char* tag, u32 ring, u32 segment) {
+            const f32 theta = PI * ring / rings;
+            const f32 phi = 2.0f * PI * segment / segments;
+            text << tag << " " << std::sin(theta) * std::cos(phi) << " " << std::cos(theta) << " "
+                 << std::sin(theta) * std::sin(phi) << "\n";
+        };
+        writePoint("v", 0, 0);
+        for (u32 ring = 1; ring < rings; ++ring)
+            for (u32 segment = 0; segment < segments; ++segment)
+                writePoint("v", ring, segment);
+        writePoint("v", rings, 0);
+
+        writePoint("vn", 0, 0);
+        for (u32 ring = 1; ring < rings; ++ring)
+            for (u32 segment = 0; segment < segments; ++segment)
+                writePoint("vn", ring, segment);
+        writePoint("vn", rings, 0);
+
+        for (u32 ring = 0; ring <= rings; ++ring)
+            for (u32 segment = 0; segment <= segments; ++segment)
+                text << "vt " << static_cast<f32>(segment) / segments << " " << static_cast<f32>(ring) / rings << "\n";
+
+        auto writeCorner = [&](u32 ring, u32 segment) {
+            const u32 p = position(ring, segment);
+            text << " " << p << "/" << texCoord(ring, segment) << "/" << p;
+        };
+        auto writeTriangle = [&](u32 r0, u32 s0, u32 r1, u32 s1, u32 r2, u32 s2) {
+            text << "f";
+            writeCorner(r0, s0);
+            writeCorner(r1, s1);
+            writeCorner(r2, s2);
+            text << "\n";
+        };
+
+        for (u32 ring = 0; ring < rings; ++ring)
+        {
+            if (ring * groups % rings < groups)
+                text << "g Band" << ring * groups / rings << "\n";
+            for (u32 segment = 0; segment < segments; ++segment)
+            {
+                if (ring != 0)
+                    writeTriangle(ring, segment, ring, segment + 1, ring + 1, segment);
+                if (ring + 1 != rings)
+                    writeTriangle(ring, segment + 1, ring + 1, segment + 1, ring + 1, segment);
+            }
+        }
+        return text.str();
+    }
+
+    // (quadsX+1) x (quadsZ+1) 个顶点的 XZ 平面网格，法线朝 +Y，三角形按行扫描顺序排列（未经缓存优化）
+    inline MeshData MakeGridMesh(u32 quadsX, u32 quadsZ, f32 spacing = 1.0f)
+    {
+        MeshData mesh;
+        for (u32 z = 0; z <= quadsZ; ++z)
+        {
+            for (u32 x = 0; x <= quadsX; ++x)
+            {
+                Vertex v = {};
+                v.position = { x * spacing, 0.0f, z * spacing };
+                v.normal = { 0.0f, 1.0f, 0.0f };
+                v.texCoord = { static_cast<f32>(x) / quadsX, static_cast<f32>(z) / quadsZ };
+                v.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+                mesh.vertices.push_back(v);
+            }
+        }
+        for (u32 z = 0; z < quadsZ; ++z)
+        {
+            for (u32 x = 0; x < quadsX; ++x)
+            {
+                const u32 a = z * (quadsX + 1) + x;
+                const u32 b = a + 1;
+                const u32 c = a + quadsX + 1;
+                const u32 d = c + 1;
+                mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+            }
+        }
+        mesh.subMeshes.push_back({ 0, static_cast<u32>(mesh.indices.size()), 0, 0 });
+        return mesh;
+    }
+
+    // 经纬球：UV 接缝两侧的顶点各自复制，两极每个扇区一个顶点（没有内容完全相同或未被引用的顶点）
+    // 两极只输出一个三角形，不产生退化三角形
+    inline MeshData MakeSphereMesh(u32 rings, u32 segments, f32 radius = 1.0f)
+    {
+        constexpr f32 PI = 3.14159265358979f;
+
+        MeshData mesh;
+        auto addVertex = [&](u32 ring, f32 segment) {
+            // 两极精确落在轴上，接缝两侧的顶点位置逐位相同
+            const bool pole = ring == 0 || ring == rings;
+            const f32 sinTheta = pole ? 0.0f : std::sin(PI * ring / rings);
+            const f32 cosTheta = pole ? (ring == 0 ? 1.0f : -1.0f) : std::cos(PI * ring / rings);
+            const f32 phi = segment < static_cast<f32>(segments) ? 2.0f * PI * segment / segments : 0.0f;
+            const XMFLOAT3 normal = { sinTheta * std::cos(phi), cosTheta, sinTheta * std::sin(phi) };
+
+            Vertex v = {};
+            v.position = { normal.x * radius, normal.y * radius, normal.z * radius };
+            v.normal = normal;
+            v.texCoord = { segment / segments, static_cast<f32>(ring) / rings };
+            v.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+            mesh.vertices.push_back(v);
+        };
+
+        for (u32 segment = 0; segment < segments; ++segment)
+            addVertex(0, segment + 0.5f);
+        for (u32 ring = 1; ring < rings; ++ring)
+            for (u32 segment = 0; segment <= segments; ++segment)
+                addVertex(ring, static_cast<f32>(segment));
+        for (u32 segment = 0; segment < segments; ++segment)
+            addVertex(rings, segment + 0.5f);
+
+        auto vertex = [rings, segments](u32 ring, u32 segment) -> u32 {
+            if (ring == 0)
+                return segment;
+            if (ring == rings)
+                return segments + (rings - 1) * (segments + 1) + segment;
+            return segments + (ring - 1) * (segments + 1) + segment;
+        };
+        for (u32 ring = 0; ring < rings; ++ring)
+        {
+            for (u32 segment = 0; segment < segments; ++segment)
+            {
+                if (ring == 0)
+                    mesh.indices.insert(mesh.indices.end(), { vertex(0, segment), vertex(1, segment + 1), vertex(1, segment) });
+                else if (ring + 1 == rings)
+                    mesh.indices.insert(mesh.indices.end(), { vertex(ring, segment), vertex(ring, segment + 1), vertex(rings, segment) });
+                else
+                    mesh.indices.insert(mesh.indices.end(), { vertex(ring, segment), vertex(ring, segment + 1), vertex(ring + 1, segment),
+                                                              vertex(ring, segment + 1), vertex(ring + 1, segment + 1), vertex(ring + 1, segment) });
+            }
+        }
+        mesh.subMeshes.push_back({ 0, static_cast<u32>(mesh.indices.size()), 0, 0 });
+        return mesh;
+    }
+
+    // 把 part 的全部三角形作为一个新子网格追加到 mesh 末尾，索引改写为全局顶点编号
+    inline void AppendSubMesh(MeshData& mesh, const MeshData& part, u32 materialIndex = 0)
+    {
+        const u32 baseVertex = static_cast<u32>(mesh.vertices.size());
+        SubMesh subMesh;
+        subMesh.indexOffset = static_cast<u32>(mesh.indices.size());
+        subMesh.indexCount = static_cast<u32>(part.indices.size());
+        subMesh.materialIndex = materialIndex;
+
+        mesh.vertices.insert(mesh.vertices.end(), part.vertices.begin(), part.vertices.end());
+        for (u32 index : part.indices)
+            mesh.indices.push_back(baseVertex + index);
+        mesh.subMeshes.push_back(subMesh);
+    }
+}
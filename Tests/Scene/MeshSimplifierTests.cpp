@@ -0,0 +1,213 @@
+#include "Scene/MeshSimplifier.h"
+#include "Scene/MeshReference.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        void TranslateMesh(MeshData& mesh, f32 x, f32 y, f32 z)
+        {
+            for (Vertex& vertex : mesh.vertices)
+                vertex.position = { vertex.position.x + x, vertex.position.y + y, vertex.position.z + z };
+        }
+
+        // 球（UV 接缝 + 两极各扇区独立的顶点）、远处的网格、只有 2 个三角形的小网格，三个材质各一个子网格
+        MeshData MakeSimplifyTestMesh()
+        {
+            MeshData mesh;
+            AppendSubMesh(mesh, MakeSphereMesh(32, 64), 0);
+
+            MeshData grid = MakeGridMesh(24, 24, 0.125f);
+            TranslateMesh(grid, 2.0f, 0.0f, 0.0f);
+            AppendSubMesh(mesh, grid, 1);
+
+            MeshData tiny = MakeGridMesh(1, 1, 0.25f);
+            TranslateMesh(tiny, -2.0f, 0.0f, 0.0f);
+            AppendSubMesh(mesh, tiny, 2);
+            return mesh;
+        }
+    }
+
+    TEST(MeshSimplifierTest, LODTriangleCountsDecrease)
+    {
+        MeshData mesh = MakeSimplifyTestMesh();
+        const u32 inputTriangles = static_cast<u32>(mesh.indices.size() / 3);
+        const size_t lod0IndexCount = mesh.indices.size();
+
+        LODChainOptions options;
+        options.levelCount = 5;
+        std::vector<MeshLOD> lods;
+        GenerateLODChain(mesh.vertices, mesh.subMeshes, options, mesh.indices, lods);
+
+        ASSERT_GE(lods.size(), 3u);
+        EXPECT_EQ(lods[0].triangleCount, inputTriangles);
+        EXPECT_EQ(lods[0].error, 0.0f);
+        for (size_t level = 0; level < lods.size(); ++level)
+        {
+            SCOPED_TRACE(testing::Message() << "LOD" << level);
+            const MeshLOD& lod = lods[level];
+            if (level > 0)
+            {
+                // 每一级至少减少 10%，误差只增不减
+                EXPECT_LE(lod.triangleCount, lods[level - 1].triangleCount * 0.9f);
+                EXPECT_GE(lod.error, lods[level - 1].error);
+            }
+
+            ASSERT_EQ(lod.subMeshes.size(), mesh.subMeshes.size());
+            u32 triangleCount = 0;
+            for (size_t s = 0; s < lod.subMeshes.size(); ++s)
+            {
+                const SubMesh& subMesh = lod.subMeshes[s];
+                EXPECT_EQ(subMesh.materialIndex, mesh.subMeshes[s].materialIndex);
+                EXPECT_EQ(subMesh.indexCount % 3, 0u);
+                ASSERT_LE(subMesh.indexOffset + subMesh.indexCount, mesh.indices.size());
+                if (level > 0)
+                    EXPECT_GE(subMesh.indexOffset, lod0IndexCount);     // LOD 的索引追加在 LOD0 之后
+                for (u32 i = subMesh.indexOffset; i < subMesh.indexOffset + subMesh.indexCount; ++i)
+                    ASSERT_LT(mesh.indices[i] + subMesh.baseVertex, mesh.vertices.size());
+                triangleCount += subMesh.indexCount / 3;
+            }
+            EXPECT_EQ(triangleCount, lod.triangleCount);
+        }
+    }
+
+    TEST(MeshSimplifierTest, EverySubMeshKeepsATriangle)
+    {
+        // 误差不设限、每级只保留 30%，把链推到最粗
+        MeshData mesh = MakeSimplifyTestMesh();
+        LODChainOptions options;
+        options.levelCount = MESH_MAX_LODS;
+        options.reduction = 0.3f;
+        options.maxError = 1.0f;
+        std::vector<MeshLOD> lods;
+        GenerateLODChain(mesh.vertices, mesh.subMeshes, options, mesh.indices, lods);
+
+        ASSERT_GE(lods.size(), 3u);
+        for (size_t level = 0; level < lods.size(); ++level)
+        {
+            for (size_t s = 0; s < lods[level].subMeshes.size(); ++s)
+                EXPECT_GE(lods[level].subMeshes[s].indexCount, 3u) << "LOD" << level << " submesh " << s;
+        }
+
+        // 直接要求 0 个三角形时也不能删掉任何一个分组
+        std::vector<u32> indices;
+        std::vector<u32> groups;
+        for (u32 s = 0; s < mesh.subMeshes.size(); ++s)
+        {
+            const SubMesh& subMesh = mesh.subMeshes[s];
+            for (u32 i = subMesh.indexOffset; i < subMesh.indexOffset + subMesh.indexCount; ++i)
+                indices.push_back(mesh.indices[i] + subMesh.baseVertex);
+            groups.insert(groups.end(), subMesh.indexCount / 3, s);
+        }
+        std::vector<u32> outIndices;
+        std::vector<u32> outGroups;
+        SimplifyMesh(mesh.vertices, indices, groups, 0, 1.0f, outIndices, outGroups);
+        ASSERT_EQ(outGroups.size() * 3, outIndices.size());
+        EXPECT_LT(outGroups.size(), groups.size());
+        for (u32 s = 0; s < mesh.subMeshes.size(); ++s)
+            EXPECT_NE(std::find(outGroups.begin(), outGroups.end(), s), outGroups.end()) << "group " << s;
+    }
+
+    TEST(MeshSimplifierTest, SeamVerticesAreNotMixed)
+    {
+        // 两块网格沿 x = 2 拼成一个平面（同一分组），接缝上的位置逐位相同，UV 分别落在 [0, 1] 与 [2, 3] 两个图块
+        // 平面上的折叠误差为 0，简化会一直进行到接缝两侧；每个三角形都只能引用同一图块的顶点
+        MeshData plane;
+        AppendSubMesh(plane, MakeGridMesh(16, 16, 0.125f));
+        MeshData right = MakeGridMesh(16, 16, 0.125f);
+        TranslateMesh(right, 2.0f, 0.0f, 0.0f);
+        for (Vertex& vertex : right.vertices)
+            vertex.texCoord.x += 2.0f;
+        AppendSubMesh(plane, right);
+
+        const std::vector<u32> planeGroups(plane.indices.size() / 3, 0);
+        for (u32 target : { 256u, 64u, 16u })
+        {
+            SCOPED_TRACE(testing::Message() << "plane, " << target << " triangles");
+            std::vector<u32> indices;
+            std::vector<u32> groups;
+            SimplifyStats stats;
+            SimplifyMesh(plane.vertices, plane.indices, planeGroups, target, 1.0f, indices, groups, &stats);
+            EXPECT_EQ(stats.seamVertices, 17u);
+            EXPECT_LT(indices.size() / 3, plane.indices.size() / 3);
+
+            u32 mixed = 0;
+            for (size_t t = 0; t + 2 < indices.size(); t += 3)
+            {
+                const bool island0 = plane.vertices[indices[t]].texCoord.x > 1.5f;
+                const bool island1 = plane.vertices[indices[t + 1]].texCoord.x > 1.5f;
+                const bool island2 = plane.vertices[indices[t + 2]].texCoord.x > 1.5f;
+                mixed += island0 != island1 || island0 != island2 ? 1 : 0;
+            }
+            EXPECT_EQ(mixed, 0u);
+        }
+
+        // 球的经度接缝：u = 0 与 u = 1 的顶点位置相同，引用其中一个的三角形其余顶点必须在同一侧
+        const MeshData sphere = MakeSphereMesh(32, 64);
+        const std::vector<u32> sphereGroups(sphere.indices.size() / 3, 0);
+        for (u32 target : { 2048u, 512u, 128u })
+        {
+            SCOPED_TRACE(testing::Message() << "sphere, " << target << " triangles");
+            std::vector<u32> indices;
+            std::vector<u32> groups;
+            SimplifyStats stats;
+            SimplifyMesh(sphere.vertices, sphere.indices, sphereGroups, target, 1.0f, indices, groups, &stats);
+            EXPECT_GT(stats.seamVertices, 0u);
+            EXPECT_LE(indices.size() / 3, target * 1.1f);
+
+            u32 mixed = 0;
+            for (size_t t = 0; t + 2 < indices.size(); t += 3)
+            {
+                bool onStart = false, onEnd = false, nearStart = false, nearEnd = false;
+                for (u32 k = 0; k < 3; ++k)
+                {
+                    const f32 u = sphere.vertices[indices[t + k]].texCoord.x;
+                    onStart |= u == 0.0f;
+                    onEnd |= u == 1.0f;
+                    nearStart |= u < 0.5f;
+                    nearEnd |= u > 0.5f;
+                }
+                mixed += (onStart && nearEnd) || (onEnd && nearStart) ? 1 : 0;
+            }
+            EXPECT_EQ(mixed, 0u);
+        }
+    }
+
+    TEST(MeshSimplifierTest, ErrorStaysWithinLimit)
+    {
+        MeshData mesh = MakeSimplifyTestMesh();
+        std::vector<u32> groups(mesh.indices.size() / 3, 0);
+        for (u32 s = 0; s < mesh.subMeshes.size(); ++s)
+            std::fill(groups.begin() + mesh.subMeshes[s].indexOffset / 3,
+                      groups.begin() + (mesh.subMeshes[s].indexOffset + mesh.subMeshes[s].indexCount) / 3, s);
+
+        // 三角形数目标为 0，只由误差上限决定停在哪里：上限越大剩下的三角形越少
+        size_t previousTriangles = mesh.indices.size() / 3 + 1;
+        for (f32 targetError : { 1e-4f, 1e-3f, 1e-2f, 5e-2f })
+        {
+            SCOPED_TRACE(testing::Message() << "target error " << targetError);
+            std::vector<u32> indices;
+            std::vector<u32> outGroups;
+            const f32 error = SimplifyMesh(mesh.vertices, mesh.indices, groups, 0, targetError, indices, outGroups);
+            EXPECT_GE(error, 0.0f);
+            EXPECT_LE(error, targetError * 1.0001f);
+            EXPECT_LE(indices.size() / 3, previousTriangles);
+            previousTriangles = indices.size() / 3;
+        }
+        EXPECT_LT(previousTriangles, mesh.indices.size() / 3);
+
+        // LOD 链的累计误差不超过 maxError
+        LODChainOptions options;
+        options.levelCount = MESH_MAX_LODS;
+        options.maxError = 0.01f;
+        std::vector<MeshLOD> lods;
+        GenerateLODChain(mesh.vertices, mesh.subMeshes, options, mesh.indices, lods);
+        ASSERT_GE(lods.size(), 2u);
+        for (const MeshLOD& lod : lods)
+            EXPECT_LE(lod.error, options.maxError * 1.0001f);
+    }
+}
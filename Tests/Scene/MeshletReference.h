@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Scene/Frustum.h"
+#include "Scene/MeshData.h"
+#include "Scene/Meshlet.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace Sea
+{
+    // 剔除测试视角：偶数视角在 2.5 倍包围球半径处环绕看向中心，奇数视角靠近到 1.2 倍并偏离中心（部分出屏）
+    // 每三个视角中有一个给物体加上旋转 + 均匀缩放，验证局部空间剔除
+    struct MeshletTestView
+    {
+        XMFLOAT3 eye = { 0, 0, 0 };
+        Frustum frustum;
+        XMFLOAT4X4 world = {};
+    };
+
+    inline MeshletTestView MakeMeshletTestView(const XMFLOAT3& center, f32 radius, u32 view, u32 viewCount)
+    {
+        const bool nearView = (view % 2) == 1;
+        const f32 angle = 6.2831853f * view / viewCount;
+        const f32 elevation = (view % 4 < 2) ? 0.35f : -0.35f;
+        const f32 distance = radius * (nearView ? 1.2f : 2.5f);
+
+        MeshletTestView result;
+        result.eye = { center.x + std::cos(angle) * std::cos(elevation) * distance,
+                       center.y + std::sin(elevation) * distance,
+                       center.z + std::sin(angle) * std::cos(elevation) * distance };
+        XMFLOAT3 target = center;
+        if (nearView)
+            target = { center.x - std::sin(angle) * radius * 0.5f, center.y, center.z + std::cos(angle) * radius * 0.5f };
+
+        XMMATRIX viewMatrix = XMMatrixLookAtLH(XMLoadFloat3(&result.eye), XMLoadFloat3(&target), XMVectorSet(0, 1, 0, 0));
+        XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, radius * 0.01f, radius * 10.0f);
+        XMFLOAT4X4 viewProj;
+        XMStoreFloat4x4(&viewProj, viewMatrix * proj);
+        result.frustum.SetFromViewProjection(viewProj);
+
+        const f32 scale = (view % 3 == 2) ? 2.0f : 1.0f;
+        XMMATRIX world = XMMatrixTranslation(-center.x, -center.y, -center.z) * XMMatrixScaling(scale, scale, scale) *
+                         XMMatrixRotationRollPitchYaw(0.0f, (view % 3 == 2) ? 0.6f : 0.0f, 0.0f) *
+                         XMMatrixTranslation(center.x, center.y, center.z);
+        XMStoreFloat4x4(&result.world, world);
+        return result;
+    }
+
+    // 保守性检查：不在绘制区间里的三角形必须是退化、背面（仅当允许背面剔除时），或三个顶点都在同一个视锥平面外侧
+    // 返回违反条件的三角形个数；subMeshes 为空时整块索引按 baseVertex = 0 处理
+    inline u64 CountRejectedVisibleTriangles(std::span<const Vertex> vertices, std::span<const u32> indices,
+                                             std::span<const SubMesh> subMeshes, std::span<const MeshletDrawRange> ranges,
+                                             const MeshletTestView& view, f32 radius, bool backfaceCulling = true)
+    {
+        const u64 triangleCount = indices.size() / 3;
+        std::vector<u8> visibleTriangles(triangleCount, 0);
+        for (const MeshletDrawRange& range : ranges)
+            std::fill(visibleTriangles.begin() + range.indexOffset / 3, visibleTriangles.begin() + (range.indexOffset + range.indexCount) / 3, 1);
+
+        std::vector<u32> baseVertices(triangleCount, 0);
+        for (const SubMesh& subMesh : subMeshes)
+            std::fill(baseVertices.begin() + subMesh.indexOffset / 3, baseVertices.begin() + (subMesh.indexOffset + subMesh.indexCount) / 3, subMesh.baseVertex);
+
+        auto sub = [](const XMFLOAT3& a, const XMFLOAT3& b) { return XMFLOAT3{ a.x - b.x, a.y - b.y, a.z - b.z }; };
+        const XMMATRIX world = XMLoadFloat4x4(&view.world);
+        u64 nonConservative = 0;
+        for (u64 t = 0; t < triangleCount; ++t)
+        {
+            if (visibleTriangles[t])
+                continue;
+
+            XMFLOAT3 p[3];
+            for (u32 k = 0; k < 3; ++k)
+                XMStoreFloat3(&p[k], XMVector3TransformCoord(XMLoadFloat3(&vertices[indices[t * 3 + k] + baseVertices[t]].position), world));
+
+            const XMFLOAT3 e1 = sub(p[1], p[0]);
+            const XMFLOAT3 e2 = sub(p[2], p[0]);
+            const XMFLOAT3 n = { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };
+            const f32 length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+            if (length <= 1e-20f)
+                continue;
+            const XMFLOAT3 toEye = sub(p[0], view.eye);
+            if (backfaceCulling && (n.x * toEye.x + n.y * toEye.y + n.z * toEye.z) / length >= -radius * 1e-4f)
+                continue;
+
+            bool outside = false;
+            for (u32 i = 0; i < Frustum::Count && !outside; ++i)
+            {
+                const XMFLOAT4& plane = view.frustum.GetPlane(i);
+                outside = true;
+                for (u32 k = 0; k < 3; ++k)
+                    outside &= plane.x * p[k].x + plane.y * p[k].y + plane.z * p[k].z + plane.w < radius * 1e-4f;
+            }
+            if (!outside)
+                ++nonConservative;
+        }
+        return nonConservative;
+    }
+}
@@ -0,0 +1,241 @@
+#include "Scene/Meshlet.h"
+#include "Scene/MeshletReference.h"
+#include "Scene/MeshReference.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        using Triangle = std::array<u32, 3>;
+
+        // 三角形旋转到最小编号在前（保留绕序），编号为加上 baseVertex 后的全局顶点
+        Triangle Canonical(u32 a, u32 b, u32 c)
+        {
+            Triangle triangle = { a, b, c };
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            return triangle;
+        }
+
+        std::vector<Triangle> CollectTriangles(const MeshData& mesh, const SubMesh& subMesh)
+        {
+            std::vector<Triangle> triangles;
+            for (u32 i = subMesh.indexOffset; i + 2 < subMesh.indexOffset + subMesh.indexCount; i += 3)
+            {
+                triangles.push_back(Canonical(mesh.indices[i] + subMesh.baseVertex, mesh.indices[i + 1] + subMesh.baseVertex,
+                                              mesh.indices[i + 2] + subMesh.baseVertex));
+            }
+            std::sort(triangles.begin(), triangles.end());
+            return triangles;
+        }
+
+        void ShuffleTriangles(MeshData& mesh, u32 seed)
+        {
+            std::mt19937 rng(seed);
+            for (const SubMesh& subMesh : mesh.subMeshes)
+            {
+                std::vector<Triangle> triangles(subMesh.indexCount / 3);
+                std::memcpy(triangles.data(), mesh.indices.data() + subMesh.indexOffset, triangles.size() * sizeof(Triangle));
+                std::shuffle(triangles.begin(), triangles.end(), rng);
+                std::memcpy(mesh.indices.data() + subMesh.indexOffset, triangles.data(), triangles.size() * sizeof(Triangle));
+            }
+        }
+
+        // 球 + 网格两个子网格，第三个子网格用 baseVertex 引用追加在末尾的另一个球（局部索引）
+        MeshData MakeMeshletTestMesh()
+        {
+            MeshData mesh;
+            AppendSubMesh(mesh, MakeSphereMesh(24, 48), 0);
+            AppendSubMesh(mesh, MakeGridMesh(30, 20, 0.1f), 1);
+
+            const MeshData part = MakeSphereMesh(10, 16, 0.5f);
+            SubMesh subMesh;
+            subMesh.indexOffset = static_cast<u32>(mesh.indices.size());
+            subMesh.indexCount = static_cast<u32>(part.indices.size());
+            subMesh.baseVertex = static_cast<u32>(mesh.vertices.size());
+            subMesh.materialIndex = 2;
+            mesh.vertices.insert(mesh.vertices.end(), part.vertices.begin(), part.vertices.end());
+            mesh.indices.insert(mesh.indices.end(), part.indices.begin(), part.indices.end());
+            mesh.subMeshes.push_back(subMesh);
+
+            ShuffleTriangles(mesh, 7);
+            return mesh;
+        }
+
+        struct MeshletLimits
+        {
+            u32 maxVertices;
+            u32 maxTriangles;
+        };
+        constexpr MeshletLimits LIMITS[] = { { MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES }, { 16, 8 }, { 3, 1 }, { 128, 256 } };
+    }
+
+    TEST(MeshletTest, RespectsVertexAndTriangleLimits)
+    {
+        for (const MeshletLimits& limits : LIMITS)
+        {
+            SCOPED_TRACE(testing::Message() << limits.maxVertices << " vertices / " << limits.maxTriangles << " triangles");
+            MeshData mesh = MakeMeshletTestMesh();
+            MeshletData data;
+            BuildMeshlets(mesh.vertices, mesh.indices, mesh.subMeshes, data, limits.maxVertices, limits.maxTriangles);
+            ASSERT_FALSE(data.IsEmpty());
+            ASSERT_EQ(data.bounds.size(), data.meshlets.size());
+
+            // 各 meshlet 的顶点 / 三角形在 MeshletData 里首尾相接
+            u32 vertexOffset = 0;
+            u32 triangleOffset = 0;
+            for (const Meshlet& meshlet : data.meshlets)
+            {
+                EXPECT_GT(meshlet.triangleCount, 0u);
+                EXPECT_LE(meshlet.triangleCount, limits.maxTriangles);
+                EXPECT_GE(meshlet.vertexCount, 3u);
+                EXPECT_LE(meshlet.vertexCount, limits.maxVertices);
+                EXPECT_EQ(meshlet.vertexOffset, vertexOffset);
+                EXPECT_EQ(meshlet.triangleOffset, triangleOffset);
+                vertexOffset += meshlet.vertexCount;
+                triangleOffset += meshlet.triangleCount * 3;
+
+                for (u32 i = 0; i < meshlet.triangleCount * 3; ++i)
+                    EXPECT_LT(data.triangles[meshlet.triangleOffset + i], meshlet.vertexCount);
+                for (u32 i = 0; i < meshlet.vertexCount; ++i)
+                    EXPECT_LT(data.vertices[meshlet.vertexOffset + i], mesh.vertices.size());
+            }
+            EXPECT_EQ(data.vertices.size(), vertexOffset);
+            EXPECT_EQ(data.triangles.size(), triangleOffset);
+        }
+    }
+
+    TEST(MeshletTest, IndexRangesAreContiguousAndCoverEveryTriangleOnce)
+    {
+        for (const MeshletLimits& limits : LIMITS)
+        {
+            SCOPED_TRACE(testing::Message() << limits.maxVertices << " vertices / " << limits.maxTriangles << " triangles");
+            MeshData mesh = MakeMeshletTestMesh();
+            std::vector<std::vector<Triangle>> expected;
+            for (const SubMesh& subMesh : mesh.subMeshes)
+                expected.push_back(CollectTriangles(mesh, subMesh));
+
+            MeshletData data;
+            BuildMeshlets(mesh.vertices, mesh.indices, mesh.subMeshes, data, limits.maxVertices, limits.maxTriangles);
+
+            // 每个子网格内的三角形集合（含绕序）不变
+            for (size_t s = 0; s < mesh.subMeshes.size(); ++s)
+                EXPECT_EQ(CollectTriangles(mesh, mesh.subMeshes[s]), expected[s]) << "submesh " << s;
+
+            // meshlet 按顺序首尾相接铺满每个子网格的索引区间，不跨子网格
+            size_t m = 0;
+            for (const SubMesh& subMesh : mesh.subMeshes)
+            {
+                u32 cursor = subMesh.indexOffset;
+                while (m < data.meshlets.size() && cursor < subMesh.indexOffset + subMesh.indexCount)
+                {
+                    const Meshlet& meshlet = data.meshlets[m++];
+                    EXPECT_EQ(meshlet.indexOffset, cursor);
+                    EXPECT_EQ(meshlet.baseVertex, subMesh.baseVertex);
+                    cursor += meshlet.triangleCount * 3;
+                }
+                EXPECT_EQ(cursor, subMesh.indexOffset + subMesh.indexCount);
+            }
+            EXPECT_EQ(m, data.meshlets.size());
+
+            // meshlet 的局部三角形与它在索引缓冲里的区间逐个对应
+            for (const Meshlet& meshlet : data.meshlets)
+            {
+                for (u32 i = 0; i < meshlet.triangleCount * 3; ++i)
+                {
+                    const u32 local = data.triangles[meshlet.triangleOffset + i];
+                    ASSERT_EQ(data.vertices[meshlet.vertexOffset + local], mesh.indices[meshlet.indexOffset + i] + meshlet.baseVertex);
+                }
+            }
+        }
+    }
+
+    TEST(MeshletTest, BoundsContainVerticesAndConeContainsNormals)
+    {
+        MeshData mesh = MakeMeshletTestMesh();
+        MeshletData data;
+        BuildMeshlets(mesh.vertices, mesh.indices, mesh.subMeshes, data);
+
+        u32 coneCount = 0;
+        for (size_t m = 0; m < data.meshlets.size(); ++m)
+        {
+            const Meshlet& meshlet = data.meshlets[m];
+            const MeshletBounds& bounds = data.bounds[m];
+            for (u32 i = 0; i < meshlet.vertexCount; ++i)
+            {
+                const XMFLOAT3& p = mesh.vertices[data.vertices[meshlet.vertexOffset + i]].position;
+                const f32 dx = p.x - bounds.center.x, dy = p.y - bounds.center.y, dz = p.z - bounds.center.z;
+                EXPECT_LE(std::sqrt(dx * dx + dy * dy + dz * dz), bounds.radius * 1.0001f + 1e-6f) << "meshlet " << m;
+            }
+
+            if (bounds.coneCutoff >= 1.0f)
+                continue;
+            ++coneCount;
+            // 锥半角 θ 满足 sin θ = coneCutoff，每个三角形法线与锥轴的夹角不超过 θ
+            const f32 minCos = std::sqrt(1.0f - bounds.coneCutoff * bounds.coneCutoff);
+            for (u32 t = 0; t < meshlet.triangleCount; ++t)
+            {
+                XMFLOAT3 p[3];
+                for (u32 k = 0; k < 3; ++k)
+                    p[k] = mesh.vertices[data.vertices[meshlet.vertexOffset + data.triangles[meshlet.triangleOffset + t * 3 + k]]].position;
+                const XMVECTOR n = XMVector3Normalize(XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&p[1]), XMLoadFloat3(&p[0])),
+                                                                     XMVectorSubtract(XMLoadFloat3(&p[2]), XMLoadFloat3(&p[0]))));
+                EXPECT_GE(XMVectorGetX(XMVector3Dot(n, XMLoadFloat3(&bounds.coneAxis))), minCos - 1e-4f) << "meshlet " << m;
+            }
+        }
+        // 球面和平面上大部分 meshlet 都应有可用的法线锥，否则背面剔除形同虚设
+        EXPECT_GT(coneCount, data.meshlets.size() / 2);
+    }
+
+    TEST(MeshletTest, CullingIsConservative)
+    {
+        constexpr u32 VIEW_COUNT = 16;
+
+        MeshData mesh = MakeMeshletTestMesh();
+        MeshletData data;
+        BuildMeshlets(mesh.vertices, mesh.indices, mesh.subMeshes, data);
+
+        // 包围盒 [-1, 3] x [-1, 1] x [-1, 2] 的中心与半对角线
+        const XMFLOAT3 center = { 1.0f, 0.0f, 0.5f };
+        const f32 radius = 2.7f;
+
+        std::vector<MeshletDrawRange> ranges;
+        MeshletCullStats total;
+        for (u32 v = 0; v < VIEW_COUNT; ++v)
+        {
+            SCOPED_TRACE(testing::Message() << "view " << v);
+            MeshletTestView view = MakeMeshletTestView(center, radius, v, VIEW_COUNT);
+
+            MeshletCullStats stats;
+            CullMeshlets(data, view.frustum, view.eye, view.world, ranges, &stats);
+            total.Add(stats);
+            EXPECT_EQ(CountRejectedVisibleTriangles(mesh.vertices, mesh.indices, mesh.subMeshes, ranges, view, radius), 0u);
+
+            // 不允许背面剔除时，只能剔除完全在视锥外的三角形
+            CullMeshlets(data, view.frustum, view.eye, view.world, ranges, &stats, false);
+            EXPECT_EQ(stats.backfaceCulled, 0u);
+            EXPECT_EQ(CountRejectedVisibleTriangles(mesh.vertices, mesh.indices, mesh.subMeshes, ranges, view, radius, false), 0u);
+
+            // 非均匀缩放与镜像下法线锥不再保守，同样只能做视锥剔除
+            const XMMATRIX scales[] = { XMMatrixScaling(1.5f, 0.5f, 1.0f), XMMatrixScaling(-1.0f, 1.0f, 1.0f) };
+            for (const XMMATRIX& scale : scales)
+            {
+                XMStoreFloat4x4(&view.world, XMMatrixTranslation(-center.x, -center.y, -center.z) * scale *
+                                             XMMatrixTranslation(center.x, center.y, center.z));
+                CullMeshlets(data, view.frustum, view.eye, view.world, ranges, &stats);
+                EXPECT_EQ(stats.backfaceCulled, 0u);
+                EXPECT_EQ(CountRejectedVisibleTriangles(mesh.vertices, mesh.indices, mesh.subMeshes, ranges, view, radius, false), 0u);
+            }
+        }
+
+        // 测试视角下两种剔除都确实发生过
+        EXPECT_GT(total.frustumCulled, 0u);
+        EXPECT_GT(total.backfaceCulled, 0u);
+    }
+}
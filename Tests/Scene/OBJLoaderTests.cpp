@@ -0,0 +1,270 @@
+#include "Scene/OBJLoader.h"
+#include "Scene/OBJParser.h"
+#include "Core/JobSystem.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace Sea
+{
+    namespace
+    {
+        // 每个测试把 OBJ 文本写到临时目录，结束时删除
+        class OBJLoaderTest : public ::testing::Test
+        {
+        protected:
+            void TearDown() override
+            {
+                for (const auto& path : m_Files)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                }
+            }
+
+            std::string WriteOBJ(const std::string& contents)
+            {
+                const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+                auto path = std::filesystem::temp_directory_path() /
+                            (std::string("SeaOBJ_") + info->name() + "_" + std::to_string(m_Files.size()) + ".obj");
+                std::ofstream(path, std::ios::binary) << contents;
+                m_Files.push_back(path);
+                return path.string();
+            }
+
+            std::vector<std::filesystem::path> m_Files;
+        };
+
+        struct ParsedOBJ
+        {
+            tinyobj::attrib_t attrib;
+            std::vector<tinyobj::shape_t> shapes;
+            std::vector<tinyobj::material_t> materials;
+        };
+
+        OBJParseResult ParseParallel(const std::string& path, ParsedOBJ& out, OBJParseStats* stats = nullptr)
+        {
+            std::string warning;
+            return ParseOBJParallel(path, "", out.attrib, out.shapes, out.materials, warning, stats);
+        }
+
+        bool ParseReference(const std::string& path, ParsedOBJ& out)
+        {
+            std::string warning, error;
+            return tinyobj::LoadObj(&out.attrib, &out.shapes, &out.materials, &warning, &error, path.c_str(), "");
+        }
+
+        void ExpectSameIndices(const tinyobj::mesh_t& actual, const tinyobj::mesh_t& expected)
+        {
+            ASSERT_EQ(actual.indices.size(), expected.indices.size());
+            for (size_t i = 0; i < actual.indices.size(); ++i)
+            {
+                EXPECT_EQ(actual.indices[i].vertex_index, expected.indices[i].vertex_index) << "index " << i;
+                EXPECT_EQ(actual.indices[i].normal_index, expected.indices[i].normal_index) << "index " << i;
+                EXPECT_EQ(actual.indices[i].texcoord_index, expected.indices[i].texcoord_index) << "index " << i;
+            }
+            EXPECT_EQ(actual.material_ids, expected.material_ids);
+        }
+
+        // 只含三角形的结果与 tinyobjloader 逐项比较（四边形的切分方式单独测试）
+        void ExpectMatchesReference(const ParsedOBJ& actual, const ParsedOBJ& expected)
+        {
+            EXPECT_EQ(actual.attrib.vertices, expected.attrib.vertices);
+            EXPECT_EQ(actual.attrib.normals, expected.attrib.normals);
+            EXPECT_EQ(actual.attrib.texcoords, expected.attrib.texcoords);
+            ASSERT_EQ(actual.shapes.size(), expected.shapes.size());
+            for (size_t s = 0; s < actual.shapes.size(); ++s)
+            {
+                SCOPED_TRACE("shape " + std::to_string(s));
+                ExpectSameIndices(actual.shapes[s].mesh, expected.shapes[s].mesh);
+            }
+        }
+
+        // size x size 个顶点的网格，每格两个三角形；坐标都是 0.25 的整数倍，文本与浮点一一对应
+        std::string MakeGridOBJ(u32 size)
+        {
+            std::ostringstream text;
+            text << "o Grid\n";
+            for (u32 z = 0; z < size; ++z)
+            {
+                for (u32 x = 0; x < size; ++x)
+                {
+                    text << "v " << x * 0.25f << " 0 " << z * 0.25f << "\n";
+                    text << "vt " << x * 0.25f << " " << z * 0.25f << "\n";
+                }
+            }
+            text << "vn 0 1 0\n";
+            for (u32 z = 0; z + 1 < size; ++z)
+            {
+                for (u32 x = 0; x + 1 < size; ++x)
+                {
+                    const u32 a = z * size + x + 1;
+                    const u32 b = a + 1;
+                    const u32 c = a + size;
+                    const u32 d = c + 1;
+                    text << "f " << a << "/" << a << "/1 " << c << "/" << c << "/1 " << b << "/" << b << "/1\n";
+                    text << "f " << b << "/" << b << "/1 " << c << "/" << c << "/1 " << d << "/" << d << "/1\n";
+                }
+            }
+            return text.str();
+        }
+    }
+
+    TEST_F(OBJLoaderTest, ParallelParserMatchesTinyObjOnTriangles)
+    {
+        // 各种索引写法、相对索引与多个 group
+        const std::string path = WriteOBJ(
+            "# test\n"
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+            "vt 0 0\nvt 1 0\nvt 1 1\n"
+            "vn 0 0 1\n"
+            "g First\n"
+            "f 1/1/1 2/2/1 3/3/1\n"
+            "f 1//1 3//1 4//1\n"
+            "g Second\n"
+            "v 2 0 0.5\nv 2 1 -0.5\r\n"
+            "f -1/-1 -2/-2 2/-3\n"
+            "f 2 5 6\n");
+
+        ParsedOBJ parallel, reference;
+        ASSERT_EQ(ParseParallel(path, parallel), OBJParseResult::Success);
+        ASSERT_TRUE(ParseReference(path, reference));
+        EXPECT_EQ(parallel.shapes.size(), 2u);
+        ExpectMatchesReference(parallel, reference);
+    }
+
+    TEST_F(OBJLoaderTest, QuadSplitsAlongShorterDiagonal)
+    {
+        // 1-3 对角线（长度平方 2）比 0-2（长度平方 10）短
+        const std::string path = WriteOBJ(
+            "v 0 0 0\nv 1 0 0\nv 3 1 0\nv 0 1 0\n"
+            "f 1 2 3 4\n");
+
+        ParsedOBJ parsed;
+        ASSERT_EQ(ParseParallel(path, parsed), OBJParseResult::Success);
+        ASSERT_EQ(parsed.shapes.size(), 1u);
+
+        const auto& indices = parsed.shapes[0].mesh.indices;
+        const int expected[] = { 0, 1, 3, 1, 2, 3 };
+        ASSERT_EQ(indices.size(), std::size(expected));
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            EXPECT_EQ(indices[i].vertex_index, expected[i]) << "index " << i;
+        }
+    }
+
+    TEST_F(OBJLoaderTest, MultiChunkParseMatchesTinyObj)
+    {
+        // 文件足够大时按行边界切成多块并行解析，拼接后必须与串行结果一致
+        JobSystem::Initialize(4);
+        const std::string path = WriteOBJ(MakeGridOBJ(160));
+
+        ParsedOBJ parallel, reference;
+        OBJParseStats stats;
+        EXPECT_EQ(ParseParallel(path, parallel, &stats), OBJParseResult::Success);
+        JobSystem::Shutdown();
+
+        EXPECT_GT(stats.chunkCount, 1u);
+        ASSERT_TRUE(ParseReference(path, reference));
+        ExpectMatchesReference(parallel, reference);
+    }
+
+    TEST_F(OBJLoaderTest, ParallelParseIsByteIdenticalAtAnyThreadCount)
+    {
+        // 分块数随线程数变化，解析结果与最终网格必须与 tinyobjloader 的串行解析逐字节一致
+        const std::string path = WriteOBJ(MakeGridOBJ(200));
+        ParsedOBJ reference;
+        ASSERT_TRUE(ParseReference(path, reference));
+        ASSERT_EQ(reference.shapes.size(), 1u);
+
+        auto sameBytes = [](const auto& actual, const auto& expected) {
+            return actual.size() == expected.size() &&
+                   std::memcmp(actual.data(), expected.data(), actual.size() * sizeof(actual[0])) == 0;
+        };
+
+        MeshData serialMesh;
+        for (u32 threadCount : { 1u, 2u, 3u, 4u, 8u, 16u })
+        {
+            SCOPED_TRACE(std::to_string(threadCount) + " threads");
+            ScopedJobSystem jobSystem(threadCount);
+
+            ParsedOBJ parallel;
+            OBJParseStats stats;
+            ASSERT_EQ(ParseParallel(path, parallel, &stats), OBJParseResult::Success);
+            EXPECT_EQ(stats.threadCount, threadCount);
+            EXPECT_GT(stats.chunkCount, 1u);
+
+            EXPECT_TRUE(sameBytes(parallel.attrib.vertices, reference.attrib.vertices));
+            EXPECT_TRUE(sameBytes(parallel.attrib.normals, reference.attrib.normals));
+            EXPECT_TRUE(sameBytes(parallel.attrib.texcoords, reference.attrib.texcoords));
+            ASSERT_EQ(parallel.shapes.size(), 1u);
+            ExpectSameIndices(parallel.shapes[0].mesh, reference.shapes[0].mesh);
+
+            MeshData mesh;
+            ASSERT_TRUE(LoadOBJ(path, mesh));
+            if (threadCount == 1)
+            {
+                serialMesh = mesh;
+                continue;
+            }
+            EXPECT_TRUE(sameBytes(mesh.vertices, serialMesh.vertices));
+            EXPECT_TRUE(sameBytes(mesh.indices, serialMesh.indices));
+            EXPECT_TRUE(sameBytes(mesh.subMeshes, serialMesh.subMeshes));
+        }
+    }
+
+    TEST_F(OBJLoaderTest, LoadDeduplicatesSharedVertices)
+    {
+        // 两个三角形共享一条边；同一位置但法线不同的角要拆成两个顶点
+        const std::string path = WriteOBJ(
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+            "vn 0 0 1\nvn 1 0 0\n"
+            "f 1//1 2//1 3//1\n"
+            "f 1//1 3//1 4//1\n"
+            "f 1//2 3//2 4//1\n");
+
+        MeshData data;
+        OBJLoadStats stats;
+        ASSERT_TRUE(LoadOBJ(path, data, &stats));
+        EXPECT_EQ(data.indices.size(), 9u);
+        EXPECT_EQ(stats.indexCount, 9u);
+        EXPECT_EQ(data.vertices.size(), 6u);
+        EXPECT_EQ(stats.uniqueVertices, 6u);
+        EXPECT_GT(stats.parseChunks, 0u);
+        ASSERT_EQ(data.subMeshes.size(), 1u);
+        EXPECT_EQ(data.subMeshes[0].indexCount, 9u);
+        ASSERT_EQ(data.materials.size(), 1u);
+        EXPECT_EQ(data.materials[0].name, "Default");
+    }
+
+    TEST_F(OBJLoaderTest, PolygonFallsBackToTinyObj)
+    {
+        // 五边形超出并行解析器的范围，LoadOBJ 回退到 tinyobjloader
+        const std::string path = WriteOBJ(
+            "v 0 0 0\nv 2 0 0\nv 3 1 0\nv 1 2 0\nv -1 1 0\n"
+            "f 1 2 3 4 5\n");
+
+        ParsedOBJ parsed;
+        EXPECT_EQ(ParseParallel(path, parsed), OBJParseResult::Unsupported);
+
+        MeshData data;
+        OBJLoadStats stats;
+        ASSERT_TRUE(LoadOBJ(path, data, &stats));
+        EXPECT_EQ(stats.parseChunks, 0u);
+        EXPECT_EQ(data.indices.size(), 9u);
+        EXPECT_EQ(data.vertices.size(), 5u);
+    }
+
+    TEST_F(OBJLoaderTest, MissingFileFails)
+    {
+        const std::string path = (std::filesystem::temp_directory_path() / "SeaOBJ_DoesNotExist.obj").string();
+
+        ParsedOBJ parsed;
+        EXPECT_EQ(ParseParallel(path, parsed), OBJParseResult::Failed);
+
+        MeshData data;
+        EXPECT_FALSE(LoadOBJ(path, data));
+    }
+}
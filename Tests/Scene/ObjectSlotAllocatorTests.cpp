@@ -0,0 +1,178 @@
+#include "Scene/ObjectSlotAllocator.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        constexpr u32 COPIES = ObjectSlotAllocator::FRAME_COPIES;
+    }
+
+    TEST(ObjectSlotAllocatorTest, SlotsAreStablePerObject)
+    {
+        ObjectSlotAllocator slots;
+        slots.Initialize(4);
+        slots.BeginFrame();
+
+        const u32 a = slots.AcquireSlot(10);
+        const u32 b = slots.AcquireSlot(20);
+        const u32 c = slots.AcquireSlot(30);
+        EXPECT_NE(a, b);
+        EXPECT_NE(a, c);
+        EXPECT_NE(b, c);
+        EXPECT_EQ(slots.AcquireSlot(20), b);
+
+        for (u32 frame = 0; frame < 5; ++frame)
+        {
+            slots.BeginFrame();
+            EXPECT_EQ(slots.AcquireSlot(30), c);
+            EXPECT_EQ(slots.AcquireSlot(10), a);
+            EXPECT_EQ(slots.AcquireSlot(20), b);
+        }
+    }
+
+    TEST(ObjectSlotAllocatorTest, RevisionIsTrackedPerFrameCopy)
+    {
+        ObjectSlotAllocator slots;
+        slots.Initialize(4);
+        slots.BeginFrame();
+
+        const u32 slot = slots.AcquireSlot(7);
+        EXPECT_FALSE(slots.IsCurrent(slot, 0));
+        const u32 first = slots.MarkWritten(slot, 3);
+        EXPECT_EQ(first, slots.GetPhysicalSlot(slot));
+        EXPECT_TRUE(slots.IsCurrent(slot, 3));
+        EXPECT_FALSE(slots.IsCurrent(slot, 4));
+
+        // 后面 COPIES - 1 帧写的是其它副本，各写一次
+        std::set<u32> physical = { first };
+        for (u32 frame = 1; frame < COPIES; ++frame)
+        {
+            slots.BeginFrame();
+            ASSERT_EQ(slots.AcquireSlot(7), slot);
+            EXPECT_FALSE(slots.IsCurrent(slot, 3));
+            physical.insert(slots.MarkWritten(slot, 3));
+        }
+        EXPECT_EQ(physical.size(), COPIES);
+
+        // 所有副本都写过之后，revision 不变就不用再写
+        for (u32 frame = 0; frame < COPIES * 2; ++frame)
+        {
+            slots.BeginFrame();
+            ASSERT_EQ(slots.AcquireSlot(7), slot);
+            EXPECT_TRUE(slots.IsCurrent(slot, 3));
+        }
+
+        slots.SetForceRebuild(true);
+        EXPECT_FALSE(slots.IsCurrent(slot, 3));
+        slots.SetForceRebuild(false);
+        EXPECT_TRUE(slots.IsCurrent(slot, 3));
+
+        slots.Invalidate();
+        for (u32 frame = 0; frame < COPIES; ++frame)
+        {
+            slots.BeginFrame();
+            EXPECT_FALSE(slots.IsCurrent(slot, 3));
+        }
+    }
+
+    TEST(ObjectSlotAllocatorTest, ReclaimsSlotsUnusedThisFrame)
+    {
+        ObjectSlotAllocator slots;
+        slots.Initialize(2);
+        for (u32 frame = 0; frame < COPIES; ++frame)
+        {
+            slots.BeginFrame();
+            slots.MarkWritten(slots.AcquireSlot(1), 5);
+            slots.MarkWritten(slots.AcquireSlot(2), 5);
+        }
+
+        // 物体 2 这一帧没有绘制，它的槽位交给物体 3，旧内容在所有副本上都作废
+        slots.BeginFrame();
+        const u32 a = slots.AcquireSlot(1);
+        const u32 c = slots.AcquireSlot(3);
+        ASSERT_NE(c, ObjectSlotAllocator::INVALID_SLOT);
+        EXPECT_NE(a, c);
+        EXPECT_TRUE(slots.IsCurrent(a, 5));
+        EXPECT_FALSE(slots.IsCurrent(c, 5));
+        for (u32 frame = 1; frame < COPIES; ++frame)
+        {
+            slots.BeginFrame();
+            EXPECT_FALSE(slots.IsCurrent(slots.AcquireSlot(3), 5));
+            slots.AcquireSlot(1);
+        }
+
+        // 本帧用到的槽位不能回收：容量已满时新物体拿不到槽位，物体 2 也已经失去了原来的槽位
+        EXPECT_EQ(slots.AcquireSlot(2), ObjectSlotAllocator::INVALID_SLOT);
+        EXPECT_EQ(slots.AcquireSlot(1), a);
+        EXPECT_EQ(slots.AcquireSlot(3), c);
+    }
+
+    TEST(ObjectSlotAllocatorTest, NeverOverwritesCopyReadByFrameInFlight)
+    {
+        // 模拟渲染器：每帧随机绘制一部分物体，部分物体的 revision 变化；槽位不够时回收
+        // 写入时检查物理副本最近一次被读是否已经过了 FRAME_COPIES 帧，读取时检查内容就是物体当前的 revision
+        constexpr u32 CAPACITY = 6;
+        constexpr u32 OBJECT_COUNT = 10;
+        constexpr u32 FRAME_COUNT = 400;
+        constexpr u64 NEVER = ~0ull;
+
+        ObjectSlotAllocator slots;
+        slots.Initialize(CAPACITY);
+        std::vector<u32> revisions(OBJECT_COUNT, 0);
+        std::vector<std::pair<u32, u32>> contents(CAPACITY * COPIES, { ~0u, ~0u });     // (物体, revision)
+        std::vector<u64> lastRead(CAPACITY * COPIES, NEVER);
+        std::mt19937 rng(11);
+
+        u32 writes = 0;
+        u32 skipped = 0;
+        u32 overflows = 0;
+        for (u64 frame = 1; frame <= FRAME_COUNT; ++frame)
+        {
+            slots.BeginFrame();
+            slots.SetForceRebuild(frame % 50 == 0);
+            for (u32 object = 0; object < OBJECT_COUNT; ++object)
+            {
+                if (rng() % 3 == 0)
+                    continue;
+                if (rng() % 4 == 0)
+                    ++revisions[object];
+
+                const u32 slot = slots.AcquireSlot(object);
+                if (slot == ObjectSlotAllocator::INVALID_SLOT)
+                {
+                    ++overflows;
+                    continue;
+                }
+                ASSERT_LT(slot, CAPACITY);
+
+                if (!slots.IsCurrent(slot, revisions[object]))
+                {
+                    const u32 physical = slots.MarkWritten(slot, revisions[object]);
+                    ASSERT_TRUE(lastRead[physical] == NEVER || lastRead[physical] == frame ||
+                                lastRead[physical] + COPIES <= frame)
+                        << "frame " << frame << " overwrites a copy read in frame " << lastRead[physical];
+                    contents[physical] = { object, revisions[object] };
+                    ++writes;
+                }
+                else
+                {
+                    ++skipped;
+                }
+
+                const u32 physical = slots.GetPhysicalSlot(slot);
+                ASSERT_EQ(contents[physical], std::make_pair(object, revisions[object])) << "frame " << frame;
+                lastRead[physical] = frame;
+            }
+        }
+
+        // 三条路径（重写、跳过、容量不足）都覆盖到
+        EXPECT_GT(writes, 0u);
+        EXPECT_GT(skipped, 0u);
+        EXPECT_GT(overflows, 0u);
+    }
+}
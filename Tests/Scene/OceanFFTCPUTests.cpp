@@ -0,0 +1,643 @@
+#include "Scene/OceanFFTCPU.h"
+#include "Scene/OceanFFTTables.h"
+#include "Scene/OceanFFTReference.h"
+#include "Core/JobSystem.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        using Complex = std::complex<f64>;
+
+        constexpr f64 PI = 3.14159265358979323846;
+
+        // 模拟按 级联 × 行 并行，多线程下结果也必须逐位确定
+        class OceanFFTCPUTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override { JobSystem::Initialize(4); }
+            void TearDown() override { JobSystem::Shutdown(); }
+        };
+
+        constexpr f32 QUERY_TIME = 2.5f;
+        constexpr f32 QUERY_AREA = 1000.0f;
+
+        // 在 [-AREA/2, AREA/2]² 内随机取网格顶点，返回它们被推到的位置与高度
+        void DisplacedVertices(const OceanFFTCPU& ocean, u32 count, u32 seed, std::vector<XMFLOAT2>& outPositions, std::vector<f32>& outHeights)
+        {
+            std::mt19937 rng(seed);
+            std::uniform_real_distribution<f32> positionDist(-QUERY_AREA * 0.5f, QUERY_AREA * 0.5f);
+            outPositions.resize(count);
+            outHeights.resize(count);
+            for (u32 i = 0; i < count; ++i)
+            {
+                const f32 x = positionDist(rng);
+                const f32 z = positionDist(rng);
+                const XMFLOAT3 displacement = ocean.SampleDisplacement(x, z);
+                outPositions[i] = XMFLOAT2(x + displacement.x, z + displacement.z);
+                outHeights[i] = displacement.y;
+            }
+        }
+    }
+
+    // 2D 逆 FFT：随机输入，与 double 精度的直接 DFT 对比（先沿 y，再沿 x，结果按着色器布局转置）
+    TEST_F(OceanFFTCPUTest, InverseFFTMatchesDirectDFT)
+    {
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+
+        const u32 N = ocean.GetMapSize();
+        const size_t texelCount = static_cast<size_t>(N) * N;
+
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+        std::vector<std::vector<Complex>> inputs(ocean.GetPlaneCount(), std::vector<Complex>(texelCount));
+        for (u32 p = 0; p < ocean.GetPlaneCount(); ++p)
+        {
+            std::span<f32> re = ocean.GetPlaneReal(p);
+            std::span<f32> im = ocean.GetPlaneImag(p);
+            for (size_t i = 0; i < texelCount; ++i)
+            {
+                re[i] = dist(rng);
+                im[i] = dist(rng);
+                inputs[p][i] = Complex(re[i], im[i]);
+            }
+        }
+
+        ocean.PerformFFT();
+
+        std::vector<Complex> twiddles(N);
+        for (u32 i = 0; i < N; ++i)
+            twiddles[i] = std::polar(1.0, 2.0 * PI * i / N);
+
+        f64 maxError = 0.0;
+        f64 maxMagnitude = 0.0;
+        std::vector<Complex> columns(texelCount);
+        for (u32 p = 0; p < ocean.GetPlaneCount(); ++p)
+        {
+            // columns[ny * N + kx] = Σ_ky in[ky][kx] · e^{2πi·ky·ny/N}
+            const auto& in = inputs[p];
+            for (u32 ny = 0; ny < N; ++ny)
+            {
+                for (u32 kx = 0; kx < N; ++kx)
+                {
+                    Complex sum = 0.0;
+                    for (u32 ky = 0; ky < N; ++ky)
+                        sum += in[static_cast<size_t>(ky) * N + kx] * twiddles[(ky * ny) % N];
+                    columns[static_cast<size_t>(ny) * N + kx] = sum;
+                }
+            }
+
+            // 结果第 row 行第 col 列 = Σ_kx columns[col][kx] · e^{2πi·kx·row/N}
+            const std::span<f32> re = ocean.GetPlaneReal(p);
+            const std::span<f32> im = ocean.GetPlaneImag(p);
+            for (u32 row = 0; row < N; ++row)
+            {
+                for (u32 col = 0; col < N; ++col)
+                {
+                    Complex sum = 0.0;
+                    for (u32 kx = 0; kx < N; ++kx)
+                        sum += columns[static_cast<size_t>(col) * N + kx] * twiddles[(kx * row) % N];
+
+                    const size_t index = static_cast<size_t>(row) * N + col;
+                    maxError = std::max(maxError, std::abs(Complex(re[index], im[index]) - sum));
+                    maxMagnitude = std::max(maxMagnitude, std::abs(sum));
+                }
+            }
+        }
+
+        EXPECT_LT(maxError / std::max(maxMagnitude, 1e-12), 1e-5) << "max error " << maxError;
+    }
+
+    // 完整流程：位移 / 坡度与按频谱逐项求和（含着色器的 1/N）对比，高度场的虚部应为 0
+    TEST_F(OceanFFTCPUTest, SimulationMatchesDirectSpectrumSum)
+    {
+        constexpr f32 TIME = 3.7f;
+        constexpr u32 SAMPLES = 32;
+
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(TIME);
+
+        const u32 N = ocean.GetMapSize();
+        const size_t texelCount = static_cast<size_t>(N) * N;
+        const f64 depth = ocean.GetParams().depth;
+        const f64 scale = 1.0 / N;
+        std::mt19937 sampleRng(678);
+        for (u32 cascadeIndex = 0; cascadeIndex < ocean.GetCascadeCount(); ++cascadeIndex)
+        {
+            SCOPED_TRACE(cascadeIndex);
+            const auto& spectrum = ocean.GetSpectrum(cascadeIndex);
+            const auto& maps = ocean.GetCascadeMaps(cascadeIndex);
+            const f64 tileLength = ocean.GetParams().cascades[cascadeIndex].tileLength;
+            const f64 dk = 2.0 * PI / tileLength;
+
+            // 每个波矢的 h(k,t) 与 k 向量
+            std::vector<Complex> h(texelCount);
+            std::vector<f64> kvx(texelCount), kvy(texelCount);
+            for (u32 y = 0; y < N; ++y)
+            {
+                for (u32 x = 0; x < N; ++x)
+                {
+                    const size_t i = static_cast<size_t>(y) * N + x;
+                    kvx[i] = (static_cast<f64>(x) - N * 0.5) * dk;
+                    kvy[i] = (static_cast<f64>(y) - N * 0.5) * dk;
+                    const f64 k = std::sqrt(kvx[i] * kvx[i] + kvy[i] * kvy[i]) + 1e-6;
+                    const f64 phase = std::sqrt(9.81 * k * std::tanh(k * depth)) * TIME;
+                    const Complex h0(spectrum[i].x, spectrum[i].y);
+                    const Complex h0NegConj(spectrum[i].z, spectrum[i].w);
+                    h[i] = h0 * std::polar(1.0, phase) + h0NegConj * std::polar(1.0, -phase);
+                }
+            }
+
+            f64 maxError = 0.0;
+            f64 maxHeight = 0.0;
+            f64 maxImaginary = 0.0;
+            std::uniform_int_distribution<u32> texelDist(0, N - 1);
+            for (u32 sample = 0; sample < SAMPLES; ++sample)
+            {
+                const u32 tx = texelDist(sampleRng);
+                const u32 ty = texelDist(sampleRng);
+
+                // 贴图 (tx, ty)：k_vec.x 对应 ty 方向，k_vec.y 对应 tx 方向
+                const f64 px = ty * tileLength / N;
+                const f64 pz = tx * tileLength / N;
+                // 与着色器一样对打包后的复数求和：Nyquist 行 / 列上 i·k 项不满足共轭对称，会串入打包的另一个场
+                Complex height = 0.0, packed0 = 0.0, packed1 = 0.0;
+                for (size_t i = 0; i < texelCount; ++i)
+                {
+                    const f64 k = std::sqrt(kvx[i] * kvx[i] + kvy[i] * kvy[i]) + 1e-6;
+                    const Complex wave = h[i] * std::polar(1.0, kvx[i] * px + kvy[i] * pz);
+                    const Complex iWave = Complex(0.0, 1.0) * wave;
+                    height += wave;
+                    packed0 += iWave * (kvy[i] / k) + Complex(0.0, 1.0) * wave;
+                    packed1 += iWave * (kvx[i] / k) + Complex(0.0, 1.0) * (iWave * kvy[i]);
+                }
+                height *= scale;
+                packed0 *= scale;
+                packed1 *= scale;
+
+                const size_t texel = static_cast<size_t>(ty) * N + tx;
+                const XMFLOAT4& d = maps.displacement[texel];
+                const XMFLOAT4& nf = maps.normalFoam[texel];
+
+                maxError = std::max(maxError, std::abs(d.x - packed0.real()));
+                maxError = std::max(maxError, std::abs(d.y - packed0.imag()));
+                maxError = std::max(maxError, std::abs(d.z - packed1.real()));
+                maxError = std::max(maxError, std::abs(nf.x * (1.0 + std::abs(nf.z)) - packed1.imag()));
+                maxHeight = std::max(maxHeight, std::abs(height.real()));
+                maxImaginary = std::max(maxImaginary, std::abs(height.imag()));
+            }
+
+            const f64 tolerance = 1e-3 * std::max(maxHeight, 1e-6);
+            EXPECT_LT(maxError, tolerance);
+            EXPECT_LT(maxImaginary, tolerance);
+        }
+    }
+
+    // 多线程下逐位确定：重新生成频谱并模拟同一时间，结果应完全相同
+    TEST_F(OceanFFTCPUTest, SimulationIsBitwiseDeterministic)
+    {
+        constexpr f32 TIME = 3.7f;
+
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(TIME);
+
+        std::vector<OceanFFTMaps> previous;
+        for (u32 i = 0; i < ocean.GetCascadeCount(); ++i)
+            previous.push_back(ocean.GetCascadeMaps(i));
+
+        ocean.RebuildAllSpectra();
+        ocean.Simulate(TIME);
+
+        const size_t bytes = static_cast<size_t>(ocean.GetMapSize()) * ocean.GetMapSize() * sizeof(XMFLOAT4);
+        for (u32 i = 0; i < ocean.GetCascadeCount(); ++i)
+        {
+            const auto& maps = ocean.GetCascadeMaps(i);
+            EXPECT_EQ(std::memcmp(maps.displacement.data(), previous[i].displacement.data(), bytes), 0) << "cascade " << i;
+            EXPECT_EQ(std::memcmp(maps.normalFoam.data(), previous[i].normalFoam.data(), bytes), 0) << "cascade " << i;
+        }
+    }
+
+    // 采样与逐级联独立实现的 double 双线性插值对比（含负坐标的环绕）
+    TEST_F(OceanFFTCPUTest, SampleDisplacementMatchesBilinearReference)
+    {
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(QUERY_TIME);
+
+        const i64 N = ocean.GetMapSize();
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<f32> positionDist(-QUERY_AREA * 0.5f, QUERY_AREA * 0.5f);
+        f64 maxError = 0.0;
+        for (u32 sample = 0; sample < 256; ++sample)
+        {
+            const f32 x = positionDist(rng);
+            const f32 z = positionDist(rng);
+            f64 expected[3] = {};
+            for (u32 c = 0; c < ocean.GetCascadeCount(); ++c)
+            {
+                const auto& cascade = ocean.GetParams().cascades[c];
+                const f64 u = static_cast<f64>(x) / cascade.tileLength * N - 0.5;
+                const f64 v = static_cast<f64>(z) / cascade.tileLength * N - 0.5;
+                const f64 u0 = std::floor(u);
+                const f64 v0 = std::floor(v);
+                const f64 fu = u - u0;
+                const f64 fv = v - v0;
+                auto texel = [&](f64 tx, f64 ty) {
+                    const i64 ix = ((static_cast<i64>(tx) % N) + N) % N;
+                    const i64 iy = ((static_cast<i64>(ty) % N) + N) % N;
+                    return ocean.GetCascadeMaps(c).displacement[static_cast<size_t>(iy * N + ix)];
+                };
+                const XMFLOAT4 d00 = texel(u0, v0), d10 = texel(u0 + 1, v0);
+                const XMFLOAT4 d01 = texel(u0, v0 + 1), d11 = texel(u0 + 1, v0 + 1);
+                auto bilinear = [&](f64 a, f64 b, f64 c2, f64 d) {
+                    return ((a * (1 - fu) + b * fu) * (1 - fv) + (c2 * (1 - fu) + d * fu) * fv) * cascade.displacementScale;
+                };
+                expected[0] += bilinear(d00.x, d10.x, d01.x, d11.x);
+                expected[1] += bilinear(d00.y, d10.y, d01.y, d11.y);
+                expected[2] += bilinear(d00.z, d10.z, d01.z, d11.z);
+            }
+
+            const XMFLOAT3 actual = ocean.SampleDisplacement(x, z);
+            maxError = std::max(maxError, std::abs(actual.x - expected[0]));
+            maxError = std::max(maxError, std::abs(actual.y - expected[1]));
+            maxError = std::max(maxError, std::abs(actual.z - expected[2]));
+        }
+
+        EXPECT_LT(maxError, 1e-3);
+    }
+
+    // 在随机顶点被推到的位置上查询，应该得到这个顶点的高度
+    // 大浪时位移场不是一一映射（折叠、拉伸处同一点对应多个顶点，迭代也可能在其间振荡），
+    // 所以只要求默认迭代次数下的中位数误差足够小，尾部误差不检查
+    TEST_F(OceanFFTCPUTest, HeightQueryFindsDisplacedVertex)
+    {
+        constexpr u32 SAMPLES = 4096;
+
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(QUERY_TIME);
+
+        std::vector<XMFLOAT2> positions;
+        std::vector<f32> expectedHeights;
+        DisplacedVertices(ocean, SAMPLES, 4243, positions, expectedHeights);
+        f32 maxHeight = 0.0f;
+        for (f32 height : expectedHeights)
+            maxHeight = std::max(maxHeight, std::abs(height));
+
+        std::vector<f32> heights(SAMPLES);
+        std::vector<f32> errors(SAMPLES);
+        f32 previousMedian = 0.0f;
+        for (u32 iterations = 0; iterations <= OceanFFTCPU::QUERY_ITERATIONS; ++iterations)
+        {
+            ocean.QueryHeights(positions, heights, iterations);
+            for (u32 i = 0; i < SAMPLES; ++i)
+                errors[i] = std::abs(heights[i] - expectedHeights[i]);
+            std::nth_element(errors.begin(), errors.begin() + SAMPLES / 2, errors.end());
+
+            const f32 median = errors[SAMPLES / 2];
+            if (iterations > 0)
+            {
+                EXPECT_LE(median, previousMedian) << iterations << " iterations";
+            }
+            previousMedian = median;
+        }
+        EXPECT_LT(previousMedian, 0.005f * maxHeight);
+    }
+
+    // 批量查询与逐个查询结果一致（数量不是批大小的整数倍）
+    TEST_F(OceanFFTCPUTest, BatchedQueriesMatchSingleQueries)
+    {
+        constexpr u32 COUNT = 1001;
+
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(QUERY_TIME);
+
+        std::vector<XMFLOAT2> positions;
+        std::vector<f32> unused;
+        DisplacedVertices(ocean, COUNT, 4244, positions, unused);
+
+        std::vector<f32> heights(COUNT);
+        ocean.QueryHeights(positions, heights);
+        for (u32 i = 0; i < COUNT; ++i)
+        {
+            f32 single = 0.0f;
+            ocean.QueryHeights(std::span(positions).subspan(i, 1), std::span(&single, 1));
+            ASSERT_EQ(single, heights[i]) << "query " << i;
+        }
+    }
+
+    // 降低分辨率的模拟与原模拟在公共波矢上的初始频谱相同（降分辨率后的 Nyquist 行列除外）
+    TEST_F(OceanFFTCPUTest, ReducedResolutionSpectrumMatchesFullSpectrum)
+    {
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(MakeReferenceOceanParams(64)));
+        ocean.Simulate(QUERY_TIME);
+
+        const u32 N = ocean.GetMapSize();
+        const u32 reducedSize = N / 2;
+        OceanFFTCPU reduced;
+        ASSERT_TRUE(reduced.Initialize(MakeReducedResolutionParams(ocean.GetParams(), reducedSize)));
+        reduced.Simulate(QUERY_TIME);
+
+        const u32 offset = (N - reducedSize) / 2;
+        u32 mismatches = 0;
+        for (u32 c = 0; c < ocean.GetCascadeCount(); ++c)
+        {
+            for (u32 y = 1; y < reducedSize; ++y)
+            {
+                for (u32 x = 1; x < reducedSize; ++x)
+                {
+                    const XMFLOAT4& a = reduced.GetSpectrum(c)[y * reducedSize + x];
+                    const XMFLOAT4& b = ocean.GetSpectrum(c)[(y + offset) * N + x + offset];
+                    if (a.x != b.x || a.y != b.y || a.z != b.z || a.w != b.w)
+                        mismatches++;
+                }
+            }
+        }
+        EXPECT_EQ(mismatches, 0u);
+    }
+
+    // 种子导出：同一种子结果相同，不同种子结果不同
+    TEST(OceanSeedTest, SeedDerivationIsDeterministic)
+    {
+        constexpr u32 SEED = 42;
+
+        OceanFFTParams a, b, c;
+        ApplyOceanSeed(a, SEED);
+        ApplyOceanSeed(b, SEED);
+        ApplyOceanSeed(c, SEED + 1);
+        bool differs = false;
+        for (u32 i = 0; i < OceanFFTParams::MAX_CASCADES; ++i)
+        {
+            EXPECT_EQ(a.cascades[i].spectrumSeedX, b.cascades[i].spectrumSeedX);
+            EXPECT_EQ(a.cascades[i].spectrumSeedY, b.cascades[i].spectrumSeedY);
+            differs |= a.cascades[i].spectrumSeedX != c.cascades[i].spectrumSeedX || a.cascades[i].spectrumSeedY != c.cascades[i].spectrumSeedY;
+        }
+        EXPECT_TRUE(differs);
+    }
+
+    // 不同帧率（含抖动）推进到同一步时状态哈希逐位相同，且等于直接模拟该步；
+    // 帧率高于更新频率时跳过模拟；插值结果等于两步结果的线性插值
+    TEST_F(OceanFFTCPUTest, FixedStepIsIndependentOfFrameRate)
+    {
+        constexpr u32 SEED = 42;
+        constexpr f32 UPDATES_PER_SECOND = 50.0f;
+        constexpr f32 DURATION = 1.0f;
+
+        OceanFFTParams params = MakeReferenceOceanParams(32);
+        params.updatesPerSecond = UPDATES_PER_SECOND;
+        ApplyOceanSeed(params, SEED);
+
+        // 每一步直接模拟得到的参照哈希
+        OceanFFTCPU reference;
+        ASSERT_TRUE(reference.Initialize(params));
+        const u32 maxStep = static_cast<u32>(DURATION * UPDATES_PER_SECOND) + 1;
+        std::vector<u64> referenceHashes(maxStep + 1);
+        for (u32 step = 0; step <= maxStep; ++step)
+        {
+            reference.Simulate(reference.GetClock().GetStepTime(step));
+            referenceHashes[step] = reference.ComputeStateHash();
+        }
+
+        // 不同的帧间隔序列：高帧率、低帧率、抖动
+        struct FrameSequence
+        {
+            const char* name;
+            f32 minDelta;
+            f32 maxDelta;
+        };
+        const FrameSequence sequences[] = {
+            { "144 fps", 1.0f / 144.0f, 1.0f / 144.0f },
+            { "30 fps", 1.0f / 30.0f, 1.0f / 30.0f },
+            { "jittered", 1.0f / 240.0f, 1.0f / 15.0f },
+        };
+
+        std::mt19937 rng(7);
+        const XMFLOAT2 probe(37.5f, -12.25f);
+        for (const auto& sequence : sequences)
+        {
+            SCOPED_TRACE(sequence.name);
+            OceanFFTCPU ocean;
+            ASSERT_TRUE(ocean.Initialize(params));
+
+            std::uniform_real_distribution<f32> deltaDist(sequence.minDelta, sequence.maxDelta);
+            u32 mismatches = 0;
+            u64 lastStep = ~0ull;
+            f32 elapsed = 0.0f;
+            bool interpolationChecked = false;
+            while (elapsed < DURATION)
+            {
+                const f32 dt = deltaDist(rng);
+                elapsed += dt;
+                ocean.Update(dt);
+
+                const u64 step = ocean.GetClock().GetStep();
+                if (step > maxStep)
+                    break;
+                if (step != lastStep)
+                {
+                    lastStep = step;
+                    if (ocean.ComputeStateHash() != referenceHashes[step])
+                        mismatches++;
+                }
+
+                // 插值：结果应等于上一步与当前步采样值的线性插值
+                const f32 alpha = ocean.GetInterpolationAlpha();
+                if (!interpolationChecked && step > 0 && alpha > 0.1f && alpha < 0.9f)
+                {
+                    interpolationChecked = true;
+                    reference.Simulate(reference.GetClock().GetStepTime(step - 1));
+                    const XMFLOAT3 previous = reference.SampleDisplacement(probe.x, probe.y);
+                    reference.Simulate(reference.GetClock().GetStepTime(step));
+                    const XMFLOAT3 current = reference.SampleDisplacement(probe.x, probe.y);
+                    const XMFLOAT3 sample = ocean.SampleDisplacement(probe.x, probe.y);
+
+                    EXPECT_NEAR(previous.x + (current.x - previous.x) * alpha, sample.x, 1e-4f) << "alpha " << alpha;
+                    EXPECT_NEAR(previous.y + (current.y - previous.y) * alpha, sample.y, 1e-4f) << "alpha " << alpha;
+                    EXPECT_NEAR(previous.z + (current.z - previous.z) * alpha, sample.z, 1e-4f) << "alpha " << alpha;
+                }
+            }
+
+            EXPECT_EQ(mismatches, 0u);
+            EXPECT_TRUE(interpolationChecked) << "no frame landed between two steps";
+
+            // 每帧最多跨一步时每一步只模拟一次，其余帧跳过；一帧跨多步时还要补算上一步
+            const u64 simulations = ocean.GetSimulationCount();
+            const u64 expected = lastStep + 1;
+            if (sequence.maxDelta < ocean.GetClock().GetStepSeconds())
+            {
+                EXPECT_EQ(simulations, expected);
+            }
+            EXPECT_LE(simulations, 2 * expected);
+        }
+    }
+
+    // 参数不变时不重新生成，回到之前的参数时命中缓存且结果与重新生成逐位相同，超出容量时按 LRU 淘汰
+    TEST_F(OceanFFTCPUTest, SpectrumCacheReusesAndEvictsSpectra)
+    {
+        constexpr f32 TIME = 1.5f;
+        constexpr f32 WIND_SPEEDS[] = { 24.0f, 28.0f, 32.0f };
+
+        OceanFFTParams params = MakeReferenceOceanParams(32);
+        params.spectrumCacheSize = 2;
+
+        OceanFFTCPU ocean;
+        ASSERT_TRUE(ocean.Initialize(params));
+        const u64 cascadeCount = ocean.GetCascadeCount();
+
+        ocean.Simulate(TIME);
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().misses, cascadeCount) << "first simulation should generate every cascade";
+        const std::vector<XMFLOAT4> original = ocean.GetSpectrum(0);
+
+        // 重建标记被设置、但只有不影响频谱的参数变化时不重新生成
+        for (u32 i = 0; i < ocean.GetCascadeCount(); ++i)
+        {
+            ocean.GetCascadeParams(i).displacementScale *= 0.5f;
+            ocean.GetCascadeParams(i).needsSpectrumRebuild = true;
+        }
+        ocean.Simulate(TIME);
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().misses, cascadeCount) << "unchanged spectrum parameters should not touch the cache";
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().hits, 0u);
+
+        // 拖动滑条经过几个风速：每个新值生成一次，超出容量后最早的值被淘汰
+        auto& cascade = ocean.GetCascadeParams(0);
+        const f32 originalWind = cascade.windSpeed;
+        for (f32 wind : WIND_SPEEDS)
+        {
+            cascade.windSpeed = wind;
+            ocean.Simulate(TIME);
+        }
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().misses, cascadeCount + std::size(WIND_SPEEDS)) << "each new wind speed should generate once";
+        EXPECT_GT(ocean.GetSpectrumCacheStats().evictions, 0u) << "scrubbing past the capacity should evict";
+
+        // 回到最近用过的值命中缓存
+        const u64 missesBefore = ocean.GetSpectrumCacheStats().misses;
+        cascade.windSpeed = WIND_SPEEDS[1];
+        ocean.Simulate(TIME);
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().misses, missesBefore) << "returning to a recent wind speed should hit";
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().hits, 1u);
+
+        // 最早的值已被淘汰，重新生成的频谱应与最初的逐位相同
+        cascade.windSpeed = originalWind;
+        ocean.Simulate(TIME);
+        EXPECT_EQ(ocean.GetSpectrumCacheStats().misses, missesBefore + 1) << "the least recently used spectrum should have been evicted";
+        EXPECT_EQ(std::memcmp(ocean.GetSpectrum(0).data(), original.data(), original.size() * sizeof(XMFLOAT4)), 0)
+            << "regenerated spectrum differs from the original";
+
+        // 命中缓存得到的模拟结果与全新模拟逐位相同
+        cascade.windSpeed = WIND_SPEEDS[2];
+        ocean.Simulate(TIME);
+        cascade.windSpeed = originalWind;
+        ocean.Simulate(TIME);
+        OceanFFTCPU fresh;
+        OceanFFTParams freshParams = ocean.GetParams();
+        for (auto& c : freshParams.cascades)
+            c.needsSpectrumRebuild = true;
+        ASSERT_TRUE(fresh.Initialize(freshParams));
+        fresh.Simulate(TIME);
+        EXPECT_EQ(fresh.ComputeStateHash(), ocean.ComputeStateHash()) << "cached simulation differs from a fresh one";
+    }
+
+    // 同一 N 共享一份表，表与 double 直接计算一致
+    TEST(OceanFFTTablesTest, TablesAreCachedAndExact)
+    {
+        EXPECT_EQ(GetOceanFFTTables(256), GetOceanFFTTables(256));
+        EXPECT_NE(GetOceanFFTTables(256), GetOceanFFTTables(512));
+        EXPECT_EQ(GetOceanFFTTables(100), nullptr);
+
+        for (u32 N = 128; N <= 1024; N *= 2)
+        {
+            SCOPED_TRACE(N);
+            const auto tables = GetOceanFFTTables(N);
+            ASSERT_NE(tables, nullptr);
+            ASSERT_EQ(tables->mapSize, N);
+            ASSERT_EQ(1u << tables->logN, N);
+            ASSERT_EQ(tables->twiddleRe.size(), N);
+            ASSERT_EQ(tables->twiddleIm.size(), N);
+            ASSERT_EQ(tables->gpuTwiddles.size(), 2 * static_cast<size_t>(N));
+
+            f64 maxError = 0.0;
+            for (u32 i = 0; i < N; ++i)
+            {
+                const Complex expected = std::polar(1.0, 2.0 * PI * i / N);
+                maxError = std::max(maxError, std::abs(expected - Complex(tables->twiddleRe[i], tables->twiddleIm[i])));
+                EXPECT_EQ(tables->gpuTwiddles[2 * i], tables->twiddleRe[i]);
+                EXPECT_EQ(tables->gpuTwiddles[2 * i + 1], tables->twiddleIm[i]);
+            }
+            EXPECT_LT(maxError, 1e-7);
+        }
+    }
+
+    // 往返：同一个实例依次切换到各个尺寸，IFFT 之后用 conj(IFFT(conj(y))) 做正变换，
+    // 两次转置抵消，结果应为 N² 倍的输入（PerformFFT 本身不缩放）
+    TEST_F(OceanFFTCPUTest, InverseFFTRoundTripsAcrossSizes)
+    {
+        OceanFFTCPU ocean;
+        std::mt19937 rng(31337);
+        std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+        for (u32 N = 128; N <= 1024; N *= 2)
+        {
+            SCOPED_TRACE(N);
+            OceanFFTParams params = MakeReferenceOceanParams(N);
+            params.numCascades = 1;
+            params.spectrumCacheSize = 0;
+            ASSERT_TRUE(ocean.Initialize(params));
+            EXPECT_EQ(ocean.GetFFTTables(), GetOceanFFTTables(N)) << "simulation does not use the shared table";
+
+            const size_t texelCount = static_cast<size_t>(N) * N;
+            std::vector<std::vector<f32>> inputRe(ocean.GetPlaneCount()), inputIm(ocean.GetPlaneCount());
+            for (u32 p = 0; p < ocean.GetPlaneCount(); ++p)
+            {
+                std::span<f32> re = ocean.GetPlaneReal(p);
+                std::span<f32> im = ocean.GetPlaneImag(p);
+                for (size_t i = 0; i < texelCount; ++i)
+                {
+                    re[i] = dist(rng);
+                    im[i] = dist(rng);
+                }
+                inputRe[p].assign(re.begin(), re.end());
+                inputIm[p].assign(im.begin(), im.end());
+            }
+
+            auto conjugateAll = [&]() {
+                for (u32 p = 0; p < ocean.GetPlaneCount(); ++p)
+                {
+                    for (f32& im : ocean.GetPlaneImag(p))
+                        im = -im;
+                }
+            };
+
+            ocean.PerformFFT();
+            conjugateAll();
+            ocean.PerformFFT();
+            conjugateAll();
+
+            const f32 scale = 1.0f / static_cast<f32>(texelCount);
+            f64 maxError = 0.0;
+            for (u32 p = 0; p < ocean.GetPlaneCount(); ++p)
+            {
+                const std::span<f32> re = ocean.GetPlaneReal(p);
+                const std::span<f32> im = ocean.GetPlaneImag(p);
+                for (size_t i = 0; i < texelCount; ++i)
+                {
+                    const f64 errorRe = re[i] * scale - inputRe[p][i];
+                    const f64 errorIm = im[i] * scale - inputIm[p][i];
+                    maxError = std::max(maxError, std::sqrt(errorRe * errorRe + errorIm * errorIm));
+                }
+            }
+            EXPECT_LT(maxError, 1e-5);
+        }
+    }
+}
@@ -0,0 +1,205 @@
+#include "Scene/OceanFFTPlan.h"
+#include "Scene/OceanFFTTables.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        using ComplexF = std::complex<f32>;
+
+        // 与 FFTCompute_CS.hlsl 的 GetLineIndex 相同：axis 0 沿行，axis 1 沿列（步长 N）
+        u32 GetLineIndex(u32 N, u32 slice, u32 line, u32 position, u32 axis)
+        {
+            const u32 base = slice * N * N;
+            return axis == 0 ? base + line * N + position : base + position * N + line;
+        }
+
+        // 一个 radix-2 Stockham 蝶形：第 stage 阶段的第 j 个（j < N/2），结果按自然顺序排列
+        // 旋转因子 exp(+iπk/Ns) 与着色器一样从 N 点表中按 k·N/(2Ns) 取
+        void Butterfly(const OceanFFTTables& tables, u32 stage, u32 j, ComplexF a, ComplexF b, u32& outIndex0, u32& outIndex1, ComplexF& out0, ComplexF& out1)
+        {
+            const u32 Ns = 1u << stage;
+            const u32 k = j & (Ns - 1);
+            const u32 twiddle = k * (tables.mapSize >> (stage + 1));
+            b *= ComplexF(tables.twiddleRe[twiddle], tables.twiddleIm[twiddle]);
+            outIndex0 = (j - k) * 2 + k;
+            outIndex1 = outIndex0 + Ns;
+            out0 = a + b;
+            out1 = a - b;
+        }
+
+        // 按计划逐个 dispatch、逐个线程组模拟 FFTCompute_CS
+        void ExecuteOceanFFTPlan(const OceanFFTPlan& plan, std::vector<ComplexF>& buffer)
+        {
+            const u32 N = plan.mapSize;
+            const u32 logN = static_cast<u32>(std::countr_zero(N));
+            const auto tables = GetOceanFFTTables(N);
+            std::vector<ComplexF> shared(2 * N);
+
+            for (const auto& dispatch : plan.dispatches)
+            {
+                const ComplexF* source = buffer.data() + dispatch.sourceHalf * plan.halfElementCount;
+                ComplexF* dest = buffer.data() + dispatch.destHalf * plan.halfElementCount;
+                const u32 writeAxis = dispatch.transposeOutput ? 0 : dispatch.axis;
+
+                for (u32 slice = 0; slice < dispatch.groupsZ; ++slice)
+                {
+                    if (dispatch.pass == OceanFFTPass::Stage)
+                    {
+                        const u32 threads = dispatch.groupsX * OceanFFTPlan::STAGE_THREAD_GROUP_SIZE;
+                        for (u32 line = 0; line < dispatch.groupsY; ++line)
+                        {
+                            for (u32 j = 0; j < std::min(threads, N / 2); ++j)
+                            {
+                                const ComplexF a = source[GetLineIndex(N, slice, line, j, dispatch.axis)];
+                                const ComplexF b = source[GetLineIndex(N, slice, line, j + N / 2, dispatch.axis)];
+                                u32 i0, i1;
+                                ComplexF v0, v1;
+                                Butterfly(*tables, dispatch.stage, j, a, b, i0, i1, v0, v1);
+                                dest[GetLineIndex(N, slice, line, i0, writeAxis)] = v0 * dispatch.outputScale;
+                                dest[GetLineIndex(N, slice, line, i1, writeAxis)] = v1 * dispatch.outputScale;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (u32 line = 0; line < dispatch.groupsX; ++line)
+                        {
+                            for (u32 i = 0; i < N; ++i)
+                                shared[i] = source[GetLineIndex(N, slice, line, i, dispatch.axis)];
+
+                            for (u32 stage = 0; stage < logN; ++stage)
+                            {
+                                const ComplexF* in = shared.data() + (stage & 1) * N;
+                                ComplexF* out = shared.data() + ((stage + 1) & 1) * N;
+                                for (u32 j = 0; j < N / 2; ++j)
+                                {
+                                    u32 i0, i1;
+                                    ComplexF v0, v1;
+                                    Butterfly(*tables, stage, j, in[j], in[j + N / 2], i0, i1, v0, v1);
+                                    out[i0] = v0;
+                                    out[i1] = v1;
+                                }
+                            }
+
+                            const ComplexF* result = shared.data() + (logN & 1) * N;
+                            for (u32 i = 0; i < N; ++i)
+                                dest[GetLineIndex(N, slice, line, i, writeAxis)] = result[i] * dispatch.outputScale;
+                        }
+                    }
+                }
+            }
+        }
+
+        constexpr OceanFFTPlanMode PLAN_MODES[] = { OceanFFTPlanMode::Staged, OceanFFTPlanMode::SharedMemory };
+    }
+
+    // Staged 为 2·log2(N) 次 dispatch，SharedMemory 为 2 次，与级联数无关；每次之后一个屏障
+    TEST(OceanFFTPlanTest, DispatchAndBarrierCounts)
+    {
+        for (u32 N = 64; N <= 1024; N *= 2)
+        {
+            const u32 logN = static_cast<u32>(std::countr_zero(N));
+            for (u32 cascades = 1; cascades <= 4; ++cascades)
+            {
+                for (OceanFFTPlanMode mode : PLAN_MODES)
+                {
+                    SCOPED_TRACE(::testing::Message() << N << "x" << N << " x" << cascades << " cascades, mode " << static_cast<u32>(mode));
+                    const OceanFFTPlan plan = BuildOceanFFTPlan(N, cascades, mode);
+                    const u32 expected = (mode == OceanFFTPlanMode::Staged) ? 2 * logN : 2;
+
+                    EXPECT_EQ(plan.mode, mode);
+                    EXPECT_EQ(plan.dispatches.size(), expected);
+                    EXPECT_EQ(plan.barrierCount, expected);
+                    for (const auto& dispatch : plan.dispatches)
+                    {
+                        EXPECT_EQ(dispatch.groupsZ, cascades * 4);
+                        EXPECT_GT(dispatch.groupsX, 0u);
+                        EXPECT_GT(dispatch.groupsY, 0u);
+                    }
+                }
+            }
+            EXPECT_LT(2 * logN, GetLegacyOceanFFTDispatchCount(N, 3));
+        }
+    }
+
+    // 超出 groupshared 容量时退化为 Staged
+    TEST(OceanFFTPlanTest, SharedMemoryFallsBackToStagedAboveCapacity)
+    {
+        EXPECT_EQ(BuildOceanFFTPlan(2048, 1, OceanFFTPlanMode::SharedMemory).mode, OceanFFTPlanMode::Staged);
+    }
+
+    // 整个 2D 变换只在最后一个 dispatch 乘一次 1/N
+    TEST(OceanFFTPlanTest, OnlyLastDispatchNormalizes)
+    {
+        for (OceanFFTPlanMode mode : PLAN_MODES)
+        {
+            const OceanFFTPlan plan = BuildOceanFFTPlan(256, 3, mode);
+            ASSERT_FALSE(plan.dispatches.empty());
+            for (size_t i = 0; i + 1 < plan.dispatches.size(); ++i)
+                EXPECT_EQ(plan.dispatches[i].outputScale, 1.0f) << "dispatch " << i;
+            EXPECT_EQ(plan.dispatches.back().outputScale, 1.0f / 256.0f);
+        }
+    }
+
+    // 在 CPU 上执行计划，与 double 精度的直接 2D DFT 对比：
+    // out[x * N + y] = (1/N) · Σ in[ky * N + kx] · e^{2πi(kx·x + ky·y)/N}
+    TEST(OceanFFTPlanTest, ExecutedPlanMatchesDirectDFT)
+    {
+        constexpr u32 CASCADES = 2;
+        for (u32 N : { 16u, 32u })
+        {
+            for (OceanFFTPlanMode mode : PLAN_MODES)
+            {
+                SCOPED_TRACE(::testing::Message() << N << "x" << N << ", mode " << static_cast<u32>(mode));
+                const OceanFFTPlan plan = BuildOceanFFTPlan(N, CASCADES, mode);
+
+                std::mt19937 rng(2024);
+                std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+                std::vector<ComplexF> buffer(2 * static_cast<size_t>(plan.halfElementCount));
+                for (u32 i = 0; i < plan.halfElementCount; ++i)
+                    buffer[i] = ComplexF(dist(rng), dist(rng));
+                const std::vector<ComplexF> input(buffer.begin(), buffer.begin() + plan.halfElementCount);
+
+                ExecuteOceanFFTPlan(plan, buffer);
+
+                std::vector<std::complex<f64>> twiddles(N);
+                for (u32 i = 0; i < N; ++i)
+                    twiddles[i] = std::polar(1.0, 2.0 * 3.14159265358979323846 * i / N);
+
+                f64 maxError = 0.0;
+                f64 maxMagnitude = 0.0;
+                const ComplexF* output = buffer.data() + plan.outputHalf * plan.halfElementCount;
+                for (u32 slice = 0; slice < plan.sliceCount; ++slice)
+                {
+                    const ComplexF* in = input.data() + slice * N * N;
+                    for (u32 x = 0; x < N; ++x)
+                    {
+                        for (u32 y = 0; y < N; ++y)
+                        {
+                            std::complex<f64> sum = 0.0;
+                            for (u32 ky = 0; ky < N; ++ky)
+                            {
+                                for (u32 kx = 0; kx < N; ++kx)
+                                    sum += std::complex<f64>(in[ky * N + kx]) * twiddles[(kx * x + ky * y) % N];
+                            }
+                            sum /= static_cast<f64>(N);
+
+                            const std::complex<f64> actual(output[slice * N * N + x * N + y]);
+                            maxError = std::max(maxError, std::abs(actual - sum));
+                            maxMagnitude = std::max(maxMagnitude, std::abs(sum));
+                        }
+                    }
+                }
+
+                EXPECT_LT(maxError / std::max(maxMagnitude, 1e-12), 1e-5) << "max error " << maxError;
+            }
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Scene/OceanFFTParams.h"
+
+namespace Sea
+{
+    // 与 OceanFFT 构造函数相同的默认级联，种子固定
+    inline OceanFFTParams MakeReferenceOceanParams(u32 mapSize)
+    {
+        constexpr f32 TILE_LENGTHS[] = { 250.0f, 50.0f, 10.0f };
+        constexpr f32 WIND_SPEEDS[] = { 20.0f, 15.0f, 10.0f };
+
+        OceanFFTParams params;
+        params.mapSize = mapSize;
+        params.numCascades = 3;
+        for (u32 i = 0; i < params.numCascades; ++i)
+        {
+            auto& cascade = params.cascades[i];
+            cascade.tileLength = TILE_LENGTHS[i];
+            cascade.windSpeed = WIND_SPEEDS[i];
+            cascade.foamGrowRate = 1.0f;
+            cascade.spectrumSeedX = static_cast<i32>(1000 + 17 * i);
+            cascade.spectrumSeedY = static_cast<i32>(2000 + 31 * i);
+        }
+        return params;
+    }
+}
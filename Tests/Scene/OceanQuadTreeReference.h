@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Scene/OceanQuadTree.h"
+#include <cmath>
+#include <vector>
+
+namespace Sea
+{
+    // 暴力版本（旧实现的复杂度）：扫描全部可见叶子，找出包含邻格中心的叶子，用作邻居 LOD 的参照
+    // 节点池中还有回收的节点，它们与被剔除的叶子一样不可见
+    inline f32 FindNeighborLODBruteForce(const std::vector<OceanQuadNode>& nodes, const OceanQuadNode& node, f32 dirX, f32 dirZ)
+    {
+        const f32 px = node.center.x + dirX * node.size;
+        const f32 pz = node.center.y + dirZ * node.size;
+        for (const OceanQuadNode& other : nodes)
+        {
+            if (!other.isLeaf || !other.inFrustum)
+                continue;
+
+            const f32 halfSize = other.size * 0.5f;
+            if (std::abs(px - other.center.x) < halfSize && std::abs(pz - other.center.y) < halfSize)
+            {
+                // 只有更粗的邻居需要缝合
+                return other.size > node.size ? static_cast<f32>(other.lod) : static_cast<f32>(node.lod);
+            }
+        }
+        return static_cast<f32>(node.lod);
+    }
+
+    // 左、右、下、上四个方向的参照值，顺序与 OceanQuadInstance::neighborLOD 一致
+    inline void FindNeighborLODsBruteForce(const OceanQuadTree& tree, const OceanQuadNode& node, f32 outLODs[4])
+    {
+        outLODs[0] = FindNeighborLODBruteForce(tree.GetNodes(), node, -1.0f, 0.0f);
+        outLODs[1] = FindNeighborLODBruteForce(tree.GetNodes(), node, 1.0f, 0.0f);
+        outLODs[2] = FindNeighborLODBruteForce(tree.GetNodes(), node, 0.0f, -1.0f);
+        outLODs[3] = FindNeighborLODBruteForce(tree.GetNodes(), node, 0.0f, 1.0f);
+    }
+}
@@ -0,0 +1,224 @@
+#include "Scene/OceanQuadTree.h"
+#include "Scene/OceanQuadTreeReference.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    namespace
+    {
+        struct BalanceCase
+        {
+            const char* name;
+            f32 baseDistance;
+            f32 multiplier;
+            u32 maxLOD;
+        };
+
+        // Ocean 使用的配置、默认配置，以及范围远小于节点尺寸、按距离选择时相邻叶子会差好几级的配置
+        constexpr BalanceCase BALANCE_CASES[] = {
+            { "ocean", 80.0f, 2.2f, 5 },
+            { "default", 50.0f, 2.0f, 6 },
+            { "steep", 10.0f, 1.5f, 8 },
+        };
+
+        constexpr u32 BALANCE_STEPS = 200;
+
+        struct BalanceResult
+        {
+            u32 imbalancedEdges = 0;
+            u32 neighborMismatches = 0;
+            u32 badMorphs = 0;
+            u32 staleInstances = 0;
+            u32 maxLeaves = 0;
+        };
+
+        // 沿随机相机路径完整重建或增量更新，逐帧检查受限四叉树的不变量
+        BalanceResult RunBalanceCheck(const BalanceCase& test, bool incremental)
+        {
+            OceanQuadTreeConfig config;
+            config.lodBaseDistance = test.baseDistance;
+            config.lodDistanceMultiplier = test.multiplier;
+            config.maxLOD = test.maxLOD;
+
+            OceanQuadTree tree;
+            tree.Initialize(config);
+
+            // 随机游走的相机路径：水平方向每步最多移动海面的 2%，高度在 [1, 400] 米之间
+            std::mt19937 rng(12345);
+            std::uniform_real_distribution<f32> step(-1.0f, 1.0f);
+            const f32 halfWorld = config.worldSize * 0.5f;
+            XMFLOAT3 position = { 0.0f, 20.0f, 0.0f };
+
+            // 相机朝向单独随机游走（不影响位置序列），让视锥体剔除在增量更新中不断剔除 / 恢复子树
+            std::mt19937 turnRng(678);
+            std::uniform_real_distribution<f32> turn(-1.0f, 1.0f);
+            f32 yaw = 0.0f, pitch = -20.0f;
+
+            BalanceResult result;
+            for (u32 i = 0; i < BALANCE_STEPS; ++i)
+            {
+                position.x = std::clamp(position.x + step(rng) * config.worldSize * 0.02f, -halfWorld * 1.2f, halfWorld * 1.2f);
+                position.z = std::clamp(position.z + step(rng) * config.worldSize * 0.02f, -halfWorld * 1.2f, halfWorld * 1.2f);
+                position.y = std::clamp(position.y + step(rng) * 20.0f, 1.0f, 400.0f);
+                yaw += turn(turnRng) * 30.0f;
+                pitch = std::clamp(pitch + turn(turnRng) * 10.0f, -80.0f, 10.0f);
+
+                Camera camera;
+                camera.SetPerspective(60.0f, 16.0f / 9.0f, 0.1f, config.worldSize);
+                camera.SetPosition(position);
+                camera.SetRotation(pitch, yaw, 0.0f);
+                camera.Update();
+
+                if (incremental && i > 0)
+                    tree.UpdateTree(camera);
+                else
+                    tree.BuildTree(camera);
+                tree.UpdateInstances();
+                result.maxLeaves = std::max(result.maxLeaves, tree.GetLeafCount());
+
+                const std::vector<OceanQuadNode>& nodes = tree.GetNodes();
+                const std::vector<u32>& leafNodes = tree.GetLeafNodeIndices();
+
+                // 每个可见叶子恰好占一个实例；回收的节点不在树中，不会被计入
+                u32 visibleLeaves = 0;
+                std::vector<u32> stack = { tree.GetRootNodeIndex() };
+                while (!stack.empty())
+                {
+                    const u32 nodeIndex = stack.back();
+                    const OceanQuadNode& node = nodes[nodeIndex];
+                    stack.pop_back();
+                    if (!node.isLeaf)
+                    {
+                        stack.insert(stack.end(), std::begin(node.childIndices), std::end(node.childIndices));
+                    }
+                    else if (node.inFrustum)
+                    {
+                        visibleLeaves++;
+                        result.staleInstances += (node.instanceIndex >= leafNodes.size() ||
+                                                  leafNodes[node.instanceIndex] != nodeIndex) ? 1 : 0;
+                    }
+                }
+                result.staleInstances += (visibleLeaves != tree.GetLeafCount()) ? 1 : 0;
+
+                for (size_t leaf = 0; leaf < leafNodes.size(); ++leaf)
+                {
+                    const OceanQuadNode& node = nodes[leafNodes[leaf]];
+                    const OceanQuadInstance& instance = tree.GetRenderInstances()[leaf];
+
+                    // 增量更新留下的实例必须与从头计算的一致
+                    const OceanQuadInstance expected = tree.BuildInstance(node);
+                    result.staleInstances += (memcmp(&expected, &instance, sizeof(OceanQuadInstance)) != 0) ? 1 : 0;
+
+                    // 暴力查找不依赖树的结构，只看哪个叶子包含邻格中心；每对相邻叶子都会从更细的一侧检查到
+                    f32 reference[4];
+                    FindNeighborLODsBruteForce(tree, node, reference);
+                    const f32 neighborLOD[4] = { instance.neighborLOD.x, instance.neighborLOD.y,
+                                                 instance.neighborLOD.z, instance.neighborLOD.w };
+                    for (u32 dir = 0; dir < 4; ++dir)
+                    {
+                        result.imbalancedEdges += (reference[dir] > static_cast<f32>(node.lod + 1)) ? 1 : 0;
+                        result.neighborMismatches += (neighborLOD[dir] != reference[dir]) ? 1 : 0;
+                    }
+
+                    const XMFLOAT4& morph = instance.lodMorph;
+                    if (morph.z > morph.w || (morph.w > morph.z && (morph.w != tree.GetLODRange(node.lod) ||
+                        std::abs(morph.y * (morph.w - morph.z) - 1.0f) > 1e-4f)) || (morph.w == morph.z && morph.y != 0.0f))
+                    {
+                        result.badMorphs++;
+                    }
+                }
+            }
+            return result;
+        }
+
+        void ExpectBalanced(bool incremental)
+        {
+            for (const BalanceCase& test : BALANCE_CASES)
+            {
+                SCOPED_TRACE(test.name);
+                const BalanceResult result = RunBalanceCheck(test, incremental);
+                EXPECT_GT(result.maxLeaves, 0u);
+                EXPECT_EQ(result.imbalancedEdges, 0u);
+                EXPECT_EQ(result.neighborMismatches, 0u);
+                EXPECT_EQ(result.badMorphs, 0u);
+                EXPECT_EQ(result.staleInstances, 0u);
+            }
+        }
+
+        Camera MakeCamera(const XMFLOAT3& position, f32 pitch, f32 yaw, f32 farPlane)
+        {
+            Camera camera;
+            camera.SetPerspective(60.0f, 16.0f / 9.0f, 0.1f, farPlane);
+            camera.SetPosition(position);
+            camera.SetRotation(pitch, yaw, 0.0f);
+            camera.Update();
+            return camera;
+        }
+    }
+
+    TEST(OceanQuadTreeTest, RebuildSatisfiesRestrictedQuadtreeInvariants)
+    {
+        ExpectBalanced(false);
+    }
+
+    TEST(OceanQuadTreeTest, IncrementalUpdateSatisfiesRestrictedQuadtreeInvariants)
+    {
+        ExpectBalanced(true);
+    }
+
+    TEST(OceanQuadTreeTest, DirtyRangesCoverChangedInstances)
+    {
+        OceanQuadTreeConfig config;
+        OceanQuadTree tree;
+        tree.Initialize(config);
+
+        // 第一次更新所有实例都是新的，合并成覆盖全部实例的一段
+        ASSERT_TRUE(tree.Update(MakeCamera({ 0.0f, 20.0f, 0.0f }, -20.0f, 0.0f, config.worldSize)));
+        std::vector<OceanInstanceRange> ranges;
+        tree.GetDirtyRanges(ranges);
+        ASSERT_EQ(ranges.size(), 1u);
+        EXPECT_EQ(ranges[0].begin, 0u);
+        EXPECT_EQ(ranges[0].count, tree.GetInstanceCount());
+
+        tree.ClearInstanceDirty();
+        tree.GetDirtyRanges(ranges);
+        EXPECT_TRUE(ranges.empty());
+
+        // 相机在门限内没动，不更新；移动后只有变化的实例需要上传
+        EXPECT_FALSE(tree.Update(MakeCamera({ 0.0f, 20.0f, 0.0f }, -20.0f, 0.0f, config.worldSize)));
+        ASSERT_TRUE(tree.Update(MakeCamera({ 40.0f, 20.0f, 0.0f }, -20.0f, 0.0f, config.worldSize)));
+        tree.GetDirtyRanges(ranges);
+        u32 dirtyInstances = 0;
+        for (const OceanInstanceRange& range : ranges)
+        {
+            EXPECT_LE(range.begin + range.count, tree.GetInstanceCount());
+            dirtyInstances += range.count;
+        }
+        EXPECT_GT(dirtyInstances, 0u);
+        EXPECT_LT(dirtyInstances, tree.GetInstanceCount());
+    }
+
+    TEST(OceanQuadTreeTest, LeafCountIsNotCappedByInstanceBufferSize)
+    {
+        // 只按距离选择、最细一级的节点只有几米：叶子远超旧的 4096 个实例上限，树本身不截断
+        OceanQuadTreeConfig config;
+        config.maxLOD = 10;
+        config.lodBaseDistance = 200.0f;
+        config.lodDistanceMultiplier = 2.0f;
+        config.enableFrustumCulling = false;
+
+        OceanQuadTree tree;
+        tree.Initialize(config);
+        tree.Update(MakeCamera({ 0.0f, 5.0f, 0.0f }, -20.0f, 0.0f, config.worldSize));
+
+        EXPECT_GT(tree.GetLeafCount(), 4096u);
+        EXPECT_EQ(tree.GetInstanceCount(), tree.GetLeafCount());
+        EXPECT_EQ(tree.GetRenderInstances().size(), tree.GetLeafCount());
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Scene/MeshData.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Sea
+{
+    inline XMFLOAT3 RandomUnitVector(std::mt19937& rng)
+    {
+        std::normal_distribution<f32> dist(0.0f, 1.0f);
+        for (;;)
+        {
+            XMFLOAT3 v = { dist(rng), dist(rng), dist(rng) };
+            f32 len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+            if (len > 1e-6f)
+                return { v.x / len, v.y / len, v.z / len };
+        }
+    }
+
+    // 随机生成落在给定包围盒内的顶点（法线单位化，UV 含平铺范围）
+    inline std::vector<Vertex> GenerateRandomVertices(u32 count, const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax, u32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<f32> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<f32> uv(-4.0f, 4.0f);
+
+        std::vector<Vertex> vertices(count);
+        for (Vertex& v : vertices)
+        {
+            v.position = { boundsMin.x + (boundsMax.x - boundsMin.x) * unit(rng),
+                           boundsMin.y + (boundsMax.y - boundsMin.y) * unit(rng),
+                           boundsMin.z + (boundsMax.z - boundsMin.z) * unit(rng) };
+            v.normal = RandomUnitVector(rng);
+            v.texCoord = { uv(rng), uv(rng) };
+            v.color = { unit(rng), unit(rng), unit(rng), unit(rng) };
+        }
+        return vertices;
+    }
+}
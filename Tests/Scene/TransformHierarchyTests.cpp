@@ -0,0 +1,173 @@
+#include "Scene/TransformHierarchy.h"
+#include "Core/JobSystem.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace Sea
+{
+    namespace
+    {
+        void ExpectTranslation(const XMFLOAT4X4& m, f32 x, f32 y, f32 z)
+        {
+            EXPECT_FLOAT_EQ(m._41, x);
+            EXPECT_FLOAT_EQ(m._42, y);
+            EXPECT_FLOAT_EQ(m._43, z);
+        }
+
+        bool Contains(const std::vector<u32>& nodes, u32 node)
+        {
+            return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+        }
+    }
+
+    TEST(TransformHierarchyTest, ChildInheritsParentTransform)
+    {
+        TransformHierarchy hierarchy;
+        u32 root = hierarchy.CreateNode();
+        u32 child = hierarchy.CreateNode(root);
+        u32 grandChild = hierarchy.CreateNode(child);
+        hierarchy.SetLocalPosition(root, { 1.0f, 0.0f, 0.0f });
+        hierarchy.SetLocalPosition(child, { 0.0f, 2.0f, 0.0f });
+        hierarchy.SetLocalPosition(grandChild, { 0.0f, 0.0f, 3.0f });
+
+        EXPECT_EQ(hierarchy.Update(), 3u);
+        ExpectTranslation(hierarchy.GetWorldMatrix(grandChild), 1.0f, 2.0f, 3.0f);
+        EXPECT_EQ(hierarchy.GetDepth(grandChild), 2u);
+    }
+
+    TEST(TransformHierarchyTest, CleanHierarchyUpdatesNothing)
+    {
+        TransformHierarchy hierarchy;
+        hierarchy.CreateNode();
+        hierarchy.CreateNode(0);
+        hierarchy.Update();
+
+        EXPECT_FALSE(hierarchy.HasDirtyNodes());
+        EXPECT_EQ(hierarchy.Update(), 0u);
+        EXPECT_TRUE(hierarchy.GetUpdatedNodes().empty());
+        EXPECT_FALSE(hierarchy.WasUpdated(0));
+    }
+
+    TEST(TransformHierarchyTest, OnlyDirtySubtreeIsRecomputed)
+    {
+        // 0 ── 1 ── 3
+        //  └── 2 ── 4
+        // 5（独立根节点）
+        TransformHierarchy hierarchy;
+        hierarchy.CreateNode();
+        hierarchy.CreateNode(0);
+        hierarchy.CreateNode(0);
+        hierarchy.CreateNode(1);
+        hierarchy.CreateNode(2);
+        hierarchy.CreateNode();
+        hierarchy.Update();
+
+        hierarchy.SetLocalPosition(1, { 5.0f, 0.0f, 0.0f });
+        EXPECT_EQ(hierarchy.Update(), 2u);
+
+        const auto& updated = hierarchy.GetUpdatedNodes();
+        EXPECT_EQ(updated, (std::vector<u32>{ 1, 3 }));
+        EXPECT_TRUE(hierarchy.WasUpdated(3));
+        EXPECT_FALSE(hierarchy.WasUpdated(2));
+        ExpectTranslation(hierarchy.GetWorldMatrix(3), 5.0f, 0.0f, 0.0f);
+        ExpectTranslation(hierarchy.GetWorldMatrix(4), 0.0f, 0.0f, 0.0f);
+    }
+
+    TEST(TransformHierarchyTest, DirtyDescendantOfDirtyNodeIsVisitedOnce)
+    {
+        TransformHierarchy hierarchy;
+        u32 root = hierarchy.CreateNode();
+        u32 child = hierarchy.CreateNode(root);
+        u32 leaf = hierarchy.CreateNode(child);
+        hierarchy.Update();
+
+        // 先改后代再改祖先，两者都在脏列表里
+        hierarchy.SetLocalPosition(leaf, { 0.0f, 0.0f, 1.0f });
+        hierarchy.SetLocalPosition(root, { 2.0f, 0.0f, 0.0f });
+        hierarchy.MarkDirty(leaf);
+
+        EXPECT_EQ(hierarchy.Update(), 3u);
+        EXPECT_EQ(hierarchy.GetStats().dirtyNodes, 2u);
+        EXPECT_EQ(hierarchy.GetUpdatedNodes(), (std::vector<u32>{ root, child, leaf }));
+        ExpectTranslation(hierarchy.GetWorldMatrix(leaf), 2.0f, 0.0f, 1.0f);
+    }
+
+    TEST(TransformHierarchyTest, WorldInvTransposeMatchesWorld)
+    {
+        TransformHierarchy hierarchy;
+        u32 root = hierarchy.CreateNode();
+        u32 child = hierarchy.CreateNode(root);
+        hierarchy.SetLocalScale(root, { 2.0f, 4.0f, 0.5f });
+        hierarchy.SetLocalRotationEuler(child, { 0.0f, 90.0f, 0.0f });
+        hierarchy.SetLocalPosition(child, { 1.0f, 2.0f, 3.0f });
+        hierarchy.Update();
+
+        // (W^-1)^T 的转置与 W 相乘应当得到单位矩阵
+        XMMATRIX world = XMLoadFloat4x4(&hierarchy.GetWorldMatrix(child));
+        XMMATRIX invTranspose = XMLoadFloat4x4(&hierarchy.GetWorldInvTranspose(child));
+        XMFLOAT4X4 product;
+        XMStoreFloat4x4(&product, XMMatrixMultiply(world, XMMatrixTranspose(invTranspose)));
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                EXPECT_NEAR(product.m[row][column], row == column ? 1.0f : 0.0f, 1e-5f);
+            }
+        }
+    }
+
+    TEST(TransformHierarchyTest, ParentCreatedAfterChildBecomesRoot)
+    {
+        TransformHierarchy hierarchy;
+        u32 node = hierarchy.CreateNode(5);
+        EXPECT_EQ(hierarchy.GetParent(node), TransformHierarchy::INVALID_NODE);
+    }
+
+    TEST(TransformHierarchyTest, ParallelUpdateMatchesFullRecompute)
+    {
+        // 受影响的节点数超过并行阈值，逐层并行的结果必须与全量重算一致
+        JobSystem::Initialize(4);
+
+        const u32 nodeCount = TransformHierarchy::PARALLEL_THRESHOLD * 2;
+        TransformHierarchy hierarchy;
+        TransformHierarchy reference;
+        for (u32 i = 0; i < nodeCount; ++i)
+        {
+            u32 parent = (i % 7 == 0) ? TransformHierarchy::INVALID_NODE : i / 2;
+            hierarchy.CreateNode(parent);
+            reference.CreateNode(parent);
+            XMFLOAT3 position = { static_cast<f32>(i % 13), 0.25f * (i % 5), -0.5f };
+            hierarchy.SetLocalPosition(i, position);
+            reference.SetLocalPosition(i, position);
+        }
+        hierarchy.Update();
+        reference.Update();
+
+        // 移动除 7 以外的所有根节点，7 的子树（15、30、31 ...）保持不变
+        for (u32 root = 0; root < nodeCount; root += 7)
+        {
+            if (root == 7)
+                continue;
+            hierarchy.SetLocalPosition(root, { 3.0f, 1.0f, static_cast<f32>(root) });
+            reference.SetLocalPosition(root, { 3.0f, 1.0f, static_cast<f32>(root) });
+        }
+        const u32 updated = hierarchy.Update();
+        for (u32 i = 0; i < nodeCount; ++i)
+        {
+            reference.MarkDirty(i);
+        }
+        reference.Update();
+
+        JobSystem::Shutdown();
+
+        EXPECT_GE(updated, TransformHierarchy::PARALLEL_THRESHOLD);
+        EXPECT_TRUE(std::is_sorted(hierarchy.GetUpdatedNodes().begin(), hierarchy.GetUpdatedNodes().end()));
+        EXPECT_FALSE(Contains(hierarchy.GetUpdatedNodes(), 15));
+        EXPECT_TRUE(Contains(hierarchy.GetUpdatedNodes(), 1));
+        for (u32 i = 0; i < nodeCount; ++i)
+        {
+            const XMFLOAT4X4& expected = reference.GetWorldMatrix(i);
+            ExpectTranslation(hierarchy.GetWorldMatrix(i), expected._41, expected._42, expected._43);
+        }
+    }
+}
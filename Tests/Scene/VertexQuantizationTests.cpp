@@ -0,0 +1,102 @@
+#include "Scene/VertexQuantization.h"
+#include "Scene/RandomVertices.h"
+#include "Core/JobSystem.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace Sea
+{
+    namespace
+    {
+        // 小角度下 acos 精度不够，用 atan2(|a x b|, a . b) 并在 double 下计算
+        f64 AngleDegrees(const XMFLOAT3& a, const XMFLOAT3& b)
+        {
+            const f64 ax = a.x, ay = a.y, az = a.z;
+            const f64 bx = b.x, by = b.y, bz = b.z;
+            const f64 cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+            return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz) * 57.29577951308232;
+        }
+
+        // 半精度尾数 10 位，舍入误差不超过 2^-11 的相对值
+        f32 RelativeError(f32 a, f32 b)
+        {
+            return std::abs(a - b) / std::max(std::abs(a), 6.1e-5f);
+        }
+    }
+
+    // 随机顶点与边界情况编码再解码，各分量误差不超过格式精度
+    TEST(VertexQuantizationTest, RoundTripWithinFormatPrecision)
+    {
+        const XMFLOAT3 boundsMin = { -37.5f, -0.25f, 1000.0f };
+        const XMFLOAT3 boundsMax = { 62.5f, 0.75f, 1003.0f };
+        std::vector<Vertex> vertices = GenerateRandomVertices(100000, boundsMin, boundsMax, 1234);
+
+        // 边界情况：坐标轴与八面体折线上的法线、包围盒角点、UV 整数与 0
+        const XMFLOAT3 axes[] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+                                  { 0.70710678f, 0, -0.70710678f }, { 0, -0.70710678f, -0.70710678f },
+                                  { 0.57735027f, -0.57735027f, -0.57735027f } };
+        for (const XMFLOAT3& axis : axes)
+        {
+            Vertex v = {};
+            v.position = boundsMin;
+            v.normal = axis;
+            v.texCoord = { 0.0f, 1.0f };
+            v.color = { 0.0f, 1.0f, 0.5f, 1.0f };
+            vertices.push_back(v);
+            v.position = boundsMax;
+            v.texCoord = { -2.0f, 3.0f };
+            vertices.push_back(v);
+        }
+
+        // 批量量化在任务系统上并行执行
+        JobSystem::Initialize(4);
+        VertexQuantization q = ComputeVertexQuantization(boundsMin, boundsMax);
+        std::vector<QuantizedVertex> quantized(vertices.size());
+        QuantizeVertices(vertices, q, quantized);
+        JobSystem::Shutdown();
+
+        // 容差：半个量化步长（加上 float 运算误差）
+        const XMFLOAT3 positionTolerance = { q.scale.x / 65535.0f * 0.5f + 1e-4f,
+                                             q.scale.y / 65535.0f * 0.5f + 1e-6f,
+                                             q.scale.z / 65535.0f * 0.5f + 1e-4f };
+        const f32 colorTolerance = 0.5f / 255.0f + 1e-6f;
+
+        XMFLOAT3 maxPositionError = { 0, 0, 0 };
+        f64 maxNormalErrorDeg = 0.0;
+        f32 maxTexCoordError = 0.0f;
+        f32 maxColorError = 0.0f;
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            const Vertex& src = vertices[i];
+            const Vertex dst = DequantizeVertex(quantized[i], q);
+
+            maxPositionError.x = std::max(maxPositionError.x, std::abs(dst.position.x - src.position.x));
+            maxPositionError.y = std::max(maxPositionError.y, std::abs(dst.position.y - src.position.y));
+            maxPositionError.z = std::max(maxPositionError.z, std::abs(dst.position.z - src.position.z));
+            maxNormalErrorDeg = std::max(maxNormalErrorDeg, AngleDegrees(src.normal, dst.normal));
+            maxTexCoordError = std::max({ maxTexCoordError, RelativeError(src.texCoord.x, dst.texCoord.x),
+                                          RelativeError(src.texCoord.y, dst.texCoord.y) });
+            maxColorError = std::max({ maxColorError, std::abs(src.color.x - dst.color.x), std::abs(src.color.y - dst.color.y),
+                                       std::abs(src.color.z - dst.color.z), std::abs(src.color.w - dst.color.w) });
+        }
+
+        EXPECT_LE(maxPositionError.x, positionTolerance.x);
+        EXPECT_LE(maxPositionError.y, positionTolerance.y);
+        EXPECT_LE(maxPositionError.z, positionTolerance.z);
+        EXPECT_LE(maxNormalErrorDeg, 0.01);
+        EXPECT_LE(maxTexCoordError, 1.0f / 2048.0f);
+        EXPECT_LE(maxColorError, colorTolerance);
+    }
+
+    TEST(VertexQuantizationTest, DegenerateBoundsDoNotProduceNaN)
+    {
+        // 包围盒退化为平面时 scale = 0
+        VertexQuantization flat = ComputeVertexQuantization({ 0, 2, 0 }, { 1, 2, 1 });
+        Vertex vertex = {};
+        vertex.position = { 0.5f, 2.0f, 0.25f };
+        vertex.normal = { 0, 1, 0 };
+        Vertex decoded = DequantizeVertex(QuantizeVertex(vertex, flat), flat);
+        EXPECT_EQ(decoded.position.y, 2.0f);
+        EXPECT_NEAR(decoded.position.x, 0.5f, 1.0f / 65535.0f);
+    }
+}
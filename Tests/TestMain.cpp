@@ -0,0 +1,11 @@
+#include "Core/Log.h"
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    Sea::Log::Initialize("SeaTests.log");
+    int result = RUN_ALL_TESTS();
+    Sea::Log::Shutdown();
+    return result;
+}